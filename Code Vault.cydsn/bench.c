@@ -0,0 +1,877 @@
+/****************************************************************************
+ *
+ *  File:           bench.c
+ *  Module:         Benchmark Library
+ *  Project:        Code Vault
+ *  Workspace:      PSoC Tools
+ *
+ *  Author:         Rodney B. Elliott
+ *  Date:           16 October 2026
+ *
+ ****************************************************************************
+ *
+ *  Copyright:      2013 Rodney B. Elliott
+ *
+ *  This file is part of PSoC Tools.
+ *
+ *  PSoC Tools is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  PSoC Tools is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with PSoC Tools. If not, see <http://www.gnu.org/licenses/>.
+ *
+ ****************************************************************************/
+/**
+ *  @file bench.c
+ *  @brief Benchmark library implementation.
+ */
+
+/****************************************************************************
+ *  Modules
+ ****************************************************************************/
+#include <device.h>
+#include <stdlib.h>
+
+#include "bench.h"
+#include "cbuff.h"
+#include "cllist.h"
+#include "deque.h"
+#include "dllist.h"
+#include "misc.h"
+#include "queue.h"
+#include "rtime.h"
+
+/****************************************************************************
+ *  Definitions and Macros
+ ****************************************************************************/
+#ifdef HO_SHIM
+/**
+ *  @brief The timer frequency in hertz.
+ */
+#define _TICK_HZ                        1000000000ull
+#else
+/**
+ *  @brief The timer frequency in hertz.
+ */
+#define _TICK_HZ                        ((unsigned long long)BCLK__BUS_CLK__HZ)
+
+/**
+ *  @brief Debug exception and monitor control register.
+ */
+#define _DEMCR                          0xe000edfcu
+
+/**
+ *  @brief Trace enable mask.
+ */
+#define _DEMCR_TRCENA                   0x01000000u
+
+/**
+ *  @brief DWT control register.
+ */
+#define _DWT_CTRL                       0xe0001000u
+
+/**
+ *  @brief Cycle counter enable mask.
+ */
+#define _DWT_CTRL_CYCCNTENA             0x00000001u
+
+/**
+ *  @brief DWT cycle count register.
+ */
+#define _DWT_CYCCNT                     0xe0001004u
+#endif
+
+/****************************************************************************
+ *  Typedefs and Structures
+ ****************************************************************************/
+/**
+ *  @brief The accumulated measurements of a single function and size.
+ */
+typedef struct _SAMPLE
+{
+    /**
+     *  @brief The total number of timer ticks taken.
+     */
+    unsigned long long ticks;
+    
+    /**
+     *  @brief The total number of calls timed.
+     */
+    uint32 operations;
+    
+    /**
+     *  @brief The total number of heap allocations made.
+     */
+    uint32 allocations;
+} _SAMPLE;
+
+/**
+ *  @brief A benchmark table entry.
+ */
+typedef struct _BENCHMARK
+{
+    /**
+     *  @brief The name of the function measured.
+     */
+    char *name;
+    
+    /**
+     *  @brief A pointer to the benchmark function.
+     */
+    uint8 (*function)(uint32 size, _SAMPLE *sample);
+} _BENCHMARK;
+
+/****************************************************************************
+ *  Prototypes of Local Functions
+ ****************************************************************************/
+/**
+ *  @brief Benchmark a DLL add function.
+ *  @param[in] function A pointer to the add function.
+ *  @param[in] size The number of nodes to add to an empty DLL.
+ *  @param[out] sample A pointer to the sample to accumulate into.
+ *  @return #BM_SUCCESS if successful, otherwise #BM_NO_MEMORY.
+ */
+static uint8 _dl_add(uint8 (*function)(DL_LIST **, uint16, void *),
+    uint32 size, _SAMPLE *sample);
+
+/**
+ *  @brief Benchmark a CLL move function.
+ *  @param[in] function A pointer to the move function.
+ *  @param[in] size The number of nodes in the CLL.
+ *  @param[out] sample A pointer to the sample to accumulate into.
+ *  @return #BM_SUCCESS if successful, otherwise #BM_NO_MEMORY or
+ *      #BM_FAILURE.
+ *  @remark Each call moves the current node by one place.
+ */
+static uint8 _cl_move(uint8 (*function)(CL_LIST *, uint32),
+    uint32 size, _SAMPLE *sample);
+
+/**
+ *  @brief Benchmark a deque add function.
+ *  @param[in] function A pointer to the add function.
+ *  @param[in] size The number of nodes to add to an empty deque.
+ *  @param[out] sample A pointer to the sample to accumulate into.
+ *  @return #BM_SUCCESS if successful, otherwise #BM_NO_MEMORY.
+ */
+static uint8 _de_add(uint8 (*function)(DE_LIST *, uint16, void *),
+    uint32 size, _SAMPLE *sample);
+
+/**
+ *  @brief Benchmark a deque remove function.
+ *  @param[in] function A pointer to the remove function.
+ *  @param[in] size The number of nodes to remove from a full deque.
+ *  @param[out] sample A pointer to the sample to accumulate into.
+ *  @return #BM_SUCCESS if successful, otherwise #BM_NO_MEMORY or
+ *      #BM_FAILURE.
+ */
+static uint8 _de_remove(uint8 (*function)(DE_LIST *, void **),
+    uint32 size, _SAMPLE *sample);
+
+/*
+ *  Benchmark table functions. Each measures the function of the same name
+ *  at the given size, accumulating into the given sample.
+ */
+static uint8 _dl_add_first(uint32 size, _SAMPLE *sample);
+static uint8 _dl_add_last(uint32 size, _SAMPLE *sample);
+static uint8 _dl_add_before(uint32 size, _SAMPLE *sample);
+static uint8 _dl_add_after(uint32 size, _SAMPLE *sample);
+static uint8 _cl_move_forward(uint32 size, _SAMPLE *sample);
+static uint8 _cl_move_backward(uint32 size, _SAMPLE *sample);
+static uint8 _cb_add_new(uint32 size, _SAMPLE *sample);
+static uint8 _cb_remove_old(uint32 size, _SAMPLE *sample);
+static uint8 _qu_add_last(uint32 size, _SAMPLE *sample);
+static uint8 _qu_remove_first(uint32 size, _SAMPLE *sample);
+static uint8 _de_add_first(uint32 size, _SAMPLE *sample);
+static uint8 _de_add_last(uint32 size, _SAMPLE *sample);
+static uint8 _de_remove_first(uint32 size, _SAMPLE *sample);
+static uint8 _de_remove_last(uint32 size, _SAMPLE *sample);
+static uint8 _rt_convert(uint32 size, _SAMPLE *sample);
+static uint8 _rt_render(uint32 size, _SAMPLE *sample);
+
+/**
+ *  @brief Get the number of times a measurement is repeated.
+ *  @param[in] size The number of calls timed by each measurement.
+ *  @return The number of measurements needed to time at least
+ *      #BM_OPERATIONS calls.
+ */
+static uint32 _get_rounds(uint32 size);
+
+/**
+ *  @brief Get the current value of the timer.
+ *  @return The number of timer ticks since the timer was started.
+ */
+static unsigned long long _get_ticks(void);
+
+/**
+ *  @brief Start a measurement.
+ */
+static void _start(void);
+
+/**
+ *  @brief Stop a measurement.
+ *  @param[out] sample A pointer to the sample to accumulate into.
+ *  @param[in] operations The number of calls timed by the measurement.
+ */
+static void _stop(_SAMPLE *sample, uint32 operations);
+
+/**
+ *  @brief Transmit a single line of results.
+ *  @param[in] name A pointer to the name of the function measured.
+ *  @param[in] size The size at which the function was measured.
+ *  @param[in] sample A pointer to the accumulated measurements.
+ */
+static void _report(char *name, uint32 size, _SAMPLE *sample);
+
+/**
+ *  @brief Transmit an unsigned integer.
+ *  @param[in] number The unsigned integer to transmit.
+ */
+static void _put_number(uint32 number);
+
+/**
+ *  @brief Transmit a fixed-point number with two decimal places.
+ *  @param[in] number The number multiplied by one hundred.
+ */
+static void _put_fixed(uint32 number);
+
+#ifdef BM_COUNT_ALLOCATIONS
+/**
+ *  @brief The C library malloc() function.
+ *  @param[in] size The number of bytes to allocate.
+ *  @return A pointer to the allocated memory, or NULL.
+ *  @remark Provided by the linker when -Wl,--wrap=malloc is used.
+ */
+void *__real_malloc(size_t size);
+
+/**
+ *  @brief Count a heap allocation.
+ *  @param[in] size The number of bytes to allocate.
+ *  @return A pointer to the allocated memory, or NULL.
+ *  @remark Called by the linker in place of every call to malloc() when
+ *      -Wl,--wrap=malloc is used.
+ */
+void *__wrap_malloc(size_t size);
+#endif
+
+/****************************************************************************
+ *  Exported Variables
+ ****************************************************************************/
+
+/****************************************************************************
+ *  Global Variables
+ ****************************************************************************/
+/**
+ *  @brief The object added to every container.
+ */
+static char _object = 0;
+
+/**
+ *  @brief The timer value at the start of the current measurement.
+ */
+static unsigned long long _start_ticks = 0;
+
+#ifdef BM_COUNT_ALLOCATIONS
+/**
+ *  @brief The number of heap allocations made since startup.
+ */
+static volatile uint32 _allocations = 0;
+
+/**
+ *  @brief The allocation count at the start of the current measurement.
+ */
+static uint32 _start_allocations = 0;
+#endif
+
+#ifndef HO_SHIM
+/**
+ *  @brief The cycle count when the timer was last read.
+ */
+static uint32 _last_cycles = 0;
+
+/**
+ *  @brief The cycle count wraparounds seen, in ticks.
+ */
+static unsigned long long _wrapped_ticks = 0;
+#endif
+
+/**
+ *  @brief The table of benchmarks.
+ */
+static const _BENCHMARK _benchmarks[] =
+{
+    {"dl_add_first", _dl_add_first},
+    {"dl_add_last", _dl_add_last},
+    {"dl_add_before", _dl_add_before},
+    {"dl_add_after", _dl_add_after},
+    {"cl_move_forward", _cl_move_forward},
+    {"cl_move_backward", _cl_move_backward},
+    {"cb_add_new", _cb_add_new},
+    {"cb_remove_old", _cb_remove_old},
+    {"qu_add_last", _qu_add_last},
+    {"qu_remove_first", _qu_remove_first},
+    {"de_add_first", _de_add_first},
+    {"de_add_last", _de_add_last},
+    {"de_remove_first", _de_remove_first},
+    {"de_remove_last", _de_remove_last},
+    {"rt_convert", _rt_convert},
+    {"rt_render", _rt_render}
+};
+
+/****************************************************************************
+ *  Exported Functions
+ ****************************************************************************/
+uint8 bm_run(uint32 maximum)
+{
+    uint32 i;
+    uint32 size;
+    _SAMPLE sample;
+    uint8 result = BM_BAD_ARGUMENT;
+    
+    if (maximum > 0 && maximum <= BM_SIZE_MAXIMUM)
+    {
+#ifndef HO_SHIM
+        CY_SET_REG32(_DEMCR, CY_GET_REG32(_DEMCR) | _DEMCR_TRCENA);
+        CY_SET_REG32(_DWT_CTRL,
+            CY_GET_REG32(_DWT_CTRL) | _DWT_CTRL_CYCCNTENA);
+        
+#endif
+        UART_1_Start();
+        UART_1_PutString("function,size,operations,ns_per_op,"
+            "allocs_per_op\r\n");
+        
+        result = BM_SUCCESS;
+        
+        for (i = 0 ; i < sizeof(_benchmarks) / sizeof(_benchmarks[0]) &&
+            result == BM_SUCCESS ; i++)
+        {
+            for (size = 1 ; size <= maximum && result == BM_SUCCESS ;
+                size *= 10)
+            {
+                sample.ticks = 0;
+                sample.operations = 0;
+                sample.allocations = 0;
+                
+                result = _benchmarks[i].function(size, &sample);
+                
+                if (result == BM_SUCCESS && sample.operations > 0)
+                {
+                    _report(_benchmarks[i].name, size, &sample);
+                }
+            }
+        }
+        
+        while ((UART_1_ReadTxStatus() & UART_1_TX_STS_FIFO_EMPTY) !=
+            UART_1_TX_STS_FIFO_EMPTY)
+        {
+            CyDelay(1);
+        }
+        
+        UART_1_Stop();
+    }
+    
+    return result;
+}
+
+#ifdef BM_COUNT_ALLOCATIONS
+void *__wrap_malloc(size_t size)
+{
+    ++_allocations;
+    
+    return __real_malloc(size);
+}
+#endif
+
+/****************************************************************************
+ *  Local Functions
+ ****************************************************************************/
+uint8 _dl_add(uint8 (*function)(DL_LIST **, uint16, void *),
+    uint32 size, _SAMPLE *sample)
+{
+    uint32 i;
+    uint32 j;
+    DL_LIST *list = NULL;
+    uint32 rounds = _get_rounds(size);
+    uint8 result = BM_SUCCESS;
+    
+    for (i = 0 ; i < rounds && result == BM_SUCCESS ; i++)
+    {
+        _start();
+        
+        for (j = 0 ; j < size && result == BM_SUCCESS ; j++)
+        {
+            if (function(&list, 0, &_object) != DL_SUCCESS)
+            {
+                result = BM_NO_MEMORY;
+            }
+        }
+        
+        _stop(sample, j);
+        
+        dl_destroy(&list);
+    }
+    
+    return result;
+}
+
+uint8 _cl_move(uint8 (*function)(CL_LIST *, uint32),
+    uint32 size, _SAMPLE *sample)
+{
+    uint32 i;
+    CL_LIST list = {0};
+    uint8 result = BM_SUCCESS;
+    
+    for (i = 0 ; i < size && result == BM_SUCCESS ; i++)
+    {
+        if (cl_add_after(&list, 0, &_object) != CL_SUCCESS)
+        {
+            result = BM_NO_MEMORY;
+        }
+    }
+    
+    if (result == BM_SUCCESS)
+    {
+        _start();
+        
+        for (i = 0 ; i < BM_OPERATIONS && result == BM_SUCCESS ; i++)
+        {
+            if (function(&list, 1) != CL_SUCCESS)
+            {
+                result = BM_FAILURE;
+            }
+        }
+        
+        _stop(sample, i);
+    }
+    
+    cl_destroy(&list);
+    
+    return result;
+}
+
+uint8 _de_add(uint8 (*function)(DE_LIST *, uint16, void *),
+    uint32 size, _SAMPLE *sample)
+{
+    uint32 i;
+    uint32 j;
+    DE_LIST deque = {0};
+    uint32 rounds = _get_rounds(size);
+    uint8 result = BM_SUCCESS;
+    
+    for (i = 0 ; i < rounds && result == BM_SUCCESS ; i++)
+    {
+        _start();
+        
+        for (j = 0 ; j < size && result == BM_SUCCESS ; j++)
+        {
+            if (function(&deque, 0, &_object) != DE_SUCCESS)
+            {
+                result = BM_NO_MEMORY;
+            }
+        }
+        
+        _stop(sample, j);
+        
+        de_destroy(&deque);
+    }
+    
+    return result;
+}
+
+uint8 _de_remove(uint8 (*function)(DE_LIST *, void **),
+    uint32 size, _SAMPLE *sample)
+{
+    uint32 i;
+    uint32 j;
+    void *object;
+    DE_LIST deque = {0};
+    uint32 rounds = _get_rounds(size);
+    uint8 result = BM_SUCCESS;
+    
+    for (i = 0 ; i < rounds && result == BM_SUCCESS ; i++)
+    {
+        for (j = 0 ; j < size && result == BM_SUCCESS ; j++)
+        {
+            if (de_add_last(&deque, 0, &_object) != DE_SUCCESS)
+            {
+                result = BM_NO_MEMORY;
+            }
+        }
+        
+        if (result == BM_SUCCESS)
+        {
+            _start();
+            
+            for (j = 0 ; j < size && result == BM_SUCCESS ; j++)
+            {
+                if (function(&deque, &object) != DE_SUCCESS)
+                {
+                    result = BM_FAILURE;
+                }
+            }
+            
+            _stop(sample, j);
+        }
+        
+        de_destroy(&deque);
+    }
+    
+    return result;
+}
+
+uint8 _dl_add_first(uint32 size, _SAMPLE *sample)
+{
+    return _dl_add(dl_add_first, size, sample);
+}
+
+uint8 _dl_add_last(uint32 size, _SAMPLE *sample)
+{
+    return _dl_add(dl_add_last, size, sample);
+}
+
+uint8 _dl_add_before(uint32 size, _SAMPLE *sample)
+{
+    return _dl_add(dl_add_before, size, sample);
+}
+
+uint8 _dl_add_after(uint32 size, _SAMPLE *sample)
+{
+    return _dl_add(dl_add_after, size, sample);
+}
+
+uint8 _cl_move_forward(uint32 size, _SAMPLE *sample)
+{
+    return _cl_move(cl_move_forward, size, sample);
+}
+
+uint8 _cl_move_backward(uint32 size, _SAMPLE *sample)
+{
+    return _cl_move(cl_move_backward, size, sample);
+}
+
+uint8 _cb_add_new(uint32 size, _SAMPLE *sample)
+{
+    uint32 i;
+    CB_LIST buffer = {0};
+    uint8 result = BM_SUCCESS;
+    
+    /*
+     *  Measure the steady state, in which every new node overwrites the
+     *  oldest node in the buffer.
+     */
+    if (cb_set_limit(&buffer, size) == CB_SUCCESS)
+    {
+        for (i = 0 ; i < size && result == BM_SUCCESS ; i++)
+        {
+            if (cb_add_new(&buffer, 0, &_object) != CB_SUCCESS)
+            {
+                result = BM_NO_MEMORY;
+            }
+        }
+        
+        if (result == BM_SUCCESS)
+        {
+            _start();
+            
+            for (i = 0 ; i < BM_OPERATIONS && result == BM_SUCCESS ; i++)
+            {
+                if (cb_add_new(&buffer, 0, &_object) != CB_SUCCESS)
+                {
+                    result = BM_NO_MEMORY;
+                }
+            }
+            
+            _stop(sample, i);
+        }
+        
+        cb_destroy(&buffer);
+    }
+    
+    return result;
+}
+
+uint8 _cb_remove_old(uint32 size, _SAMPLE *sample)
+{
+    uint32 i;
+    uint32 j;
+    void *object;
+    CB_LIST buffer = {0};
+    uint32 rounds = _get_rounds(size);
+    uint8 result = BM_SUCCESS;
+    
+    if (cb_set_limit(&buffer, size) == CB_SUCCESS)
+    {
+        for (i = 0 ; i < rounds && result == BM_SUCCESS ; i++)
+        {
+            for (j = 0 ; j < size && result == BM_SUCCESS ; j++)
+            {
+                if (cb_add_new(&buffer, 0, &_object) != CB_SUCCESS)
+                {
+                    result = BM_NO_MEMORY;
+                }
+            }
+            
+            if (result == BM_SUCCESS)
+            {
+                _start();
+                
+                for (j = 0 ; j < size && result == BM_SUCCESS ; j++)
+                {
+                    if (cb_remove_old(&buffer, &object) != CB_SUCCESS)
+                    {
+                        result = BM_FAILURE;
+                    }
+                }
+                
+                _stop(sample, j);
+            }
+            
+            cb_destroy(&buffer);
+        }
+    }
+    
+    return result;
+}
+
+uint8 _qu_add_last(uint32 size, _SAMPLE *sample)
+{
+    uint32 i;
+    uint32 j;
+    QU_LIST queue = {0};
+    uint32 rounds = _get_rounds(size);
+    uint8 result = BM_SUCCESS;
+    
+    for (i = 0 ; i < rounds && result == BM_SUCCESS ; i++)
+    {
+        _start();
+        
+        for (j = 0 ; j < size && result == BM_SUCCESS ; j++)
+        {
+            if (qu_add_last(&queue, 0, &_object) != QU_SUCCESS)
+            {
+                result = BM_NO_MEMORY;
+            }
+        }
+        
+        _stop(sample, j);
+        
+        qu_destroy(&queue);
+    }
+    
+    return result;
+}
+
+uint8 _qu_remove_first(uint32 size, _SAMPLE *sample)
+{
+    uint32 i;
+    uint32 j;
+    void *object;
+    QU_LIST queue = {0};
+    uint32 rounds = _get_rounds(size);
+    uint8 result = BM_SUCCESS;
+    
+    for (i = 0 ; i < rounds && result == BM_SUCCESS ; i++)
+    {
+        for (j = 0 ; j < size && result == BM_SUCCESS ; j++)
+        {
+            if (qu_add_last(&queue, 0, &_object) != QU_SUCCESS)
+            {
+                result = BM_NO_MEMORY;
+            }
+        }
+        
+        if (result == BM_SUCCESS)
+        {
+            _start();
+            
+            for (j = 0 ; j < size && result == BM_SUCCESS ; j++)
+            {
+                if (qu_remove_first(&queue, &object) != QU_SUCCESS)
+                {
+                    result = BM_FAILURE;
+                }
+            }
+            
+            _stop(sample, j);
+        }
+        
+        qu_destroy(&queue);
+    }
+    
+    return result;
+}
+
+uint8 _de_add_first(uint32 size, _SAMPLE *sample)
+{
+    return _de_add(de_add_first, size, sample);
+}
+
+uint8 _de_add_last(uint32 size, _SAMPLE *sample)
+{
+    return _de_add(de_add_last, size, sample);
+}
+
+uint8 _de_remove_first(uint32 size, _SAMPLE *sample)
+{
+    return _de_remove(de_remove_first, size, sample);
+}
+
+uint8 _de_remove_last(uint32 size, _SAMPLE *sample)
+{
+    return _de_remove(de_remove_last, size, sample);
+}
+
+uint8 _rt_convert(uint32 size, _SAMPLE *sample)
+{
+    uint32 i;
+    uint32 j;
+    uint32 rounds = _get_rounds(size);
+    char string[RT_STRING_SIZE];
+    RT_DATA timestamp = {0, 59, 23, 0, 31, 0, 12, 2199};
+    
+    for (i = 0 ; i < rounds ; i++)
+    {
+        _start();
+        
+        for (j = 0 ; j < size ; j++)
+        {
+            timestamp.Sec = j % 60;
+            rt_convert(&timestamp, string);
+        }
+        
+        _stop(sample, j);
+    }
+    
+    return BM_SUCCESS;
+}
+
+uint8 _rt_render(uint32 size, _SAMPLE *sample)
+{
+    uint32 i;
+    uint32 j;
+    uint32 rounds = _get_rounds(size);
+    RT_TEXT text = {{0}};
+    RT_DATA timestamp = {0, 59, 23, 0, 31, 0, 12, 2199};
+    
+    for (i = 0 ; i < rounds ; i++)
+    {
+        _start();
+        
+        for (j = 0 ; j < size ; j++)
+        {
+            timestamp.Sec = j % 60;
+            rt_render(&text, &timestamp, RT_FORMAT_DMY);
+        }
+        
+        _stop(sample, j);
+    }
+    
+    return BM_SUCCESS;
+}
+
+uint32 _get_rounds(uint32 size)
+{
+    return (BM_OPERATIONS + size - 1) / size;
+}
+
+unsigned long long _get_ticks(void)
+{
+#ifdef HO_SHIM
+    return ho_get_nanoseconds();
+#else
+    uint32 cycles = CY_GET_REG32(_DWT_CYCCNT);
+    
+    if (cycles < _last_cycles)
+    {
+        _wrapped_ticks += 0x100000000ull;
+    }
+    
+    _last_cycles = cycles;
+    
+    return _wrapped_ticks + cycles;
+#endif
+}
+
+void _start(void)
+{
+#ifdef BM_COUNT_ALLOCATIONS
+    _start_allocations = _allocations;
+#endif
+    _start_ticks = _get_ticks();
+}
+
+void _stop(_SAMPLE *sample, uint32 operations)
+{
+    unsigned long long ticks = _get_ticks();
+    
+    sample->ticks += ticks - _start_ticks;
+    sample->operations += operations;
+#ifdef BM_COUNT_ALLOCATIONS
+    sample->allocations += _allocations - _start_allocations;
+#endif
+}
+
+void _report(char *name, uint32 size, _SAMPLE *sample)
+{
+    unsigned long long nanoseconds;
+    unsigned long long per_operation;
+    
+    /*
+     *  Split the conversion so that neither product is able to overflow.
+     */
+    nanoseconds = (sample->ticks / _TICK_HZ) * 1000000000ull +
+        (sample->ticks % _TICK_HZ) * 1000000000ull / _TICK_HZ;
+    per_operation = nanoseconds * 100 / sample->operations;
+    
+    if (per_operation > 0xffffffffull)
+    {
+        per_operation = 0xffffffffull;
+    }
+    
+    UART_1_PutString(name);
+    UART_1_PutString(",");
+    _put_number(size);
+    UART_1_PutString(",");
+    _put_number(sample->operations);
+    UART_1_PutString(",");
+    _put_fixed((uint32)per_operation);
+    UART_1_PutString(",");
+#ifdef BM_COUNT_ALLOCATIONS
+    _put_fixed((uint32)((unsigned long long)sample->allocations * 100 /
+        sample->operations));
+#else
+    UART_1_PutString("-");
+#endif
+    UART_1_PutString("\r\n");
+}
+
+void _put_number(uint32 number)
+{
+    char t[11] = {'\0'};
+    
+    mi_utoa(number, t);
+    UART_1_PutString(t);
+}
+
+void _put_fixed(uint32 number)
+{
+    _put_number(number / 100);
+    UART_1_PutString(".");
+    
+    if (number % 100 < 10)
+    {
+        UART_1_PutString("0");
+    }
+    
+    _put_number(number % 100);
+}
+
+/****************************************************************************
+ *  End of File
+ ****************************************************************************/
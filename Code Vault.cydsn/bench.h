@@ -0,0 +1,194 @@
+/****************************************************************************
+ *
+ *  File:           bench.h
+ *  Module:         Benchmark Library
+ *  Project:        Code Vault
+ *  Workspace:      PSoC Tools
+ *
+ *  Author:         Rodney B. Elliott
+ *  Date:           16 October 2026
+ *
+ ****************************************************************************
+ *
+ *  Copyright:      2013 Rodney B. Elliott
+ *
+ *  This file is part of PSoC Tools.
+ *
+ *  PSoC Tools is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  PSoC Tools is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with PSoC Tools. If not, see <http://www.gnu.org/licenses/>.
+ *
+ ****************************************************************************/
+#ifndef BENCH_H
+#define BENCH_H
+/**
+ *  @file bench.h
+ *  @brief Benchmark library interface.
+ *
+ *  <H3> Introduction </H3>
+ *
+ *  The benchmark library is a collection of functions that measure the cost
+ *  of the container operations and timestamp conversions provided by the
+ *  code vault, so that changes to the libraries concerned may be checked for
+ *  performance regressions.
+ *
+ *  Each benchmark times a single library function at a range of container
+ *  sizes, from one node up to a maximum chosen by the programmer, and
+ *  reports the mean time taken by the function in nanoseconds, together
+ *  with the mean number of heap allocations it made. The functions measured
+ *  are as follows:
+ *
+ *  - dl_add_first(), dl_add_last(), dl_add_before() and dl_add_after().
+ *  - cl_move_forward() and cl_move_backward().
+ *  - cb_add_new() and cb_remove_old().
+ *  - qu_add_last() and qu_remove_first().
+ *  - de_add_first(), de_add_last(), de_remove_first() and de_remove_last().
+ *  - rt_convert() and rt_render(), where the size is the number of
+ *    successive seconds converted.
+ *
+ *  For each size, a benchmark repeats its measurement until at least
+ *  #BM_OPERATIONS calls have been timed, so that results for small
+ *  containers are not swamped by the resolution of the timer.
+ *
+ *  <H3> Use </H3>
+ *
+ *  In order to run the benchmarks, the programmer need only call bm_run()
+ *  with the largest container size to be measured, ie:
+ *
+ *  @code
+ *  bm_run(1000);
+ *  @endcode
+ *
+ *  The results are transmitted using the UART as comma-separated values
+ *  (CSV), one line per function and size, preceded by a single header
+ *  line, ie:
+ *
+ *  @code
+ *  function,size,operations,ns_per_op,allocs_per_op
+ *  dl_add_first,1,100000,41.27,1.00
+ *  dl_add_first,10,100000,38.90,1.00
+ *  @endcode
+ *
+ *  Sizes are successive powers of ten. Functions that are not measured at
+ *  a given size, such as cb_add_new() at sizes greater than #CB_ARRAY_SIZE
+ *  when that option is selected, are omitted from the results.
+ *
+ *  <H3> Options </H3>
+ *
+ *  Heap allocations are only counted if the #BM_COUNT_ALLOCATIONS
+ *  definition is uncommented. Otherwise, the allocations column reports a
+ *  dash.
+ *
+ *  <H3> Hardware </H3>
+ *
+ *  On the target, times are measured using the data watchpoint and trace
+ *  (DWT) cycle counter of the Cortex-M3, and converted to nanoseconds using
+ *  the bus clock frequency. On the workstation, the host shim supplies a
+ *  nanosecond clock instead. The benchmark library otherwise requires the
+ *  same UART component as the test libraries.
+ *
+ *  <H3> Further Reading </H3>
+ *
+ *  Circular buffer library (cbuff.h)
+ *
+ *  Circular linked list library (cllist.h)
+ *
+ *  Deque library (deque.h)
+ *
+ *  Doubly linked list library (dllist.h)
+ *
+ *  Queue library (queue.h)
+ *
+ *  Real-time clock library (rtime.h)
+ */
+
+/****************************************************************************
+ *  Modules
+ ****************************************************************************/
+
+/****************************************************************************
+ *  Definitions and Macros
+ ****************************************************************************/
+/**
+ *  @brief Generic success.
+ */
+#define BM_SUCCESS                      0
+
+/**
+ *  @brief Generic failure.
+ */
+#define BM_FAILURE                      1
+
+/**
+ *  @brief Memory was unable to be allocated from the heap.
+ *
+ *  Any function returning this value will free any memory that was
+ *  successfully allocated from the heap prior to the allocation failure.
+ */
+#define BM_NO_MEMORY                    2
+
+/**
+ *  @brief A bad argument was passed to a function.
+ */
+#define BM_BAD_ARGUMENT                 3
+
+/**
+ *  @brief The largest container size that may be measured.
+ */
+#define BM_SIZE_MAXIMUM                 100000
+
+/**
+ *  @brief The minimum number of calls timed for each function and size.
+ */
+#define BM_OPERATIONS                   100000
+
+/**
+ *  @brief Count heap allocations.
+ *
+ *  Uncomment this definition in order to count the heap allocations made
+ *  by each function. The project must then be linked with the option
+ *  -Wl,--wrap=malloc, so that every call to malloc() passes through the
+ *  benchmark library.
+ */
+//#define BM_COUNT_ALLOCATIONS
+
+/****************************************************************************
+ *  Typedefs and Structures
+ ****************************************************************************/
+
+/****************************************************************************
+ *  Exported Variables
+ ****************************************************************************/
+
+/****************************************************************************
+ *  Exported Functions
+ ****************************************************************************/
+/**
+ *  @brief Run every benchmark.
+ *  @param[in] maximum The largest container size to be measured.
+ *  @return #BM_SUCCESS if successful, otherwise #BM_BAD_ARGUMENT,
+ *      #BM_NO_MEMORY, or #BM_FAILURE.
+ *  @remark The maximum argument must be between one and #BM_SIZE_MAXIMUM
+ *      inclusive.
+ *  @remark Returns #BM_NO_MEMORY if a container could not be filled to the
+ *      size being measured, having first transmitted the results obtained
+ *      up to that point.
+ *  @remark Starts the UART component, and stops it again once every
+ *      result has been transmitted.
+ */
+uint8 bm_run(uint32 maximum);
+
+#endif
+
+/****************************************************************************
+ *  End of File
+ ****************************************************************************/
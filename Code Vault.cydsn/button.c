@@ -37,9 +37,10 @@
  *  Modules
  ****************************************************************************/
 #include <device.h>
-#include <stdlib.h>
 
 #include "button.h"
+#include "rtime.h"
+#include "spsc.h"
 
 /****************************************************************************
  *  Definitions and Macros
@@ -116,29 +117,96 @@
  */
 #define _BUTTON_8                       CYREG_PRT0_PC7
 
+/**
+ *  @brief The mask used to find the index of an event within a button list.
+ */
+#define _MASK                           (BU_LIST_SIZE - 1)
+
+/**
+ *  @brief The packed event button number mask.
+ */
+#define _EVENT_NUMBER                   0x0000000f
+
+/**
+ *  @brief The packed event button state shift.
+ */
+#define _EVENT_STATE                    7
+
+/**
+ *  @brief The packed event millisecond count shift.
+ */
+#define _EVENT_TICKS                    8
+
 /****************************************************************************
  *  Typedefs and Structures
  ****************************************************************************/
+/**
+ *  @brief The software debounce state of a button.
+ */
+typedef struct _DEBOUNCE
+{
+    /**
+     *  @brief The millisecond count at which the last change was accepted.
+     */
+    uint32 accepted;
+    
+    /**
+     *  @brief The debounce window, in milliseconds.
+     */
+    uint16 window;
+} _DEBOUNCE;
 
 /****************************************************************************
  *  Prototypes of Local Functions
  ****************************************************************************/
 /**
- *  @brief Create a new button object.
- *  @param[out] object A pointer to a pointer to the newly-created object.
+ *  @brief Pack a button event into a single word.
  *  @param[in] number The button number.
  *  @param[in] state The button state.
- *
- *  This member may be one of the following values.
- *
- *  Value       | Description
- *  ----------- | -------------------------
- *  @b BU_PRESSED  | The button was pressed.
- *  @b BU_RELEASED | The button was released.
- *
- *  @return #BU_SUCCESS if successful, otherwise #BU_NO_MEMORY.
+ *  @param[in] ticks The millisecond count at which the event occurred.
+ *  @return The packed event.
+ */
+static uint32 _pack(uint8 number, uint8 state, uint32 ticks);
+
+/**
+ *  @brief Unpack a button event into a button object.
+ *  @param[in] event The packed event.
+ *  @param[out] object A pointer to the returned object.
+ */
+static void _unpack(uint32 event, BU_OBJECT *object);
+
+/**
+ *  @brief Add a packed event to a button list.
+ *  @param[in] buffer A pointer to a button list.
+ *  @param[in] event The packed event.
+ *  @return #BU_SUCCESS if successful, otherwise #BU_FULL.
+ */
+static uint8 _add_event(BU_LIST *buffer, uint32 event);
+
+/**
+ *  @brief Place a button event into the SPSC ring.
+ *  @param[in] number The button number.
+ *  @param[in] state The button state.
+ *  @param[in] ticks The millisecond count at which the event occurred.
  */
-uint8 _create_object(BU_OBJECT **object, uint8 number, uint8 state);
+static void _put_event(uint8 number, uint8 state, uint32 ticks);
+
+/**
+ *  @brief Compare the status register with the previous state of the
+ *      buttons, placing an event into the SPSC ring for each accepted change.
+ *  @remark Must only be called from the ISR, or with the ISR disabled.
+ */
+static void _sample(void);
+
+/**
+ *  @brief Move the button events held by the SPSC ring into a button list.
+ *  @param[in] buffer A pointer to a button list.
+ *  @remark Events are only moved if the buffer argument points to the
+ *      button list used by the ISR. Any change held back by a debounce
+ *      window is examined again first. Should the list be full and without
+ *      an event limit, the remaining events are discarded.
+ */
+static void _drain(BU_LIST *buffer);
 
 /****************************************************************************
  *  Exported Variables
@@ -148,165 +216,267 @@ uint8 _create_object(BU_OBJECT **object, uint8 number, uint8 state);
  *  Global Variables
  ****************************************************************************/
 /**
- *  @brief The circular buffer used by the button interrupt service routine
+ *  @brief The button list used by the button interrupt service routine
  *      (ISR).
  */
-static CB_LIST *_buffer = NULL;
+static BU_LIST *_buffer = NULL;
 
 /**
  *  @brief The previous state of the buttons.
  */
 static uint8 _old_state = BU_BUTTON_NONE;
 
+/**
+ *  @brief The buttons whose latest change is being held back by their
+ *      debounce window.
+ */
+static volatile uint8 _held = 0;
+
+/**
+ *  @brief The SPSC ring used to pass button events from the ISR to the main
+ *      loop.
+ */
+static SP_RING _ring;
+
+/**
+ *  @brief The array of button events used by the SPSC ring.
+ *
+ *  Each event is packed into a single word, with the button number held in
+ *  the low nibble, the button state held in bit 7, and the low 24 bits of
+ *  the millisecond count held in the top three bytes.
+ */
+static uint32 _events[BU_RING_SIZE];
+
+/**
+ *  @brief The software debounce state of each button, indexed by button
+ *      number less one.
+ */
+static _DEBOUNCE _debounce[BU_BUTTON_COUNT];
+
 /****************************************************************************
  *  Exported Functions
  ****************************************************************************/
-/**
- *  @brief Button interrupt service routine (ISR).
- */
 CY_ISR(bu_interrupt)
 {
-    uint8 new_state = Status_Reg_1_Read();
+    _sample();
+}
+
+uint8 bu_start(BU_LIST *buffer)
+{
+    uint8 index;
+    uint8 result = BU_BAD_ARGUMENT;
     
-    if ((new_state ^ _old_state) == BU_BUTTON_1)
+    if (buffer != NULL)
     {
-        if ((new_state & BU_BUTTON_1) == BU_BUTTON_1)
+        if (_buffer == NULL)
         {
-            bu_add_new(_buffer, 1, BU_RELEASED);
+            _buffer = buffer;
+            
+            sp_init(&_ring, _events, BU_RING_SIZE, sizeof(*_events));
+            
+            /*
+             *  Windows are limited to 16 bits, so that the first change to
+             *  each button is always accepted.
+             */
+            for (index = 0 ; index < BU_BUTTON_COUNT ; index++)
+            {
+                _debounce[index].accepted = rt_get_ticks() - 0xffff;
+            }
+
+            isr_1_StartEx(bu_interrupt);
+            isr_1_ClearPending();
+                
+            /*
+             *  This delay gives the button pins time to go high.
+             */
+            CyDelay(10);
+            
+            result = BU_SUCCESS;
         }
         else
         {
-            bu_add_new(_buffer, 1, BU_PRESSED);
+            result = BU_FAILURE;
         }
     }
     
-    if ((new_state ^ _old_state) == BU_BUTTON_2)
+    return result;
+}
+
+uint8 bu_stop(BU_LIST *buffer)
+{
+    uint8 result = BU_BAD_ARGUMENT;
+    
+    if (buffer != NULL)
     {
-        if ((new_state & BU_BUTTON_2) == BU_BUTTON_2)
+        if (_buffer != NULL)
         {
-            bu_add_new(_buffer, 2, BU_RELEASED);
+            isr_1_Stop();
+            
+            /*
+             *  The ISR must stay stopped, so any change still held back is
+             *  abandoned rather than examined again by _drain().
+             */
+            _held = 0;
+            
+            _drain(_buffer);
+            _buffer = NULL;
+            
+            result = BU_SUCCESS;
         }
         else
         {
-            bu_add_new(_buffer, 2, BU_PRESSED);
+            result = BU_FAILURE;
         }
     }
     
-    if ((new_state ^ _old_state) == BU_BUTTON_3)
+    return result;
+}
+
+uint8 bu_add_new(BU_LIST *buffer, uint8 number, uint8 state)
+{
+    uint8 result = BU_BAD_ARGUMENT;
+    
+    /*
+     *  The number and state are packed into narrow fields of the event, so
+     *  anything out of range would corrupt its neighbours.
+     */
+    if (buffer != NULL && number >= 1 && number <= BU_BUTTON_COUNT &&
+        (state == BU_PRESSED || state == BU_RELEASED))
     {
-        if ((new_state & BU_BUTTON_3) == BU_BUTTON_3)
-        {
-            bu_add_new(_buffer, 3, BU_RELEASED);
-        }
-        else
-        {
-            bu_add_new(_buffer, 3, BU_PRESSED);
-        }
+        _drain(buffer);
+        
+        result = _add_event(buffer, _pack(number, state, rt_get_ticks()));
     }
     
-    if ((new_state ^ _old_state) == BU_BUTTON_4)
+    return result;
+}
+
+uint8 bu_remove_old(BU_LIST *buffer)
+{
+    uint8 result = BU_BAD_ARGUMENT;
+    
+    if (buffer != NULL)
     {
-        if ((new_state & BU_BUTTON_4) == BU_BUTTON_4)
+        _drain(buffer);
+        
+        if (buffer->write != buffer->read)
         {
-            bu_add_new(_buffer, 4, BU_RELEASED);
+            ++buffer->read;
+            
+            result = BU_SUCCESS;
         }
         else
         {
-            bu_add_new(_buffer, 4, BU_PRESSED);
+            result = BU_EMPTY;
         }
     }
     
-    if ((new_state ^ _old_state) == BU_BUTTON_5)
+    return result;
+}
+
+uint8 bu_get_new_object(BU_LIST *buffer, BU_OBJECT *object)
+{
+    uint8 result = BU_BAD_ARGUMENT;
+    
+    if (buffer != NULL && object != NULL)
     {
-        if ((new_state & BU_BUTTON_5) == BU_BUTTON_5)
+        _drain(buffer);
+        
+        if (buffer->write != buffer->read)
         {
-            bu_add_new(_buffer, 5, BU_RELEASED);
+            _unpack(buffer->events[(buffer->write - 1) & _MASK], object);
+            
+            result = BU_SUCCESS;
         }
         else
         {
-            bu_add_new(_buffer, 5, BU_PRESSED);
+            result = BU_EMPTY;
         }
     }
     
-    if ((new_state ^ _old_state) == BU_BUTTON_6)
+    return result;
+}
+
+uint8 bu_get_old_object(BU_LIST *buffer, BU_OBJECT *object)
+{
+    uint8 result = BU_BAD_ARGUMENT;
+    
+    if (buffer != NULL && object != NULL)
     {
-        if ((new_state & BU_BUTTON_6) == BU_BUTTON_6)
+        _drain(buffer);
+        
+        if (buffer->write != buffer->read)
         {
-            bu_add_new(_buffer, 6, BU_RELEASED);
+            _unpack(buffer->events[buffer->read & _MASK], object);
+            
+            result = BU_SUCCESS;
         }
         else
         {
-            bu_add_new(_buffer, 6, BU_PRESSED);
+            result = BU_EMPTY;
         }
     }
     
-    if ((new_state ^ _old_state) == BU_BUTTON_7)
+    return result;
+}
+
+uint32 bu_get_count(BU_LIST *buffer)
+{
+    uint32 count = 0;
+    
+    if (buffer != NULL)
     {
-        if ((new_state & BU_BUTTON_7) == BU_BUTTON_7)
-        {
-            bu_add_new(_buffer, 7, BU_RELEASED);
-        }
-        else
-        {
-            bu_add_new(_buffer, 7, BU_PRESSED);
-        }
+        _drain(buffer);
+        
+        count = buffer->write - buffer->read;
     }
     
-    if ((new_state ^ _old_state) == BU_BUTTON_8)
+    return count;
+}
+
+uint32 bu_get_limit(BU_LIST *buffer)
+{
+    uint32 limit = 0;
+    
+    if (buffer != NULL)
     {
-        if ((new_state & BU_BUTTON_8) == BU_BUTTON_8)
-        {
-            bu_add_new(_buffer, 8, BU_RELEASED);
-        }
-        else
-        {
-            bu_add_new(_buffer, 8, BU_PRESSED);
-        }
+        limit = buffer->limit;
     }
     
-    _old_state = new_state;
+    return limit;
 }
 
-uint8 bu_start(CB_LIST *buffer)
+uint8 bu_set_limit(BU_LIST *buffer, uint32 limit)
 {
     uint8 result = BU_BAD_ARGUMENT;
     
     if (buffer != NULL)
     {
-        if (_buffer == NULL)
+        if (((bu_get_count(buffer) > limit) && (limit != 0)) ||
+            (limit > BU_LIST_SIZE))
         {
-            _buffer = buffer;
-
-            isr_1_StartEx(bu_interrupt);
-            isr_1_ClearPending();
-                
-            /*
-             *  This delay gives the button pins time to go high.
-             */
-            CyDelay(10);
-            
-            result = BU_SUCCESS;
+            result = BU_FAILURE;
         }
         else
         {
-            result = BU_FAILURE;
+            buffer->limit = limit;
+            
+            result = BU_SUCCESS;
         }
     }
     
     return result;
 }
 
-uint8 bu_stop(CB_LIST *buffer)
+uint8 bu_destroy(BU_LIST *buffer)
 {
     uint8 result = BU_BAD_ARGUMENT;
     
     if (buffer != NULL)
     {
-        if (_buffer != NULL)
+        if (_buffer == NULL)
         {
-            isr_1_Stop();
-            
-            _buffer = NULL;
+            buffer->read = buffer->write;
             
             result = BU_SUCCESS;
         }
@@ -319,117 +489,152 @@ uint8 bu_stop(CB_LIST *buffer)
     return result;
 }
 
-uint8 bu_add_new(CB_LIST *buffer, uint8 number, uint8 state)
+uint8 bu_set_window(uint8 number, uint16 window)
 {
-    BU_OBJECT *object;
     uint8 result = BU_BAD_ARGUMENT;
     
-    if (buffer != NULL)
+    if (number >= 1 && number <= BU_BUTTON_COUNT)
     {
-        result = _create_object(&object, number, state);
+        _debounce[number - 1].window = window;
         
-        if (result == BU_SUCCESS)
-        {
-            result = cb_add_new(buffer, TAG, object);
-            
-            if (result != CB_SUCCESS)
-            {
-                free(object);
-            }
-        }
+        result = BU_SUCCESS;
     }
     
     return result;
 }
 
-uint8 bu_remove_old(CB_LIST *buffer)
+uint16 bu_get_window(uint8 number)
 {
-    BU_OBJECT *object;
-    uint8 result = BU_BAD_ARGUMENT;
+    uint16 window = 0;
     
-    if (buffer != NULL)
+    if (number >= 1 && number <= BU_BUTTON_COUNT)
     {
-        result = cb_remove_old(buffer, (void **)&object);
-        
-        if (result == CB_SUCCESS)
-        {
-            free(object);
-        }
+        window = _debounce[number - 1].window;
     }
     
-    return result;
-}
-
-uint8 bu_get_new_object(CB_LIST *buffer, BU_OBJECT **object)
-{   
-    return cb_get_new_object(buffer, NULL, (void **)object);
+    return window;
 }
 
-uint8 bu_get_old_object(CB_LIST *buffer, BU_OBJECT **object)
+/****************************************************************************
+ *  Local Functions
+ ****************************************************************************/
+uint32 _pack(uint8 number, uint8 state, uint32 ticks)
 {
-    return cb_get_old_object(buffer, NULL, (void **)object);
+    return (number & _EVENT_NUMBER) | ((uint32)state << _EVENT_STATE) |
+        (ticks << _EVENT_TICKS);
 }
 
-uint32 bu_get_count(CB_LIST *buffer)
+void _unpack(uint32 event, BU_OBJECT *object)
 {
-    return cb_get_count(buffer);
+    object->number = event & _EVENT_NUMBER;
+    object->state = (event >> _EVENT_STATE) & 0x01;
+    object->ticks = event >> _EVENT_TICKS;
 }
 
-uint32 bu_get_limit(CB_LIST *buffer)
+uint8 _add_event(BU_LIST *buffer, uint32 event)
 {
-    return cb_get_limit(buffer);
+    uint8 result = BU_SUCCESS;
+    
+    if ((buffer->limit != 0) &&
+        (buffer->write - buffer->read >= buffer->limit))
+    {
+        ++buffer->read;
+    }
+    else if (buffer->write - buffer->read >= BU_LIST_SIZE)
+    {
+        result = BU_FULL;
+    }
+    
+    if (result == BU_SUCCESS)
+    {
+        buffer->events[buffer->write & _MASK] = event;
+        
+        ++buffer->write;
+    }
+    
+    return result;
 }
 
-uint8 bu_set_limit(CB_LIST *buffer, uint32 limit)
+void _put_event(uint8 number, uint8 state, uint32 ticks)
 {
-    return cb_set_limit(buffer, limit);
+    uint32 event = _pack(number, state, ticks);
+    
+    /*
+     *  Should the ring be full, the event is discarded and counted by the
+     *  ring.
+     */
+    sp_put(&_ring, &event);
 }
 
-uint8 bu_destroy(CB_LIST *buffer)
+void _sample(void)
 {
-    uint8 result = BU_BAD_ARGUMENT;
+    uint8 changed;
+    uint8 held = 0;
+    uint8 index;
+    uint8 mask;
+    uint8 new_state = Status_Reg_1_Read();
+    uint32 ticks = rt_get_ticks();
     
-    if (buffer != NULL)
+    changed = new_state ^ _old_state;
+    
+    /*
+     *  Visit each changed bit in turn, stopping as soon as none remain. A
+     *  change that falls within the debounce window of its button is left
+     *  out of the old state, so that it is examined again later.
+     */
+    for (index = 0, mask = 0x01 ; changed != 0 ; index++, mask <<= 1)
     {
-        if (_buffer == NULL)
+        if ((changed & mask) == mask)
         {
-            while (bu_get_count(buffer) > 0)
+            changed ^= mask;
+            
+            if (ticks - _debounce[index].accepted >= _debounce[index].window)
             {
-                bu_remove_old(buffer);
+                _debounce[index].accepted = ticks;
+                _old_state ^= mask;
+                
+                if ((new_state & mask) == mask)
+                {
+                    _put_event(index + 1, BU_RELEASED, ticks);
+                }
+                else
+                {
+                    _put_event(index + 1, BU_PRESSED, ticks);
+                }
+            }
+            else
+            {
+                held |= mask;
             }
-            
-            result = BU_SUCCESS;
-        }
-        else
-        {
-            result = BU_FAILURE;
         }
     }
     
-    return result;
+    _held = held;
 }
 
-/****************************************************************************
- *  Local Functions
- ****************************************************************************/
-uint8 _create_object(BU_OBJECT **object, uint8 number, uint8 state)
+void _drain(BU_LIST *buffer)
 {
-    BU_OBJECT *new_object;
-    uint8 result = BU_NO_MEMORY;
-    
-    new_object = malloc(sizeof(*new_object));
+    uint32 event;
     
-    if (new_object != NULL)
+    if (buffer != NULL && buffer == _buffer)
     {
-        new_object->number = number;
-        new_object->state = state;
-        
-        *object = new_object;
+        /*
+         *  The ISR only runs when the status register changes, so a change
+         *  held back by a debounce window would otherwise wait for the next
+         *  one, and a tap shorter than the window would lose its release.
+         */
+        if (_held != 0)
+        {
+            isr_1_Disable();
+            _sample();
+            isr_1_Enable();
+        }
         
-        result = BU_SUCCESS;
+        while (sp_get(&_ring, &event) == SP_SUCCESS)
+        {
+            _add_event(buffer, event);
+        }
     }
-    
-    return result;
 }
 
 /****************************************************************************
@@ -40,41 +40,72 @@
  *  to use of up to eight SPNO buttons as part of the physical user interface
  *  of their project.
  *
- *  The library uses a circular buffer to store button information. A node is
- *  added to the buffer whenever a button is pressed or released. Each node
- *  contains a pointer to a button object that is owned by the library - that
- *  is, the library is responsible for everything from its creation to its
- *  eventual destruction.
- *
- *  By adding a node when a button is both pressed and released, the library
+ *  The library uses a button list to store button information. An event is
+ *  added to the list whenever a button is pressed or released. A button list
+ *  is a circular buffer of #BU_LIST_SIZE events held within the BU_LIST
+ *  structure itself, and each event is packed into a single 32-bit word that
+ *  holds the button number, the button state, and the millisecond count at
+ *  which the event occurred. Adding, examining and removing events therefore
+ *  requires no calls to the heap. Events are unpacked into a BU_OBJECT
+ *  structure supplied by the caller whenever they are examined.
+ *
+ *  The library ISR does not add events to the button list itself. Instead
+ *  it places each button event into a single-producer single-consumer (SPSC)
+ *  ring, from which the events are moved into the button list by those
+ *  library functions that examine the list from the main loop. The ISR and
+ *  the main loop therefore never share the button list. The ring is able to
+ *  hold #BU_RING_SIZE events between calls to the library.
+ *
+ *  While a change is being held back by a debounce window, as described
+ *  below, those same library functions examine the buttons themselves, and
+ *  so place events into the ring from the main loop. They disable the ISR
+ *  for as long as they do so, so that only one of the two is ever placing
+ *  events into the ring, and the ring keeps a single producer.
+ *
+ *  By adding an event when a button is both pressed and released, the library
  *  gives the programmer the ability to design user interfaces that permit
  *  multiple buttons to be pressed at once. It also gives programmers the
  *  ability to make use of the order in which buttons are pressed or released.
+ *  Should several buttons change state between two runs of the ISR, an event
+ *  is added for each of them, in order of button number.
+ *
+ *  Each button may also be given a software debounce window using the
+ *  function bu_set_window(). Once the ISR has accepted a change in the state
+ *  of a button, any further change to that button is held back until the
+ *  window has elapsed, and is only accepted if it is still present when the
+ *  buttons are next examined. As the ISR only runs when the status register
+ *  changes, the library functions below also examine the buttons whenever a
+ *  change is being held back. Windows are measured using the millisecond
+ *  count of the real-time clock library, which must therefore be started
+ *  using rt_tick_start() before a window other than #BU_WINDOW_NONE is used.
  *
  *  <H3> Use </H3>
  *
  *  In order to use the library, the programmer must start by declaring an
- *  instance of a CB_LIST structure with scope appropriate to the intended
+ *  instance of a BU_LIST structure with scope appropriate to the intended
  *  application. This instance must be initialised to zero, ie:
  *
- *  @code CB_LIST cb_list = {0}; @endcode
+ *  @code BU_LIST bu_list = {0}; @endcode
  *
  *  The library requires exclusive access to this instance. The programmer
  *  must not attempt to use the declared structure for any other purpose.
  *
  *  With the instance declared, the next step is start the library by calling
  *  the function bu_start(). This initialises the components used by the
- *  library. Nodes will then be automatically added to the circular buffer
- *  whenever a button is pressed or released. Nodes may also be manually 
- *  added to the buffer using the function bu_add_new(). Nodes are removed
+ *  library. Events will then be automatically added to the button list
+ *  whenever a button is pressed or released. Events may also be manually
+ *  added to the list using the function bu_add_new(). Events are removed
  *  using the function bu_remove_old().
  *
  *  The functions bu_get_new_object() and bu_get_old_object() may be used
- *  to examine the newest and oldest button objects without removing their
- *  nodes from the buffer. The function bu_get_count() returns the number
- *  of nodes in the buffer, whilst bu_destroy() removes all nodes from the
- *  buffer. Finally, the function bu_stop() stops the components used by
- *  the library.
+ *  to examine the newest and oldest button events without removing them
+ *  from the list. The function bu_get_count() returns the number of events
+ *  in the list, whilst bu_destroy() removes all events from the list.
+ *  Finally, the function bu_stop() stops the components used by the library.
+ *
+ *  Should an event be added to a full button list without an event limit,
+ *  the event is discarded. Setting a limit using bu_set_limit() instead
+ *  causes the oldest event to be overwritten.
  *
  *  For further information about these library functions, please refer to the
  *  individual function documentation. For examples of their use, please see
@@ -82,7 +113,7 @@
  *
  *  <H3> Hardware </H3>
  *
- *  The error management library has been designed to run on a Cypress
+ *  The button library has been designed to run on a Cypress
  *  CY8CKIT-001 development kit fitted with a PSoC5 CY8C5568AXI-060 module. It
  *  requires access to the following components:
  *
@@ -110,13 +141,14 @@
  *
  *  <H3> Further Reading </H3>
  *
- *  Circular buffer library (cbuff.h)
+ *  Real-time clock library (rtime.h)
+ *
+ *  Single-producer single-consumer ring library (spsc.h)
  */
  
 /****************************************************************************
  *  Modules
  ****************************************************************************/
-#include "cbuff.h"
 
 /****************************************************************************
  *  Definitions and Macros
@@ -145,10 +177,15 @@
 #define BU_BAD_ARGUMENT                 3
 
 /**
- *  @brief The circular buffer is empty.
+ *  @brief The button list is empty.
  */
 #define BU_EMPTY                        4
 
+/**
+ *  @brief The button list is full.
+ */
+#define BU_FULL                         5
+
 /**
  *  @brief The button was pressed.
  */
@@ -233,9 +270,46 @@
 #define BU_BUTTON_NONE                  0xff
 
 /**
- *  @brief The button library object tag.
+ *  @brief The number of buttons.
  */
-#define TAG                             1000
+#define BU_BUTTON_COUNT                 8
+
+/**
+ *  @brief The debounce window that applies no software debounce.
+ */
+#define BU_WINDOW_NONE                  0
+
+/**
+ *  @brief The number of button events the ISR is able to hold.
+ *
+ *  The value must be a power of two.
+ */
+#define BU_RING_SIZE                    16
+
+#if (BU_RING_SIZE == 0) || ((BU_RING_SIZE & (BU_RING_SIZE - 1)) != 0)
+#error BU_RING_SIZE must be a power of two.
+#endif
+
+/**
+ *  @brief The number of events a button list is able to hold.
+ *
+ *  The value must be a power of two.
+ */
+#define BU_LIST_SIZE                    32
+
+#if (BU_LIST_SIZE == 0) || ((BU_LIST_SIZE & (BU_LIST_SIZE - 1)) != 0)
+#error BU_LIST_SIZE must be a power of two.
+#endif
+
+/**
+ *  @brief The button object millisecond count mask.
+ *
+ *  Only the low 24 bits of the millisecond count are packed into an event.
+ *  The interval between two events is therefore found by subtracting their
+ *  counts and masking the result with this value, provided that the events
+ *  are less than 2^24 milliseconds - about four and a half hours - apart.
+ */
+#define BU_TICKS_MASK                   0x00ffffff
 
 /****************************************************************************
  *  Typedefs and Structures
@@ -261,8 +335,46 @@ typedef struct BU_OBJECT
      *  @b BU_RELEASED | The button was released.
      */
     uint8 state;
+    
+    /**
+     *  @brief The millisecond count at which the event occurred, masked with
+     *      #BU_TICKS_MASK.
+     */
+    uint32 ticks;
 } BU_OBJECT;
 
+/**
+ *  @brief A button list.
+ */
+typedef struct BU_LIST
+{
+    /**
+     *  @brief The number of events ever removed from the list.
+     *
+     *  Masked with #BU_LIST_SIZE - 1, this gives the index of the oldest
+     *  event in the array.
+     */
+    uint32 read;
+    
+    /**
+     *  @brief The number of events ever added to the list.
+     *
+     *  Masked with #BU_LIST_SIZE - 1, this gives the index at which the
+     *  next event will be written.
+     */
+    uint32 write;
+    
+    /**
+     *  @brief The array of packed events.
+     */
+    uint32 events[BU_LIST_SIZE];
+    
+    /**
+     *  @brief The maximum number of events allowed in the list.
+     */
+    uint32 limit;
+} BU_LIST;
+
 /****************************************************************************
  *  Exported Variables
  ****************************************************************************/
@@ -270,29 +382,41 @@ typedef struct BU_OBJECT
 /****************************************************************************
  *  Exported Functions
  ****************************************************************************/
+/**
+ *  @brief Button interrupt service routine (ISR).
+ *
+ *  Reads the status register, and places an event into the SPSC ring for
+ *  every button whose state has changed and whose debounce window has
+ *  elapsed.
+ *
+ *  @remark This is started by bu_start(), and should not normally be called
+ *      directly.
+ */
+CY_ISR_PROTO(bu_interrupt);
+
 /**
  *  @brief Start the components used by the library.
- *  @param[in] buffer A pointer to a circular buffer.
+ *  @param[in] buffer A pointer to a button list.
  *  @return #BU_SUCCESS if successful, otherwise #BU_BAD_ARGUMENT or
  *      #BU_FAILURE.
  *  @remark If this function is called more than once, it will
  *      return #BU_FAILURE.
  *  @warning This must be the first library function to be called.
  */
-uint8 bu_start(CB_LIST *buffer);
+uint8 bu_start(BU_LIST *buffer);
 
 /**
  *  @brief Stop the components used by the library.
- *  @param[in] buffer A pointer to a circular buffer.
+ *  @param[in] buffer A pointer to a button list.
  *  @return #BU_SUCCESS if successful, otherwise #BU_BAD_ARGUMENT.
  *  @remark If this function is called before bu_start(), it will
  *      return #BU_FAILURE.
  */
-uint8 bu_stop(CB_LIST *buffer);
+uint8 bu_stop(BU_LIST *buffer);
 
 /**
- *  @brief Add a new button object to a circular buffer.
- *  @param[in] buffer A pointer to a circular buffer.
+ *  @brief Add a new button event to a button list.
+ *  @param[in] buffer A pointer to a button list.
  *  @param[in] number The button number.
  *  @param[in] state The button state.
  *
@@ -304,69 +428,78 @@ uint8 bu_stop(CB_LIST *buffer);
  *  @b BU_RELEASED | The button was released.
  *
  *  @return #BU_SUCCESS if successful, otherwise #BU_BAD_ARGUMENT or
- *      #BU_NO_MEMORY.
+ *      #BU_FULL.
+ *  @remark #BU_BAD_ARGUMENT is returned unless the number lies between one
+ *      and #BU_BUTTON_COUNT, and the state is one of the values above.
+ *  @remark The event is given the current millisecond count of the
+ *      real-time clock library.
+ *  @remark #BU_FULL is only returned by a button list without an event
+ *      limit.
  */
-uint8 bu_add_new(CB_LIST *buffer, uint8 number, uint8 state);
+uint8 bu_add_new(BU_LIST *buffer, uint8 number, uint8 state);
 
 /**
- *  @brief Remove the oldest button object from a circular buffer.
- *  @param[in] buffer A pointer to a circular buffer.
+ *  @brief Remove the oldest button event from a button list.
+ *  @param[in] buffer A pointer to a button list.
  *  @return #BU_SUCCESS if successful, otherwise #BU_BAD_ARGUMENT or
  *      #BU_EMPTY.
  */
-uint8 bu_remove_old(CB_LIST *buffer);
+uint8 bu_remove_old(BU_LIST *buffer);
 
 /**
- *  @brief Get the newest button object of a circular buffer.
- *  @param[in] buffer A pointer to a circular buffer.
- *  @param[out] object A pointer to a pointer to the returned object.
+ *  @brief Get the newest button object of a button list.
+ *  @param[in] buffer A pointer to a button list.
+ *  @param[out] object A pointer to the returned object.
  *  @return #BU_SUCCESS if successful, otherwise #BU_BAD_ARGUMENT or
  *      #BU_EMPTY.
  */
-uint8 bu_get_new_object(CB_LIST *buffer, BU_OBJECT **object);
+uint8 bu_get_new_object(BU_LIST *buffer, BU_OBJECT *object);
 
 /**
- *  @brief Get the oldest button object of a circular buffer.
- *  @param[in] buffer A pointer to a circular buffer.
- *  @param[out] object A pointer to a pointer to the returned object.
+ *  @brief Get the oldest button object of a button list.
+ *  @param[in] buffer A pointer to a button list.
+ *  @param[out] object A pointer to the returned object.
  *  @return #BU_SUCCESS if successful, otherwise #BU_BAD_ARGUMENT or
  *      #BU_EMPTY.
  */
-uint8 bu_get_old_object(CB_LIST *buffer, BU_OBJECT **object);
+uint8 bu_get_old_object(BU_LIST *buffer, BU_OBJECT *object);
 
 /**
- *  @brief Get the node count of a circular buffer.
- *  @param[in] buffer A pointer to a circular buffer.
- *  @return The number of nodes in the circular buffer.
+ *  @brief Get the event count of a button list.
+ *  @param[in] buffer A pointer to a button list.
+ *  @return The number of events in the button list.
  *  @remark If the buffer argument is NULL, a count of zero will be returned.
  */
-uint32 bu_get_count(CB_LIST *buffer);
+uint32 bu_get_count(BU_LIST *buffer);
 
 /**
- *  @brief Get the node limit of a circular buffer.
- *  @param[in] buffer A pointer to a circular buffer.
- *  @return The maximum number of nodes allowed in the circular buffer.
+ *  @brief Get the event limit of a button list.
+ *  @param[in] buffer A pointer to a button list.
+ *  @return The maximum number of events allowed in the button list.
  *  @remark If the buffer argument is NULL, a limit of zero will be returned.
  */
-uint32 bu_get_limit(CB_LIST *buffer);
+uint32 bu_get_limit(BU_LIST *buffer);
 
 /**
- *  @brief Set the node limit of a circular buffer.
- *  @param[in] buffer A pointer to a circular buffer.
- *  @param[in] limit The maximum number of nodes allowed in the circular
- *      buffer.
+ *  @brief Set the event limit of a button list.
+ *  @param[in] buffer A pointer to a button list.
+ *  @param[in] limit The maximum number of events allowed in the button
+ *      list.
  *  @return #BU_SUCCESS if successful, otherwise #BU_BAD_ARGUMENT or
  *      #BU_FAILURE.
- *  @remark It is up to the caller to ensure that the number of nodes in the
- *      buffer is less than the proposed limit. Failure to do so will result
- *      in this function returning #BU_FAILURE.
- *  @remark Set the limit to zero to allow the buffer to grow without limit.
+ *  @remark It is up to the caller to ensure that the number of events in
+ *      the list is less than the proposed limit. Failure to do so will
+ *      result in this function returning #BU_FAILURE.
+ *  @remark A limit greater than #BU_LIST_SIZE will also result in this
+ *      function returning #BU_FAILURE.
+ *  @remark Set the limit to zero to allow the list to fill without
+ *      overwriting the oldest event.
  */
-uint8 bu_set_limit(CB_LIST *buffer, uint32 limit);
+uint8 bu_set_limit(BU_LIST *buffer, uint32 limit);
 
 /**
- *  @brief Destroy a circular buffer.
- *  @param[in] buffer A pointer to a circular buffer.
+ *  @brief Destroy a button list.
+ *  @param[in] buffer A pointer to a button list.
  *  @return #BU_SUCCESS if successful, otherwise #BU_BAD_ARGUMENT or
  *      #BU_FAILURE.
  *  @remark It is up to the caller to ensure that the library components
@@ -375,7 +508,27 @@ uint8 bu_set_limit(CB_LIST *buffer, uint32 limit);
  *  @remark This should be the last library function to be called.
  *  @see bu_stop()
  */
-uint8 bu_destroy(CB_LIST *buffer);
+uint8 bu_destroy(BU_LIST *buffer);
+
+/**
+ *  @brief Set the software debounce window of a button.
+ *  @param[in] number The button number, from 1 to #BU_BUTTON_COUNT.
+ *  @param[in] window The number of milliseconds for which further changes
+ *      to the state of the button are held back, or #BU_WINDOW_NONE.
+ *  @return #BU_SUCCESS if successful, otherwise #BU_BAD_ARGUMENT.
+ *  @remark Windows default to #BU_WINDOW_NONE, and are kept when the
+ *      library is stopped and restarted.
+ */
+uint8 bu_set_window(uint8 number, uint16 window);
+
+/**
+ *  @brief Get the software debounce window of a button.
+ *  @param[in] number The button number, from 1 to #BU_BUTTON_COUNT.
+ *  @return The debounce window of the button, in milliseconds.
+ *  @remark If the number argument is out of range, a window of zero will be
+ *      returned.
+ */
+uint16 bu_get_window(uint8 number);
 
 #endif
 
@@ -40,6 +40,7 @@
 
 #include "button.h"
 #include "button_test.h"
+#include "rtime.h"
 
 /****************************************************************************
  *  Definitions and Macros
@@ -75,10 +76,12 @@
  ****************************************************************************/
 uint8 but_test_1(void)
 {
-    CB_LIST buffer_1 = {0};
-    CB_LIST buffer_2 = {0};
-    BU_OBJECT *object_0;
+    BU_LIST buffer_1 = {0};
+    BU_LIST buffer_2 = {0};
+    uint32 i;
+    BU_OBJECT object_0;
     uint8 result = BUT_SUCCESS;
+    uint32 ticks_0;
     
     UART_1_Start();
     
@@ -206,7 +209,9 @@ uint8 but_test_1(void)
     
     if (result == BUT_SUCCESS)
     {
-        if (bu_add_new(&buffer_1, 1, BU_PRESSED) == BU_SUCCESS)
+        if ((bu_add_new(&buffer_1, 0, BU_PRESSED) == BU_BAD_ARGUMENT) &&
+            (bu_add_new(&buffer_1, BU_BUTTON_COUNT + 1, BU_PRESSED) ==
+            BU_BAD_ARGUMENT))
         {
             UART_1_PutString("   8\tbu_add_new()\t\tPASS\r\n");
         }
@@ -216,6 +221,33 @@ uint8 but_test_1(void)
             result = BUT_FAILURE;
         }
     }
+    
+    if (result == BUT_SUCCESS)
+    {
+        if ((bu_add_new(&buffer_1, 1, 2) == BU_BAD_ARGUMENT) &&
+            (bu_get_count(&buffer_1) == 0))
+        {
+            UART_1_PutString("   9\tbu_add_new()\t\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("   9\tbu_add_new()\t\tFAIL\r\n");
+            result = BUT_FAILURE;
+        }
+    }
+    
+    if (result == BUT_SUCCESS)
+    {
+        if (bu_add_new(&buffer_1, 1, BU_PRESSED) == BU_SUCCESS)
+        {
+            UART_1_PutString("  10\tbu_add_new()\t\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("  10\tbu_add_new()\t\tFAIL\r\n");
+            result = BUT_FAILURE;
+        }
+    }
      
     /*
      *  Initialise bu_get_new_object() test.
@@ -253,11 +285,11 @@ uint8 but_test_1(void)
     {
         if (bu_get_new_object(NULL, NULL) == BU_BAD_ARGUMENT)
         {
-            UART_1_PutString("   9\tbu_get_new_object()\tPASS\r\n");
+            UART_1_PutString("  11\tbu_get_new_object()\tPASS\r\n");
         }
         else
         {
-            UART_1_PutString("   9\tbu_get_new_object()\tFAIL\r\n");
+            UART_1_PutString("  11\tbu_get_new_object()\tFAIL\r\n");
             result = BUT_FAILURE;
         }
     }
@@ -266,11 +298,11 @@ uint8 but_test_1(void)
     {
         if (bu_get_new_object(NULL, &object_0) == BU_BAD_ARGUMENT)
         {
-            UART_1_PutString("  10\tbu_get_new_object()\tPASS\r\n");
+            UART_1_PutString("  12\tbu_get_new_object()\tPASS\r\n");
         }
         else
         {
-            UART_1_PutString("  10\tbu_get_new_object()\tFAIL\r\n");
+            UART_1_PutString("  12\tbu_get_new_object()\tFAIL\r\n");
             result = BUT_FAILURE;
         }
     }
@@ -279,11 +311,11 @@ uint8 but_test_1(void)
     {
         if (bu_get_new_object(&buffer_1, NULL) == BU_BAD_ARGUMENT)
         {
-            UART_1_PutString("  11\tbu_get_new_object()\tPASS\r\n");
+            UART_1_PutString("  13\tbu_get_new_object()\tPASS\r\n");
         }
         else
         {
-            UART_1_PutString("  11\tbu_get_new_object()\tFAIL\r\n");
+            UART_1_PutString("  13\tbu_get_new_object()\tFAIL\r\n");
             result = BUT_FAILURE;
         }
     }
@@ -292,24 +324,24 @@ uint8 but_test_1(void)
     {
         if (bu_get_new_object(&buffer_1, &object_0) == BU_SUCCESS)
         {
-            UART_1_PutString("  12\tbu_get_new_object()\tPASS\r\n");
+            UART_1_PutString("  14\tbu_get_new_object()\tPASS\r\n");
         }
         else
         {
-            UART_1_PutString("  12\tbu_get_new_object()\tFAIL\r\n");
+            UART_1_PutString("  14\tbu_get_new_object()\tFAIL\r\n");
             result = BUT_FAILURE;
         }
     }
     
     if (result == BUT_SUCCESS)
     {
-        if ((object_0->number == 2) && (object_0->state == BU_PRESSED))
+        if ((object_0.number == 2) && (object_0.state == BU_PRESSED))
         {
-            UART_1_PutString("  13\tbu_get_new_object()\tPASS\r\n");
+            UART_1_PutString("  15\tbu_get_new_object()\tPASS\r\n");
         }
         else
         {
-            UART_1_PutString("  13\tbu_get_new_object()\tFAIL\r\n");
+            UART_1_PutString("  15\tbu_get_new_object()\tFAIL\r\n");
             result = BUT_FAILURE;
         }
     }
@@ -321,11 +353,11 @@ uint8 but_test_1(void)
     {
         if (bu_get_old_object(NULL, NULL) == BU_BAD_ARGUMENT)
         {
-            UART_1_PutString("  14\tbu_get_old_object()\tPASS\r\n");
+            UART_1_PutString("  16\tbu_get_old_object()\tPASS\r\n");
         }
         else
         {
-            UART_1_PutString("  14\tbu_get_old_object()\tFAIL\r\n");
+            UART_1_PutString("  16\tbu_get_old_object()\tFAIL\r\n");
             result = BUT_FAILURE;
         }
     }
@@ -334,11 +366,11 @@ uint8 but_test_1(void)
     {
         if (bu_get_old_object(NULL, &object_0) == BU_BAD_ARGUMENT)
         {
-            UART_1_PutString("  15\tbu_get_old_object()\tPASS\r\n");
+            UART_1_PutString("  17\tbu_get_old_object()\tPASS\r\n");
         }
         else
         {
-            UART_1_PutString("  15\tbu_get_old_object()\tFAIL\r\n");
+            UART_1_PutString("  17\tbu_get_old_object()\tFAIL\r\n");
             result = BUT_FAILURE;
         }
     }
@@ -347,11 +379,11 @@ uint8 but_test_1(void)
     {
         if (bu_get_old_object(&buffer_1, NULL) == BU_BAD_ARGUMENT)
         {
-            UART_1_PutString("  16\tbu_get_old_object()\tPASS\r\n");
+            UART_1_PutString("  18\tbu_get_old_object()\tPASS\r\n");
         }
         else
         {
-            UART_1_PutString("  16\tbu_get_old_object()\tFAIL\r\n");
+            UART_1_PutString("  18\tbu_get_old_object()\tFAIL\r\n");
             result = BUT_FAILURE;
         }
     }
@@ -360,24 +392,24 @@ uint8 but_test_1(void)
     {
         if (bu_get_old_object(&buffer_1, &object_0) == BU_SUCCESS)
         {
-            UART_1_PutString("  17\tbu_get_old_object()\tPASS\r\n");
+            UART_1_PutString("  19\tbu_get_old_object()\tPASS\r\n");
         }
         else
         {
-            UART_1_PutString("  17\tbu_get_old_object()\tFAIL\r\n");
+            UART_1_PutString("  19\tbu_get_old_object()\tFAIL\r\n");
             result = BUT_FAILURE;
         }
     }
     
     if (result == BUT_SUCCESS)
     {
-        if ((object_0->number == 1) && (object_0->state == BU_PRESSED))
+        if ((object_0.number == 1) && (object_0.state == BU_PRESSED))
         {
-            UART_1_PutString("  18\tbu_get_old_object()\tPASS\r\n");
+            UART_1_PutString("  20\tbu_get_old_object()\tPASS\r\n");
         }
         else
         {
-            UART_1_PutString("  18\tbu_get_old_object()\tFAIL\r\n");
+            UART_1_PutString("  20\tbu_get_old_object()\tFAIL\r\n");
             result = BUT_FAILURE;
         }
     }
@@ -389,11 +421,11 @@ uint8 but_test_1(void)
     {
         if (bu_get_count(NULL) == 0)
         {
-            UART_1_PutString("  19\tbu_get_count()\t\tPASS\r\n");
+            UART_1_PutString("  21\tbu_get_count()\t\tPASS\r\n");
         }
         else
         {
-            UART_1_PutString("  19\tbu_get_count()\t\tFAIL\r\n");
+            UART_1_PutString("  21\tbu_get_count()\t\tFAIL\r\n");
             result = BUT_FAILURE;
         }
     }
@@ -402,11 +434,11 @@ uint8 but_test_1(void)
     {
         if (bu_get_count(&buffer_1) == 3)
         {
-            UART_1_PutString("  20\tbu_get_count()\t\tPASS\r\n");
+            UART_1_PutString("  22\tbu_get_count()\t\tPASS\r\n");
         }
         else
         {
-            UART_1_PutString("  20\tbu_get_count()\t\tFAIL\r\n");
+            UART_1_PutString("  22\tbu_get_count()\t\tFAIL\r\n");
             result = BUT_FAILURE;
         }
     }
@@ -418,11 +450,11 @@ uint8 but_test_1(void)
     {
         if (bu_remove_old(NULL) == BU_BAD_ARGUMENT)
         {
-            UART_1_PutString("  21\tbu_remove_old()\t\tPASS\r\n");
+            UART_1_PutString("  23\tbu_remove_old()\t\tPASS\r\n");
         }
         else
         {
-            UART_1_PutString("  21\tbu_remove_old()\t\tFAIL\r\n");
+            UART_1_PutString("  23\tbu_remove_old()\t\tFAIL\r\n");
             result = BUT_FAILURE;
         }
     }
@@ -431,11 +463,11 @@ uint8 but_test_1(void)
     {
         if (bu_remove_old(&buffer_2) == BU_EMPTY)
         {
-            UART_1_PutString("  22\tbu_remove_old()\t\tPASS\r\n");
+            UART_1_PutString("  24\tbu_remove_old()\t\tPASS\r\n");
         }
         else
         {
-            UART_1_PutString("  22\tbu_remove_old()\t\tFAIL\r\n");
+            UART_1_PutString("  24\tbu_remove_old()\t\tFAIL\r\n");
             result = BUT_FAILURE;
         }
     }
@@ -444,11 +476,11 @@ uint8 but_test_1(void)
     {
         if (bu_remove_old(&buffer_1) == BU_SUCCESS)
         {
-            UART_1_PutString("  23\tbu_remove_old()\t\tPASS\r\n");
+            UART_1_PutString("  25\tbu_remove_old()\t\tPASS\r\n");
         }
         else
         {
-            UART_1_PutString("  23\tbu_remove_old()\t\tFAIL\r\n");
+            UART_1_PutString("  25\tbu_remove_old()\t\tFAIL\r\n");
             result = BUT_FAILURE;
         }
     }
@@ -457,11 +489,11 @@ uint8 but_test_1(void)
     {
         if (bu_get_count(&buffer_1) == 2)
         {
-            UART_1_PutString("  24\tbu_remove_old()\t\tPASS\r\n");
+            UART_1_PutString("  26\tbu_remove_old()\t\tPASS\r\n");
         }
         else
         {
-            UART_1_PutString("  24\tbu_remove_old()\t\tFAIL\r\n");
+            UART_1_PutString("  26\tbu_remove_old()\t\tFAIL\r\n");
             result = BUT_FAILURE;
         }
     }
@@ -481,13 +513,13 @@ uint8 but_test_1(void)
     
     if (result == BUT_SUCCESS)
     {
-        if ((object_0->number == 1) && (object_0->state == BU_RELEASED))
+        if ((object_0.number == 1) && (object_0.state == BU_RELEASED))
         {
-            UART_1_PutString("  25\tbu_remove_old()\t\tPASS\r\n");
+            UART_1_PutString("  27\tbu_remove_old()\t\tPASS\r\n");
         }
         else
         {
-            UART_1_PutString("  25\tbu_remove_old()\t\tFAIL\r\n");
+            UART_1_PutString("  27\tbu_remove_old()\t\tFAIL\r\n");
             result = BUT_FAILURE;
         }
     }
@@ -499,11 +531,11 @@ uint8 but_test_1(void)
     {
         if (bu_get_limit(NULL) == 0)
         {
-            UART_1_PutString("  26\tbu_get_limit()\t\tPASS\r\n");
+            UART_1_PutString("  28\tbu_get_limit()\t\tPASS\r\n");
         }
         else
         {
-            UART_1_PutString("  26\tbu_get_limit()\t\tFAIL\r\n");
+            UART_1_PutString("  28\tbu_get_limit()\t\tFAIL\r\n");
             result = BUT_FAILURE;
         }
     }
@@ -512,11 +544,11 @@ uint8 but_test_1(void)
     {
         if (bu_get_limit(&buffer_1) == 0)
         {
-            UART_1_PutString("  27\tbu_get_limit()\t\tPASS\r\n");
+            UART_1_PutString("  29\tbu_get_limit()\t\tPASS\r\n");
         }
         else
         {
-            UART_1_PutString("  27\tbu_get_limit()\t\tFAIL\r\n");
+            UART_1_PutString("  29\tbu_get_limit()\t\tFAIL\r\n");
             result = BUT_FAILURE;
         }
     }
@@ -544,11 +576,11 @@ uint8 but_test_1(void)
     {
         if (bu_set_limit(NULL, 10) == BU_BAD_ARGUMENT)
         {
-            UART_1_PutString("  28\tbu_set_limit()\t\tPASS\r\n");
+            UART_1_PutString("  30\tbu_set_limit()\t\tPASS\r\n");
         }
         else
         {
-            UART_1_PutString("  28\tbu_set_limit()\t\tFAIL\r\n");
+            UART_1_PutString("  30\tbu_set_limit()\t\tFAIL\r\n");
             result = BUT_FAILURE;
         }
     }
@@ -557,11 +589,11 @@ uint8 but_test_1(void)
     {
         if (bu_set_limit(&buffer_1, 2) == BU_FAILURE)
         {
-            UART_1_PutString("  29\tbu_set_limit()\t\tPASS\r\n");
+            UART_1_PutString("  31\tbu_set_limit()\t\tPASS\r\n");
         }
         else
         {
-            UART_1_PutString("  29\tbu_set_limit()\t\tFAIL\r\n");
+            UART_1_PutString("  31\tbu_set_limit()\t\tFAIL\r\n");
             result = BUT_FAILURE;
         }
     }
@@ -570,11 +602,11 @@ uint8 but_test_1(void)
     {
         if (bu_set_limit(&buffer_1, 4) == BU_SUCCESS)
         {
-            UART_1_PutString("  30\tbu_set_limit()\t\tPASS\r\n");
+            UART_1_PutString("  32\tbu_set_limit()\t\tPASS\r\n");
         }
         else
         {
-            UART_1_PutString("  30\tbu_set_limit()\t\tFAIL\r\n");
+            UART_1_PutString("  32\tbu_set_limit()\t\tFAIL\r\n");
             result = BUT_FAILURE;
         }
     }
@@ -586,11 +618,11 @@ uint8 but_test_1(void)
     {
         if (bu_destroy(NULL) == BU_BAD_ARGUMENT)
         {
-            UART_1_PutString("  31\tbu_destroy()\t\tPASS\r\n");
+            UART_1_PutString("  33\tbu_destroy()\t\tPASS\r\n");
         }
         else
         {
-            UART_1_PutString("  31\tbu_destroy()\t\tFAIL\r\n");
+            UART_1_PutString("  33\tbu_destroy()\t\tFAIL\r\n");
             result = BUT_FAILURE;
         }
     }
@@ -599,11 +631,11 @@ uint8 but_test_1(void)
     {
         if (bu_destroy(&buffer_1) == BU_FAILURE)
         {
-            UART_1_PutString("  32\tbu_destroy()\t\tPASS\r\n");
+            UART_1_PutString("  34\tbu_destroy()\t\tPASS\r\n");
         }
         else
         {
-            UART_1_PutString("  32\tbu_destroy()\t\tFAIL\r\n");
+            UART_1_PutString("  34\tbu_destroy()\t\tFAIL\r\n");
             result = BUT_FAILURE;
         }
     }
@@ -631,11 +663,11 @@ uint8 but_test_1(void)
     {
         if (bu_destroy(&buffer_1) == BU_SUCCESS)
         {
-            UART_1_PutString("  33\tbu_destroy()\t\tPASS\r\n");
+            UART_1_PutString("  35\tbu_destroy()\t\tPASS\r\n");
         }
         else
         {
-            UART_1_PutString("  33\tbu_destroy()\t\tFAIL\r\n");
+            UART_1_PutString("  35\tbu_destroy()\t\tFAIL\r\n");
             result = BUT_FAILURE;
         }
     }
@@ -644,11 +676,124 @@ uint8 but_test_1(void)
     {
         if (bu_get_count(&buffer_1) == 0)
         {
-            UART_1_PutString("  34\tbu_destroy()\t\tPASS\r\n");
+            UART_1_PutString("  36\tbu_destroy()\t\tPASS\r\n");
         }
         else
         {
-            UART_1_PutString("  34\tbu_destroy()\t\tFAIL\r\n");
+            UART_1_PutString("  36\tbu_destroy()\t\tFAIL\r\n");
+            result = BUT_FAILURE;
+        }
+    }
+    
+    /*
+     *  Initialise bu_add_new() test.
+     */
+    if (result == BUT_SUCCESS)
+    {
+        bu_set_limit(&buffer_1, 0);
+        
+        for (i = 0 ; i < BU_LIST_SIZE ; i++)
+        {
+            bu_add_new(&buffer_1, 3, BU_PRESSED);
+        }
+        
+        if (bu_get_count(&buffer_1) == BU_LIST_SIZE)
+        {
+            UART_1_PutString("   -\tInitialise test...\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("   -\tInitialise test...\tFAIL\r\n");
+            result = BUT_FAILURE;
+        }
+    }
+    
+    /*
+     *  Test bu_add_new().
+     */
+    if (result == BUT_SUCCESS)
+    {
+        if (bu_add_new(&buffer_1, 4, BU_PRESSED) == BU_FULL)
+        {
+            UART_1_PutString("  37\tbu_add_new()\t\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("  37\tbu_add_new()\t\tFAIL\r\n");
+            result = BUT_FAILURE;
+        }
+    }
+    
+    /*
+     *  Test bu_set_limit().
+     */
+    if (result == BUT_SUCCESS)
+    {
+        if (bu_set_limit(&buffer_1, BU_LIST_SIZE + 1) == BU_FAILURE)
+        {
+            UART_1_PutString("  38\tbu_set_limit()\t\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("  38\tbu_set_limit()\t\tFAIL\r\n");
+            result = BUT_FAILURE;
+        }
+    }
+    
+    /*
+     *  Test bu_add_new().
+     */
+    if (result == BUT_SUCCESS)
+    {
+        bu_set_limit(&buffer_1, BU_LIST_SIZE);
+        
+        if ((bu_add_new(&buffer_1, 4, BU_RELEASED) == BU_SUCCESS) &&
+            (bu_get_count(&buffer_1) == BU_LIST_SIZE))
+        {
+            UART_1_PutString("  39\tbu_add_new()\t\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("  39\tbu_add_new()\t\tFAIL\r\n");
+            result = BUT_FAILURE;
+        }
+    }
+    
+    /*
+     *  Test bu_get_new_object().
+     */
+    if (result == BUT_SUCCESS)
+    {
+        bu_get_new_object(&buffer_1, &object_0);
+        ticks_0 = rt_get_ticks() - object_0.ticks;
+        
+        if ((object_0.number == 4) &&
+            (object_0.state == BU_RELEASED) &&
+            ((ticks_0 & BU_TICKS_MASK) < 1000))
+        {
+            UART_1_PutString("  40\tbu_get_new_object()\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("  40\tbu_get_new_object()\tFAIL\r\n");
+            result = BUT_FAILURE;
+        }
+    }
+    
+    /*
+     *  Test bu_destroy().
+     */
+    if (result == BUT_SUCCESS)
+    {
+        bu_destroy(&buffer_1);
+        
+        if (bu_get_count(&buffer_1) == 0)
+        {
+            UART_1_PutString("  41\tbu_destroy()\t\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("  41\tbu_destroy()\t\tFAIL\r\n");
             result = BUT_FAILURE;
         }
     }
@@ -683,8 +828,8 @@ uint8 but_test_1(void)
 
 void but_test_2(void)
 {
-    CB_LIST buffer = {0};
-    BU_OBJECT *object;
+    BU_LIST buffer = {0};
+    BU_OBJECT object;
     uint8 status = 0;
     
     UART_1_Start();
@@ -713,74 +858,74 @@ void but_test_2(void)
             UART_1_PutString("BUTTON LIBRARY TEST\r\n");
             UART_1_PutString("\r\n");
             
-            if ((object->number == 1) && (object->state == BU_PRESSED))
+            if ((object.number == 1) && (object.state == BU_PRESSED))
             {
                 status |= BU_BUTTON_1;
             }
-            else if ((object->number == 1) && (object->state == BU_RELEASED))
+            else if ((object.number == 1) && (object.state == BU_RELEASED))
             {
                 status ^= BU_BUTTON_1;
             }
             
-            if ((object->number == 2) && (object->state == BU_PRESSED))
+            if ((object.number == 2) && (object.state == BU_PRESSED))
             {
                 status |= BU_BUTTON_2;
             }
-            else if ((object->number == 2) && (object->state == BU_RELEASED))
+            else if ((object.number == 2) && (object.state == BU_RELEASED))
             {
                 status ^= BU_BUTTON_2;
             }
             
-            if ((object->number == 3) && (object->state == BU_PRESSED))
+            if ((object.number == 3) && (object.state == BU_PRESSED))
             {
                 status |= BU_BUTTON_3;
             }
-            else if ((object->number == 3) && (object->state == BU_RELEASED))
+            else if ((object.number == 3) && (object.state == BU_RELEASED))
             {
                 status ^= BU_BUTTON_3;
             }
             
-            if ((object->number == 4) && (object->state == BU_PRESSED))
+            if ((object.number == 4) && (object.state == BU_PRESSED))
             {
                 status |= BU_BUTTON_4;
             }
-            else if ((object->number == 4) && (object->state == BU_RELEASED))
+            else if ((object.number == 4) && (object.state == BU_RELEASED))
             {
                 status ^= BU_BUTTON_4;
             }
             
-            if ((object->number == 5) && (object->state == BU_PRESSED))
+            if ((object.number == 5) && (object.state == BU_PRESSED))
             {
                 status |= BU_BUTTON_5;
             }
-            else if ((object->number == 5) && (object->state == BU_RELEASED))
+            else if ((object.number == 5) && (object.state == BU_RELEASED))
             {
                 status ^= BU_BUTTON_5;
             }
             
-            if ((object->number == 6) && (object->state == BU_PRESSED))
+            if ((object.number == 6) && (object.state == BU_PRESSED))
             {
                 status |= BU_BUTTON_6;
             }
-            else if ((object->number == 6) && (object->state == BU_RELEASED))
+            else if ((object.number == 6) && (object.state == BU_RELEASED))
             {
                 status ^= BU_BUTTON_6;
             }
             
-            if ((object->number == 7) && (object->state == BU_PRESSED))
+            if ((object.number == 7) && (object.state == BU_PRESSED))
             {
                 status |= BU_BUTTON_7;
             }
-            else if ((object->number == 7) && (object->state == BU_RELEASED))
+            else if ((object.number == 7) && (object.state == BU_RELEASED))
             {
                 status ^= BU_BUTTON_7;
             }
             
-            if ((object->number == 8) && (object->state == BU_PRESSED))
+            if ((object.number == 8) && (object.state == BU_PRESSED))
             {
                 status |= BU_BUTTON_8;
             }
-            else if ((object->number == 8) && (object->state == BU_RELEASED))
+            else if ((object.number == 8) && (object.state == BU_RELEASED))
             {
                 status ^= BU_BUTTON_8;
             }
@@ -862,6 +1007,427 @@ void but_test_2(void)
     }
 }
 
+#ifdef HO_SHIM
+uint8 but_test_3(void)
+{
+    BU_LIST buffer_1 = {0};
+    BU_OBJECT object_0;
+    uint8 result = BUT_SUCCESS;
+    uint32 ticks_0;
+    
+    UART_1_Start();
+    
+    UART_1_PutString("\x1b\x5b\x32\x4a");
+    UART_1_PutString("BUTTON INTERRUPT TEST\r\n");
+    UART_1_PutString("\r\n");
+    UART_1_PutString("Test\tFunction\t\tResult\r\n");
+    UART_1_PutString("----\t--------\t\t------\r\n");
+    
+    /*
+     *  Initialise bu_set_window() test.
+     */
+    if (result == BUT_SUCCESS)
+    {
+        ho_status_write(BU_BUTTON_NONE);
+        
+        if (bu_start(&buffer_1) == BU_SUCCESS)
+        {
+            UART_1_PutString("   -\tInitialise test...\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("   -\tInitialise test...\tFAIL\r\n");
+            result = BUT_FAILURE;
+        }
+    }
+    
+    /*
+     *  Test bu_set_window().
+     */
+    if (result == BUT_SUCCESS)
+    {
+        if (bu_set_window(0, 10) == BU_BAD_ARGUMENT)
+        {
+            UART_1_PutString("   1\tbu_set_window()\t\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("   1\tbu_set_window()\t\tFAIL\r\n");
+            result = BUT_FAILURE;
+        }
+    }
+    
+    if (result == BUT_SUCCESS)
+    {
+        if (bu_set_window(BU_BUTTON_COUNT + 1, 10) == BU_BAD_ARGUMENT)
+        {
+            UART_1_PutString("   2\tbu_set_window()\t\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("   2\tbu_set_window()\t\tFAIL\r\n");
+            result = BUT_FAILURE;
+        }
+    }
+    
+    if (result == BUT_SUCCESS)
+    {
+        if (bu_set_window(1, 60000) == BU_SUCCESS)
+        {
+            UART_1_PutString("   3\tbu_set_window()\t\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("   3\tbu_set_window()\t\tFAIL\r\n");
+            result = BUT_FAILURE;
+        }
+    }
+    
+    /*
+     *  Test bu_get_window().
+     */
+    if (result == BUT_SUCCESS)
+    {
+        if (bu_get_window(0) == 0)
+        {
+            UART_1_PutString("   4\tbu_get_window()\t\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("   4\tbu_get_window()\t\tFAIL\r\n");
+            result = BUT_FAILURE;
+        }
+    }
+    
+    if (result == BUT_SUCCESS)
+    {
+        if (bu_get_window(1) == 60000)
+        {
+            UART_1_PutString("   5\tbu_get_window()\t\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("   5\tbu_get_window()\t\tFAIL\r\n");
+            result = BUT_FAILURE;
+        }
+    }
+    
+    if (result == BUT_SUCCESS)
+    {
+        if (bu_get_window(2) == BU_WINDOW_NONE)
+        {
+            UART_1_PutString("   6\tbu_get_window()\t\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("   6\tbu_get_window()\t\tFAIL\r\n");
+            result = BUT_FAILURE;
+        }
+    }
+    
+    /*
+     *  Test bu_interrupt().
+     */
+    if (result == BUT_SUCCESS)
+    {
+        ho_status_write(BU_BUTTON_NONE ^ BU_BUTTON_2 ^ BU_BUTTON_3);
+        bu_interrupt();
+        
+        if (bu_get_count(&buffer_1) == 2)
+        {
+            UART_1_PutString("   7\tbu_interrupt()\t\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("   7\tbu_interrupt()\t\tFAIL\r\n");
+            result = BUT_FAILURE;
+        }
+    }
+    
+    if (result == BUT_SUCCESS)
+    {
+        bu_get_old_object(&buffer_1, &object_0);
+        
+        if ((object_0.number == 2) && (object_0.state == BU_PRESSED))
+        {
+            UART_1_PutString("   8\tbu_interrupt()\t\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("   8\tbu_interrupt()\t\tFAIL\r\n");
+            result = BUT_FAILURE;
+        }
+    }
+    
+    if (result == BUT_SUCCESS)
+    {
+        bu_get_new_object(&buffer_1, &object_0);
+        
+        if ((object_0.number == 3) && (object_0.state == BU_PRESSED))
+        {
+            UART_1_PutString("   9\tbu_interrupt()\t\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("   9\tbu_interrupt()\t\tFAIL\r\n");
+            result = BUT_FAILURE;
+        }
+    }
+    
+    if (result == BUT_SUCCESS)
+    {
+        ho_status_write(BU_BUTTON_NONE ^ BU_BUTTON_4);
+        bu_interrupt();
+        bu_get_new_object(&buffer_1, &object_0);
+        
+        if ((bu_get_count(&buffer_1) == 5) &&
+            (object_0.number == 4) &&
+            (object_0.state == BU_PRESSED))
+        {
+            UART_1_PutString("  10\tbu_interrupt()\t\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("  10\tbu_interrupt()\t\tFAIL\r\n");
+            result = BUT_FAILURE;
+        }
+    }
+    
+    if (result == BUT_SUCCESS)
+    {
+        ho_status_write(BU_BUTTON_NONE ^ BU_BUTTON_4 ^ BU_BUTTON_1);
+        bu_interrupt();
+        bu_get_new_object(&buffer_1, &object_0);
+        
+        if ((bu_get_count(&buffer_1) == 6) &&
+            (object_0.number == 1) &&
+            (object_0.state == BU_PRESSED))
+        {
+            UART_1_PutString("  11\tbu_interrupt()\t\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("  11\tbu_interrupt()\t\tFAIL\r\n");
+            result = BUT_FAILURE;
+        }
+    }
+    
+    if (result == BUT_SUCCESS)
+    {
+        ho_status_write(BU_BUTTON_NONE ^ BU_BUTTON_4);
+        bu_interrupt();
+        
+        if (bu_get_count(&buffer_1) == 6)
+        {
+            UART_1_PutString("  12\tbu_interrupt()\t\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("  12\tbu_interrupt()\t\tFAIL\r\n");
+            result = BUT_FAILURE;
+        }
+    }
+    
+    if (result == BUT_SUCCESS)
+    {
+        ho_status_write(BU_BUTTON_NONE ^ BU_BUTTON_4 ^ BU_BUTTON_1);
+        bu_interrupt();
+        ho_status_write(BU_BUTTON_NONE ^ BU_BUTTON_4);
+        bu_interrupt();
+        
+        if (bu_get_count(&buffer_1) == 6)
+        {
+            UART_1_PutString("  13\tbu_interrupt()\t\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("  13\tbu_interrupt()\t\tFAIL\r\n");
+            result = BUT_FAILURE;
+        }
+    }
+    
+    if (result == BUT_SUCCESS)
+    {
+        bu_set_window(1, 1);
+        ticks_0 = rt_get_ticks();
+        
+        while (rt_get_ticks() == ticks_0)
+        {
+            CyDelay(1);
+        }
+        
+        bu_get_new_object(&buffer_1, &object_0);
+        
+        if ((bu_get_count(&buffer_1) == 7) &&
+            (object_0.number == 1) &&
+            (object_0.state == BU_RELEASED))
+        {
+            UART_1_PutString("  14\tbu_interrupt()\t\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("  14\tbu_interrupt()\t\tFAIL\r\n");
+            result = BUT_FAILURE;
+        }
+    }
+    
+    if (result == BUT_SUCCESS)
+    {
+        bu_set_window(1, BU_WINDOW_NONE);
+        ho_status_write(0x00);
+        bu_interrupt();
+        bu_get_new_object(&buffer_1, &object_0);
+        
+        if ((bu_get_count(&buffer_1) == 14) &&
+            (object_0.number == 8) &&
+            (object_0.state == BU_PRESSED))
+        {
+            UART_1_PutString("  15\tbu_interrupt()\t\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("  15\tbu_interrupt()\t\tFAIL\r\n");
+            result = BUT_FAILURE;
+        }
+    }
+    
+    if (result == BUT_SUCCESS)
+    {
+        ho_status_write(BU_BUTTON_NONE);
+        bu_interrupt();
+        bu_get_new_object(&buffer_1, &object_0);
+        
+        if ((bu_get_count(&buffer_1) == 22) &&
+            (object_0.number == 8) &&
+            (object_0.state == BU_RELEASED))
+        {
+            UART_1_PutString("  16\tbu_interrupt()\t\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("  16\tbu_interrupt()\t\tFAIL\r\n");
+            result = BUT_FAILURE;
+        }
+    }
+    
+    /*
+     *  A tap shorter than the debounce window must still be released once
+     *  the window elapses, even though the ISR does not run again.
+     */
+    if (result == BUT_SUCCESS)
+    {
+        bu_set_window(5, 20);
+        ticks_0 = rt_get_ticks();
+        
+        while (rt_get_ticks() - ticks_0 < 20)
+        {
+            CyDelay(1);
+        }
+        
+        ho_status_write(BU_BUTTON_NONE ^ BU_BUTTON_5);
+        bu_interrupt();
+        ticks_0 = rt_get_ticks();
+        ho_status_write(BU_BUTTON_NONE);
+        bu_interrupt();
+        bu_get_new_object(&buffer_1, &object_0);
+        
+        if ((bu_get_count(&buffer_1) == 23) &&
+            (object_0.number == 5) &&
+            (object_0.state == BU_PRESSED))
+        {
+            UART_1_PutString("  17\tbu_interrupt()\t\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("  17\tbu_interrupt()\t\tFAIL\r\n");
+            result = BUT_FAILURE;
+        }
+    }
+    
+    if (result == BUT_SUCCESS)
+    {
+        while (rt_get_ticks() - ticks_0 < 20)
+        {
+            CyDelay(1);
+        }
+        
+        bu_get_new_object(&buffer_1, &object_0);
+        
+        if ((bu_get_count(&buffer_1) == 24) &&
+            (object_0.number == 5) &&
+            (object_0.state == BU_RELEASED))
+        {
+            UART_1_PutString("  18\tbu_interrupt()\t\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("  18\tbu_interrupt()\t\tFAIL\r\n");
+            result = BUT_FAILURE;
+        }
+    }
+    
+    if (result == BUT_SUCCESS)
+    {
+        ticks_0 = rt_get_ticks();
+        
+        while (rt_get_ticks() - ticks_0 < 20)
+        {
+            CyDelay(1);
+        }
+        
+        ho_status_write(BU_BUTTON_NONE ^ BU_BUTTON_5);
+        bu_interrupt();
+        bu_get_new_object(&buffer_1, &object_0);
+        
+        if ((bu_get_count(&buffer_1) == 25) &&
+            (object_0.number == 5) &&
+            (object_0.state == BU_PRESSED))
+        {
+            UART_1_PutString("  19\tbu_interrupt()\t\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("  19\tbu_interrupt()\t\tFAIL\r\n");
+            result = BUT_FAILURE;
+        }
+    }
+    
+    /*
+     *  Report test result.
+     */
+    if (result == BUT_SUCCESS)
+    {
+        UART_1_PutString("\r\n");
+        UART_1_PutString("TEST PASSED\r\n");
+    }
+    else
+    {
+        UART_1_PutString("\r\n");
+        UART_1_PutString("TEST FAILED\r\n");
+    }
+    
+    /*
+     *  Clean-up test.
+     */
+    ho_status_write(BU_BUTTON_NONE);
+    bu_set_window(5, BU_WINDOW_NONE);
+    bu_interrupt();
+    bu_stop(&buffer_1);
+    bu_destroy(&buffer_1);
+    bu_set_window(1, BU_WINDOW_NONE);
+    
+    while ((UART_1_ReadTxStatus() & UART_1_TX_STS_FIFO_EMPTY) !=
+        UART_1_TX_STS_FIFO_EMPTY)
+    {
+        CyDelay(1);
+    }
+        
+    UART_1_Stop();
+    
+    return result;
+}
+#endif
+
 /****************************************************************************
  *  Local Functions
  ****************************************************************************/
@@ -36,17 +36,20 @@
  *
  *  <H3> Introduction </H3>
  *
- *  The button test library contains two functions that test each of the
+ *  The button test library contains three functions that test each of the
  *  functions that comprise the button library.
  *
  *  The first function, but_test_1(), provides complete coverage of the button
- *  library codebase - with two exceptions. The first is that those library
- *  functions that call malloc(), either directly or indirectly, have not had
- *  their #BU_NO_MEMORY return value tested. The second is that it does not
- *  cover the button library interrupt service routine (ISR).
+ *  library codebase - with the exception of the button library interrupt
+ *  service routine (ISR).
  *
  *  The second function, but_test_2(), provides complete coverage of the ISR.
  *
+ *  The third function, but_test_3(), tests the ISR without the programmer
+ *  pressing any buttons, including the handling of simultaneous changes and
+ *  of debounce windows. As it supplies the status register values itself,
+ *  it is only built against the host shim.
+ *
  *  <H3> Use </H3>
  *
  *  In order to use the library, the programmer must first connect the target
@@ -68,37 +71,45 @@
  *     -    Initialise test...      PASS
  *     7    bu_add_new()            PASS
  *     8    bu_add_new()            PASS
+ *     9    bu_add_new()            PASS
+ *    10    bu_add_new()            PASS
  *     -    Initialise test...      PASS
  *     -    Initialise test...      PASS
- *     9    bu_get_new_object()     PASS
- *    10    bu_get_new_object()     PASS
  *    11    bu_get_new_object()     PASS
  *    12    bu_get_new_object()     PASS
  *    13    bu_get_new_object()     PASS
- *    14    bu_get_old_object()     PASS
- *    15    bu_get_old_object()     PASS
+ *    14    bu_get_new_object()     PASS
+ *    15    bu_get_new_object()     PASS
  *    16    bu_get_old_object()     PASS
  *    17    bu_get_old_object()     PASS
  *    18    bu_get_old_object()     PASS
- *    19    bu_get_count()          PASS
- *    20    bu_get_count()          PASS
- *    21    bu_remove_old()         PASS
- *    22    bu_remove_old()         PASS
+ *    19    bu_get_old_object()     PASS
+ *    20    bu_get_old_object()     PASS
+ *    21    bu_get_count()          PASS
+ *    22    bu_get_count()          PASS
  *    23    bu_remove_old()         PASS
  *    24    bu_remove_old()         PASS
- *     -    Initialise test...      PASS
  *    25    bu_remove_old()         PASS
- *    26    bu_get_limit()          PASS
- *    27    bu_get_limit()          PASS
+ *    26    bu_remove_old()         PASS
  *     -    Initialise test...      PASS
- *    28    bu_set_limit()          PASS
- *    29    bu_set_limit()          PASS
- *    30    bu_set_limit()          PASS
- *    31    bu_destroy()            PASS
- *    32    bu_destroy()            PASS
+ *    27    bu_remove_old()         PASS
+ *    28    bu_get_limit()          PASS
+ *    29    bu_get_limit()          PASS
  *     -    Initialise test...      PASS
+ *    30    bu_set_limit()          PASS
+ *    31    bu_set_limit()          PASS
+ *    32    bu_set_limit()          PASS
  *    33    bu_destroy()            PASS
  *    34    bu_destroy()            PASS
+ *     -    Initialise test...      PASS
+ *    35    bu_destroy()            PASS
+ *    36    bu_destroy()            PASS
+ *     -    Initialise test...      PASS
+ *    37    bu_add_new()            PASS
+ *    38    bu_set_limit()          PASS
+ *    39    bu_add_new()            PASS
+ *    40    bu_get_new_object()     PASS
+ *    41    bu_destroy()            PASS
  *
  *  TEST PASSED
  *  @endcode
@@ -121,6 +132,37 @@
  *  While but_test_2() is running, the word 'PRESSED' should appear next to
  *  the name of any buttons pressed by the programmer.
  *
+ *  In the case of but_test_3(), the output should be as follows.
+ *
+ *  @code
+ *  BUTTON INTERRUPT TEST
+ *
+ *  Test    Function                Result
+ *  ----    --------                ------
+ *     -    Initialise test...      PASS
+ *     1    bu_set_window()         PASS
+ *     2    bu_set_window()         PASS
+ *     3    bu_set_window()         PASS
+ *     4    bu_get_window()         PASS
+ *     5    bu_get_window()         PASS
+ *     6    bu_get_window()         PASS
+ *     7    bu_interrupt()          PASS
+ *     8    bu_interrupt()          PASS
+ *     9    bu_interrupt()          PASS
+ *    10    bu_interrupt()          PASS
+ *    11    bu_interrupt()          PASS
+ *    12    bu_interrupt()          PASS
+ *    13    bu_interrupt()          PASS
+ *    14    bu_interrupt()          PASS
+ *    15    bu_interrupt()          PASS
+ *    16    bu_interrupt()          PASS
+ *    17    bu_interrupt()          PASS
+ *    18    bu_interrupt()          PASS
+ *    19    bu_interrupt()          PASS
+ *
+ *  TEST PASSED
+ *  @endcode
+ *
  *  <H3> Hardware </H3>
  *
  *  The button test library has been designed to run on a Cypress CY8CKIT-001
@@ -204,6 +246,14 @@ uint8 but_test_1(void);
  */
 void but_test_2(void);
 
+#ifdef HO_SHIM
+/**
+ *  @brief Tests the button library ISR using the host shim.
+ *  @return #BUT_SUCCESS if successful, otherwise #BUT_FAILURE.
+ */
+uint8 but_test_3(void);
+#endif
+
 #endif
 
 /****************************************************************************
@@ -45,6 +45,12 @@
 /****************************************************************************
  *  Definitions and Macros
  ****************************************************************************/
+#ifdef CB_ARRAY_SIZE
+/**
+ *  @brief Convert a read or write count into an array index.
+ */
+#define _MASK                           (CB_ARRAY_SIZE - 1)
+#endif
 
 /****************************************************************************
  *  Typedefs and Structures
@@ -71,6 +77,25 @@ uint8 cb_add_new(CB_LIST *buffer, uint16 tag, void *object)
     
     if (buffer != NULL && object != NULL)
     {
+#ifdef CB_ARRAY_SIZE
+        if ((buffer->limit != 0) &&
+            (buffer->write - buffer->read >= buffer->limit))
+        {
+            ++buffer->read;
+        }
+        else if (buffer->write - buffer->read >= CB_ARRAY_SIZE)
+        {
+            result = CB_FULL;
+        }
+        
+        if (result == CB_SUCCESS)
+        {
+            buffer->nodes[buffer->write & _MASK].tag = tag;
+            buffer->nodes[buffer->write & _MASK].object = object;
+            
+            ++buffer->write;
+        }
+#else
         if (buffer->list == NULL)
         {
             CL_LIST *list = malloc(sizeof(*list));
@@ -104,6 +129,7 @@ uint8 cb_add_new(CB_LIST *buffer, uint16 tag, void *object)
                 }
             }
         }
+#endif
     }
     else
     {
@@ -119,6 +145,23 @@ uint8 cb_remove_old(CB_LIST *buffer, void **object)
     
     if (buffer != NULL)
     {
+#ifdef CB_ARRAY_SIZE
+        if (buffer->write != buffer->read)
+        {
+            if (object != NULL)
+            {
+                *object = buffer->nodes[buffer->read & _MASK].object;
+            }
+            
+            ++buffer->read;
+            
+            result = CB_SUCCESS;
+        }
+        else
+        {
+            result = CB_EMPTY;
+        }
+#else
         if (buffer->list != NULL)
         {
             cl_move_forward(buffer->list, 1);
@@ -136,6 +179,7 @@ uint8 cb_remove_old(CB_LIST *buffer, void **object)
         {
             result = CB_EMPTY;
         }
+#endif
     }
     
     return result;
@@ -147,6 +191,9 @@ uint8 cb_get_old_object(CB_LIST *buffer, uint16 *tag, void **object)
     
     if (buffer != NULL && object != NULL)
     {
+#ifdef CB_ARRAY_SIZE
+        result = cb_get_object(buffer, 0, tag, object);
+#else
         if (buffer->list != NULL)
         {
             cl_move_forward(buffer->list, 1);
@@ -157,6 +204,7 @@ uint8 cb_get_old_object(CB_LIST *buffer, uint16 *tag, void **object)
         {
             result = CB_EMPTY;
         }
+#endif
     }
     
     return result;
@@ -168,6 +216,10 @@ uint8 cb_get_new_object(CB_LIST *buffer, uint16 *tag, void **object)
     
     if (buffer != NULL && object != NULL)
     {
+#ifdef CB_ARRAY_SIZE
+        result = cb_get_object(buffer, buffer->write - buffer->read - 1, tag,
+            object);
+#else
         if (buffer->list != NULL)
         {
             result = cl_get_current_object(buffer->list, tag, object);
@@ -176,6 +228,42 @@ uint8 cb_get_new_object(CB_LIST *buffer, uint16 *tag, void **object)
         {
             result = CB_EMPTY;
         }
+#endif
+    }
+    
+    return result;
+}
+
+uint8 cb_get_object(CB_LIST *buffer, uint32 index, uint16 *tag,
+    void **object)
+{
+    uint8 result = CB_BAD_ARGUMENT;
+    
+    if (buffer != NULL && object != NULL)
+    {
+        if (cb_get_count(buffer) == 0)
+        {
+            result = CB_EMPTY;
+        }
+        else if (index < cb_get_count(buffer))
+        {
+#ifdef CB_ARRAY_SIZE
+            index = (buffer->read + index) & _MASK;
+            
+            if (tag != NULL)
+            {
+                *tag = buffer->nodes[index].tag;
+            }
+            
+            *object = buffer->nodes[index].object;
+            
+            result = CB_SUCCESS;
+#else
+            cl_move_forward(buffer->list, index + 1);
+            result = cl_get_current_object(buffer->list, tag, object);
+            cl_move_backward(buffer->list, index + 1);
+#endif
+        }
     }
     
     return result;
@@ -187,10 +275,14 @@ uint32 cb_get_count(CB_LIST *buffer)
     
     if (buffer != NULL)
     {
+#ifdef CB_ARRAY_SIZE
+        count = buffer->write - buffer->read;
+#else
         if (buffer->list != NULL)
         {
             count = cl_get_count(buffer->list);
         }
+#endif
     }
     
     return count;
@@ -214,6 +306,19 @@ uint8 cb_set_limit(CB_LIST *buffer, uint32 limit)
     
     if (buffer != NULL)
     {
+#ifdef CB_ARRAY_SIZE
+        if (((cb_get_count(buffer) > limit) && (limit != 0)) ||
+            (limit > CB_ARRAY_SIZE))
+        {
+            result = CB_FAILURE;
+        }
+        else
+        {
+            buffer->limit = limit;
+            
+            result = CB_SUCCESS;
+        }
+#else
         if (buffer->list != NULL)
         {
             if ((buffer->list->count > limit) && (limit != 0))
@@ -233,6 +338,7 @@ uint8 cb_set_limit(CB_LIST *buffer, uint32 limit)
             
             result = CB_SUCCESS;
         }
+#endif
     }
     
     return result;
@@ -244,10 +350,14 @@ uint8 cb_destroy(CB_LIST *buffer)
     
     if (buffer != NULL)
     {
+#ifdef CB_ARRAY_SIZE
+        buffer->read = buffer->write;
+#else
         while (cb_get_count(buffer) > 0)
         {
             cb_remove_old(buffer, NULL);
         }
+#endif
         
         result = CB_SUCCESS;
     }
@@ -88,7 +88,20 @@
  *  whilst cb_get_limit() and cb_set_limit() may be used to get and set the
  *  maximum number of nodes allowed in the buffer respectively. The function
  *  cb_get_count() returns the number of nodes in the circular buffer, and
- *  cb_destroy() deletes all nodes from a buffer.
+ *  cb_destroy() deletes all nodes from a buffer. Any node may be examined
+ *  using the function cb_get_object(), which takes the position of the node
+ *  counting from the oldest.
+ *
+ *  By default, a circular buffer is built upon a CLL, so that each node is
+ *  allocated from the heap by cb_add_new() and returned to the heap by
+ *  cb_remove_old(). If #CB_ARRAY_SIZE is defined, each circular buffer
+ *  instead holds its nodes in an array of #CB_ARRAY_SIZE elements contained
+ *  within the CB_LIST structure itself. Adding and removing nodes then
+ *  requires no calls to the heap, and examining a node by position takes the
+ *  same time regardless of its position. Should a new node be added to an
+ *  array-based circular buffer without a node limit once the array is full,
+ *  cb_add_new() will return #CB_FULL, and a node limit greater than
+ *  #CB_ARRAY_SIZE may not be set.
  *
  *  For further information about these library functions, please refer to the
  *  individual function documentation. For examples of their use, please see
@@ -102,6 +115,9 @@
  *
  *  Circular linked list library (cllist.h)
  *
+ *  <a href = "http://en.wikipedia.org/wiki/Power_of_two">
+ *      Power of two (Wikipedia) </a>
+ *
  *  <a href = "http://en.wikipedia.org/wiki/Circular_buffer">
  *      Circular buffer (Wikipedia) </a>
  */
@@ -114,6 +130,20 @@
 /****************************************************************************
  *  Definitions and Macros
  ****************************************************************************/
+/**
+ *  @brief The number of nodes in an array-based circular buffer.
+ *
+ *  Uncomment this definition in order to build each circular buffer upon an
+ *  array of nodes, rather than a CLL. The value must be a power of two.
+ */
+//#define CB_ARRAY_SIZE                   64
+
+#ifdef CB_ARRAY_SIZE
+#if (CB_ARRAY_SIZE == 0) || ((CB_ARRAY_SIZE & (CB_ARRAY_SIZE - 1)) != 0)
+#error CB_ARRAY_SIZE must be a power of two.
+#endif
+#endif
+
 /**
  *  @brief Generic success.
  */
@@ -142,9 +172,63 @@
  */
 #define CB_EMPTY                        4
 
+/**
+ *  @brief The circular buffer is full.
+ */
+#define CB_FULL                         5
+
 /****************************************************************************
  *  Typedefs and Structures
  ****************************************************************************/
+#ifdef CB_ARRAY_SIZE
+/**
+ *  @brief An array-based circular buffer node.
+ */
+typedef struct CB_NODE
+{
+    /**
+     *  @brief A tag used to identify this node's object type.
+     */
+    uint16 tag;
+    
+    /**
+     *  @brief A pointer to this node's object.
+     */
+    void *object;
+} CB_NODE;
+
+/**
+ *  @brief A circular buffer based upon an array of nodes.
+ */
+typedef struct CB_LIST
+{
+    /**
+     *  @brief The number of nodes ever removed from the circular buffer.
+     *
+     *  Masked with #CB_ARRAY_SIZE - 1, this gives the index of the oldest
+     *  node in the array.
+     */
+    uint32 read;
+    
+    /**
+     *  @brief The number of nodes ever added to the circular buffer.
+     *
+     *  Masked with #CB_ARRAY_SIZE - 1, this gives the index at which the
+     *  next node will be written.
+     */
+    uint32 write;
+    
+    /**
+     *  @brief The array of nodes.
+     */
+    CB_NODE nodes[CB_ARRAY_SIZE];
+    
+    /**
+     *  @brief The maximum number of nodes allowed in the array.
+     */
+    uint32 limit;
+} CB_LIST;
+#else
 /**
  *  @brief A circular buffer based upon a circular linked list (CLL).
  */
@@ -160,6 +244,7 @@ typedef struct CB_LIST
      */
     uint32 limit;
 } CB_LIST;
+#endif
 
 /****************************************************************************
  *  Exported Variables
@@ -173,8 +258,10 @@ typedef struct CB_LIST
  *  @param[in] buffer A pointer to a circular buffer.
  *  @param[in] tag A tag used to identify the new node's object type.
  *  @param[in] object A pointer to the new node's object.
- *  @return #CB_SUCCESS if successful, otherwise #CB_BAD_ARGUMENT or
- *      #CB_NO_MEMORY.
+ *  @return #CB_SUCCESS if successful, otherwise #CB_BAD_ARGUMENT,
+ *      #CB_NO_MEMORY or #CB_FULL.
+ *  @remark #CB_FULL is only returned by an array-based circular buffer
+ *      without a node limit, and #CB_NO_MEMORY only by a CLL-based one.
  *  @warning It is up to the caller to ensure that the buffer argument
  *      points to an actual circular buffer. Passing a pointer to an
  *      uninitialised circular buffer would be a <B> very bad thing. </B>
@@ -225,6 +312,26 @@ uint8 cb_get_old_object(CB_LIST *buffer, uint16 *tag, void **object);
  */
 uint8 cb_get_new_object(CB_LIST *buffer, uint16 *tag, void **object);
 
+/**
+ *  @brief Get the object of any node of a circular buffer.
+ *  @param[in] buffer A pointer to a circular buffer.
+ *  @param[in] index The position of the node, where the oldest node is at
+ *      position zero.
+ *  @param[out] tag A pointer to the returned object's tag.
+ *  @param[out] object A pointer to a pointer to the returned object.
+ *  @return #CB_SUCCESS if successful, otherwise #CB_BAD_ARGUMENT or
+ *      #CB_EMPTY.
+ *  @remark The tag parameter is optional, and may be set to NULL if
+ *      the object's tag is not required.
+ *  @remark An index that is not less than the node count will result in
+ *      this function returning #CB_BAD_ARGUMENT.
+ *  @warning It is up to the caller to ensure that the buffer argument
+ *      points to an actual circular buffer. Passing a pointer to an
+ *      uninitialised circular buffer would be a <B> very bad thing. </B>
+ */
+uint8 cb_get_object(CB_LIST *buffer, uint32 index, uint16 *tag,
+    void **object);
+
 /**
  *  @brief Get the node count of a circular buffer.
  *  @param[in] buffer A pointer to a circular buffer.
@@ -251,6 +358,8 @@ uint32 cb_get_limit(CB_LIST *buffer);
  *  @remark It is up to the caller to ensure that the number of nodes in the
  *      circular buffer is less than the proposed limit. Failure to do so will
  *      result in this function returning #CB_FAILURE.
+ *  @remark A limit greater than #CB_ARRAY_SIZE will also result in this
+ *      function returning #CB_FAILURE when the circular buffer is array-based.
  *  @remark Set the limit to zero to allow the circular buffer to grow without
  *      limit.
  */
@@ -38,6 +38,7 @@
  ****************************************************************************/
 #include <device.h>
 #include <stdlib.h>
+#include <string.h>
 
 #include "cbuff.h"
 #include "cbuff_test.h"
@@ -248,7 +249,7 @@ uint8 cbt_test_1(void)
     
     if (result == CBT_SUCCESS)
     {   
-        if (buffer_1.list->count == 2)
+        if (cb_get_count(&buffer_1) == 2)
         {
             UART_1_PutString("   7\tcb_add_new()\t\tPASS\r\n");
         }
@@ -857,6 +858,410 @@ uint8 cbt_test_1(void)
     return result;
 }
 
+uint8 cbt_test_2(void)
+{
+    CB_LIST buffer_1 = {0};
+    CBT_OBJECT *object_0;
+    CBT_OBJECT *object_1;
+    CBT_OBJECT *object_2;
+    CBT_OBJECT *object_3;
+    uint8 result = CBT_SUCCESS;
+    uint16 tag_0;
+    
+    UART_1_Start();
+    
+    UART_1_PutString("\x1b\x5b\x32\x4a");
+    UART_1_PutString("CIRCULAR BUFFER INDEX TEST\r\n");
+    UART_1_PutString("\r\n");
+    UART_1_PutString("Test\tFunction\t\tResult\r\n");
+    UART_1_PutString("----\t--------\t\t------\r\n");
+    
+    /*
+     *  Initialise test.
+     */
+    if (result == CBT_SUCCESS)
+    {
+        if (_create_object("one", 1, &object_1) == CBT_SUCCESS)
+        {
+            UART_1_PutString("   -\tInitialise test...\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("   -\tInitialise test...\tFAIL\r\n");
+            result = CBT_FAILURE;
+        }
+    }
+    
+    if (result == CBT_SUCCESS)
+    {
+        if (_create_object("two", 2, &object_2) == CBT_SUCCESS)
+        {
+            UART_1_PutString("   -\tInitialise test...\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("   -\tInitialise test...\tFAIL\r\n");
+            result = CBT_FAILURE;
+        }
+    }
+    
+    if (result == CBT_SUCCESS)
+    {
+        if (_create_object("three", 3, &object_3) == CBT_SUCCESS)
+        {
+            UART_1_PutString("   -\tInitialise test...\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("   -\tInitialise test...\tFAIL\r\n");
+            result = CBT_FAILURE;
+        }
+    }
+    
+    /*
+     *  Test cb_get_object().
+     */
+    if (result == CBT_SUCCESS)
+    {
+        if (cb_get_object(NULL, 0, NULL,
+            (void **)&object_0) == CB_BAD_ARGUMENT)
+        {
+            UART_1_PutString("   1\tcb_get_object()\t\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("   1\tcb_get_object()\t\tFAIL\r\n");
+            result = CBT_FAILURE;
+        }
+    }
+    
+    if (result == CBT_SUCCESS)
+    {
+        if (cb_get_object(&buffer_1, 0, NULL, NULL) == CB_BAD_ARGUMENT)
+        {
+            UART_1_PutString("   2\tcb_get_object()\t\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("   2\tcb_get_object()\t\tFAIL\r\n");
+            result = CBT_FAILURE;
+        }
+    }
+    
+    if (result == CBT_SUCCESS)
+    {
+        if (cb_get_object(&buffer_1, 0, NULL,
+            (void **)&object_0) == CB_EMPTY)
+        {
+            UART_1_PutString("   3\tcb_get_object()\t\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("   3\tcb_get_object()\t\tFAIL\r\n");
+            result = CBT_FAILURE;
+        }
+    }
+    
+    if (result == CBT_SUCCESS)
+    {
+        if (cb_add_new(&buffer_1, _TAG, object_1) == CB_SUCCESS)
+        {
+            UART_1_PutString("   -\tInitialise test...\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("   -\tInitialise test...\tFAIL\r\n");
+            result = CBT_FAILURE;
+        }
+    }
+    
+    if (result == CBT_SUCCESS)
+    {
+        if (cb_add_new(&buffer_1, _TAG, object_2) == CB_SUCCESS)
+        {
+            UART_1_PutString("   -\tInitialise test...\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("   -\tInitialise test...\tFAIL\r\n");
+            result = CBT_FAILURE;
+        }
+    }
+    
+    if (result == CBT_SUCCESS)
+    {
+        if (cb_add_new(&buffer_1, _TAG, object_3) == CB_SUCCESS)
+        {
+            UART_1_PutString("   -\tInitialise test...\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("   -\tInitialise test...\tFAIL\r\n");
+            result = CBT_FAILURE;
+        }
+    }
+    
+    if (result == CBT_SUCCESS)
+    {
+        if (cb_get_object(&buffer_1, 0, &tag_0,
+            (void **)&object_0) == CB_SUCCESS)
+        {
+            UART_1_PutString("   4\tcb_get_object()\t\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("   4\tcb_get_object()\t\tFAIL\r\n");
+            result = CBT_FAILURE;
+        }
+    }
+    
+    if (result == CBT_SUCCESS)
+    {
+        if ((object_0 == object_1) && (tag_0 == _TAG))
+        {
+            UART_1_PutString("   5\tcb_get_object()\t\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("   5\tcb_get_object()\t\tFAIL\r\n");
+            result = CBT_FAILURE;
+        }
+    }
+    
+    if (result == CBT_SUCCESS)
+    {
+        if (cb_get_object(&buffer_1, 2, NULL,
+            (void **)&object_0) == CB_SUCCESS)
+        {
+            UART_1_PutString("   6\tcb_get_object()\t\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("   6\tcb_get_object()\t\tFAIL\r\n");
+            result = CBT_FAILURE;
+        }
+    }
+    
+    if (result == CBT_SUCCESS)
+    {
+        if (object_0 == object_3)
+        {
+            UART_1_PutString("   7\tcb_get_object()\t\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("   7\tcb_get_object()\t\tFAIL\r\n");
+            result = CBT_FAILURE;
+        }
+    }
+    
+    if (result == CBT_SUCCESS)
+    {
+        if (cb_get_object(&buffer_1, 3, NULL,
+            (void **)&object_0) == CB_BAD_ARGUMENT)
+        {
+            UART_1_PutString("   8\tcb_get_object()\t\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("   8\tcb_get_object()\t\tFAIL\r\n");
+            result = CBT_FAILURE;
+        }
+    }
+    
+    if (result == CBT_SUCCESS)
+    {
+        cb_remove_old(&buffer_1, NULL);
+        
+        if (cb_get_object(&buffer_1, 0, NULL,
+            (void **)&object_0) == CB_SUCCESS)
+        {
+            UART_1_PutString("   9\tcb_get_object()\t\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("   9\tcb_get_object()\t\tFAIL\r\n");
+            result = CBT_FAILURE;
+        }
+    }
+    
+    if (result == CBT_SUCCESS)
+    {
+        if (object_0 == object_2)
+        {
+            UART_1_PutString("  10\tcb_get_object()\t\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("  10\tcb_get_object()\t\tFAIL\r\n");
+            result = CBT_FAILURE;
+        }
+    }
+    
+#ifdef CB_ARRAY_SIZE
+    /*
+     *  Test array-based circular buffer capacity.
+     */
+    if (result == CBT_SUCCESS)
+    {
+        if (cb_set_limit(&buffer_1, CB_ARRAY_SIZE + 1) == CB_FAILURE)
+        {
+            UART_1_PutString("  11\tcb_set_limit()\t\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("  11\tcb_set_limit()\t\tFAIL\r\n");
+            result = CBT_FAILURE;
+        }
+    }
+    
+    if (result == CBT_SUCCESS)
+    {
+        while (cb_get_count(&buffer_1) < CB_ARRAY_SIZE)
+        {
+            cb_add_new(&buffer_1, _TAG, object_1);
+        }
+        
+        if (cb_add_new(&buffer_1, _TAG, object_1) == CB_FULL)
+        {
+            UART_1_PutString("  12\tcb_add_new()\t\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("  12\tcb_add_new()\t\tFAIL\r\n");
+            result = CBT_FAILURE;
+        }
+    }
+    
+    if (result == CBT_SUCCESS)
+    {
+        if (cb_set_limit(&buffer_1, CB_ARRAY_SIZE) == CB_SUCCESS)
+        {
+            UART_1_PutString("  13\tcb_set_limit()\t\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("  13\tcb_set_limit()\t\tFAIL\r\n");
+            result = CBT_FAILURE;
+        }
+    }
+    
+    if (result == CBT_SUCCESS)
+    {
+        if (cb_add_new(&buffer_1, _TAG, object_2) == CB_SUCCESS)
+        {
+            UART_1_PutString("  14\tcb_add_new()\t\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("  14\tcb_add_new()\t\tFAIL\r\n");
+            result = CBT_FAILURE;
+        }
+    }
+    
+    if (result == CBT_SUCCESS)
+    {
+        if (cb_get_count(&buffer_1) == CB_ARRAY_SIZE)
+        {
+            UART_1_PutString("  15\tcb_add_new()\t\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("  15\tcb_add_new()\t\tFAIL\r\n");
+            result = CBT_FAILURE;
+        }
+    }
+    
+    if (result == CBT_SUCCESS)
+    {
+        if (cb_get_object(&buffer_1, CB_ARRAY_SIZE - 1, NULL,
+            (void **)&object_0) == CB_SUCCESS)
+        {
+            UART_1_PutString("  16\tcb_get_object()\t\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("  16\tcb_get_object()\t\tFAIL\r\n");
+            result = CBT_FAILURE;
+        }
+    }
+    
+    if (result == CBT_SUCCESS)
+    {
+        if (object_0 == object_2)
+        {
+            UART_1_PutString("  17\tcb_get_object()\t\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("  17\tcb_get_object()\t\tFAIL\r\n");
+            result = CBT_FAILURE;
+        }
+    }
+    
+    if (result == CBT_SUCCESS)
+    {
+        if (cb_get_object(&buffer_1, 0, NULL,
+            (void **)&object_0) == CB_SUCCESS)
+        {
+            UART_1_PutString("  18\tcb_get_object()\t\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("  18\tcb_get_object()\t\tFAIL\r\n");
+            result = CBT_FAILURE;
+        }
+    }
+    
+    if (result == CBT_SUCCESS)
+    {
+        if (object_0 == object_3)
+        {
+            UART_1_PutString("  19\tcb_get_object()\t\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("  19\tcb_get_object()\t\tFAIL\r\n");
+            result = CBT_FAILURE;
+        }
+    }
+    
+#endif
+    
+    /*
+     *  Report test result.
+     */
+    if (result == CBT_SUCCESS)
+    {
+        UART_1_PutString("\r\n");
+        UART_1_PutString("TEST PASSED\r\n");
+    }
+    else
+    {
+        UART_1_PutString("\r\n");
+        UART_1_PutString("TEST FAILED\r\n");
+    }
+    
+    /*
+     *  Clean-up test.
+     */
+    cb_destroy(&buffer_1);
+    
+    _destroy_object(object_1);
+    _destroy_object(object_2);
+    _destroy_object(object_3);
+    
+    while ((UART_1_ReadTxStatus() & UART_1_TX_STS_FIFO_EMPTY) !=
+        UART_1_TX_STS_FIFO_EMPTY)
+    {
+        CyDelay(1);
+    }
+    
+    UART_1_Stop();
+    
+    return result;
+}
+
 /****************************************************************************
  *  Local Functions
  ****************************************************************************/
@@ -903,14 +1308,12 @@ void _walk_buffer(CB_LIST *buffer)
     uint32 count;
     CBT_OBJECT *object;
     
-    for (count = 0 ; count < buffer->list->count ; count++)
+    for (count = 0 ; count < cb_get_count(buffer) ; count++)
     {
-        object = (CBT_OBJECT *)buffer->list->list->object;
+        cb_get_object(buffer, count, NULL, (void **)&object);
         
         UART_1_PutString(object->string);
         UART_1_PutString("\r\n");
-        
-        cl_move_forward(buffer->list, 1);
     }
 }
 
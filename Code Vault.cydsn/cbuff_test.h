@@ -36,20 +36,24 @@
  *
  *  <H3> Introduction </H3>
  *
- *  The circular buffer test library contains a single function that tests
- *  each of the functions that comprise the circular buffer library.
- *
- *  This function, cbt_test_1(), provides complete coverage of the circular
- *  buffer library codebase, with one exception. Those circular buffer library
+ *  The circular buffer test library contains two functions that test the
+ *  circular buffer library. The first, cbt_test_1(), tests each of the
+ *  functions that add, remove and examine the oldest and newest nodes, while
+ *  the second, cbt_test_2(), tests the function cb_get_object(). If
+ *  #CB_ARRAY_SIZE is defined, cbt_test_2() also tests the behaviour of a full
+ *  array-based circular buffer.
+ *
+ *  Together, these functions provide complete coverage of the circular buffer
+ *  library codebase, with one exception. Those circular buffer library
  *  functions that call malloc(), either directly or indirectly, have not had
  *  their #CB_NO_MEMORY return value tested.
  *
  *  <H3> Use </H3>
  *
  *  In order to use the library, the programmer must first connect the target
- *  system to a serial terminal configured as 57600 8-N-1. To run the test,
- *  simply call the function cbt_test_1() and observe the serial output, which
- *  should be as follows.
+ *  system to a serial terminal configured as 57600 8-N-1. To run a test,
+ *  simply call the appropriate function and observe the serial output. Running
+ *  cbt_test_1() should produce the following serial output.
  *
  *  @code
  *  CIRCULAR BUFFER LIBRARY TEST
@@ -111,8 +115,47 @@
  *  TEST PASSED
  *  @endcode
  *
- *  Alternatively, if no serial terminal is available, the cbt_test_1() return
- *  value may be checked to see if the test completed successfully or not.
+ *  Running cbt_test_2() with #CB_ARRAY_SIZE defined should produce the
+ *  following serial output. Without #CB_ARRAY_SIZE, tests 11 to 19 are
+ *  omitted.
+ *
+ *  @code
+ *  CIRCULAR BUFFER INDEX TEST
+ *
+ *  Test    Function                Result
+ *  ----    --------                ------
+ *     -    Initialise test...      PASS
+ *     -    Initialise test...      PASS
+ *     -    Initialise test...      PASS
+ *     1    cb_get_object()         PASS
+ *     2    cb_get_object()         PASS
+ *     3    cb_get_object()         PASS
+ *     -    Initialise test...      PASS
+ *     -    Initialise test...      PASS
+ *     -    Initialise test...      PASS
+ *     4    cb_get_object()         PASS
+ *     5    cb_get_object()         PASS
+ *     6    cb_get_object()         PASS
+ *     7    cb_get_object()         PASS
+ *     8    cb_get_object()         PASS
+ *     9    cb_get_object()         PASS
+ *    10    cb_get_object()         PASS
+ *    11    cb_set_limit()          PASS
+ *    12    cb_add_new()            PASS
+ *    13    cb_set_limit()          PASS
+ *    14    cb_add_new()            PASS
+ *    15    cb_add_new()            PASS
+ *    16    cb_get_object()         PASS
+ *    17    cb_get_object()         PASS
+ *    18    cb_get_object()         PASS
+ *    19    cb_get_object()         PASS
+ *
+ *  TEST PASSED
+ *  @endcode
+ *
+ *  Alternatively, if no serial terminal is available, the return value of
+ *  each test function may be checked to see if the test completed
+ *  successfully or not.
  *
  *  <H3> Hardware </H3>
  *
@@ -189,6 +232,12 @@ typedef struct CBT_OBJECT
  */
 uint8 cbt_test_1(void);
 
+/**
+ *  @brief Tests the indexed access functions of the circular buffer library.
+ *  @return #CBT_SUCCESS if successful, otherwise #CBT_FAILURE.
+ */
+uint8 cbt_test_2(void);
+
 #endif
 
 /****************************************************************************
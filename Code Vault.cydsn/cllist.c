@@ -163,7 +163,10 @@ uint8 cl_remove_current(CL_LIST *list, void **object)
                 *object = current_node->object;
             }
             
-            free(current_node);
+            current_node->previous = NULL;
+            current_node->next = NULL;
+            
+            dl_delete(current_node);
             
             --list->count;
             
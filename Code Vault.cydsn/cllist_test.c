@@ -38,6 +38,7 @@
  ****************************************************************************/
 #include <device.h>
 #include <stdlib.h>
+#include <string.h>
 
 #include "cllist.h"
 #include "cllist_test.h"
@@ -37,6 +37,7 @@
  *  Modules
  ****************************************************************************/
 #include <device.h>
+#include <stdlib.h>
 
 #include "deque.h"
 #include "dllist.h"
@@ -44,6 +45,13 @@
 /****************************************************************************
  *  Definitions and Macros
  ****************************************************************************/
+#ifdef DE_RING_SIZE
+/**
+ *  @brief Convert a position within a deque into an index into its ring.
+ */
+#define _INDEX(DEQUE, POSITION) \
+    (((DEQUE)->first + (POSITION)) & ((DEQUE)->size - 1))
+#endif
 
 /****************************************************************************
  *  Typedefs and Structures
@@ -52,6 +60,17 @@
 /****************************************************************************
  *  Prototypes of Local Functions
  ****************************************************************************/
+#ifdef DE_RING_SIZE
+/**
+ *  @brief Ensure that the ring of a deque can hold a number of nodes.
+ *  @param[in] deque A pointer to a deque.
+ *  @param[in] count The number of nodes the ring must hold.
+ *  @return #DE_SUCCESS if successful, otherwise #DE_NO_MEMORY.
+ *  @remark The ring is doubled in size until it can hold the nodes, and
+ *      the nodes of the deque are moved to the start of the new ring.
+ */
+static uint8 _reserve(DE_LIST *deque, uint32 count);
+#endif
 
 /****************************************************************************
  *  Exported Variables
@@ -73,12 +92,25 @@ uint8 de_add_first(DE_LIST *deque, uint16 tag, void *object)
         if ((deque->limit == 0) ||
             (deque->limit > 0 && deque->count < deque->limit))
         {
+#ifdef DE_RING_SIZE
+            result = _reserve(deque, deque->count + 1);
+            
+            if (result == DE_SUCCESS)
+            {
+                deque->first = _INDEX(deque, deque->size - 1);
+                deque->nodes[deque->first].tag = tag;
+                deque->nodes[deque->first].object = object;
+                
+                ++deque->count;
+            }
+#else
             result = dl_add_first(&deque->list, tag, object);
             
             if (result == DL_SUCCESS)
             {
                 ++deque->count;
             }
+#endif
         }
         else
         {
@@ -98,12 +130,24 @@ uint8 de_add_last(DE_LIST *deque, uint16 tag, void *object)
         if ((deque->limit == 0) ||
             (deque->limit > 0 && deque->count < deque->limit))
         {
+#ifdef DE_RING_SIZE
+            result = _reserve(deque, deque->count + 1);
+            
+            if (result == DE_SUCCESS)
+            {
+                deque->nodes[_INDEX(deque, deque->count)].tag = tag;
+                deque->nodes[_INDEX(deque, deque->count)].object = object;
+                
+                ++deque->count;
+            }
+#else
             result = dl_add_last(&deque->list, tag, object);
             
             if (result == DL_SUCCESS)
             {
                 ++deque->count;
             }
+#endif
         }
         else
         {
@@ -116,14 +160,26 @@ uint8 de_add_last(DE_LIST *deque, uint16 tag, void *object)
 
 uint8 de_remove_first(DE_LIST *deque, void **object)
 {
+#ifndef DE_RING_SIZE
     DL_LIST *first_node;
     DL_LIST *next_node;
+#endif
     uint8 result = DE_SUCCESS;
 
     if (deque != NULL)
     {
         if (deque->count > 0)
         {
+#ifdef DE_RING_SIZE
+            if (object != NULL)
+            {
+                *object = deque->nodes[deque->first].object;
+            }
+            
+            deque->first = _INDEX(deque, 1);
+            
+            --deque->count;
+#else
             first_node = dl_get_first(deque->list);
             next_node = dl_get_next(first_node);
             
@@ -140,6 +196,7 @@ uint8 de_remove_first(DE_LIST *deque, void **object)
             
                 --deque->count;
             }
+#endif
         }
         else
         {
@@ -156,14 +213,24 @@ uint8 de_remove_first(DE_LIST *deque, void **object)
 
 uint8 de_remove_last(DE_LIST *deque, void **object)
 {
+#ifndef DE_RING_SIZE
     DL_LIST *last_node;
     DL_LIST *previous_node;
+#endif
     uint8 result = DE_SUCCESS;
 
     if (deque != NULL)
     {
         if (deque->count > 0)
         {
+#ifdef DE_RING_SIZE
+            if (object != NULL)
+            {
+                *object = deque->nodes[_INDEX(deque, deque->count - 1)].object;
+            }
+            
+            --deque->count;
+#else
             last_node = dl_get_last(deque->list);
             previous_node = dl_get_previous(last_node);
             
@@ -180,6 +247,7 @@ uint8 de_remove_last(DE_LIST *deque, void **object)
             
                 --deque->count;
             }
+#endif
         }
         else
         {
@@ -194,6 +262,198 @@ uint8 de_remove_last(DE_LIST *deque, void **object)
     return result;
 }
 
+uint8 de_push_many(DE_LIST *deque, uint16 *tags, void **objects,
+    uint32 count, uint32 *accepted)
+{
+#ifndef DE_RING_SIZE
+    DL_LIST *first_node = NULL;
+    DL_LIST *last_node = NULL;
+#endif
+    uint32 i;
+    uint32 space = count;
+    uint8 result = DE_BAD_ARGUMENT;
+    
+    if (accepted != NULL)
+    {
+        *accepted = 0;
+    }
+    
+    if (deque != NULL && objects != NULL)
+    {
+        result = DE_SUCCESS;
+        
+        for (i = 0 ; i < count && result == DE_SUCCESS ; i++)
+        {
+            if (objects[i] == NULL)
+            {
+                result = DE_BAD_ARGUMENT;
+            }
+        }
+        
+        if (result == DE_SUCCESS && deque->limit > 0 &&
+            deque->limit - deque->count < count)
+        {
+            space = deque->limit - deque->count;
+        }
+        
+#ifdef DE_RING_SIZE
+        /*
+         *  Grow the ring once for all of the new nodes, so that no
+         *  more than one copy is made.
+         */
+        if (result == DE_SUCCESS && space > 0)
+        {
+            result = _reserve(deque, deque->count + space);
+        }
+        
+        if (result == DE_SUCCESS)
+        {
+            for (i = 0 ; i < space ; i++)
+            {
+                deque->nodes[_INDEX(deque, deque->count)].tag =
+                    tags != NULL ? tags[i] : 0;
+                deque->nodes[_INDEX(deque, deque->count)].object =
+                    objects[i];
+                
+                ++deque->count;
+            }
+            
+            if (accepted != NULL)
+            {
+                *accepted = space;
+            }
+            
+            if (space < count)
+            {
+                result = DE_FULL;
+            }
+        }
+#else
+        /*
+         *  Build the new nodes into a separate DLL, keeping track of its
+         *  last node so that the DLL is never walked.
+         */
+        for (i = 0 ; i < space && result == DE_SUCCESS ; i++)
+        {
+            result = dl_add_after(&last_node, tags != NULL ? tags[i] : 0,
+                objects[i]);
+            
+            if (result == DL_SUCCESS)
+            {
+                if (first_node == NULL)
+                {
+                    first_node = last_node;
+                }
+                else
+                {
+                    last_node = dl_get_next(last_node);
+                }
+            }
+        }
+        
+        if (result == DE_SUCCESS)
+        {
+            if (first_node != NULL)
+            {
+                if (deque->list == NULL)
+                {
+                    deque->list = first_node;
+                }
+                else
+                {
+                    dl_join(deque->list, first_node);
+                }
+                
+                deque->count += space;
+            }
+            
+            if (accepted != NULL)
+            {
+                *accepted = space;
+            }
+            
+            if (space < count)
+            {
+                result = DE_FULL;
+            }
+        }
+        else
+        {
+            dl_destroy(&first_node);
+        }
+#endif
+    }
+    
+    return result;
+}
+
+uint8 de_pop_many(DE_LIST *deque, void **objects, uint32 count,
+    uint32 *removed)
+{
+#ifndef DE_RING_SIZE
+    DL_LIST *first_node;
+    DL_LIST *next_node;
+#endif
+    uint32 i = 0;
+    uint8 result = DE_BAD_ARGUMENT;
+    
+    if (deque != NULL)
+    {
+        if (count > 0 && deque->count > 0)
+        {
+#ifdef DE_RING_SIZE
+            while (i < count && deque->count > 0)
+            {
+                if (objects != NULL)
+                {
+                    objects[i] = deque->nodes[deque->first].object;
+                }
+                
+                deque->first = _INDEX(deque, 1);
+                --deque->count;
+                ++i;
+            }
+#else
+            first_node = dl_get_first(deque->list);
+            
+            while (i < count && deque->count > 0)
+            {
+                next_node = dl_get_next(first_node);
+                
+                if (objects != NULL)
+                {
+                    dl_get_object(first_node, NULL, &objects[i]);
+                }
+                
+                dl_delete(first_node);
+                
+                first_node = next_node;
+                --deque->count;
+                ++i;
+            }
+            
+            deque->list = first_node;
+#endif
+        }
+        
+        if (i < count)
+        {
+            result = DE_EMPTY;
+        }
+        else
+        {
+            result = DE_SUCCESS;
+        }
+    }
+    
+    if (removed != NULL)
+    {
+        *removed = i;
+    }
+    
+    return result;
+}
+
 uint8 de_get_first_object(DE_LIST *deque, uint16 *tag, void **object)
 {
     uint8 result = DE_BAD_ARGUMENT;
@@ -202,7 +462,11 @@ uint8 de_get_first_object(DE_LIST *deque, uint16 *tag, void **object)
     {
         if (deque->count > 0)
         {
+#ifdef DE_RING_SIZE
+            result = de_get_object(deque, 0, tag, object);
+#else
             result = dl_get_object(dl_get_first(deque->list), tag, object);
+#endif
         }
         else
         {
@@ -221,7 +485,11 @@ uint8 de_get_last_object(DE_LIST *deque, uint16 *tag, void **object)
     {
         if (deque->count > 0)
         {
+#ifdef DE_RING_SIZE
+            result = de_get_object(deque, deque->count - 1, tag, object);
+#else
             result = dl_get_object(dl_get_last(deque->list), tag, object);
+#endif
         }
         else
         {
@@ -232,6 +500,50 @@ uint8 de_get_last_object(DE_LIST *deque, uint16 *tag, void **object)
     return result;
 }
 
+uint8 de_get_object(DE_LIST *deque, uint32 index, uint16 *tag,
+    void **object)
+{
+#ifndef DE_RING_SIZE
+    DL_LIST *node;
+    uint32 i;
+#endif
+    uint8 result = DE_BAD_ARGUMENT;
+    
+    if (deque != NULL && object != NULL)
+    {
+        if (deque->count == 0)
+        {
+            result = DE_EMPTY;
+        }
+        else if (index < deque->count)
+        {
+#ifdef DE_RING_SIZE
+            index = _INDEX(deque, index);
+            
+            if (tag != NULL)
+            {
+                *tag = deque->nodes[index].tag;
+            }
+            
+            *object = deque->nodes[index].object;
+            
+            result = DE_SUCCESS;
+#else
+            node = dl_get_first(deque->list);
+            
+            for (i = 0 ; i < index ; i++)
+            {
+                node = dl_get_next(node);
+            }
+            
+            result = dl_get_object(node, tag, object);
+#endif
+        }
+    }
+    
+    return result;
+}
+
 uint32 de_get_count(DE_LIST *deque)
 {
     uint32 count = 0;
@@ -283,10 +595,19 @@ uint8 de_destroy(DE_LIST *deque)
     
     if (deque != NULL)
     {
+#ifdef DE_RING_SIZE
+        free(deque->nodes);
+        
+        deque->nodes = NULL;
+        deque->size = 0;
+        deque->first = 0;
+        deque->count = 0;
+#else
         while (de_get_count(deque) > 0)
         {
             de_remove_first(deque, NULL);
         }
+#endif
         
         result = DE_SUCCESS;
     }
@@ -297,6 +618,50 @@ uint8 de_destroy(DE_LIST *deque)
 /****************************************************************************
  *  Local Functions
  ****************************************************************************/
+#ifdef DE_RING_SIZE
+uint8 _reserve(DE_LIST *deque, uint32 count)
+{
+    DE_NODE *nodes;
+    uint32 size = deque->size;
+    uint32 i;
+    uint8 result = DE_SUCCESS;
+    
+    if (size < count)
+    {
+        if (size == 0)
+        {
+            size = DE_RING_SIZE;
+        }
+        
+        while (size < count)
+        {
+            size *= 2;
+        }
+        
+        nodes = malloc(size * sizeof(*nodes));
+        
+        if (nodes != NULL)
+        {
+            for (i = 0 ; i < deque->count ; i++)
+            {
+                nodes[i] = deque->nodes[_INDEX(deque, i)];
+            }
+            
+            free(deque->nodes);
+            
+            deque->nodes = nodes;
+            deque->size = size;
+            deque->first = 0;
+        }
+        else
+        {
+            result = DE_NO_MEMORY;
+        }
+    }
+    
+    return result;
+}
+#endif
 
 /****************************************************************************
  *  End of File
@@ -88,12 +88,34 @@
  *  removed from the deque using the functions de_remove_first() and
  *  de_remove_last().
  *
+ *  Where many objects are to be passed through the deque at once, the
+ *  functions de_push_many() and de_pop_many() may be used instead. These
+ *  add objects to the rear of the deque and remove them from the front
+ *  respectively, taking an array of objects, validating their arguments
+ *  once, and reporting the number of objects actually added or removed.
+ *  de_push_many() builds the new nodes into a separate DLL, which is then
+ *  joined to the rear of the deque in a single operation.
+ *
  *  The functions de_get_first_object() and de_get_last_object() may be used
  *  to examine an object without removing its node from the deque, whilst
  *  de_get_limit() and de_set_limit() may be used to get and set the maximum
  *  number of nodes allowed in the deque respectively. The library function
  *  de_get_count() returns the number of nodes in the deque, and de_destroy()
- *  deletes all nodes from a deque.
+ *  deletes all nodes from a deque. Any node may be examined using the
+ *  function de_get_object(), which takes the position of the node counting
+ *  from the front of the deque.
+ *
+ *  By default, a deque is built upon a DLL, so that each node is allocated
+ *  from the heap when it is added and returned to the heap when it is
+ *  removed. If #DE_RING_SIZE is defined, each deque instead holds its nodes
+ *  in a ring - a single array allocated from the heap, in which the front
+ *  of the deque may lie at any position. Nodes are then added and removed at
+ *  either end without calls to the heap, and examining a node by position
+ *  takes the same time regardless of its position. Should the ring be full
+ *  when a node is added, it is replaced by a ring of twice the size and the
+ *  nodes copied across, so that the cost of growing the ring is spread over
+ *  the nodes that filled it. The ring never shrinks, but is returned to the
+ *  heap by de_destroy().
  *
  *  For further information about these library functions, please refer to the
  *  individual function documentation. For examples of their use, please see
@@ -110,6 +132,9 @@
  *  <a href = "http://en.wikipedia.org/wiki/Double-ended_queue">
  *      Double-ended queue (Wikipedia) </a>
  *
+ *  <a href = "http://en.wikipedia.org/wiki/Dynamic_array">
+ *      Dynamic array (Wikipedia) </a>
+ *
  *  <a href = "http://www.amazon.com/
  *      C-Unleashed-Richard-Heathfield/dp/0672318962">
  *      C Unleashed (Amazon) </a>
@@ -123,6 +148,20 @@
 /****************************************************************************
  *  Definitions and Macros
  ****************************************************************************/
+/**
+ *  @brief The initial number of nodes in a ring-based deque.
+ *
+ *  Uncomment this definition in order to build each deque upon a growable
+ *  ring of nodes, rather than a DLL. The value must be a power of two.
+ */
+//#define DE_RING_SIZE                    8
+
+#ifdef DE_RING_SIZE
+#if (DE_RING_SIZE == 0) || ((DE_RING_SIZE & (DE_RING_SIZE - 1)) != 0)
+#error DE_RING_SIZE must be a power of two.
+#endif
+#endif
+
 /**
  *  @brief Generic success.
  */
@@ -159,6 +198,54 @@
 /****************************************************************************
  *  Typedefs and Structures
  ****************************************************************************/
+#ifdef DE_RING_SIZE
+/**
+ *  @brief A ring-based deque node.
+ */
+typedef struct DE_NODE
+{
+    /**
+     *  @brief A tag used to identify this node's object type.
+     */
+    uint16 tag;
+    
+    /**
+     *  @brief A pointer to this node's object.
+     */
+    void *object;
+} DE_NODE;
+
+/**
+ *  @brief A deque based upon a ring of nodes.
+ */
+typedef struct DE_LIST
+{
+    /**
+     *  @brief A pointer to the ring of nodes.
+     */
+    DE_NODE *nodes;
+    
+    /**
+     *  @brief The number of nodes in the ring.
+     */
+    uint32 size;
+    
+    /**
+     *  @brief The position in the ring of the first node of the deque.
+     */
+    uint32 first;
+    
+    /**
+     *  @brief The number of nodes in the deque.
+     */
+    uint32 count;
+    
+    /**
+     *  @brief The maximum number of nodes allowed in the deque.
+     */
+    uint32 limit;
+} DE_LIST;
+#else
 /**
  *  @brief A deque based upon a doubly linked list (DLL).
  */
@@ -179,6 +266,7 @@ typedef struct DE_LIST
      */
     uint32 limit;
 } DE_LIST;
+#endif
 
 /****************************************************************************
  *  Exported Variables
@@ -241,6 +329,52 @@ uint8 de_remove_first(DE_LIST *deque, void **object);
  */
 uint8 de_remove_last(DE_LIST *deque, void **object);
 
+/**
+ *  @brief Add many new nodes to a deque in last place.
+ *  @param[in] deque A pointer to a deque.
+ *  @param[in] tags A pointer to an array of tags, one per object.
+ *  @param[in] objects A pointer to an array of pointers to the new nodes'
+ *      objects.
+ *  @param[in] count The number of objects in the array.
+ *  @param[out] accepted A pointer to the returned number of objects added.
+ *  @return #DE_SUCCESS if every object was added, otherwise
+ *      #DE_BAD_ARGUMENT, #DE_NO_MEMORY, or #DE_FULL.
+ *  @remark Objects are added in array order, so that objects[0] will be
+ *      nearest the front of the deque. If the deque's node limit does not
+ *      allow every object to be added, as many as possible are added and
+ *      #DE_FULL is returned.
+ *  @remark The tags and accepted parameters are optional, and may be set
+ *      to NULL. If the tags parameter is NULL, every new node is given a
+ *      tag of zero.
+ *  @remark If any of the objects is NULL, no objects are added and
+ *      #DE_BAD_ARGUMENT is returned.
+ *  @warning It is up to the caller to ensure that the deque argument
+ *      points to an actual deque. Passing a pointer to an uninitialised
+ *      deque would be a <B> very bad thing. </B>
+ */
+uint8 de_push_many(DE_LIST *deque, uint16 *tags, void **objects,
+    uint32 count, uint32 *accepted);
+
+/**
+ *  @brief Remove many nodes from the front of a deque.
+ *  @param[in] deque A pointer to a deque.
+ *  @param[out] objects A pointer to an array of pointers to the returned
+ *      objects.
+ *  @param[in] count The number of nodes to remove.
+ *  @param[out] removed A pointer to the returned number of nodes removed.
+ *  @return #DE_SUCCESS if count nodes were removed, otherwise
+ *      #DE_BAD_ARGUMENT or #DE_EMPTY.
+ *  @remark If the deque holds fewer than count nodes, every node is
+ *      removed and #DE_EMPTY is returned.
+ *  @remark The objects and removed parameters are optional, and may be set
+ *      to NULL if not required.
+ *  @warning It is up to the caller to ensure that the objects array holds
+ *      at least count elements. Doing otherwise would be a <B> very bad
+ *      thing. </B>
+ */
+uint8 de_pop_many(DE_LIST *deque, void **objects, uint32 count,
+    uint32 *removed);
+
 /**
  *  @brief Get the object of the first node of a deque.
  *  @param[in] deque A pointer to a deque.
@@ -275,6 +409,26 @@ uint8 de_get_first_object(DE_LIST *deque, uint16 *tag, void **object);
  */
 uint8 de_get_last_object(DE_LIST *deque, uint16 *tag, void **object);
 
+/**
+ *  @brief Get the object of any node of a deque.
+ *  @param[in] deque A pointer to a deque.
+ *  @param[in] index The position of the node, where zero is the first node.
+ *  @param[out] tag A pointer to the returned object's tag.
+ *  @param[out] object A pointer to a pointer to the returned object.
+ *  @return #DE_SUCCESS if successful, otherwise #DE_BAD_ARGUMENT or
+ *      #DE_EMPTY.
+ *  @remark This function does not remove the object from the node,
+ *      nor does it remove the node from the deque.
+ *  @remark The tag parameter is optional, and may be set to NULL if
+ *      the object's tag is not required.
+ *  @remark If the index argument is not less than the number of nodes in
+ *      the deque, #DE_BAD_ARGUMENT will be returned.
+ *  @remark Takes constant time if #DE_RING_SIZE is defined. Otherwise, the
+ *      deque is walked from its first node.
+ */
+uint8 de_get_object(DE_LIST *deque, uint32 index, uint16 *tag,
+    void **object);
+
 /**
  *  @brief Get the node count of a deque.
  *  @param[in] deque A pointer to a deque.
@@ -309,7 +463,8 @@ uint8 de_set_limit(DE_LIST *deque, uint32 limit);
  *  @param[in] deque A pointer to a deque.
  *  @return #DE_SUCCESS if successful, otherwise #DE_BAD_ARGUMENT.
  *  @remark Deletes all nodes from the deque, and sets the node
- *      count to zero.
+ *      count to zero. If #DE_RING_SIZE is defined, the ring is also
+ *      returned to the heap.
  *  @warning It is up to the caller to ensure that the deque argument
  *      points to an actual deque. Passing a pointer to an uninitialised
  *      deque would be a <B> very bad thing. </B>
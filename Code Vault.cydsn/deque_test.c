@@ -38,6 +38,7 @@
  ****************************************************************************/
 #include <device.h>
 #include <stdlib.h>
+#include <string.h>
 
 #include "deque.h"
 #include "deque_test.h"
@@ -1037,6 +1038,823 @@ uint8 det_test_1(void)
     return result;
 }
 
+uint8 det_test_2(void)
+{
+    DE_LIST deque_1 = {0};
+    DET_OBJECT *object_0;
+    DET_OBJECT *object_1;
+    DET_OBJECT *object_2;
+    DET_OBJECT *object_3;
+    void *object;
+    void *objects[4];
+    void *bad_objects[2] = {NULL};
+    void *returned[4] = {NULL};
+    uint16 tags[4] = {_TAG, _TAG + 1, _TAG + 2, _TAG + 3};
+    uint32 accepted = 0;
+    uint32 removed = 0;
+    uint8 result = DET_SUCCESS;
+    uint16 tag_0;
+
+    UART_1_Start();
+    
+    UART_1_PutString("\x1b\x5b\x32\x4a");
+    UART_1_PutString("DEQUE BATCH TEST\r\n");
+    UART_1_PutString("\r\n");
+    UART_1_PutString("Test\tFunction\t\tResult\r\n");
+    UART_1_PutString("----\t--------\t\t------\r\n");
+    
+    /*
+     *  Initialise de_push_many() test.
+     */
+    if (result == DET_SUCCESS)
+    {
+        if (_create_object("zero", 0, &object_0) == DET_SUCCESS)
+        {
+            objects[0] = object_0;
+            
+            UART_1_PutString("   -\tInitialise test...\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("   -\tInitialise test...\tFAIL\r\n");
+            result = DET_FAILURE;
+        }
+    }
+    
+    if (result == DET_SUCCESS)
+    {
+        if (_create_object("one", 1, &object_1) == DET_SUCCESS)
+        {
+            objects[1] = object_1;
+            
+            UART_1_PutString("   -\tInitialise test...\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("   -\tInitialise test...\tFAIL\r\n");
+            result = DET_FAILURE;
+        }
+    }
+    
+    if (result == DET_SUCCESS)
+    {
+        if (_create_object("two", 2, &object_2) == DET_SUCCESS)
+        {
+            objects[2] = object_2;
+            
+            UART_1_PutString("   -\tInitialise test...\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("   -\tInitialise test...\tFAIL\r\n");
+            result = DET_FAILURE;
+        }
+    }
+    
+    if (result == DET_SUCCESS)
+    {
+        if (_create_object("three", 3, &object_3) == DET_SUCCESS)
+        {
+            objects[3] = object_3;
+            
+            UART_1_PutString("   -\tInitialise test...\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("   -\tInitialise test...\tFAIL\r\n");
+            result = DET_FAILURE;
+        }
+    }
+    
+    /*
+     *  Test de_push_many().
+     */
+    if (result == DET_SUCCESS)
+    {
+        if (de_push_many(NULL, tags, objects, 4, &accepted) == DE_BAD_ARGUMENT)
+        {
+            UART_1_PutString("   1\tde_push_many()\t\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("   1\tde_push_many()\t\tFAIL\r\n");
+            result = DET_FAILURE;
+        }
+    }
+    
+    if (result == DET_SUCCESS)
+    {
+        if (de_push_many(&deque_1, tags, NULL, 4, &accepted) == DE_BAD_ARGUMENT)
+        {
+            UART_1_PutString("   2\tde_push_many()\t\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("   2\tde_push_many()\t\tFAIL\r\n");
+            result = DET_FAILURE;
+        }
+    }
+    
+    if (result == DET_SUCCESS)
+    {
+        bad_objects[0] = object_0;
+        
+        if (de_push_many(&deque_1, tags, bad_objects, 2, &accepted) ==
+            DE_BAD_ARGUMENT)
+        {
+            UART_1_PutString("   3\tde_push_many()\t\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("   3\tde_push_many()\t\tFAIL\r\n");
+            result = DET_FAILURE;
+        }
+    }
+    
+    if (result == DET_SUCCESS)
+    {
+        if ((accepted == 0) && (deque_1.count == 0))
+        {
+            UART_1_PutString("   4\tde_push_many()\t\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("   4\tde_push_many()\t\tFAIL\r\n");
+            result = DET_FAILURE;
+        }
+    }
+    
+    if (result == DET_SUCCESS)
+    {
+        if (de_push_many(&deque_1, tags, objects, 2, &accepted) == DE_SUCCESS)
+        {
+            UART_1_PutString("   5\tde_push_many()\t\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("   5\tde_push_many()\t\tFAIL\r\n");
+            result = DET_FAILURE;
+        }
+    }
+    
+    if (result == DET_SUCCESS)
+    {
+        if ((accepted == 2) && (deque_1.count == 2))
+        {
+            UART_1_PutString("   6\tde_push_many()\t\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("   6\tde_push_many()\t\tFAIL\r\n");
+            result = DET_FAILURE;
+        }
+    }
+    
+    if (result == DET_SUCCESS)
+    {
+        if (de_push_many(&deque_1, NULL, &objects[2], 2, NULL) == DE_SUCCESS)
+        {
+            UART_1_PutString("   7\tde_push_many()\t\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("   7\tde_push_many()\t\tFAIL\r\n");
+            result = DET_FAILURE;
+        }
+    }
+    
+    if (result == DET_SUCCESS)
+    {
+        de_get_first_object(&deque_1, &tag_0, &object);
+        
+        if ((tag_0 == _TAG) && (object == object_0))
+        {
+            UART_1_PutString("   8\tde_push_many()\t\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("   8\tde_push_many()\t\tFAIL\r\n");
+            result = DET_FAILURE;
+        }
+    }
+    
+    if (result == DET_SUCCESS)
+    {
+        de_get_last_object(&deque_1, &tag_0, &object);
+        
+        if ((tag_0 == 0) && (object == object_3) && (deque_1.count == 4))
+        {
+            UART_1_PutString("   9\tde_push_many()\t\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("   9\tde_push_many()\t\tFAIL\r\n");
+            result = DET_FAILURE;
+        }
+    }
+    
+    if (result == DET_SUCCESS)
+    {
+        deque_1.limit = 5;
+        
+        if (de_push_many(&deque_1, tags, objects, 4, &accepted) == DE_FULL)
+        {
+            UART_1_PutString("  10\tde_push_many()\t\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("  10\tde_push_many()\t\tFAIL\r\n");
+            result = DET_FAILURE;
+        }
+    }
+    
+    if (result == DET_SUCCESS)
+    {
+        if ((accepted == 1) && (deque_1.count == 5))
+        {
+            UART_1_PutString("  11\tde_push_many()\t\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("  11\tde_push_many()\t\tFAIL\r\n");
+            result = DET_FAILURE;
+        }
+    }
+    
+    if (result == DET_SUCCESS)
+    {
+        accepted = 1;
+        
+        if (de_push_many(&deque_1, NULL, objects, 0, &accepted) == DE_SUCCESS)
+        {
+            UART_1_PutString("  12\tde_push_many()\t\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("  12\tde_push_many()\t\tFAIL\r\n");
+            result = DET_FAILURE;
+        }
+    }
+    
+    if (result == DET_SUCCESS)
+    {
+        if (accepted == 0)
+        {
+            UART_1_PutString("  13\tde_push_many()\t\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("  13\tde_push_many()\t\tFAIL\r\n");
+            result = DET_FAILURE;
+        }
+    }
+    
+    /*
+     *  Test de_pop_many().
+     */
+    if (result == DET_SUCCESS)
+    {
+        removed = 1;
+        
+        if ((de_pop_many(NULL, returned, 3, &removed) == DE_BAD_ARGUMENT) &&
+            (removed == 0))
+        {
+            UART_1_PutString("  14\tde_pop_many()\t\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("  14\tde_pop_many()\t\tFAIL\r\n");
+            result = DET_FAILURE;
+        }
+    }
+    
+    if (result == DET_SUCCESS)
+    {
+        if (de_pop_many(&deque_1, returned, 3, &removed) == DE_SUCCESS)
+        {
+            UART_1_PutString("  15\tde_pop_many()\t\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("  15\tde_pop_many()\t\tFAIL\r\n");
+            result = DET_FAILURE;
+        }
+    }
+    
+    if (result == DET_SUCCESS)
+    {
+        if ((removed == 3) &&
+            (returned[0] == object_0) &&
+            (returned[1] == object_1) &&
+            (returned[2] == object_2))
+        {
+            UART_1_PutString("  16\tde_pop_many()\t\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("  16\tde_pop_many()\t\tFAIL\r\n");
+            result = DET_FAILURE;
+        }
+    }
+    
+    if (result == DET_SUCCESS)
+    {
+        de_remove_last(&deque_1, &object);
+        
+        if ((object == object_0) && (deque_1.count == 1))
+        {
+            UART_1_PutString("  17\tde_pop_many()\t\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("  17\tde_pop_many()\t\tFAIL\r\n");
+            result = DET_FAILURE;
+        }
+    }
+    
+    if (result == DET_SUCCESS)
+    {
+        if (de_pop_many(&deque_1, returned, 3, &removed) == DE_EMPTY)
+        {
+            UART_1_PutString("  18\tde_pop_many()\t\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("  18\tde_pop_many()\t\tFAIL\r\n");
+            result = DET_FAILURE;
+        }
+    }
+    
+    if (result == DET_SUCCESS)
+    {
+        if ((removed == 1) &&
+            (returned[0] == object_3) &&
+            (deque_1.count == 0) &&
+            (de_get_first_object(&deque_1, NULL, &object) == DE_EMPTY))
+        {
+            UART_1_PutString("  19\tde_pop_many()\t\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("  19\tde_pop_many()\t\tFAIL\r\n");
+            result = DET_FAILURE;
+        }
+    }
+    
+    if (result == DET_SUCCESS)
+    {
+        if (de_pop_many(&deque_1, NULL, 1, NULL) == DE_EMPTY)
+        {
+            UART_1_PutString("  20\tde_pop_many()\t\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("  20\tde_pop_many()\t\tFAIL\r\n");
+            result = DET_FAILURE;
+        }
+    }
+    
+    if (result == DET_SUCCESS)
+    {
+        de_push_many(&deque_1, NULL, objects, 4, NULL);
+        
+        if ((de_pop_many(&deque_1, NULL, 4, &removed) == DE_SUCCESS) &&
+            (removed == 4) &&
+            (deque_1.count == 0))
+        {
+            UART_1_PutString("  21\tde_pop_many()\t\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("  21\tde_pop_many()\t\tFAIL\r\n");
+            result = DET_FAILURE;
+        }
+    }
+    
+    /*
+     *  Report test result.
+     */
+    if (result == DET_SUCCESS)
+    {
+        UART_1_PutString("\r\n");
+        UART_1_PutString("TEST PASSED\r\n");
+    }
+    else
+    {
+        UART_1_PutString("\r\n");
+        UART_1_PutString("TEST FAILED\r\n");
+    }
+    
+    /*
+     *  Clean-up test.
+     */
+    de_destroy(&deque_1);
+    _destroy_object(object_0);
+    _destroy_object(object_1);
+    _destroy_object(object_2);
+    _destroy_object(object_3);
+    
+    while ((UART_1_ReadTxStatus() & UART_1_TX_STS_FIFO_EMPTY) !=
+        UART_1_TX_STS_FIFO_EMPTY)
+    {
+        CyDelay(1);
+    }
+    
+    UART_1_Stop();
+    
+    return result;
+}
+
+uint8 det_test_3(void)
+{
+    DE_LIST deque_1 = {0};
+    DET_OBJECT *object_0;
+    DET_OBJECT *object_1;
+    DET_OBJECT *object_2;
+    DET_OBJECT *object_3;
+    void *object;
+    uint32 i;
+    uint8 result = DET_SUCCESS;
+    uint16 tag_0;
+
+    UART_1_Start();
+    
+    UART_1_PutString("\x1b\x5b\x32\x4a");
+    UART_1_PutString("DEQUE INDEX TEST\r\n");
+    UART_1_PutString("\r\n");
+    UART_1_PutString("Test\tFunction\t\tResult\r\n");
+    UART_1_PutString("----\t--------\t\t------\r\n");
+    
+    /*
+     *  Initialise de_get_object() test.
+     */
+    if (result == DET_SUCCESS)
+    {
+        if (_create_object("zero", 0, &object_0) == DET_SUCCESS)
+        {
+            UART_1_PutString("   -\tInitialise test...\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("   -\tInitialise test...\tFAIL\r\n");
+            result = DET_FAILURE;
+        }
+    }
+    
+    if (result == DET_SUCCESS)
+    {
+        if (_create_object("one", 1, &object_1) == DET_SUCCESS)
+        {
+            UART_1_PutString("   -\tInitialise test...\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("   -\tInitialise test...\tFAIL\r\n");
+            result = DET_FAILURE;
+        }
+    }
+    
+    if (result == DET_SUCCESS)
+    {
+        if (_create_object("two", 2, &object_2) == DET_SUCCESS)
+        {
+            UART_1_PutString("   -\tInitialise test...\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("   -\tInitialise test...\tFAIL\r\n");
+            result = DET_FAILURE;
+        }
+    }
+    
+    if (result == DET_SUCCESS)
+    {
+        if (_create_object("three", 3, &object_3) == DET_SUCCESS)
+        {
+            UART_1_PutString("   -\tInitialise test...\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("   -\tInitialise test...\tFAIL\r\n");
+            result = DET_FAILURE;
+        }
+    }
+    
+    /*
+     *  Test de_get_object().
+     */
+    if (result == DET_SUCCESS)
+    {
+        if (de_get_object(NULL, 0, &tag_0, &object) == DE_BAD_ARGUMENT)
+        {
+            UART_1_PutString("   1\tde_get_object()\t\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("   1\tde_get_object()\t\tFAIL\r\n");
+            result = DET_FAILURE;
+        }
+    }
+    
+    if (result == DET_SUCCESS)
+    {
+        if (de_get_object(&deque_1, 0, &tag_0, NULL) == DE_BAD_ARGUMENT)
+        {
+            UART_1_PutString("   2\tde_get_object()\t\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("   2\tde_get_object()\t\tFAIL\r\n");
+            result = DET_FAILURE;
+        }
+    }
+    
+    if (result == DET_SUCCESS)
+    {
+        if (de_get_object(&deque_1, 0, &tag_0, &object) == DE_EMPTY)
+        {
+            UART_1_PutString("   3\tde_get_object()\t\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("   3\tde_get_object()\t\tFAIL\r\n");
+            result = DET_FAILURE;
+        }
+    }
+    
+    if (result == DET_SUCCESS)
+    {
+        de_add_last(&deque_1, _TAG, object_1);
+        de_add_last(&deque_1, _TAG + 1, object_2);
+        de_add_first(&deque_1, _TAG + 2, object_0);
+        
+        if (de_get_object(&deque_1, 0, &tag_0, &object) == DE_SUCCESS)
+        {
+            UART_1_PutString("   4\tde_get_object()\t\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("   4\tde_get_object()\t\tFAIL\r\n");
+            result = DET_FAILURE;
+        }
+    }
+    
+    if (result == DET_SUCCESS)
+    {
+        if ((tag_0 == _TAG + 2) && (object == object_0))
+        {
+            UART_1_PutString("   5\tde_get_object()\t\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("   5\tde_get_object()\t\tFAIL\r\n");
+            result = DET_FAILURE;
+        }
+    }
+    
+    if (result == DET_SUCCESS)
+    {
+        if (de_get_object(&deque_1, 2, NULL, &object) == DE_SUCCESS)
+        {
+            UART_1_PutString("   6\tde_get_object()\t\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("   6\tde_get_object()\t\tFAIL\r\n");
+            result = DET_FAILURE;
+        }
+    }
+    
+    if (result == DET_SUCCESS)
+    {
+        if (object == object_2)
+        {
+            UART_1_PutString("   7\tde_get_object()\t\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("   7\tde_get_object()\t\tFAIL\r\n");
+            result = DET_FAILURE;
+        }
+    }
+    
+    if (result == DET_SUCCESS)
+    {
+        if (de_get_object(&deque_1, 3, &tag_0, &object) == DE_BAD_ARGUMENT)
+        {
+            UART_1_PutString("   8\tde_get_object()\t\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("   8\tde_get_object()\t\tFAIL\r\n");
+            result = DET_FAILURE;
+        }
+    }
+    
+    if (result == DET_SUCCESS)
+    {
+        for (i = 0 ; i < 20 ; i++)
+        {
+            de_add_first(&deque_1, i, object_3);
+        }
+        
+        if (de_get_count(&deque_1) == 23)
+        {
+            UART_1_PutString("   9\tde_get_object()\t\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("   9\tde_get_object()\t\tFAIL\r\n");
+            result = DET_FAILURE;
+        }
+    }
+    
+    if (result == DET_SUCCESS)
+    {
+        if (de_get_object(&deque_1, 0, &tag_0, &object) == DE_SUCCESS)
+        {
+            UART_1_PutString("  10\tde_get_object()\t\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("  10\tde_get_object()\t\tFAIL\r\n");
+            result = DET_FAILURE;
+        }
+    }
+    
+    if (result == DET_SUCCESS)
+    {
+        if ((tag_0 == 19) && (object == object_3))
+        {
+            UART_1_PutString("  11\tde_get_object()\t\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("  11\tde_get_object()\t\tFAIL\r\n");
+            result = DET_FAILURE;
+        }
+    }
+    
+    if (result == DET_SUCCESS)
+    {
+        if (de_get_object(&deque_1, 19, &tag_0, &object) == DE_SUCCESS)
+        {
+            UART_1_PutString("  12\tde_get_object()\t\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("  12\tde_get_object()\t\tFAIL\r\n");
+            result = DET_FAILURE;
+        }
+    }
+    
+    if (result == DET_SUCCESS)
+    {
+        if ((tag_0 == 0) && (object == object_3))
+        {
+            UART_1_PutString("  13\tde_get_object()\t\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("  13\tde_get_object()\t\tFAIL\r\n");
+            result = DET_FAILURE;
+        }
+    }
+    
+    if (result == DET_SUCCESS)
+    {
+        if (de_get_object(&deque_1, 21, &tag_0, &object) == DE_SUCCESS)
+        {
+            UART_1_PutString("  14\tde_get_object()\t\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("  14\tde_get_object()\t\tFAIL\r\n");
+            result = DET_FAILURE;
+        }
+    }
+    
+    if (result == DET_SUCCESS)
+    {
+        if ((tag_0 == _TAG) && (object == object_1))
+        {
+            UART_1_PutString("  15\tde_get_object()\t\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("  15\tde_get_object()\t\tFAIL\r\n");
+            result = DET_FAILURE;
+        }
+    }
+    
+    if (result == DET_SUCCESS)
+    {
+        de_remove_last(&deque_1, NULL);
+        de_pop_many(&deque_1, NULL, 20, NULL);
+        
+        if (de_get_object(&deque_1, 1, &tag_0, &object) == DE_SUCCESS)
+        {
+            UART_1_PutString("  16\tde_get_object()\t\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("  16\tde_get_object()\t\tFAIL\r\n");
+            result = DET_FAILURE;
+        }
+    }
+    
+    if (result == DET_SUCCESS)
+    {
+        if ((tag_0 == _TAG) &&
+            (object == object_1) &&
+            (de_get_count(&deque_1) == 2))
+        {
+            UART_1_PutString("  17\tde_get_object()\t\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("  17\tde_get_object()\t\tFAIL\r\n");
+            result = DET_FAILURE;
+        }
+    }
+    
+    if (result == DET_SUCCESS)
+    {
+        de_destroy(&deque_1);
+        
+        if (de_get_object(&deque_1, 0, &tag_0, &object) == DE_EMPTY)
+        {
+            UART_1_PutString("  18\tde_get_object()\t\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("  18\tde_get_object()\t\tFAIL\r\n");
+            result = DET_FAILURE;
+        }
+    }
+    
+    if (result == DET_SUCCESS)
+    {
+        de_add_last(&deque_1, _TAG, object_3);
+        
+        if (de_get_object(&deque_1, 0, &tag_0, &object) == DE_SUCCESS)
+        {
+            UART_1_PutString("  19\tde_get_object()\t\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("  19\tde_get_object()\t\tFAIL\r\n");
+            result = DET_FAILURE;
+        }
+    }
+    
+    if (result == DET_SUCCESS)
+    {
+        if ((tag_0 == _TAG) && (object == object_3))
+        {
+            UART_1_PutString("  20\tde_get_object()\t\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("  20\tde_get_object()\t\tFAIL\r\n");
+            result = DET_FAILURE;
+        }
+    }
+    
+    /*
+     *  Report test result.
+     */
+    if (result == DET_SUCCESS)
+    {
+        UART_1_PutString("\r\n");
+        UART_1_PutString("TEST PASSED\r\n");
+    }
+    else
+    {
+        UART_1_PutString("\r\n");
+        UART_1_PutString("TEST FAILED\r\n");
+    }
+    
+    /*
+     *  Clean-up test.
+     */
+    de_destroy(&deque_1);
+    _destroy_object(object_0);
+    _destroy_object(object_1);
+    _destroy_object(object_2);
+    _destroy_object(object_3);
+    
+    while ((UART_1_ReadTxStatus() & UART_1_TX_STS_FIFO_EMPTY) !=
+        UART_1_TX_STS_FIFO_EMPTY)
+    {
+        CyDelay(1);
+    }
+    
+    UART_1_Stop();
+    
+    return result;
+}
+
 /****************************************************************************
  *  Local Functions
  ****************************************************************************/
@@ -1080,12 +1898,12 @@ void _destroy_object(DET_OBJECT *object)
 
 void _walk_deque(DE_LIST *deque)
 {
-    DL_LIST *node;
     DET_OBJECT *object;
+    uint32 i;
     
-    for (node = dl_get_first(deque->list) ; node != NULL ; node = node->next)
+    for (i = 0 ; i < de_get_count(deque) ; i++)
     {
-        object = node->object;
+        de_get_object(deque, i, NULL, (void **)&object);
         
         UART_1_PutString(object->string);
         UART_1_PutString("\r\n");
@@ -36,19 +36,25 @@
  *
  *  <H3> Introduction </H3>
  *
- *  The deque test library contains a single function that tests each of the
- *  functions that comprise the deque library.
+ *  The deque test library contains three functions that test the deque
+ *  library. The first, det_test_1(), tests each of the functions that add,
+ *  remove and examine a single node, the second, det_test_2(), tests the
+ *  batch functions de_push_many() and de_pop_many(), and the third,
+ *  det_test_3(), tests de_get_object() as the deque grows and wraps around.
+ *  Each function produces the same output whether or not #DE_RING_SIZE is
+ *  defined.
  *
- *  This function, det_test_1(), provides complete coverage of the deque
+ *  Together, these functions provide complete coverage of the deque
  *  library codebase, with one exception. Those deque library functions that
- *  call dl_create() have not had their #DE_NO_MEMORY return value tested.
+ *  allocate memory from the heap have not had their #DE_NO_MEMORY return
+ *  value tested.
  *
  *  <H3> Use </H3>
  *
  *  In order to use the library, the programmer must first connect the target
- *  system to a serial terminal configured as 57600 8-N-1. To run the test,
- *  simply call the function det_test_1() and observe the serial output, which
- *  should be as follows.
+ *  system to a serial terminal configured as 57600 8-N-1. To run a test,
+ *  simply call the appropriate function and observe the serial output.
+ *  Running det_test_1() should produce the following serial output.
  *
  *  @code
  *  DEQUE LIBRARY TEST
@@ -123,8 +129,80 @@
  *  TEST PASSED
  *  @endcode
  *
- *  Alternatively, if no serial terminal is available, the det_test_1() return
- *  value may be checked to see if the test completed successfully or not.
+ *  Running det_test_2() should produce the following serial output.
+ *
+ *  @code
+ *  DEQUE BATCH TEST
+ *  
+ *  Test    Function                Result
+ *  ----    --------                ------
+ *     -    Initialise test...      PASS
+ *     -    Initialise test...      PASS
+ *     -    Initialise test...      PASS
+ *     -    Initialise test...      PASS
+ *     1    de_push_many()          PASS
+ *     2    de_push_many()          PASS
+ *     3    de_push_many()          PASS
+ *     4    de_push_many()          PASS
+ *     5    de_push_many()          PASS
+ *     6    de_push_many()          PASS
+ *     7    de_push_many()          PASS
+ *     8    de_push_many()          PASS
+ *     9    de_push_many()          PASS
+ *    10    de_push_many()          PASS
+ *    11    de_push_many()          PASS
+ *    12    de_push_many()          PASS
+ *    13    de_push_many()          PASS
+ *    14    de_pop_many()           PASS
+ *    15    de_pop_many()           PASS
+ *    16    de_pop_many()           PASS
+ *    17    de_pop_many()           PASS
+ *    18    de_pop_many()           PASS
+ *    19    de_pop_many()           PASS
+ *    20    de_pop_many()           PASS
+ *    21    de_pop_many()           PASS
+ *  
+ *  TEST PASSED
+ *  @endcode
+ *
+ *  Running det_test_3() should produce the following serial output.
+ *
+ *  @code
+ *  DEQUE INDEX TEST
+ *  
+ *  Test    Function                Result
+ *  ----    --------                ------
+ *     -    Initialise test...      PASS
+ *     -    Initialise test...      PASS
+ *     -    Initialise test...      PASS
+ *     -    Initialise test...      PASS
+ *     1    de_get_object()         PASS
+ *     2    de_get_object()         PASS
+ *     3    de_get_object()         PASS
+ *     4    de_get_object()         PASS
+ *     5    de_get_object()         PASS
+ *     6    de_get_object()         PASS
+ *     7    de_get_object()         PASS
+ *     8    de_get_object()         PASS
+ *     9    de_get_object()         PASS
+ *    10    de_get_object()         PASS
+ *    11    de_get_object()         PASS
+ *    12    de_get_object()         PASS
+ *    13    de_get_object()         PASS
+ *    14    de_get_object()         PASS
+ *    15    de_get_object()         PASS
+ *    16    de_get_object()         PASS
+ *    17    de_get_object()         PASS
+ *    18    de_get_object()         PASS
+ *    19    de_get_object()         PASS
+ *    20    de_get_object()         PASS
+ *  
+ *  TEST PASSED
+ *  @endcode
+ *
+ *  Alternatively, if no serial terminal is available, the return value of
+ *  each test function may be checked to see if the test completed
+ *  successfully or not.
  *
  *  <H3> Hardware </H3>
  *
@@ -201,6 +279,18 @@ typedef struct DET_OBJECT
  */
 uint8 det_test_1(void);
 
+/**
+ *  @brief Tests the batch functions of the deque library.
+ *  @return #DET_SUCCESS if successful, otherwise #DET_FAILURE.
+ */
+uint8 det_test_2(void);
+
+/**
+ *  @brief Tests the indexed access function of the deque library.
+ *  @return #DET_SUCCESS if successful, otherwise #DET_FAILURE.
+ */
+uint8 det_test_3(void);
+
 #endif
 
 /****************************************************************************
@@ -56,6 +56,58 @@
 /****************************************************************************
  *  Prototypes of Local Functions
  ****************************************************************************/
+/**
+ *  @brief Link a node into a DLL before another node.
+ *  @param[in] node A pointer to the DLL node to link before.
+ *  @param[in] new_node A pointer to the DLL node to link.
+ */
+static void _link_before(DL_LIST *node, DL_LIST *new_node);
+
+/**
+ *  @brief Link a node into a DLL after another node.
+ *  @param[in] node A pointer to the DLL node to link after.
+ *  @param[in] new_node A pointer to the DLL node to link.
+ */
+static void _link_after(DL_LIST *node, DL_LIST *new_node);
+
+/**
+ *  @brief Unlink a node from a DLL.
+ *  @param[in] node A pointer to a DLL node.
+ */
+static void _unlink(DL_LIST *node);
+
+/**
+ *  @brief Record a newly-linked node in a DLL head.
+ *  @param[in] head A pointer to a DLL head.
+ *  @param[in] node A pointer to the newly-linked DLL node.
+ */
+static void _attach(DL_HEAD *head, DL_LIST *node);
+
+/**
+ *  @brief Remove a node that is about to be unlinked from a DLL head.
+ *  @param[in] head A pointer to a DLL head.
+ *  @param[in] node A pointer to the DLL node.
+ */
+static void _detach(DL_HEAD *head, DL_LIST *node);
+
+/**
+ *  @brief Update the first and last nodes of a DLL head following the
+ *      exchange of two nodes.
+ *  @param[in] head A pointer to a DLL head.
+ *  @param[in] node_a A pointer to a DLL node.
+ *  @param[in] node_b A pointer to a DLL node.
+ */
+static void _exchange_ends(DL_HEAD *head, DL_LIST *node_a, DL_LIST *node_b);
+
+#ifdef DL_POOL_SIZE
+/**
+ *  @brief Get a DLL node pool, initialising the global pool if necessary.
+ *  @param[in] pool A pointer to a DLL node pool.
+ *  @return The pool argument, or a pointer to the global pool if the pool
+ *      argument is NULL.
+ */
+static DL_POOL *_get_pool(DL_POOL *pool);
+#endif
 
 /****************************************************************************
  *  Exported Variables
@@ -64,12 +116,26 @@
 /****************************************************************************
  *  Global Variables
  ****************************************************************************/
+#ifdef DL_POOL_SIZE
+/**
+ *  @brief The nodes of the global pool.
+ */
+static DL_LIST _nodes[DL_POOL_SIZE];
+
+/**
+ *  @brief The global pool.
+ */
+static DL_POOL _pool;
+#endif
 
 /****************************************************************************
  *  Exported Functions
  ****************************************************************************/
 uint8 dl_create(DL_LIST **node, uint16 tag, void *object)
 {
+#ifdef DL_POOL_SIZE
+    uint8 result = dl_pool_create(NULL, node, tag, object);
+#else
     DL_LIST *new_node;
     uint8 result = DL_BAD_ARGUMENT;
     
@@ -83,6 +149,9 @@ uint8 dl_create(DL_LIST **node, uint16 tag, void *object)
             new_node->next = NULL;
             new_node->tag = tag;
             new_node->object = object;
+#ifdef DL_COUNTED
+            new_node->head = NULL;
+#endif
             
             *node = new_node;
             
@@ -93,6 +162,7 @@ uint8 dl_create(DL_LIST **node, uint16 tag, void *object)
             result = DL_NO_MEMORY;
         }
     }
+#endif
     
     return result;
 }
@@ -103,15 +173,14 @@ uint8 dl_insert_before(DL_LIST *node, DL_LIST *new_node)
     
     if (node != NULL && new_node != NULL)
     {
-        new_node->next = node;
-        new_node->previous = node->previous;
+        _link_before(node, new_node);
+#ifdef DL_COUNTED
         
-        node->previous = new_node;
-
-        if (new_node->previous != NULL)
+        if (node->head != NULL)
         {
-            new_node->previous->next = new_node;
+            _attach(node->head, new_node);
         }
+#endif
         
         result = DL_SUCCESS;
     }
@@ -125,15 +194,14 @@ uint8 dl_insert_after(DL_LIST *node, DL_LIST *new_node)
     
     if (node != NULL && new_node != NULL)
     {
-        new_node->previous = node;
-        new_node->next = node->next;
-        
-        node->next = new_node;
+        _link_after(node, new_node);
+#ifdef DL_COUNTED
         
-        if (new_node->next != NULL)
+        if (node->head != NULL)
         {
-            new_node->next->previous = new_node;
+            _attach(node->head, new_node);
         }
+#endif
         
         result = DL_SUCCESS;
     }
@@ -143,6 +211,13 @@ uint8 dl_insert_after(DL_LIST *node, DL_LIST *new_node)
 
 DL_LIST *dl_get_first(DL_LIST *list)
 {
+#ifdef DL_COUNTED
+    if (list != NULL && list->head != NULL)
+    {
+        list = list->head->first;
+    }
+
+#endif
     if (list != NULL)
     {
         while (list->previous != NULL)
@@ -183,6 +258,13 @@ uint8 dl_add_first(DL_LIST **list, uint16 tag, void *object)
 
 DL_LIST *dl_get_last(DL_LIST *list)
 {
+#ifdef DL_COUNTED
+    if (list != NULL && list->head != NULL)
+    {
+        list = list->head->last;
+    }
+
+#endif
     if (list != NULL)
     {
         while (list->next != NULL)
@@ -297,7 +379,15 @@ uint32 dl_get_count(DL_LIST *list)
     DL_LIST *next_node = list;    
     DL_LIST *previous_node = list;
 
+#ifdef DL_COUNTED
+    if (list != NULL && list->head != NULL)
+    {
+        count = list->head->count;
+    }
+    else if (list != NULL)
+#else
     if (list != NULL)
+#endif
     {
         ++count;
         
@@ -340,18 +430,14 @@ uint8 dl_extract(DL_LIST *node)
     
     if (node != NULL)
     {
-        if (node->previous != NULL)
+#ifdef DL_COUNTED
+        if (node->head != NULL)
         {
-            node->previous->next = node->next;
+            _detach(node->head, node);
         }
         
-        if (node->next != NULL)
-        {
-            node->next->previous = node->previous;
-        }
-        
-        node->previous = NULL;
-        node->next = NULL;
+#endif
+        _unlink(node);
         
         result = DL_SUCCESS;
     }
@@ -365,7 +451,13 @@ uint8 dl_delete(DL_LIST *node)
     
     if (result == DL_SUCCESS)
     {
+#ifdef DL_POOL_SIZE
+        node->next = node->pool->free;
+        node->pool->free = node;
+        --node->pool->used;
+#else
         free(node);
+#endif
     }
     
     return result;
@@ -411,15 +503,53 @@ uint8 dl_destroy(DL_LIST **list)
 
 uint8 dl_join(DL_LIST *list_a, DL_LIST *list_b)
 {
+#ifdef DL_COUNTED
+    DL_HEAD *head_a;
+    DL_HEAD *head_b;
+#endif
     uint8 result = DL_BAD_ARGUMENT;
     
+#ifdef DL_COUNTED
+    if (list_a != NULL && list_b != NULL &&
+        (list_a->head == NULL || list_a->head != list_b->head))
+#else
     if (list_a != NULL && list_b != NULL)
+#endif
     {
         list_a = dl_get_last(list_a);
         list_b = dl_get_first(list_b);
+#ifdef DL_COUNTED
+        
+        head_a = list_a->head;
+        head_b = list_b->head;
+        
+        if (head_b != NULL)
+        {
+            head_b->first = NULL;
+            head_b->last = NULL;
+            head_b->count = 0;
+        }
+#endif
 
         list_a->next = list_b;
         list_b->previous = list_a;
+#ifdef DL_COUNTED
+        
+        if (head_a != NULL || head_b != NULL)
+        {
+            while (list_b != NULL)
+            {
+                list_b->head = NULL;
+                
+                if (head_a != NULL)
+                {
+                    _attach(head_a, list_b);
+                }
+                
+                list_b = list_b->next;
+            }
+        }
+#endif
         
         result = DL_SUCCESS;
     }
@@ -434,18 +564,22 @@ uint8 dl_exchange(DL_LIST *node_a, DL_LIST *node_b)
     DL_LIST *node_1;
     DL_LIST *node_2;
     DL_LIST *node_3;
+#ifdef DL_COUNTED
+    DL_HEAD *head_a;
+    DL_HEAD *head_b;
+#endif
 
     if (node_a != NULL && node_b != NULL)
     {
         if (node_a->next == node_b)
         {
-            dl_extract(node_a);
-            dl_insert_after(node_b, node_a);
+            _unlink(node_a);
+            _link_after(node_b, node_a);
         }
         else if (node_b->next == node_a)
         {
-            dl_extract(node_b);
-            dl_insert_after(node_a, node_b);
+            _unlink(node_b);
+            _link_after(node_a, node_b);
         }
         else
         {
@@ -454,27 +588,45 @@ uint8 dl_exchange(DL_LIST *node_a, DL_LIST *node_b)
             node_2 = node_b->previous;
             node_3 = node_b->next;
 
-            dl_extract(node_a);
-            dl_extract(node_b);
+            _unlink(node_a);
+            _unlink(node_b);
 
             if (node_2 != NULL)
             {
-                dl_insert_after(node_2, node_a);
+                _link_after(node_2, node_a);
             }
-            else
+            else if (node_3 != NULL)
             {
-                dl_insert_before(node_3, node_a);
+                _link_before(node_3, node_a);
             }
 
             if (node_0 != NULL)
             {
-                dl_insert_after(node_0, node_b);
+                _link_after(node_0, node_b);
             }
-            else
+            else if (node_1 != NULL)
             {
-                dl_insert_before(node_1, node_b);
+                _link_before(node_1, node_b);
             }
         }
+#ifdef DL_COUNTED
+        
+        head_a = node_a->head;
+        head_b = node_b->head;
+        
+        if (head_a != NULL)
+        {
+            _exchange_ends(head_a, node_a, node_b);
+        }
+        
+        if (head_b != NULL && head_b != head_a)
+        {
+            _exchange_ends(head_b, node_a, node_b);
+        }
+        
+        node_a->head = head_b;
+        node_b->head = head_a;
+#endif
         
         result = DL_SUCCESS;
     }
@@ -509,9 +661,507 @@ uint8 dl_update(DL_LIST **node, uint16 new_tag, void *new_object)
     return result;
 }
 
+DL_LIST *dl_head_get_first(DL_HEAD *head)
+{
+    DL_LIST *node = NULL;
+    
+    if (head != NULL)
+    {
+        node = head->first;
+    }
+    
+    return node;
+}
+
+DL_LIST *dl_head_get_last(DL_HEAD *head)
+{
+    DL_LIST *node = NULL;
+    
+    if (head != NULL)
+    {
+        node = head->last;
+    }
+    
+    return node;
+}
+
+uint32 dl_head_get_count(DL_HEAD *head)
+{
+    uint32 count = 0;
+    
+    if (head != NULL)
+    {
+        count = head->count;
+    }
+    
+    return count;
+}
+
+uint8 dl_head_add_first(DL_HEAD *head, uint16 tag, void *object)
+{
+    DL_LIST *new_node;
+    uint8 result = DL_BAD_ARGUMENT;
+    
+    if (head != NULL)
+    {
+#ifdef DL_POOL_SIZE
+        result = dl_pool_create(head->pool, &new_node, tag, object);
+#else
+        result = dl_create(&new_node, tag, object);
+#endif
+        
+        if (result == DL_SUCCESS)
+        {
+            result = dl_head_insert_before(head, NULL, new_node);
+        }
+    }
+    
+    return result;
+}
+
+uint8 dl_head_add_last(DL_HEAD *head, uint16 tag, void *object)
+{
+    DL_LIST *new_node;
+    uint8 result = DL_BAD_ARGUMENT;
+    
+    if (head != NULL)
+    {
+#ifdef DL_POOL_SIZE
+        result = dl_pool_create(head->pool, &new_node, tag, object);
+#else
+        result = dl_create(&new_node, tag, object);
+#endif
+        
+        if (result == DL_SUCCESS)
+        {
+            result = dl_head_insert_after(head, NULL, new_node);
+        }
+    }
+    
+    return result;
+}
+
+uint8 dl_head_insert_before(DL_HEAD *head, DL_LIST *node, DL_LIST *new_node)
+{
+    uint8 result = DL_BAD_ARGUMENT;
+    
+    if (head != NULL && new_node != NULL)
+    {
+        if (node == NULL)
+        {
+            node = head->first;
+        }
+        
+        if (node != NULL)
+        {
+            _link_before(node, new_node);
+        }
+        else
+        {
+            new_node->previous = NULL;
+            new_node->next = NULL;
+        }
+        
+        _attach(head, new_node);
+        
+        result = DL_SUCCESS;
+    }
+    
+    return result;
+}
+
+uint8 dl_head_insert_after(DL_HEAD *head, DL_LIST *node, DL_LIST *new_node)
+{
+    uint8 result = DL_BAD_ARGUMENT;
+    
+    if (head != NULL && new_node != NULL)
+    {
+        if (node == NULL)
+        {
+            node = head->last;
+        }
+        
+        if (node != NULL)
+        {
+            _link_after(node, new_node);
+        }
+        else
+        {
+            new_node->previous = NULL;
+            new_node->next = NULL;
+        }
+        
+        _attach(head, new_node);
+        
+        result = DL_SUCCESS;
+    }
+    
+    return result;
+}
+
+uint8 dl_head_extract(DL_HEAD *head, DL_LIST *node)
+{
+    uint8 result = DL_BAD_ARGUMENT;
+    
+    if (head != NULL && node != NULL && head->count > 0)
+    {
+        _detach(head, node);
+        _unlink(node);
+        
+        result = DL_SUCCESS;
+    }
+    
+    return result;
+}
+
+uint8 dl_head_delete(DL_HEAD *head, DL_LIST *node)
+{
+    uint8 result = dl_head_extract(head, node);
+    
+    if (result == DL_SUCCESS)
+    {
+        dl_delete(node);
+    }
+    
+    return result;
+}
+
+uint8 dl_head_destroy(DL_HEAD *head)
+{
+    DL_LIST *this_node;
+    DL_LIST *next_node;
+    uint8 result = DL_BAD_ARGUMENT;
+    
+    if (head != NULL)
+    {
+        next_node = head->first;
+        
+        while (next_node != NULL)
+        {
+            this_node = next_node->next;
+            dl_delete(next_node);
+            next_node = this_node;
+        }
+        
+        head->first = NULL;
+        head->last = NULL;
+        head->count = 0;
+        
+        result = DL_SUCCESS;
+    }
+    
+    return result;
+}
+
+uint8 dl_head_join(DL_HEAD *head_a, DL_HEAD *head_b)
+{
+#ifdef DL_COUNTED
+    DL_LIST *node;
+#endif
+    uint8 result = DL_BAD_ARGUMENT;
+    
+    if (head_a != NULL && head_b != NULL && head_a != head_b)
+    {
+        if (head_b->count > 0)
+        {
+#ifdef DL_COUNTED
+            for (node = head_b->first ; node != NULL ; node = node->next)
+            {
+                node->head = head_a;
+            }
+            
+#endif
+            if (head_a->count > 0)
+            {
+                head_a->last->next = head_b->first;
+                head_b->first->previous = head_a->last;
+            }
+            else
+            {
+                head_a->first = head_b->first;
+            }
+            
+            head_a->last = head_b->last;
+            head_a->count += head_b->count;
+            
+            head_b->first = NULL;
+            head_b->last = NULL;
+            head_b->count = 0;
+        }
+        
+        result = DL_SUCCESS;
+    }
+    
+    return result;
+}
+
+uint8 dl_head_exchange(DL_HEAD *head, DL_LIST *node_a, DL_LIST *node_b)
+{
+    uint8 result = DL_BAD_ARGUMENT;
+    
+    if (head != NULL)
+    {
+        result = dl_exchange(node_a, node_b);
+#ifndef DL_COUNTED
+        
+        if (result == DL_SUCCESS)
+        {
+            _exchange_ends(head, node_a, node_b);
+        }
+#endif
+    }
+    
+    return result;
+}
+
+#ifdef DL_POOL_SIZE
+uint8 dl_pool_init(DL_POOL *pool, DL_LIST *nodes, uint32 size)
+{
+    uint32 index;
+    uint8 result = DL_BAD_ARGUMENT;
+    
+    if (pool != NULL && nodes != NULL && size > 0)
+    {
+        for (index = 0 ; index < size ; index++)
+        {
+            nodes[index].previous = NULL;
+            nodes[index].next = &nodes[index + 1];
+            nodes[index].pool = pool;
+        }
+        
+        nodes[size - 1].next = NULL;
+        
+        pool->free = nodes;
+        pool->size = size;
+        pool->used = 0;
+        pool->high_water = 0;
+        pool->exhausted = 0;
+        
+        result = DL_SUCCESS;
+    }
+    
+    return result;
+}
+
+uint8 dl_pool_create(DL_POOL *pool, DL_LIST **node, uint16 tag,
+    void *object)
+{
+    DL_LIST *new_node;
+    uint8 result = DL_BAD_ARGUMENT;
+    
+    if (object != NULL && node != NULL)
+    {
+        pool = _get_pool(pool);
+        new_node = pool->free;
+        
+        if (new_node != NULL)
+        {
+            pool->free = new_node->next;
+            
+            if (++pool->used > pool->high_water)
+            {
+                pool->high_water = pool->used;
+            }
+            
+            new_node->previous = NULL;
+            new_node->next = NULL;
+            new_node->tag = tag;
+            new_node->object = object;
+#ifdef DL_COUNTED
+            new_node->head = NULL;
+#endif
+            
+            *node = new_node;
+            
+            result = DL_SUCCESS;
+        }
+        else
+        {
+            ++pool->exhausted;
+            
+            result = DL_NO_MEMORY;
+        }
+    }
+    
+    return result;
+}
+
+uint32 dl_pool_get_used(DL_POOL *pool)
+{
+    return _get_pool(pool)->used;
+}
+
+uint32 dl_pool_get_high_water(DL_POOL *pool)
+{
+    return _get_pool(pool)->high_water;
+}
+
+uint32 dl_pool_get_exhausted(DL_POOL *pool)
+{
+    return _get_pool(pool)->exhausted;
+}
+#endif
+
+#ifdef DL_DEBUG
+uint8 dl_head_verify(DL_HEAD *head)
+{
+    DL_LIST *this_node;
+    DL_LIST *previous_node = NULL;
+    uint32 count = 0;
+    uint8 result = DL_BAD_ARGUMENT;
+    
+    if (head != NULL)
+    {
+        result = DL_SUCCESS;
+        this_node = head->first;
+        
+        while (this_node != NULL && count <= head->count)
+        {
+            if (this_node->previous != previous_node)
+            {
+                result = DL_FAILURE;
+            }
+#ifdef DL_COUNTED
+            
+            if (this_node->head != head)
+            {
+                result = DL_FAILURE;
+            }
+#endif
+            
+            ++count;
+            previous_node = this_node;
+            this_node = this_node->next;
+        }
+        
+        if (head->last != previous_node || head->count != count)
+        {
+            result = DL_FAILURE;
+        }
+    }
+    
+    return result;
+}
+#endif
+
 /****************************************************************************
  *  Local Functions
  ****************************************************************************/
+void _link_before(DL_LIST *node, DL_LIST *new_node)
+{
+    new_node->next = node;
+    new_node->previous = node->previous;
+    
+    node->previous = new_node;
+    
+    if (new_node->previous != NULL)
+    {
+        new_node->previous->next = new_node;
+    }
+}
+
+void _link_after(DL_LIST *node, DL_LIST *new_node)
+{
+    new_node->previous = node;
+    new_node->next = node->next;
+    
+    node->next = new_node;
+    
+    if (new_node->next != NULL)
+    {
+        new_node->next->previous = new_node;
+    }
+}
+
+void _unlink(DL_LIST *node)
+{
+    if (node->previous != NULL)
+    {
+        node->previous->next = node->next;
+    }
+    
+    if (node->next != NULL)
+    {
+        node->next->previous = node->previous;
+    }
+    
+    node->previous = NULL;
+    node->next = NULL;
+}
+
+void _attach(DL_HEAD *head, DL_LIST *node)
+{
+    if (node->previous == NULL)
+    {
+        head->first = node;
+    }
+    
+    if (node->next == NULL)
+    {
+        head->last = node;
+    }
+    
+    ++head->count;
+#ifdef DL_COUNTED
+    node->head = head;
+#endif
+}
+
+void _detach(DL_HEAD *head, DL_LIST *node)
+{
+    if (head->first == node)
+    {
+        head->first = node->next;
+    }
+    
+    if (head->last == node)
+    {
+        head->last = node->previous;
+    }
+    
+    --head->count;
+#ifdef DL_COUNTED
+    node->head = NULL;
+#endif
+}
+
+void _exchange_ends(DL_HEAD *head, DL_LIST *node_a, DL_LIST *node_b)
+{
+    if (head->first == node_a)
+    {
+        head->first = node_b;
+    }
+    else if (head->first == node_b)
+    {
+        head->first = node_a;
+    }
+    
+    if (head->last == node_a)
+    {
+        head->last = node_b;
+    }
+    else if (head->last == node_b)
+    {
+        head->last = node_a;
+    }
+}
+
+#ifdef DL_POOL_SIZE
+DL_POOL *_get_pool(DL_POOL *pool)
+{
+    if (pool == NULL)
+    {
+        pool = &_pool;
+        
+        if (pool->size == 0)
+        {
+            dl_pool_init(pool, _nodes, DL_POOL_SIZE);
+        }
+    }
+    
+    return pool;
+}
+#endif
 
 /****************************************************************************
  *  End of File
@@ -135,6 +135,61 @@
  *  Finally, a single node may be deleted using the function dl_delete(),
  *  whilst dl_destroy() deletes all nodes from a DLL.
  *
+ *  Because a node only knows about its immediate neighbours, those functions
+ *  that operate upon the first or last node of a DLL must walk the list from
+ *  the node they are given. If this is a concern, the programmer may instead
+ *  declare an instance of a DL_HEAD structure, which records the first node,
+ *  last node and node count of a DLL. This instance must be initialised to
+ *  zero, ie:
+ *
+ *  @code DL_HEAD dl_head = {0}; @endcode
+ *
+ *  The functions prefixed dl_head_ mirror those described above, but keep the
+ *  DL_HEAD structure up to date as nodes are added, inserted, extracted,
+ *  deleted, exchanged and joined. As a result, getting or adding the first or
+ *  last node of a DLL, and getting its node count, take the same time
+ *  regardless of the length of the list. Nodes belonging to a DL_HEAD must
+ *  only be manipulated using the dl_head_ functions, although the functions
+ *  dl_get_previous(), dl_get_next() and dl_get_object() may be freely used to
+ *  examine them.
+ *
+ *  If #DL_COUNTED is defined, each node also records the DL_HEAD to which it
+ *  belongs. In this counted-list mode the node functions dl_insert_before(),
+ *  dl_insert_after(), dl_extract(), dl_delete(), dl_exchange(), dl_join() and
+ *  dl_destroy() keep the DL_HEAD up to date as well, so that nodes belonging
+ *  to a DL_HEAD may be manipulated using either set of functions. Likewise,
+ *  dl_get_first(), dl_get_last() and dl_get_count() return the values held by
+ *  the DL_HEAD, rather than walking the list. Nodes are added to a DL_HEAD
+ *  using the dl_head_ functions, and removed from it when extracted, deleted
+ *  or joined to a list that does not belong to a DL_HEAD. If #DL_DEBUG is
+ *  also defined, the function dl_head_verify() may be used to cross-check a
+ *  DL_HEAD against a walk of its list.
+ *
+ *  By default, each node is allocated from the heap by dl_create(), and
+ *  returned to the heap by dl_delete(). If #DL_POOL_SIZE is defined, nodes
+ *  are instead drawn from, and returned to, a statically allocated pool of
+ *  that many nodes. Both operations then take a fixed amount of time, and
+ *  list churn no longer fragments the heap. When the pool is exhausted,
+ *  dl_create() returns #DL_NO_MEMORY.
+ *
+ *  A list may also be given a pool of its own. To do so, the programmer must
+ *  declare an array of DL_LIST structures and a DL_POOL structure, and pass
+ *  both to dl_pool_init(), ie:
+ *
+ *  @code
+ *  DL_LIST dl_nodes[16];
+ *  DL_POOL dl_pool;
+ *
+ *  dl_pool_init(&dl_pool, dl_nodes, 16);
+ *  @endcode
+ *
+ *  Nodes may then be created from the pool using dl_pool_create(), or added
+ *  to a DL_HEAD whose pool member points to it. Every node remembers the pool
+ *  from which it was drawn, so dl_delete() always returns it to that pool.
+ *  The functions dl_pool_get_used(), dl_pool_get_high_water() and
+ *  dl_pool_get_exhausted() report how heavily a pool has been used, with a
+ *  NULL argument referring to the global pool.
+ *
  *  For further information about these and other library functions, please
  *  refer to the individual function documentation. For examples of their use,
  *  please see the doubly linked list test library.
@@ -160,6 +215,29 @@
 /****************************************************************************
  *  Definitions and Macros
  ****************************************************************************/
+/**
+ *  @brief Enable counted-list mode.
+ *
+ *  Uncomment this definition in order for each DLL node to record the
+ *  DL_HEAD to which it belongs, at the cost of one pointer per node.
+ */
+//#define DL_COUNTED
+
+/**
+ *  @brief Enable the debug functions.
+ *
+ *  Uncomment this definition in order to build dl_head_verify().
+ */
+//#define DL_DEBUG
+
+/**
+ *  @brief The number of nodes in the global node pool.
+ *
+ *  Uncomment this definition in order for dl_create() and dl_delete() to
+ *  use a statically allocated pool of nodes, rather than the heap.
+ */
+//#define DL_POOL_SIZE                    64
+
 /**
  *  @brief Generic success.
  */
@@ -210,8 +288,85 @@ typedef struct DL_LIST
      *  @brief A pointer to this node's object.
      */
     void *object;
+
+#ifdef DL_COUNTED
+    /**
+     *  @brief A pointer to the DL_HEAD to which this node belongs.
+     */
+    struct DL_HEAD *head;
+#endif
+#ifdef DL_POOL_SIZE
+    
+    /**
+     *  @brief A pointer to the pool from which this node was drawn.
+     */
+    struct DL_POOL *pool;
+#endif
 } DL_LIST;
 
+#ifdef DL_POOL_SIZE
+/**
+ *  @brief A fixed-capacity pool of DLL nodes.
+ */
+typedef struct DL_POOL
+{
+    /**
+     *  @brief A pointer to the first free node in the pool.
+     */
+    DL_LIST *free;
+    
+    /**
+     *  @brief The number of nodes in the pool.
+     */
+    uint32 size;
+    
+    /**
+     *  @brief The number of nodes currently in use.
+     */
+    uint32 used;
+    
+    /**
+     *  @brief The greatest number of nodes ever in use at once.
+     */
+    uint32 high_water;
+    
+    /**
+     *  @brief The number of requests made whilst the pool was empty.
+     */
+    uint32 exhausted;
+} DL_POOL;
+#endif
+
+/**
+ *  @brief A doubly linked list (DLL) head.
+ */
+typedef struct DL_HEAD
+{
+    /**
+     *  @brief A pointer to the first node in the DLL.
+     */
+    DL_LIST *first;
+    
+    /**
+     *  @brief A pointer to the last node in the DLL.
+     */
+    DL_LIST *last;
+    
+    /**
+     *  @brief The number of nodes in the DLL.
+     */
+    uint32 count;
+#ifdef DL_POOL_SIZE
+    
+    /**
+     *  @brief A pointer to the pool from which new nodes are drawn.
+     *
+     *  If this member is NULL, new nodes are drawn from the global pool.
+     */
+    DL_POOL *pool;
+#endif
+} DL_HEAD;
+
 /****************************************************************************
  *  Exported Variables
  ****************************************************************************/
@@ -226,7 +381,8 @@ typedef struct DL_LIST
  *  @param[in] object A pointer to the new node's object.
  *  @return #DL_SUCCESS if successful, otherwise #DL_BAD_ARGUMENT or
  *      #DL_NO_MEMORY.
- *  @remark Creates a new node on the heap.
+ *  @remark Creates a new node on the heap, or in the global pool if
+ *      #DL_POOL_SIZE is defined.
  */
 uint8 dl_create(DL_LIST **node, uint16 tag, void *object);
 
@@ -367,6 +523,8 @@ uint8 dl_add_after(DL_LIST **node, uint16 tag, void *object);
  *  @param[in] list A pointer to a DLL.
  *  @return The number of nodes in the DLL.
  *  @remark If the DLL is empty, a count of zero will be returned.
+ *  @remark In counted-list mode, the count of a DLL belonging to a
+ *      DL_HEAD is returned without walking the list.
  *  @warning It is up to the caller to ensure that the list argument
  *      points to an actual list. Passing a pointer to an uninitialised
  *      list would be a <B> very bad thing. </B>
@@ -408,7 +566,7 @@ uint8 dl_extract(DL_LIST *node);
  *  @param[in] node A pointer to a DLL node.
  *  @return #DL_SUCCESS if successful, otherwise #DL_BAD_ARGUMENT.
  *  @remark Extracts the node from the DLL, and frees the heap memory
- *      used by the node.
+ *      used by the node, or returns the node to its pool.
  *  @warning If the node pointer is the only means of addressing a DLL,
  *      the DLL will be lost.
  *  @warning It is up to the caller to ensure that the node argument
@@ -436,6 +594,10 @@ uint8 dl_destroy(DL_LIST **list);
  *  @return #DL_SUCCESS if successful, otherwise #DL_BAD_ARGUMENT.
  *  @remark After joining, the last node of list_a will point to
  *      the first node of list_b.
+ *  @remark In counted-list mode, the nodes of list_b become part of
+ *      the DL_HEAD of list_a, if any. If list_b belonged to a DL_HEAD,
+ *      that head will describe an empty DLL. Joining two lists that
+ *      belong to the same DL_HEAD will return #DL_BAD_ARGUMENT.
  *  @warning It is up to the caller to ensure that both arguments
  *      point to actual lists. Passing pointers to uninitialised
  *      lists would be a <B> very bad thing. </B>
@@ -468,6 +630,210 @@ uint8 dl_exchange(DL_LIST *node_a, DL_LIST *node_b);
  */
 uint8 dl_update(DL_LIST **node, uint16 new_tag, void *new_object);
 
+/**
+ *  @brief Get the first node of a headed DLL.
+ *  @param[in] head A pointer to a DLL head.
+ *  @return A pointer to the first node of the DLL.
+ *  @remark If the DLL is empty, or if the head argument is NULL, a NULL
+ *      pointer will be returned.
+ */
+DL_LIST *dl_head_get_first(DL_HEAD *head);
+
+/**
+ *  @brief Get the last node of a headed DLL.
+ *  @param[in] head A pointer to a DLL head.
+ *  @return A pointer to the last node of the DLL.
+ *  @remark If the DLL is empty, or if the head argument is NULL, a NULL
+ *      pointer will be returned.
+ */
+DL_LIST *dl_head_get_last(DL_HEAD *head);
+
+/**
+ *  @brief Get the node count of a headed DLL.
+ *  @param[in] head A pointer to a DLL head.
+ *  @return The number of nodes in the DLL.
+ *  @remark If the head argument is NULL, a count of zero will be returned.
+ */
+uint32 dl_head_get_count(DL_HEAD *head);
+
+/**
+ *  @brief Insert a new node into a headed DLL in first place.
+ *  @param[in] head A pointer to a DLL head.
+ *  @param[in] tag A tag used to identify the new node's object type.
+ *  @param[in] object A pointer to the new node's object.
+ *  @return #DL_SUCCESS if successful, otherwise #DL_BAD_ARGUMENT or
+ *      #DL_NO_MEMORY.
+ *  @warning It is up to the caller to ensure that the head argument
+ *      points to an actual head. Passing a pointer to an uninitialised
+ *      head would be a <B> very bad thing. </B>
+ */
+uint8 dl_head_add_first(DL_HEAD *head, uint16 tag, void *object);
+
+/**
+ *  @brief Insert a new node into a headed DLL in last place.
+ *  @param[in] head A pointer to a DLL head.
+ *  @param[in] tag A tag used to identify the new node's object type.
+ *  @param[in] object A pointer to the new node's object.
+ *  @return #DL_SUCCESS if successful, otherwise #DL_BAD_ARGUMENT or
+ *      #DL_NO_MEMORY.
+ *  @warning It is up to the caller to ensure that the head argument
+ *      points to an actual head. Passing a pointer to an uninitialised
+ *      head would be a <B> very bad thing. </B>
+ */
+uint8 dl_head_add_last(DL_HEAD *head, uint16 tag, void *object);
+
+/**
+ *  @brief Insert a node into a headed DLL before another node.
+ *  @param[in] head A pointer to a DLL head.
+ *  @param[in] node A pointer to the DLL node to insert before.
+ *  @param[in] new_node A pointer to the DLL node to insert.
+ *  @return #DL_SUCCESS if successful, otherwise #DL_BAD_ARGUMENT.
+ *  @remark If the node argument is NULL, the new node will be inserted in
+ *      first place.
+ *  @warning It is up to the caller to ensure that the node argument
+ *      belongs to the DLL, and that the new node does not belong to any
+ *      DLL. Doing otherwise would be a <B> very bad thing. </B>
+ */
+uint8 dl_head_insert_before(DL_HEAD *head, DL_LIST *node, DL_LIST *new_node);
+
+/**
+ *  @brief Insert a node into a headed DLL after another node.
+ *  @param[in] head A pointer to a DLL head.
+ *  @param[in] node A pointer to the DLL node to insert after.
+ *  @param[in] new_node A pointer to the DLL node to insert.
+ *  @return #DL_SUCCESS if successful, otherwise #DL_BAD_ARGUMENT.
+ *  @remark If the node argument is NULL, the new node will be inserted in
+ *      last place.
+ *  @warning It is up to the caller to ensure that the node argument
+ *      belongs to the DLL, and that the new node does not belong to any
+ *      DLL. Doing otherwise would be a <B> very bad thing. </B>
+ */
+uint8 dl_head_insert_after(DL_HEAD *head, DL_LIST *node, DL_LIST *new_node);
+
+/**
+ *  @brief Extract a node from a headed DLL.
+ *  @param[in] head A pointer to a DLL head.
+ *  @param[in] node A pointer to a DLL node.
+ *  @return #DL_SUCCESS if successful, otherwise #DL_BAD_ARGUMENT.
+ *  @remark The node is extracted from the structure of the DLL, but
+ *      otherwise remains intact.
+ *  @warning It is up to the caller to ensure that the node argument
+ *      belongs to the DLL. Passing a pointer to any other node would
+ *      be a <B> very bad thing. </B>
+ */
+uint8 dl_head_extract(DL_HEAD *head, DL_LIST *node);
+
+/**
+ *  @brief Delete a node from a headed DLL.
+ *  @param[in] head A pointer to a DLL head.
+ *  @param[in] node A pointer to a DLL node.
+ *  @return #DL_SUCCESS if successful, otherwise #DL_BAD_ARGUMENT.
+ *  @remark Extracts the node from the DLL, and frees the heap memory
+ *      used by the node, or returns the node to its pool.
+ *  @warning It is up to the caller to ensure that the node argument
+ *      belongs to the DLL. Passing a pointer to any other node would
+ *      be a <B> very bad thing. </B>
+ */
+uint8 dl_head_delete(DL_HEAD *head, DL_LIST *node);
+
+/**
+ *  @brief Destroy a headed DLL.
+ *  @param[in] head A pointer to a DLL head.
+ *  @return #DL_SUCCESS if successful, otherwise #DL_BAD_ARGUMENT.
+ *  @remark Deletes all nodes from the DLL, and resets the head to
+ *      describe an empty DLL.
+ */
+uint8 dl_head_destroy(DL_HEAD *head);
+
+/**
+ *  @brief Join two headed DLLs.
+ *  @param[in] head_a A pointer to a DLL head.
+ *  @param[in] head_b A pointer to a DLL head.
+ *  @return #DL_SUCCESS if successful, otherwise #DL_BAD_ARGUMENT.
+ *  @remark After joining, the last node of head_a will point to the
+ *      first node of head_b, and head_b will describe an empty DLL.
+ *  @remark If the two arguments point to the same head, this function
+ *      will return #DL_BAD_ARGUMENT.
+ */
+uint8 dl_head_join(DL_HEAD *head_a, DL_HEAD *head_b);
+
+/**
+ *  @brief Exchange two nodes in a headed DLL.
+ *  @param[in] head A pointer to a DLL head.
+ *  @param[in] node_a A pointer to a DLL node.
+ *  @param[in] node_b A pointer to a DLL node.
+ *  @return #DL_SUCCESS if successful, otherwise #DL_BAD_ARGUMENT.
+ *  @warning It is up to the caller to ensure that both nodes belong
+ *      to the DLL. Passing pointers to any other nodes would be a
+ *      <B> very bad thing. </B>
+ */
+uint8 dl_head_exchange(DL_HEAD *head, DL_LIST *node_a, DL_LIST *node_b);
+
+#ifdef DL_POOL_SIZE
+/**
+ *  @brief Initialise a DLL node pool.
+ *  @param[out] pool A pointer to the pool to initialise.
+ *  @param[in] nodes A pointer to an array of DLL nodes.
+ *  @param[in] size The number of nodes in the array.
+ *  @return #DL_SUCCESS if successful, otherwise #DL_BAD_ARGUMENT.
+ *  @warning The array must remain in scope for as long as the pool is
+ *      in use. Allowing it to go out of scope would be a <B> very bad
+ *      thing. </B>
+ */
+uint8 dl_pool_init(DL_POOL *pool, DL_LIST *nodes, uint32 size);
+
+/**
+ *  @brief Create a new DLL node from a pool.
+ *  @param[in] pool A pointer to a DLL node pool.
+ *  @param[out] node A pointer to a pointer to the newly-created node.
+ *  @param[in] tag A tag used to identify the new node's object type.
+ *  @param[in] object A pointer to the new node's object.
+ *  @return #DL_SUCCESS if successful, otherwise #DL_BAD_ARGUMENT or
+ *      #DL_NO_MEMORY.
+ *  @remark If the pool argument is NULL, the node is drawn from the
+ *      global pool.
+ */
+uint8 dl_pool_create(DL_POOL *pool, DL_LIST **node, uint16 tag,
+    void *object);
+
+/**
+ *  @brief Get the number of nodes in use from a pool.
+ *  @param[in] pool A pointer to a DLL node pool.
+ *  @return The number of nodes currently in use.
+ *  @remark If the pool argument is NULL, the global pool is used.
+ */
+uint32 dl_pool_get_used(DL_POOL *pool);
+
+/**
+ *  @brief Get the high-water mark of a pool.
+ *  @param[in] pool A pointer to a DLL node pool.
+ *  @return The greatest number of nodes ever in use at once.
+ *  @remark If the pool argument is NULL, the global pool is used.
+ */
+uint32 dl_pool_get_high_water(DL_POOL *pool);
+
+/**
+ *  @brief Get the exhaustion count of a pool.
+ *  @param[in] pool A pointer to a DLL node pool.
+ *  @return The number of node requests made whilst the pool was empty.
+ *  @remark If the pool argument is NULL, the global pool is used.
+ */
+uint32 dl_pool_get_exhausted(DL_POOL *pool);
+#endif
+
+#ifdef DL_DEBUG
+/**
+ *  @brief Verify a headed DLL.
+ *  @param[in] head A pointer to a DLL head.
+ *  @return #DL_SUCCESS if the head agrees with its DLL, otherwise
+ *      #DL_FAILURE or #DL_BAD_ARGUMENT.
+ *  @remark Walks the DLL from its first node, checking the links between
+ *      nodes and, in counted-list mode, the head of each node. The cached
+ *      last node and node count are then compared with those found.
+ */
+uint8 dl_head_verify(DL_HEAD *head);
+#endif
+
 #endif
 
 /****************************************************************************
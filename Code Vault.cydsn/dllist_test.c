@@ -38,6 +38,7 @@
  ****************************************************************************/
 #include <device.h>
 #include <stdlib.h>
+#include <string.h>
 
 #include "dllist.h"
 #include "dllist_test.h"
@@ -60,6 +61,15 @@
  */
 #define _TAG                            200
 
+/**
+ *  @brief Verify a DLL head, if the debug functions are enabled.
+ */
+#ifdef DL_DEBUG
+#define _VERIFY(head)                   (dl_head_verify(head) == DL_SUCCESS)
+#else
+#define _VERIFY(head)                   1
+#endif
+
 /****************************************************************************
  *  Typedefs and Structures
  ****************************************************************************/
@@ -1427,6 +1437,1132 @@ uint8 dlt_test_1(void)
     return result;
 }
 
+uint8 dlt_test_2(void)
+{
+    DL_HEAD head_1 = {0};
+    DL_HEAD head_2 = {0};
+    DL_LIST *node_1;
+    DL_LIST *node_2;
+    DLT_OBJECT *object_0;
+    DLT_OBJECT *object_1;
+    DLT_OBJECT *object_2;
+    DLT_OBJECT *object_3;
+    DLT_OBJECT *object_4;
+    uint8 result = DLT_SUCCESS;
+    
+    UART_1_Start();
+    
+    UART_1_PutString("\x1b\x5b\x32\x4a");
+    UART_1_PutString("DOUBLY LINKED LIST HEAD TEST\r\n");
+    UART_1_PutString("\r\n");
+    UART_1_PutString("Test\tFunction\t\tResult\r\n");
+    UART_1_PutString("----\t--------\t\t------\r\n");
+    
+    /*
+     *  Initialise test.
+     */
+    if (result == DLT_SUCCESS)
+    {
+        if (_create_object("one", 1, &object_1) == DLT_SUCCESS &&
+            _create_object("two", 2, &object_2) == DLT_SUCCESS &&
+            _create_object("three", 3, &object_3) == DLT_SUCCESS &&
+            _create_object("four", 4, &object_4) == DLT_SUCCESS)
+        {
+            UART_1_PutString("   -\tInitialise test...\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("   -\tInitialise test...\tFAIL\r\n");
+            result = DLT_FAILURE;
+        }
+    }
+    
+    /*
+     *  Test dl_head_add_first().
+     */
+    if (result == DLT_SUCCESS)
+    {
+        if (dl_head_add_first(NULL, _TAG, object_1) == DL_BAD_ARGUMENT)
+        {
+            UART_1_PutString("   1\tdl_head_add_first()\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("   1\tdl_head_add_first()\tFAIL\r\n");
+            result = DLT_FAILURE;
+        }
+    }
+    
+    if (result == DLT_SUCCESS)
+    {
+        if (dl_head_add_first(&head_1, _TAG, object_2) == DL_SUCCESS &&
+            dl_head_add_first(&head_1, _TAG, object_1) == DL_SUCCESS)
+        {
+            UART_1_PutString("   2\tdl_head_add_first()\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("   2\tdl_head_add_first()\tFAIL\r\n");
+            result = DLT_FAILURE;
+        }
+    }
+    
+    /*
+     *  Test dl_head_add_last().
+     */
+    if (result == DLT_SUCCESS)
+    {
+        if (dl_head_add_last(NULL, _TAG, object_3) == DL_BAD_ARGUMENT)
+        {
+            UART_1_PutString("   3\tdl_head_add_last()\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("   3\tdl_head_add_last()\tFAIL\r\n");
+            result = DLT_FAILURE;
+        }
+    }
+    
+    if (result == DLT_SUCCESS)
+    {
+        if (dl_head_add_last(&head_1, _TAG, object_3) == DL_SUCCESS)
+        {
+            UART_1_PutString("   4\tdl_head_add_last()\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("   4\tdl_head_add_last()\tFAIL\r\n");
+            result = DLT_FAILURE;
+        }
+    }
+    
+    /*
+     *  Test dl_head_get_first().
+     */
+    if (result == DLT_SUCCESS)
+    {
+        if (dl_head_get_first(NULL) == NULL)
+        {
+            UART_1_PutString("   5\tdl_head_get_first()\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("   5\tdl_head_get_first()\tFAIL\r\n");
+            result = DLT_FAILURE;
+        }
+    }
+    
+    if (result == DLT_SUCCESS)
+    {
+        object_0 = dl_head_get_first(&head_1)->object;
+        
+        if (object_0->number == 1)
+        {
+            UART_1_PutString("   6\tdl_head_get_first()\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("   6\tdl_head_get_first()\tFAIL\r\n");
+            result = DLT_FAILURE;
+        }
+    }
+    
+    /*
+     *  Test dl_head_get_last().
+     */
+    if (result == DLT_SUCCESS)
+    {
+        if (dl_head_get_last(NULL) == NULL)
+        {
+            UART_1_PutString("   7\tdl_head_get_last()\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("   7\tdl_head_get_last()\tFAIL\r\n");
+            result = DLT_FAILURE;
+        }
+    }
+    
+    if (result == DLT_SUCCESS)
+    {
+        object_0 = dl_head_get_last(&head_1)->object;
+        
+        if (object_0->number == 3)
+        {
+            UART_1_PutString("   8\tdl_head_get_last()\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("   8\tdl_head_get_last()\tFAIL\r\n");
+            result = DLT_FAILURE;
+        }
+    }
+    
+    /*
+     *  Test dl_head_get_count().
+     */
+    if (result == DLT_SUCCESS)
+    {
+        if (dl_head_get_count(NULL) == 0)
+        {
+            UART_1_PutString("   9\tdl_head_get_count()\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("   9\tdl_head_get_count()\tFAIL\r\n");
+            result = DLT_FAILURE;
+        }
+    }
+    
+    if (result == DLT_SUCCESS)
+    {
+        if (dl_head_get_count(&head_1) == 3 &&
+            dl_get_count(dl_head_get_first(&head_1)) == 3)
+        {
+            UART_1_PutString("  10\tdl_head_get_count()\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("  10\tdl_head_get_count()\tFAIL\r\n");
+            result = DLT_FAILURE;
+        }
+    }
+    
+    /*
+     *  Test dl_head_insert_before().
+     */
+    if (result == DLT_SUCCESS)
+    {
+        if (dl_create(&node_1, _TAG, object_4) == DL_SUCCESS)
+        {
+            UART_1_PutString("   -\tInitialise test...\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("   -\tInitialise test...\tFAIL\r\n");
+            result = DLT_FAILURE;
+        }
+    }
+    
+    if (result == DLT_SUCCESS)
+    {
+        if (dl_head_insert_before(&head_1, NULL, NULL) == DL_BAD_ARGUMENT)
+        {
+            UART_1_PutString("  11\tdl_head_insert_before()\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("  11\tdl_head_insert_before()\tFAIL\r\n");
+            result = DLT_FAILURE;
+        }
+    }
+    
+    if (result == DLT_SUCCESS)
+    {
+        if (dl_head_insert_before(&head_1, NULL, node_1) == DL_SUCCESS &&
+            dl_head_get_first(&head_1) == node_1 &&
+            dl_head_get_count(&head_1) == 4)
+        {
+            UART_1_PutString("  12\tdl_head_insert_before()\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("  12\tdl_head_insert_before()\tFAIL\r\n");
+            result = DLT_FAILURE;
+        }
+    }
+    
+    /*
+     *  Test dl_head_extract().
+     */
+    if (result == DLT_SUCCESS)
+    {
+        if (dl_head_extract(&head_1, NULL) == DL_BAD_ARGUMENT)
+        {
+            UART_1_PutString("  13\tdl_head_extract()\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("  13\tdl_head_extract()\tFAIL\r\n");
+            result = DLT_FAILURE;
+        }
+    }
+    
+    if (result == DLT_SUCCESS)
+    {
+        object_0 = dl_head_get_first(&head_1)->next->object;
+        
+        if (dl_head_extract(&head_1, node_1) == DL_SUCCESS &&
+            dl_head_get_first(&head_1)->object == object_0 &&
+            dl_head_get_count(&head_1) == 3)
+        {
+            UART_1_PutString("  14\tdl_head_extract()\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("  14\tdl_head_extract()\tFAIL\r\n");
+            result = DLT_FAILURE;
+        }
+    }
+    
+    /*
+     *  Test dl_head_insert_after().
+     */
+    if (result == DLT_SUCCESS)
+    {
+        if (dl_head_insert_after(NULL, NULL, node_1) == DL_BAD_ARGUMENT)
+        {
+            UART_1_PutString("  15\tdl_head_insert_after()\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("  15\tdl_head_insert_after()\tFAIL\r\n");
+            result = DLT_FAILURE;
+        }
+    }
+    
+    if (result == DLT_SUCCESS)
+    {
+        if (dl_head_insert_after(&head_1, NULL, node_1) == DL_SUCCESS &&
+            dl_head_get_last(&head_1) == node_1 &&
+            dl_head_get_count(&head_1) == 4)
+        {
+            UART_1_PutString("  16\tdl_head_insert_after()\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("  16\tdl_head_insert_after()\tFAIL\r\n");
+            result = DLT_FAILURE;
+        }
+    }
+    
+    /*
+     *  Test dl_head_exchange().
+     */
+    if (result == DLT_SUCCESS)
+    {
+        if (dl_head_exchange(NULL, node_1, node_1) == DL_BAD_ARGUMENT)
+        {
+            UART_1_PutString("  17\tdl_head_exchange()\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("  17\tdl_head_exchange()\tFAIL\r\n");
+            result = DLT_FAILURE;
+        }
+    }
+    
+    if (result == DLT_SUCCESS)
+    {
+        node_2 = dl_head_get_first(&head_1);
+        
+        if (dl_head_exchange(&head_1, node_1, node_2) == DL_SUCCESS &&
+            dl_head_get_first(&head_1) == node_1 &&
+            dl_head_get_last(&head_1) == node_2)
+        {
+            UART_1_PutString("  18\tdl_head_exchange()\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("  18\tdl_head_exchange()\tFAIL\r\n");
+            result = DLT_FAILURE;
+        }
+    }
+    
+    /*
+     *  Test dl_head_delete().
+     */
+    if (result == DLT_SUCCESS)
+    {
+        if (dl_head_delete(NULL, node_1) == DL_BAD_ARGUMENT)
+        {
+            UART_1_PutString("  19\tdl_head_delete()\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("  19\tdl_head_delete()\tFAIL\r\n");
+            result = DLT_FAILURE;
+        }
+    }
+    
+    if (result == DLT_SUCCESS)
+    {
+        if (dl_head_delete(&head_1, node_2) == DL_SUCCESS &&
+            dl_head_get_last(&head_1)->object == object_3 &&
+            dl_head_get_count(&head_1) == 3)
+        {
+            UART_1_PutString("  20\tdl_head_delete()\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("  20\tdl_head_delete()\tFAIL\r\n");
+            result = DLT_FAILURE;
+        }
+    }
+    
+    /*
+     *  Test dl_head_join().
+     */
+    if (result == DLT_SUCCESS)
+    {
+        if (dl_head_join(&head_1, &head_1) == DL_BAD_ARGUMENT)
+        {
+            UART_1_PutString("  21\tdl_head_join()\t\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("  21\tdl_head_join()\t\tFAIL\r\n");
+            result = DLT_FAILURE;
+        }
+    }
+    
+    if (result == DLT_SUCCESS)
+    {
+        if (dl_head_join(&head_2, &head_1) == DL_SUCCESS &&
+            dl_head_get_count(&head_1) == 0 &&
+            dl_head_get_first(&head_1) == NULL &&
+            dl_head_get_count(&head_2) == 3)
+        {
+            UART_1_PutString("  22\tdl_head_join()\t\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("  22\tdl_head_join()\t\tFAIL\r\n");
+            result = DLT_FAILURE;
+        }
+    }
+    
+    if (result == DLT_SUCCESS)
+    {
+        dl_head_add_last(&head_1, _TAG, object_1);
+        
+        if (dl_head_join(&head_2, &head_1) == DL_SUCCESS &&
+            dl_head_get_last(&head_2)->object == object_1 &&
+            dl_head_get_count(&head_2) == 4 &&
+            dl_get_count(dl_head_get_first(&head_2)) == 4)
+        {
+            UART_1_PutString("  23\tdl_head_join()\t\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("  23\tdl_head_join()\t\tFAIL\r\n");
+            result = DLT_FAILURE;
+        }
+    }
+    
+    /*
+     *  Test dl_head_destroy().
+     */
+    if (result == DLT_SUCCESS)
+    {
+        if (dl_head_destroy(NULL) == DL_BAD_ARGUMENT)
+        {
+            UART_1_PutString("  24\tdl_head_destroy()\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("  24\tdl_head_destroy()\tFAIL\r\n");
+            result = DLT_FAILURE;
+        }
+    }
+    
+    if (result == DLT_SUCCESS)
+    {
+        if (dl_head_destroy(&head_2) == DL_SUCCESS &&
+            dl_head_get_first(&head_2) == NULL &&
+            dl_head_get_last(&head_2) == NULL &&
+            dl_head_get_count(&head_2) == 0)
+        {
+            UART_1_PutString("  25\tdl_head_destroy()\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("  25\tdl_head_destroy()\tFAIL\r\n");
+            result = DLT_FAILURE;
+        }
+    }
+    
+    /*
+     *  Report test result.
+     */
+    if (result == DLT_SUCCESS)
+    {
+        UART_1_PutString("\r\n");
+        UART_1_PutString("TEST PASSED\r\n");
+    }
+    else
+    {
+        UART_1_PutString("\r\n");
+        UART_1_PutString("TEST FAILED\r\n");
+    }
+    
+    /*
+     *  Clean-up test.
+     */
+    _destroy_object(object_1);
+    _destroy_object(object_2);
+    _destroy_object(object_3);
+    _destroy_object(object_4);
+    
+    dl_head_destroy(&head_1);
+    dl_head_destroy(&head_2);
+    
+    while ((UART_1_ReadTxStatus() & UART_1_TX_STS_FIFO_EMPTY) !=
+        UART_1_TX_STS_FIFO_EMPTY)
+    {
+        CyDelay(1);
+    }
+    
+    UART_1_Stop();
+    
+    return result;
+}
+
+#ifdef DL_COUNTED
+uint8 dlt_test_3(void)
+{
+    DL_HEAD head_1 = {0};
+    DL_HEAD head_2 = {0};
+    DL_LIST *list_1 = NULL;
+    DL_LIST *list_2;
+    DL_LIST *node_1;
+    DL_LIST *node_2;
+    DLT_OBJECT *object_1;
+    DLT_OBJECT *object_2;
+    DLT_OBJECT *object_3;
+    uint8 result = DLT_SUCCESS;
+    
+    UART_1_Start();
+    
+    UART_1_PutString("\x1b\x5b\x32\x4a");
+    UART_1_PutString("DOUBLY LINKED LIST COUNTED TEST\r\n");
+    UART_1_PutString("\r\n");
+    UART_1_PutString("Test\tFunction\t\tResult\r\n");
+    UART_1_PutString("----\t--------\t\t------\r\n");
+    
+    /*
+     *  Initialise test.
+     */
+    if (result == DLT_SUCCESS)
+    {
+        if (_create_object("one", 1, &object_1) == DLT_SUCCESS &&
+            _create_object("two", 2, &object_2) == DLT_SUCCESS &&
+            _create_object("three", 3, &object_3) == DLT_SUCCESS &&
+            dl_head_add_last(&head_1, _TAG, object_1) == DL_SUCCESS &&
+            dl_head_add_last(&head_1, _TAG, object_2) == DL_SUCCESS &&
+            dl_head_add_last(&head_1, _TAG, object_3) == DL_SUCCESS &&
+            dl_create(&node_1, _TAG, object_1) == DL_SUCCESS &&
+            dl_create(&node_2, _TAG, object_2) == DL_SUCCESS)
+        {
+            UART_1_PutString("   -\tInitialise test...\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("   -\tInitialise test...\tFAIL\r\n");
+            result = DLT_FAILURE;
+        }
+    }
+    
+    /*
+     *  Test dl_insert_before().
+     */
+    if (result == DLT_SUCCESS)
+    {
+        if (dl_insert_before(dl_head_get_first(&head_1), node_1) == DL_SUCCESS &&
+            dl_head_get_first(&head_1) == node_1 &&
+            dl_head_get_count(&head_1) == 4 &&
+            _VERIFY(&head_1))
+        {
+            UART_1_PutString("   1\tdl_insert_before()\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("   1\tdl_insert_before()\tFAIL\r\n");
+            result = DLT_FAILURE;
+        }
+    }
+    
+    /*
+     *  Test dl_insert_after().
+     */
+    if (result == DLT_SUCCESS)
+    {
+        if (dl_insert_after(dl_head_get_last(&head_1), node_2) == DL_SUCCESS &&
+            dl_head_get_last(&head_1) == node_2 &&
+            dl_head_get_count(&head_1) == 5 &&
+            _VERIFY(&head_1))
+        {
+            UART_1_PutString("   2\tdl_insert_after()\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("   2\tdl_insert_after()\tFAIL\r\n");
+            result = DLT_FAILURE;
+        }
+    }
+    
+    /*
+     *  Test dl_get_first().
+     */
+    if (result == DLT_SUCCESS)
+    {
+        if (dl_get_first(node_2) == node_1)
+        {
+            UART_1_PutString("   3\tdl_get_first()\t\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("   3\tdl_get_first()\t\tFAIL\r\n");
+            result = DLT_FAILURE;
+        }
+    }
+    
+    /*
+     *  Test dl_get_last().
+     */
+    if (result == DLT_SUCCESS)
+    {
+        if (dl_get_last(node_1) == node_2)
+        {
+            UART_1_PutString("   4\tdl_get_last()\t\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("   4\tdl_get_last()\t\tFAIL\r\n");
+            result = DLT_FAILURE;
+        }
+    }
+    
+    /*
+     *  Test dl_get_count().
+     */
+    if (result == DLT_SUCCESS)
+    {
+        if (dl_get_count(node_1) == 5)
+        {
+            UART_1_PutString("   5\tdl_get_count()\t\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("   5\tdl_get_count()\t\tFAIL\r\n");
+            result = DLT_FAILURE;
+        }
+    }
+    
+    /*
+     *  Test dl_exchange().
+     */
+    if (result == DLT_SUCCESS)
+    {
+        if (dl_exchange(node_1, node_2) == DL_SUCCESS &&
+            dl_head_get_first(&head_1) == node_2 &&
+            dl_head_get_last(&head_1) == node_1 &&
+            _VERIFY(&head_1))
+        {
+            UART_1_PutString("   6\tdl_exchange()\t\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("   6\tdl_exchange()\t\tFAIL\r\n");
+            result = DLT_FAILURE;
+        }
+    }
+    
+    /*
+     *  Test dl_extract().
+     */
+    if (result == DLT_SUCCESS)
+    {
+        if (dl_extract(node_2) == DL_SUCCESS &&
+            dl_get_count(node_2) == 1 &&
+            dl_head_get_count(&head_1) == 4 &&
+            _VERIFY(&head_1))
+        {
+            UART_1_PutString("   7\tdl_extract()\t\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("   7\tdl_extract()\t\tFAIL\r\n");
+            result = DLT_FAILURE;
+        }
+    }
+    
+    /*
+     *  Test dl_delete().
+     */
+    if (result == DLT_SUCCESS)
+    {
+        if (dl_delete(node_1) == DL_SUCCESS &&
+            dl_head_get_last(&head_1)->object == object_3 &&
+            dl_head_get_count(&head_1) == 3 &&
+            _VERIFY(&head_1))
+        {
+            UART_1_PutString("   8\tdl_delete()\t\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("   8\tdl_delete()\t\tFAIL\r\n");
+            result = DLT_FAILURE;
+        }
+    }
+    
+    /*
+     *  Test dl_join().
+     */
+    if (result == DLT_SUCCESS)
+    {
+        if (dl_join(dl_head_get_first(&head_1), node_2) == DL_SUCCESS &&
+            dl_head_get_last(&head_1) == node_2 &&
+            dl_head_get_count(&head_1) == 4 &&
+            _VERIFY(&head_1))
+        {
+            UART_1_PutString("   9\tdl_join()\t\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("   9\tdl_join()\t\tFAIL\r\n");
+            result = DLT_FAILURE;
+        }
+    }
+    
+    if (result == DLT_SUCCESS)
+    {
+        if (dl_join(node_2, dl_head_get_first(&head_1)) == DL_BAD_ARGUMENT)
+        {
+            UART_1_PutString("  10\tdl_join()\t\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("  10\tdl_join()\t\tFAIL\r\n");
+            result = DLT_FAILURE;
+        }
+    }
+    
+    if (result == DLT_SUCCESS)
+    {
+        dl_head_add_last(&head_2, _TAG, object_1);
+        
+        if (dl_join(dl_head_get_first(&head_1), dl_head_get_first(&head_2)) ==
+            DL_SUCCESS &&
+            dl_head_get_count(&head_1) == 5 &&
+            dl_head_get_count(&head_2) == 0 &&
+            dl_head_get_first(&head_2) == NULL &&
+            _VERIFY(&head_1))
+        {
+            UART_1_PutString("  11\tdl_join()\t\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("  11\tdl_join()\t\tFAIL\r\n");
+            result = DLT_FAILURE;
+        }
+    }
+    
+    if (result == DLT_SUCCESS)
+    {
+        dl_add_last(&list_1, _TAG, object_2);
+        
+        if (dl_join(list_1, dl_head_get_first(&head_1)) == DL_SUCCESS &&
+            dl_head_get_count(&head_1) == 0 &&
+            dl_get_count(list_1) == 6)
+        {
+            UART_1_PutString("  12\tdl_join()\t\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("  12\tdl_join()\t\tFAIL\r\n");
+            result = DLT_FAILURE;
+        }
+    }
+    
+    /*
+     *  Test dl_destroy().
+     */
+    if (result == DLT_SUCCESS)
+    {
+        dl_head_add_last(&head_1, _TAG, object_1);
+        dl_head_add_last(&head_1, _TAG, object_2);
+        list_2 = dl_head_get_last(&head_1);
+        
+        if (dl_destroy(&list_2) == DL_SUCCESS &&
+            dl_head_get_first(&head_1) == NULL &&
+            dl_head_get_count(&head_1) == 0)
+        {
+            UART_1_PutString("  13\tdl_destroy()\t\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("  13\tdl_destroy()\t\tFAIL\r\n");
+            result = DLT_FAILURE;
+        }
+    }
+#ifdef DL_DEBUG
+    
+    /*
+     *  Test dl_head_verify().
+     */
+    if (result == DLT_SUCCESS)
+    {
+        if (dl_head_verify(NULL) == DL_BAD_ARGUMENT)
+        {
+            UART_1_PutString("  14\tdl_head_verify()\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("  14\tdl_head_verify()\tFAIL\r\n");
+            result = DLT_FAILURE;
+        }
+    }
+    
+    if (result == DLT_SUCCESS)
+    {
+        dl_head_add_last(&head_1, _TAG, object_3);
+        ++head_1.count;
+        
+        if (dl_head_verify(&head_1) == DL_FAILURE)
+        {
+            UART_1_PutString("  15\tdl_head_verify()\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("  15\tdl_head_verify()\tFAIL\r\n");
+            result = DLT_FAILURE;
+        }
+        
+        --head_1.count;
+    }
+#endif
+    
+    /*
+     *  Report test result.
+     */
+    if (result == DLT_SUCCESS)
+    {
+        UART_1_PutString("\r\n");
+        UART_1_PutString("TEST PASSED\r\n");
+    }
+    else
+    {
+        UART_1_PutString("\r\n");
+        UART_1_PutString("TEST FAILED\r\n");
+    }
+    
+    /*
+     *  Clean-up test.
+     */
+    _destroy_object(object_1);
+    _destroy_object(object_2);
+    _destroy_object(object_3);
+    
+    dl_destroy(&list_1);
+    dl_head_destroy(&head_1);
+    dl_head_destroy(&head_2);
+    
+    while ((UART_1_ReadTxStatus() & UART_1_TX_STS_FIFO_EMPTY) !=
+        UART_1_TX_STS_FIFO_EMPTY)
+    {
+        CyDelay(1);
+    }
+    
+    UART_1_Stop();
+    
+    return result;
+}
+#endif
+
+#ifdef DL_POOL_SIZE
+uint8 dlt_test_4(void)
+{
+    DL_HEAD head_1 = {0};
+    DL_LIST nodes[3];
+    DL_LIST *node_1;
+    DL_LIST *node_2;
+    DL_LIST *node_3;
+    DL_LIST *node_4;
+    DL_POOL pool_1;
+    DLT_OBJECT *object_1;
+    uint8 result = DLT_SUCCESS;
+    uint32 used;
+    
+    UART_1_Start();
+    
+    UART_1_PutString("\x1b\x5b\x32\x4a");
+    UART_1_PutString("DOUBLY LINKED LIST POOL TEST\r\n");
+    UART_1_PutString("\r\n");
+    UART_1_PutString("Test\tFunction\t\tResult\r\n");
+    UART_1_PutString("----\t--------\t\t------\r\n");
+    
+    /*
+     *  Initialise test.
+     */
+    if (result == DLT_SUCCESS)
+    {
+        if (_create_object("one", 1, &object_1) == DLT_SUCCESS)
+        {
+            UART_1_PutString("   -\tInitialise test...\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("   -\tInitialise test...\tFAIL\r\n");
+            result = DLT_FAILURE;
+        }
+    }
+    
+    /*
+     *  Test dl_pool_init().
+     */
+    if (result == DLT_SUCCESS)
+    {
+        if (dl_pool_init(NULL, nodes, 3) == DL_BAD_ARGUMENT)
+        {
+            UART_1_PutString("   1\tdl_pool_init()\t\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("   1\tdl_pool_init()\t\tFAIL\r\n");
+            result = DLT_FAILURE;
+        }
+    }
+    
+    if (result == DLT_SUCCESS)
+    {
+        if (dl_pool_init(&pool_1, nodes, 0) == DL_BAD_ARGUMENT)
+        {
+            UART_1_PutString("   2\tdl_pool_init()\t\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("   2\tdl_pool_init()\t\tFAIL\r\n");
+            result = DLT_FAILURE;
+        }
+    }
+    
+    if (result == DLT_SUCCESS)
+    {
+        if (dl_pool_init(&pool_1, nodes, 3) == DL_SUCCESS &&
+            dl_pool_get_used(&pool_1) == 0)
+        {
+            UART_1_PutString("   3\tdl_pool_init()\t\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("   3\tdl_pool_init()\t\tFAIL\r\n");
+            result = DLT_FAILURE;
+        }
+    }
+    
+    /*
+     *  Test dl_pool_create().
+     */
+    if (result == DLT_SUCCESS)
+    {
+        if (dl_pool_create(&pool_1, NULL, _TAG, object_1) == DL_BAD_ARGUMENT)
+        {
+            UART_1_PutString("   4\tdl_pool_create()\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("   4\tdl_pool_create()\tFAIL\r\n");
+            result = DLT_FAILURE;
+        }
+    }
+    
+    if (result == DLT_SUCCESS)
+    {
+        if (dl_pool_create(&pool_1, &node_1, _TAG, object_1) == DL_SUCCESS &&
+            dl_pool_create(&pool_1, &node_2, _TAG, object_1) == DL_SUCCESS &&
+            dl_pool_create(&pool_1, &node_3, _TAG, object_1) == DL_SUCCESS)
+        {
+            UART_1_PutString("   5\tdl_pool_create()\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("   5\tdl_pool_create()\tFAIL\r\n");
+            result = DLT_FAILURE;
+        }
+    }
+    
+    if (result == DLT_SUCCESS)
+    {
+        if (dl_pool_create(&pool_1, &node_4, _TAG, object_1) == DL_NO_MEMORY)
+        {
+            UART_1_PutString("   6\tdl_pool_create()\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("   6\tdl_pool_create()\tFAIL\r\n");
+            result = DLT_FAILURE;
+        }
+    }
+    
+    /*
+     *  Test dl_pool_get_used().
+     */
+    if (result == DLT_SUCCESS)
+    {
+        if (dl_pool_get_used(&pool_1) == 3)
+        {
+            UART_1_PutString("   7\tdl_pool_get_used()\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("   7\tdl_pool_get_used()\tFAIL\r\n");
+            result = DLT_FAILURE;
+        }
+    }
+    
+    /*
+     *  Test dl_pool_get_exhausted().
+     */
+    if (result == DLT_SUCCESS)
+    {
+        if (dl_pool_get_exhausted(&pool_1) == 1)
+        {
+            UART_1_PutString("   8\tdl_pool_get_exhausted()\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("   8\tdl_pool_get_exhausted()\tFAIL\r\n");
+            result = DLT_FAILURE;
+        }
+    }
+    
+    /*
+     *  Test dl_delete().
+     */
+    if (result == DLT_SUCCESS)
+    {
+        if (dl_delete(node_2) == DL_SUCCESS &&
+            dl_pool_get_used(&pool_1) == 2)
+        {
+            UART_1_PutString("   9\tdl_delete()\t\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("   9\tdl_delete()\t\tFAIL\r\n");
+            result = DLT_FAILURE;
+        }
+    }
+    
+    /*
+     *  Test dl_pool_get_high_water().
+     */
+    if (result == DLT_SUCCESS)
+    {
+        if (dl_pool_get_high_water(&pool_1) == 3)
+        {
+            UART_1_PutString("  10\tdl_pool_get_high_water()\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("  10\tdl_pool_get_high_water()\tFAIL\r\n");
+            result = DLT_FAILURE;
+        }
+    }
+    
+    /*
+     *  Test dl_head_add_last().
+     */
+    if (result == DLT_SUCCESS)
+    {
+        head_1.pool = &pool_1;
+        
+        if (dl_head_add_last(&head_1, _TAG, object_1) == DL_SUCCESS &&
+            dl_pool_get_used(&pool_1) == 3)
+        {
+            UART_1_PutString("  11\tdl_head_add_last()\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("  11\tdl_head_add_last()\tFAIL\r\n");
+            result = DLT_FAILURE;
+        }
+    }
+    
+    /*
+     *  Test dl_head_destroy().
+     */
+    if (result == DLT_SUCCESS)
+    {
+        if (dl_head_destroy(&head_1) == DL_SUCCESS &&
+            dl_pool_get_used(&pool_1) == 2)
+        {
+            UART_1_PutString("  12\tdl_head_destroy()\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("  12\tdl_head_destroy()\tFAIL\r\n");
+            result = DLT_FAILURE;
+        }
+    }
+    
+    /*
+     *  Test dl_create().
+     */
+    if (result == DLT_SUCCESS)
+    {
+        used = dl_pool_get_used(NULL);
+        
+        if (dl_create(&node_4, _TAG, object_1) == DL_SUCCESS &&
+            dl_pool_get_used(NULL) == used + 1)
+        {
+            UART_1_PutString("  13\tdl_create()\t\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("  13\tdl_create()\t\tFAIL\r\n");
+            result = DLT_FAILURE;
+        }
+    }
+    
+    /*
+     *  Test dl_delete().
+     */
+    if (result == DLT_SUCCESS)
+    {
+        if (dl_delete(node_4) == DL_SUCCESS &&
+            dl_pool_get_used(NULL) == used)
+        {
+            UART_1_PutString("  14\tdl_delete()\t\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("  14\tdl_delete()\t\tFAIL\r\n");
+            result = DLT_FAILURE;
+        }
+    }
+    
+    /*
+     *  Report test result.
+     */
+    if (result == DLT_SUCCESS)
+    {
+        UART_1_PutString("\r\n");
+        UART_1_PutString("TEST PASSED\r\n");
+    }
+    else
+    {
+        UART_1_PutString("\r\n");
+        UART_1_PutString("TEST FAILED\r\n");
+    }
+    
+    /*
+     *  Clean-up test.
+     */
+    _destroy_object(object_1);
+    
+    while ((UART_1_ReadTxStatus() & UART_1_TX_STS_FIFO_EMPTY) !=
+        UART_1_TX_STS_FIFO_EMPTY)
+    {
+        CyDelay(1);
+    }
+    
+    UART_1_Stop();
+    
+    return result;
+}
+#endif
+
 /****************************************************************************
  *  Local Functions
  ****************************************************************************/
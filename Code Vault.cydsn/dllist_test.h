@@ -36,8 +36,14 @@
  *
  *  <H3> Introduction </H3>
  *
- *  The doubly linked list test library contains a single function that tests
- *  each of the functions that comprise the doubly linked list (DLL) library.
+ *  The doubly linked list test library contains four functions that test
+ *  the doubly linked list (DLL) library. The first, dlt_test_1(), tests each
+ *  of the functions that operate on bare DLL nodes, while the second,
+ *  dlt_test_2(), tests each of the functions that operate on a #DL_HEAD. The
+ *  third, dlt_test_3(), is only built in counted-list mode, and tests that
+ *  the node functions keep a #DL_HEAD up to date. The fourth, dlt_test_4(),
+ *  is only built if #DL_POOL_SIZE is defined, and tests the node pool
+ *  functions.
  *
  *  This function, dlt_test_1(), provides complete coverage of the DLL library
  *  codebase, with one exception. The following dl_create() code fragment has
@@ -160,8 +166,102 @@
  *  TEST PASSED
  *  @endcode
  *
- *  Alternatively, if no serial terminal is available, the dlt_test_1() return
- *  value may be checked to see if the test completed successfully or not.
+ *  Running dlt_test_2() in the same manner should produce the following
+ *  serial output.
+ *
+ *  @code
+ *  DOUBLY LINKED LIST HEAD TEST
+ *
+ *  Test    Function                Result
+ *  ----    --------                ------
+ *     -    Initialise test...      PASS
+ *     1    dl_head_add_first()     PASS
+ *     2    dl_head_add_first()     PASS
+ *     3    dl_head_add_last()      PASS
+ *     4    dl_head_add_last()      PASS
+ *     5    dl_head_get_first()     PASS
+ *     6    dl_head_get_first()     PASS
+ *     7    dl_head_get_last()      PASS
+ *     8    dl_head_get_last()      PASS
+ *     9    dl_head_get_count()     PASS
+ *    10    dl_head_get_count()     PASS
+ *     -    Initialise test...      PASS
+ *    11    dl_head_insert_before() PASS
+ *    12    dl_head_insert_before() PASS
+ *    13    dl_head_extract()       PASS
+ *    14    dl_head_extract()       PASS
+ *    15    dl_head_insert_after()  PASS
+ *    16    dl_head_insert_after()  PASS
+ *    17    dl_head_exchange()      PASS
+ *    18    dl_head_exchange()      PASS
+ *    19    dl_head_delete()        PASS
+ *    20    dl_head_delete()        PASS
+ *    21    dl_head_join()          PASS
+ *    22    dl_head_join()          PASS
+ *    23    dl_head_join()          PASS
+ *    24    dl_head_destroy()       PASS
+ *    25    dl_head_destroy()       PASS
+ *
+ *  TEST PASSED
+ *  @endcode
+ *
+ *  Running dlt_test_3() should produce the following serial output. Tests
+ *  14 and 15 are only run if #DL_DEBUG is also defined.
+ *
+ *  @code
+ *  DOUBLY LINKED LIST COUNTED TEST
+ *
+ *  Test    Function                Result
+ *  ----    --------                ------
+ *     -    Initialise test...      PASS
+ *     1    dl_insert_before()      PASS
+ *     2    dl_insert_after()       PASS
+ *     3    dl_get_first()          PASS
+ *     4    dl_get_last()           PASS
+ *     5    dl_get_count()          PASS
+ *     6    dl_exchange()           PASS
+ *     7    dl_extract()            PASS
+ *     8    dl_delete()             PASS
+ *     9    dl_join()               PASS
+ *    10    dl_join()               PASS
+ *    11    dl_join()               PASS
+ *    12    dl_join()               PASS
+ *    13    dl_destroy()            PASS
+ *    14    dl_head_verify()        PASS
+ *    15    dl_head_verify()        PASS
+ *
+ *  TEST PASSED
+ *  @endcode
+ *
+ *  Running dlt_test_4() should produce the following serial output.
+ *
+ *  @code
+ *  DOUBLY LINKED LIST POOL TEST
+ *
+ *  Test    Function                Result
+ *  ----    --------                ------
+ *     -    Initialise test...      PASS
+ *     1    dl_pool_init()          PASS
+ *     2    dl_pool_init()          PASS
+ *     3    dl_pool_init()          PASS
+ *     4    dl_pool_create()        PASS
+ *     5    dl_pool_create()        PASS
+ *     6    dl_pool_create()        PASS
+ *     7    dl_pool_get_used()      PASS
+ *     8    dl_pool_get_exhausted() PASS
+ *     9    dl_delete()             PASS
+ *    10    dl_pool_get_high_water()        PASS
+ *    11    dl_head_add_last()      PASS
+ *    12    dl_head_destroy()       PASS
+ *    13    dl_create()             PASS
+ *    14    dl_delete()             PASS
+ *
+ *  TEST PASSED
+ *  @endcode
+ *
+ *  Alternatively, if no serial terminal is available, the return value of
+ *  each test function may be checked to see if the test completed
+ *  successfully or not.
  *
  *  <H3> Hardware </H3>
  *
@@ -179,6 +279,7 @@
 /****************************************************************************
  *  Modules
  ****************************************************************************/
+#include "dllist.h"
 
 /****************************************************************************
  *  Definitions and Macros
@@ -238,6 +339,28 @@ typedef struct DLT_OBJECT
  */
 uint8 dlt_test_1(void);
 
+/**
+ *  @brief Tests the #DL_HEAD functions of the DLL library.
+ *  @return #DLT_SUCCESS if successful, otherwise #DLT_FAILURE.
+ */
+uint8 dlt_test_2(void);
+
+#ifdef DL_COUNTED
+/**
+ *  @brief Tests the counted-list mode of the DLL library.
+ *  @return #DLT_SUCCESS if successful, otherwise #DLT_FAILURE.
+ */
+uint8 dlt_test_3(void);
+#endif
+
+#ifdef DL_POOL_SIZE
+/**
+ *  @brief Tests the node pool functions of the DLL library.
+ *  @return #DLT_SUCCESS if successful, otherwise #DLT_FAILURE.
+ */
+uint8 dlt_test_4(void);
+#endif
+
 #endif
 
 /****************************************************************************
@@ -51,9 +51,94 @@
  */
 #define _TAG                            900
 
+/**
+ *  @brief Convert an error log read or write count into a slot index.
+ */
+#define _MASK                           (ER_LOG_SIZE - 1)
+
+/**
+ *  @brief The number of system ticks in a second.
+ */
+#define _TICKS_PER_SECOND               1000
+
+#ifdef ER_PERSIST_ROWS
+/**
+ *  @brief The number of export record bytes held by a persisted row.
+ */
+#define _ROW_PAYLOAD                    (CYDEV_EEPROM_ROW_SIZE - 4)
+
+/**
+ *  @brief Flags the first row of a persisted batch.
+ */
+#define _ROW_START                      0x80
+
+/**
+ *  @brief Flags the last row of a persisted batch.
+ */
+#define _ROW_END                        0x40
+
+/**
+ *  @brief Selects the number of export record bytes from the flags of a
+ *      persisted row.
+ */
+#define _ROW_LENGTH                     0x0F
+
+/**
+ *  @brief Seeds the check byte of a persisted row, so that an erased row
+ *      is never valid.
+ */
+#define _ROW_SEED                       0x5A
+
+#if ((ER_PERSIST_FIRST_ROW + ER_PERSIST_ROWS) * CYDEV_EEPROM_ROW_SIZE > \
+    CYDEV_EE_SIZE)
+#error ER_PERSIST_ROWS must fit within the EEPROM.
+#endif
+#endif
+
 /****************************************************************************
  *  Typedefs and Structures
  ****************************************************************************/
+/**
+ *  @brief The files named in the current export buffer.
+ */
+typedef struct _FILES
+{
+    /**
+     *  @brief One bit per file index, set once the file has been named.
+     */
+    uint8 named[(ER_FILES_SIZE + 8) / 8];
+} _FILES;
+
+/**
+ *  @brief A token bucket limiting the rate of a standard error.
+ */
+typedef struct _BUCKET
+{
+    /**
+     *  @brief The number of tokens the bucket holds, or zero if unlimited.
+     */
+    uint8 burst;
+    
+    /**
+     *  @brief The number of tokens gained each second.
+     */
+    uint8 rate;
+    
+    /**
+     *  @brief The number of tokens in the bucket.
+     */
+    uint8 tokens;
+    
+    /**
+     *  @brief The system tick up to which tokens have been gained.
+     */
+    uint32 time;
+    
+    /**
+     *  @brief The number of errors discarded for want of a token.
+     */
+    uint32 limited;
+} _BUCKET;
 
 /****************************************************************************
  *  Prototypes of Local Functions
@@ -93,12 +178,13 @@ static uint8 _create_location(ER_LOCATION **location, char *file, int line);
  *  @b ER_OPTIONS_NONE      | Selects no error options.
  *  @b ER_OPTIONS_TIMESTAMP | Selects the timestamp error option.
  *  @b ER_OPTIONS_LOCATION  | Selects the location error option.
+ *  @b ER_OPTIONS_COALESCE  | Selects the coalesce error option.
  *
  *  @param[in] file A pointer to the name of the file in which the
  *      error occurred.
  *  @param[in] line The line number at which the error occurred.
  *  @return #ER_SUCCESS if successful, otherwise #ER_BAD_ARGUMENT,
- *      #ER_NO_MEMORY, #ER_FULL, or #ER_FAILURE.
+ *      #ER_NO_MEMORY, #ER_FULL, #ER_LIMITED, #ER_FILTERED, or #ER_FAILURE.
  *  @remark Adds a node to the rear of the deque.
  *  @warning It is up to the caller to ensure that the real-time clock
  *      component has been started prior to calling this function. Failure
@@ -126,7 +212,7 @@ uint8 _add_standard(DE_LIST *deque, uint32 number, uint8 options,
  *      error occurred.
  *  @param[in] line The line number at which the error occurred.
  *  @return #ER_SUCCESS if successful, otherwise #ER_BAD_ARGUMENT,
- *      #ER_NO_MEMORY, #ER_FULL, or #ER_FAILURE.
+ *      #ER_NO_MEMORY, #ER_FULL, #ER_FILTERED, or #ER_FAILURE.
  *  @remark Adds a node to the rear of the deque.
  *  @warning It is up to the caller to ensure that the real-time clock
  *      component has been started prior to calling this function. Failure
@@ -136,6 +222,263 @@ uint8 _add_standard(DE_LIST *deque, uint32 number, uint8 options,
 uint8 _add_special(DE_LIST *deque, char *message, uint8 options,
     char *file, int line);
 
+/**
+ *  @brief Add a new standard error object of a given severity to a deque.
+ *  @param[in] deque A pointer to a deque.
+ *  @param[in] level The severity level of the error.
+ *  @param[in] number The standard error number.
+ *  @param[in] options The selected error options.
+ *  @param[in] file A pointer to the name of the file in which the
+ *      error occurred.
+ *  @param[in] line The line number at which the error occurred.
+ *  @return #ER_SUCCESS if successful, otherwise #ER_BAD_ARGUMENT,
+ *      #ER_NO_MEMORY, #ER_FULL, #ER_LIMITED, #ER_FILTERED, or #ER_FAILURE.
+ */
+uint8 _report_standard(DE_LIST *deque, uint8 level, uint32 number,
+    uint8 options, char *file, int line);
+
+/**
+ *  @brief Add a new special error object of a given severity to a deque.
+ *  @param[in] deque A pointer to a deque.
+ *  @param[in] level The severity level of the error.
+ *  @param[in] message A pointer to the special message.
+ *  @param[in] options The selected error options.
+ *  @param[in] file A pointer to the name of the file in which the
+ *      error occurred.
+ *  @param[in] line The line number at which the error occurred.
+ *  @return #ER_SUCCESS if successful, otherwise #ER_BAD_ARGUMENT,
+ *      #ER_NO_MEMORY, #ER_FULL, #ER_FILTERED, or #ER_FAILURE.
+ */
+uint8 _report_special(DE_LIST *deque, uint8 level, char *message,
+    uint8 options, char *file, int line);
+
+/**
+ *  @brief Record a new standard error object in an error log.
+ *  @param[in] log A pointer to an error log.
+ *  @param[in] number The standard error number.
+ *  @param[in] options The selected error options.
+ *  @param[in] file A pointer to the name of the file in which the
+ *      error occurred.
+ *  @param[in] line The line number at which the error occurred.
+ *  @return #ER_SUCCESS if successful, otherwise #ER_BAD_ARGUMENT,
+ *      #ER_FULL, #ER_LIMITED, #ER_FILTERED, or #ER_FAILURE.
+ */
+uint8 _log_standard(ER_LOG *log, uint32 number, uint8 options,
+    char *file, int line);
+
+/**
+ *  @brief Record a new special error object in an error log.
+ *  @param[in] log A pointer to an error log.
+ *  @param[in] message A pointer to the special message.
+ *  @param[in] options The selected error options.
+ *  @param[in] file A pointer to the name of the file in which the
+ *      error occurred.
+ *  @param[in] line The line number at which the error occurred.
+ *  @return #ER_SUCCESS if successful, otherwise #ER_BAD_ARGUMENT,
+ *      #ER_FULL, #ER_FILTERED, or #ER_FAILURE.
+ */
+uint8 _log_special(ER_LOG *log, char *message, uint8 options,
+    char *file, int line);
+
+/**
+ *  @brief Record a new standard error object of a given severity in an
+ *      error log.
+ *  @param[in] log A pointer to an error log.
+ *  @param[in] level The severity level of the error.
+ *  @param[in] number The standard error number.
+ *  @param[in] options The selected error options.
+ *  @param[in] file A pointer to the name of the file in which the
+ *      error occurred.
+ *  @param[in] line The line number at which the error occurred.
+ *  @return #ER_SUCCESS if successful, otherwise #ER_BAD_ARGUMENT,
+ *      #ER_FULL, #ER_LIMITED, #ER_FILTERED, or #ER_FAILURE.
+ */
+uint8 _log_report_standard(ER_LOG *log, uint8 level, uint32 number,
+    uint8 options, char *file, int line);
+
+/**
+ *  @brief Record a new special error object of a given severity in an
+ *      error log.
+ *  @param[in] log A pointer to an error log.
+ *  @param[in] level The severity level of the error.
+ *  @param[in] message A pointer to the special message.
+ *  @param[in] options The selected error options.
+ *  @param[in] file A pointer to the name of the file in which the
+ *      error occurred.
+ *  @param[in] line The line number at which the error occurred.
+ *  @return #ER_SUCCESS if successful, otherwise #ER_BAD_ARGUMENT,
+ *      #ER_FULL, #ER_FILTERED, or #ER_FAILURE.
+ */
+uint8 _log_report_special(ER_LOG *log, uint8 level, char *message,
+    uint8 options, char *file, int line);
+
+/**
+ *  @brief Claim the next slot of an error log, and fill its options.
+ *  @param[in] log A pointer to an error log.
+ *  @param[in] options The selected error options.
+ *  @param[in] file A pointer to the name of the file in which the
+ *      error occurred.
+ *  @param[in] line The line number at which the error occurred.
+ *  @param[out] object A pointer to a pointer to the claimed error object.
+ *  @return #ER_SUCCESS if successful, otherwise #ER_FULL or #ER_FAILURE.
+ *  @remark The caller must fill the type and error of the claimed object.
+ */
+static uint8 _claim_slot(ER_LOG *log, uint8 options, char *file, int line,
+    ER_OBJECT **object);
+
+/**
+ *  @brief Check whether a standard error repeats an error object.
+ *  @param[in] object A pointer to the error object.
+ *  @param[in] number The standard error number.
+ *  @param[in] options The selected error options.
+ *  @param[in] file A pointer to the name of the file in which the
+ *      error occurred.
+ *  @param[in] line The line number at which the error occurred.
+ *  @return One if the error number, file, and line all match, otherwise
+ *      zero.
+ */
+static uint8 _is_repeat(ER_OBJECT *object, uint32 number, uint8 options,
+    char *file, int line);
+
+/**
+ *  @brief Get the error object most recently added to a deque.
+ *  @param[in] deque A pointer to the deque.
+ *  @param[out] object A pointer to a pointer to the returned error object.
+ *  @return #ER_SUCCESS if successful, otherwise #ER_EMPTY.
+ *  @remark The error object is remembered by _add_object(), so the deque is
+ *      only searched when errors are added to more than one deque.
+ */
+static uint8 _get_newest(DE_LIST *deque, ER_OBJECT **object);
+
+/**
+ *  @brief Add an error object to the rear of a deque.
+ *  @param[in] deque A pointer to the deque.
+ *  @param[in] object A pointer to the error object.
+ *  @return #ER_SUCCESS if successful, otherwise #ER_NO_MEMORY or
+ *      #ER_FULL.
+ */
+static uint8 _add_object(DE_LIST *deque, ER_OBJECT *object);
+
+/**
+ *  @brief Record another occurrence of an error object.
+ *  @param[in] object A pointer to the error object.
+ *  @param[in] options The selected error options.
+ *  @param[in] storage A pointer to the storage for the timestamp of the last
+ *      occurrence, or NULL to allocate it from the heap.
+ *  @return #ER_SUCCESS if successful, otherwise #ER_NO_MEMORY or
+ *      #ER_FAILURE.
+ *  @remark Nothing is changed if the function fails.
+ */
+static uint8 _repeat(ER_OBJECT *object, uint8 options, RT_DATA *storage);
+
+/**
+ *  @brief Take a token from the bucket of a standard error number.
+ *  @param[in] number The standard error number.
+ *  @return #ER_SUCCESS if successful or the number is not rate limited,
+ *      otherwise #ER_LIMITED.
+ */
+static uint8 _take_token(uint32 number);
+
+/**
+ *  @brief Pack a timestamp into the six bytes of an exported record.
+ *  @param[in] timestamp A pointer to the timestamp.
+ *  @param[out] field A pointer to the six bytes.
+ */
+static void _pack_timestamp(RT_DATA *timestamp, uint8 *field);
+
+/**
+ *  @brief Unpack a timestamp from the six bytes of an exported record.
+ *  @param[in] field A pointer to the six bytes.
+ *  @param[out] timestamp A pointer to the timestamp.
+ *  @remark The day of the week and the day of the year are set to zero.
+ */
+static void _unpack_timestamp(uint8 *field, RT_DATA *timestamp);
+
+/**
+ *  @brief Find a file name in the table of file names, adding it if new.
+ *  @param[in] file A pointer to the name of the file.
+ *  @return The index of the file, or #ER_FILES_SIZE if the table is full.
+ *  @remark The table refers to the name, rather than holding a copy of it.
+ */
+static uint8 _intern(char *file);
+
+/**
+ *  @brief Encode an error object as a binary record.
+ *  @param[in] object A pointer to the error object.
+ *  @param[in,out] files A pointer to the files already named in the
+ *      buffer.
+ *  @param[out] buffer A pointer to the space remaining in the buffer.
+ *  @param[in] size The number of bytes remaining in the buffer.
+ *  @param[out] used A pointer to the returned number of bytes written.
+ *  @return #ER_SUCCESS if successful, otherwise #ER_FULL.
+ *  @remark A file record is written ahead of the error record if the
+ *      buffer has not yet named the error object's file. Nothing is
+ *      written if both records do not fit.
+ */
+static uint8 _encode(ER_OBJECT *object, _FILES *files, uint8 *buffer,
+    uint32 size, uint32 *used);
+
+/**
+ *  @brief Add the file named by a file record to the table of file names.
+ *  @param[in] record A pointer to the file record.
+ *  @param[in] size The number of bytes remaining in the buffer.
+ *  @param[in,out] files A pointer to the table index of each file
+ *      identifier used by the buffer.
+ *  @param[out] used A pointer to the returned number of bytes read.
+ *  @return #ER_SUCCESS if successful, otherwise #ER_BAD_ARGUMENT or
+ *      #ER_NO_MEMORY.
+ *  @remark The table holds a copy of the name, unless it already holds
+ *      the name or is full.
+ */
+static uint8 _decode_file(uint8 *record, uint32 size, uint8 *files,
+    uint32 *used);
+
+/**
+ *  @brief Decode a binary record as a new error object.
+ *  @param[in] deque A pointer to the deque to receive the error object.
+ *  @param[in] record A pointer to the error record.
+ *  @param[in] size The number of bytes remaining in the buffer.
+ *  @param[in] files A pointer to the table index of each file identifier
+ *      used by the buffer.
+ *  @param[out] used A pointer to the returned number of bytes read.
+ *  @return #ER_SUCCESS if successful, otherwise #ER_BAD_ARGUMENT,
+ *      #ER_NO_MEMORY, or #ER_FULL.
+ */
+static uint8 _decode(DE_LIST *deque, uint8 *record, uint32 size,
+    uint8 *files, uint32 *used);
+
+/**
+ *  @brief Free an error object and the information it points to.
+ *  @param[in] object A pointer to the error object.
+ */
+static void _free_object(ER_OBJECT *object);
+
+#ifdef ER_PERSIST_ROWS
+/**
+ *  @brief Read a persisted row.
+ *  @param[in] index The index of the row within the region.
+ *  @param[out] row A pointer to the returned row.
+ *  @return 1 if the row is valid, otherwise 0.
+ */
+static uint8 _read_row(uint16 index, uint8 *row);
+
+/**
+ *  @brief Write the next persisted row.
+ *  @param[in] flags The flags of the row.
+ *  @param[in] payload A pointer to the export record bytes of the row.
+ *  @return #ER_SUCCESS if successful, otherwise #ER_FAILURE.
+ *  @remark The number of export record bytes is taken from the flags.
+ */
+static uint8 _write_row(uint8 flags, uint8 *payload);
+
+/**
+ *  @brief Calculate the check byte of a persisted row.
+ *  @param[in] row A pointer to the row.
+ *  @return The check byte.
+ */
+static uint8 _get_check(uint8 *row);
+#endif
+
 /****************************************************************************
  *  Exported Variables
  ****************************************************************************/
@@ -160,6 +503,47 @@ char *ER_MESSAGES[ER_MAX] =
 /****************************************************************************
  *  Global Variables
  ****************************************************************************/
+/**
+ *  @brief The table of file names, indexed by file.
+ */
+static char *_files[ER_FILES_SIZE];
+
+/**
+ *  @brief The number of file names in the table.
+ */
+static uint8 _file_count = 0;
+
+/**
+ *  @brief The token buckets, indexed by standard error number.
+ */
+static _BUCKET _buckets[ER_MAX];
+
+/**
+ *  @brief The deque to which an error object was last added.
+ */
+static DE_LIST *_newest_deque = NULL;
+
+/**
+ *  @brief The error object last added to that deque, or NULL once freed.
+ */
+static ER_OBJECT *_newest_object = NULL;
+
+/**
+ *  @brief The lowest severity level of error to keep.
+ */
+static uint8 _threshold = ER_LEVEL_DEBUG;
+
+#ifdef ER_PERSIST_ROWS
+/**
+ *  @brief The index within the region of the next persisted row to write.
+ */
+static uint16 _next_row = 0;
+
+/**
+ *  @brief The sequence number of the next persisted row to write.
+ */
+static uint16 _next_sequence = 0;
+#endif
 
 /****************************************************************************
  *  Exported Functions
@@ -223,18 +607,7 @@ uint8 er_remove(DE_LIST *deque)
         
         if (result == DE_SUCCESS)
         {
-            if (object->timestamp != NULL)
-            {
-                free(object->timestamp);
-            }
-            
-            if (object->location != NULL)
-            {
-                free(object->location->file);
-                free(object->location);
-            }
-            
-            free(object);
+            _free_object(object);
         }
     }
     
@@ -284,30 +657,34 @@ uint8 er_get_location(ER_OBJECT *object, ER_LOCATION **location)
     return result;
 }
 
-uint8 er_convert_timestamp(RT_DATA *timestamp, char *string)
+uint8 er_get_file(ER_LOCATION *location, char **file)
 {
     uint8 result = ER_BAD_ARGUMENT;
     
-    if (timestamp != NULL && string != NULL)
+    if (location != NULL && file != NULL)
     {
-        result = rt_convert(timestamp, string);
+        if (location->file < _file_count)
+        {
+            *file = _files[location->file];
+        }
+        else
+        {
+            *file = "unknown";
+        }
+        
+        result = ER_SUCCESS;
     }
     
     return result;
 }
 
-uint8 er_convert_location(ER_LOCATION *location, char *string)
+uint8 er_get_occurrences(ER_OBJECT *object, uint32 *count)
 {
     uint8 result = ER_BAD_ARGUMENT;
-    char t[32] = {0};
     
-    if (location != NULL && string != NULL)
+    if (object != NULL && count != NULL)
     {
-        strcpy(string, "file ");
-        strcat(string, location->file);
-        strcat(string, " line ");
-        mi_utoa(location->line, t);
-        strcat(string, t);
+        *count = object->count;
         
         result = ER_SUCCESS;
     }
@@ -315,208 +692,1505 @@ uint8 er_convert_location(ER_LOCATION *location, char *string)
     return result;
 }
 
-uint8 er_destroy(DE_LIST *deque)
+uint8 er_get_last_timestamp(ER_OBJECT *object, RT_DATA **timestamp)
 {
     uint8 result = ER_BAD_ARGUMENT;
     
-    if (deque != NULL)
+    if (object != NULL && timestamp != NULL)
     {
-        while (de_get_count(deque) > 0)
+        if (object->last != NULL)
         {
-            er_remove(deque);
+            *timestamp = object->last;
         }
-    
+        else
+        {
+            *timestamp = object->timestamp;
+        }
+        
         result = ER_SUCCESS;
     }
     
     return result;
 }
 
-/****************************************************************************
- *  Local Functions
- ****************************************************************************/
-uint8 _add_standard(DE_LIST *deque, uint32 number, uint8 options,
-    char *file, int line)
+uint8 er_set_rate(uint32 number, uint8 burst, uint8 rate)
 {
-    ER_LOCATION *location = NULL;
-    ER_OBJECT *object;
     uint8 result = ER_BAD_ARGUMENT;
-    RT_DATA *timestamp = NULL;
     
-    if (deque != NULL && file != NULL)
+    if (number < ER_MAX)
     {
-        if (options & ER_OPTIONS_TIMESTAMP)
-        {
-            result = _create_timestamp(&timestamp);
-        }
-        else
-        {
-            result = ER_SUCCESS;
-        }
+        _buckets[number].burst = burst;
+        _buckets[number].rate = rate;
+        _buckets[number].tokens = burst;
+        _buckets[number].time = rt_get_ticks();
+        _buckets[number].limited = 0;
         
-        if ((options & ER_OPTIONS_LOCATION) && (result == ER_SUCCESS))
-        {
-            result = _create_location(&location, file, line);
-            
-            if (result != ER_SUCCESS)
-            {
-                if (options & ER_OPTIONS_TIMESTAMP)
-                {
-                    free(timestamp);
-                }
-            }
-        }
+        result = ER_SUCCESS;
+    }
+    
+    return result;
+}
+
+uint32 er_get_limited(uint32 number)
+{
+    uint32 limited = 0;
+    
+    if (number < ER_MAX)
+    {
+        limited = _buckets[number].limited;
+    }
+    
+    return limited;
+}
+
+uint8 er_get_level(ER_OBJECT *object, uint8 *level)
+{
+    uint8 result = ER_BAD_ARGUMENT;
+    
+    if (object != NULL && level != NULL)
+    {
+        *level = object->level;
         
-        if (result == ER_SUCCESS)
-        {
-            object = malloc(sizeof(*object));
+        result = ER_SUCCESS;
+    }
+    
+    return result;
+}
+
+uint8 er_set_threshold(uint8 level)
+{
+    uint8 result = ER_BAD_ARGUMENT;
+    
+    if (level <= ER_LEVEL_FATAL)
+    {
+        _threshold = level;
+        
+        result = ER_SUCCESS;
+    }
+    
+    return result;
+}
+
+uint8 er_get_threshold(void)
+{
+    return _threshold;
+}
+
+uint8 er_convert_timestamp(RT_DATA *timestamp, char *string)
+{
+    uint8 result = ER_BAD_ARGUMENT;
+    
+    if (timestamp != NULL && string != NULL)
+    {
+        result = rt_convert(timestamp, string);
+    }
+    
+    return result;
+}
+
+uint8 er_convert_location(ER_LOCATION *location, char *string)
+{
+    char *file;
+    uint8 result = ER_BAD_ARGUMENT;
+    char t[32] = {0};
+    
+    if (location != NULL && string != NULL)
+    {
+        er_get_file(location, &file);
+        
+        strcpy(string, "file ");
+        strcat(string, file);
+        strcat(string, " line ");
+        mi_utoa(location->line, t);
+        strcat(string, t);
+        
+        result = ER_SUCCESS;
+    }
+    
+    return result;
+}
+
+uint8 er_destroy(DE_LIST *deque)
+{
+    uint8 result = ER_BAD_ARGUMENT;
+    
+    if (deque != NULL)
+    {
+        while (de_get_count(deque) > 0)
+        {
+            er_remove(deque);
+        }
+    
+        result = ER_SUCCESS;
+    }
+    
+    return result;
+}
+
+uint8 er_log_get_object(ER_LOG *log, uint32 index, ER_OBJECT **object)
+{
+    uint8 result = ER_BAD_ARGUMENT;
+    
+    if (log != NULL && object != NULL)
+    {
+        if (log->write == log->read)
+        {
+            result = ER_EMPTY;
+        }
+        else if (index < log->write - log->read)
+        {
+            *object = &log->slots[(log->read + index) & _MASK].object;
+            
+            result = ER_SUCCESS;
+        }
+    }
+    
+    return result;
+}
+
+uint8 er_log_remove(ER_LOG *log)
+{
+    uint8 result = ER_BAD_ARGUMENT;
+    
+    if (log != NULL)
+    {
+        if (log->write != log->read)
+        {
+            ++log->read;
+            
+            result = ER_SUCCESS;
+        }
+        else
+        {
+            result = ER_EMPTY;
+        }
+    }
+    
+    return result;
+}
+
+uint32 er_log_get_count(ER_LOG *log)
+{
+    uint32 count = 0;
+    
+    if (log != NULL)
+    {
+        count = log->write - log->read;
+    }
+    
+    return count;
+}
+
+uint32 er_log_get_lost(ER_LOG *log)
+{
+    uint32 lost = 0;
+    
+    if (log != NULL)
+    {
+        lost = log->lost;
+    }
+    
+    return lost;
+}
+
+uint8 er_log_set_policy(ER_LOG *log, uint8 policy)
+{
+    uint8 result = ER_BAD_ARGUMENT;
+    
+    if ((log != NULL) &&
+        ((policy == ER_LOG_DROP) || (policy == ER_LOG_OVERWRITE)))
+    {
+        log->policy = policy;
+        
+        result = ER_SUCCESS;
+    }
+    
+    return result;
+}
+
+uint8 er_log_clear(ER_LOG *log)
+{
+    uint8 result = ER_BAD_ARGUMENT;
+    
+    if (log != NULL)
+    {
+        log->read = 0;
+        log->write = 0;
+        log->lost = 0;
+        
+        result = ER_SUCCESS;
+    }
+    
+    return result;
+}
+
+uint8 er_export(DE_LIST *deque, uint8 *buffer, uint32 size,
+    uint32 *written)
+{
+    _FILES files = {{0}};
+    ER_OBJECT *object;
+    uint8 result = ER_BAD_ARGUMENT;
+    uint32 used;
+    
+    if (deque != NULL && buffer != NULL && written != NULL)
+    {
+        *written = 0;
+        
+        result = ER_SUCCESS;
+        
+        while ((result == ER_SUCCESS) &&
+            (de_get_first_object(deque, NULL, (void **)&object) ==
+            DE_SUCCESS))
+        {
+            result = _encode(object, &files, &buffer[*written],
+                size - *written, &used);
+            
+            if (result == ER_SUCCESS)
+            {
+                *written += used;
+                er_remove(deque);
+            }
+        }
+    }
+    
+    return result;
+}
+
+uint8 er_log_export(ER_LOG *log, uint8 *buffer, uint32 size,
+    uint32 *written)
+{
+    _FILES files = {{0}};
+    ER_OBJECT *object;
+    uint8 result = ER_BAD_ARGUMENT;
+    uint32 used;
+    
+    if (log != NULL && buffer != NULL && written != NULL)
+    {
+        *written = 0;
+        
+        result = ER_SUCCESS;
+        
+        while ((result == ER_SUCCESS) &&
+            (er_log_get_object(log, 0, &object) == ER_SUCCESS))
+        {
+            result = _encode(object, &files, &buffer[*written],
+                size - *written, &used);
+            
+            if (result == ER_SUCCESS)
+            {
+                *written += used;
+                er_log_remove(log);
+            }
+        }
+    }
+    
+    return result;
+}
+
+uint8 er_import(DE_LIST *deque, uint8 *buffer, uint32 size)
+{
+    uint8 files[256];
+    uint8 result = ER_BAD_ARGUMENT;
+    uint32 used;
+    
+    if (deque != NULL && buffer != NULL)
+    {
+        /*
+         *  A buffer may only refer to files that it has named, so any other
+         *  file identifier is given the file name "unknown".
+         */
+        memset(files, ER_FILES_SIZE, sizeof(files));
+        
+        result = ER_SUCCESS;
+        
+        while ((result == ER_SUCCESS) && (size > 0))
+        {
+            if ((buffer[0] & ER_RECORD_KIND) == ER_RECORD_FILE)
+            {
+                result = _decode_file(buffer, size, files, &used);
+            }
+            else
+            {
+                result = _decode(deque, buffer, size, files, &used);
+            }
+            
+            if (result == ER_SUCCESS)
+            {
+                buffer += used;
+                size -= used;
+            }
+        }
+    }
+    
+    return result;
+}
+
+#ifdef ER_PERSIST_ROWS
+uint8 er_persist_start(void)
+{
+    uint16 i;
+    uint16 newest = 0;
+    uint8 result = ER_EMPTY;
+    uint8 row[CYDEV_EEPROM_ROW_SIZE];
+    uint16 sequence;
+    
+    for (i = 0 ; i < ER_PERSIST_ROWS ; i++)
+    {
+        if (_read_row(i, row) == 1)
+        {
+            sequence = row[0] | (row[1] << 8);
+            
+            /*
+             *  The valid rows were written within the last lap of the
+             *  region, so their sequence numbers may be compared across a
+             *  wrap of the counter.
+             */
+            if ((result == ER_EMPTY) ||
+                ((int16)(uint16)(sequence - newest) > 0))
+            {
+                newest = sequence;
+                
+                _next_row = (i + 1) % ER_PERSIST_ROWS;
+                _next_sequence = sequence + 1;
+                
+                result = ER_SUCCESS;
+            }
+        }
+    }
+    
+    if (result == ER_EMPTY)
+    {
+        _next_row = 0;
+        _next_sequence = 0;
+    }
+    
+    return result;
+}
+
+uint8 er_persist_commit(DE_LIST *deque)
+{
+    uint8 batch[ER_PERSIST_BATCH * _ROW_PAYLOAD];
+    uint8 flags;
+    uint32 length;
+    uint32 offset;
+    uint8 result = ER_BAD_ARGUMENT;
+    uint32 written;
+    
+    if (deque != NULL)
+    {
+        result = ER_FULL;
+        
+        while (result == ER_FULL)
+        {
+            result = er_export(deque, batch, sizeof(batch), &written);
+            
+            if ((result == ER_FULL) && (written == 0))
+            {
+                er_remove(deque);
+            }
+            
+            for (offset = 0 ; (offset < written) && (result != ER_FAILURE) ;
+                offset += length)
+            {
+                length = written - offset;
+                
+                if (length > _ROW_PAYLOAD)
+                {
+                    length = _ROW_PAYLOAD;
+                }
+                
+                flags = length;
+                
+                if (offset == 0)
+                {
+                    flags |= _ROW_START;
+                }
+                
+                if (offset + length == written)
+                {
+                    flags |= _ROW_END;
+                }
+                
+                if (_write_row(flags, &batch[offset]) != ER_SUCCESS)
+                {
+                    result = ER_FAILURE;
+                }
+            }
+        }
+    }
+    
+    return result;
+}
+
+uint8 er_persist_restore(DE_LIST *deque)
+{
+    uint8 batch[ER_PERSIST_BATCH * _ROW_PAYLOAD];
+    uint16 expected = 0;
+    uint16 i;
+    uint32 length = 0;
+    uint8 open = 0;
+    uint8 result = ER_BAD_ARGUMENT;
+    uint8 row[CYDEV_EEPROM_ROW_SIZE];
+    uint16 sequence;
+    
+    if (deque != NULL)
+    {
+        result = ER_SUCCESS;
+        
+        /*
+         *  The next row to be written is the oldest row of a full region.
+         */
+        for (i = 0 ; (i < ER_PERSIST_ROWS) && (result == ER_SUCCESS) ; i++)
+        {
+            if (_read_row((_next_row + i) % ER_PERSIST_ROWS, row) == 0)
+            {
+                open = 0;
+            }
+            else
+            {
+                sequence = row[0] | (row[1] << 8);
+                
+                if (row[2] & _ROW_START)
+                {
+                    open = 1;
+                    length = 0;
+                }
+                else if (sequence != expected)
+                {
+                    open = 0;
+                }
+                
+                if ((open == 1) &&
+                    (length + (row[2] & _ROW_LENGTH) > sizeof(batch)))
+                {
+                    open = 0;
+                }
+                
+                if (open == 1)
+                {
+                    memcpy(&batch[length], &row[4], row[2] & _ROW_LENGTH);
+                    
+                    length += row[2] & _ROW_LENGTH;
+                    expected = sequence + 1;
+                    
+                    if (row[2] & _ROW_END)
+                    {
+                        result = er_import(deque, batch, length);
+                        
+                        open = 0;
+                    }
+                }
+            }
+        }
+    }
+    
+    return result;
+}
+
+uint8 er_persist_clear(void)
+{
+    uint16 i;
+    uint8 result = ER_SUCCESS;
+    uint8 row[CYDEV_EEPROM_ROW_SIZE] = {0};
+    
+    for (i = 0 ; (i < ER_PERSIST_ROWS) && (result == ER_SUCCESS) ; i++)
+    {
+        if (EEPROM_1_Write(row, ER_PERSIST_FIRST_ROW + i) != CYRET_SUCCESS)
+        {
+            result = ER_FAILURE;
+        }
+    }
+    
+    _next_row = 0;
+    _next_sequence = 0;
+    
+    return result;
+}
+#endif
+
+/****************************************************************************
+ *  Local Functions
+ ****************************************************************************/
+uint8 _add_standard(DE_LIST *deque, uint32 number, uint8 options,
+    char *file, int line)
+{
+    return _report_standard(deque, ER_LEVEL_ERROR, number, options, file,
+        line);
+}
+
+uint8 _report_standard(DE_LIST *deque, uint8 level, uint32 number,
+    uint8 options, char *file, int line)
+{
+    ER_LOCATION *location = NULL;
+    ER_OBJECT *object;
+    uint8 result = ER_BAD_ARGUMENT;
+    RT_DATA *timestamp = NULL;
+    
+    if (deque != NULL && file != NULL && level <= ER_LEVEL_FATAL)
+    {
+        if (level < _threshold)
+        {
+            result = ER_FILTERED;
+        }
+        else if ((options & ER_OPTIONS_COALESCE) &&
+            (_get_newest(deque, &object) == ER_SUCCESS) &&
+            (_is_repeat(object, number, options, file, line) == 1))
+        {
+            result = _repeat(object, options, NULL);
+        }
+        else
+        {
+            result = _take_token(number);
+            
+            if (result == ER_SUCCESS)
+            {
+                if (options & ER_OPTIONS_TIMESTAMP)
+                {
+                    result = _create_timestamp(&timestamp);
+                }
+                
+                if ((options & ER_OPTIONS_LOCATION) &&
+                    (result == ER_SUCCESS))
+                {
+                    result = _create_location(&location, file, line);
+                    
+                    if (result != ER_SUCCESS)
+                    {
+                        if (options & ER_OPTIONS_TIMESTAMP)
+                        {
+                            free(timestamp);
+                        }
+                    }
+                }
+                
+                if (result == ER_SUCCESS)
+                {
+                    object = malloc(sizeof(*object));
+                    
+                    if (object != NULL)
+                    {
+                        object->error_type = ER_STANDARD_TYPE;
+                        object->level = level;
+                        object->error.number = number;
+                        object->timestamp = timestamp;
+                        object->location = location;
+                        object->count = 1;
+                        object->last = NULL;
+                        
+                        result = _add_object(deque, object);
+                        
+                        if (result != DE_SUCCESS)
+                        {
+                            if (options & ER_OPTIONS_TIMESTAMP)
+                            {
+                                free(timestamp);
+                            }
+                            
+                            if (options & ER_OPTIONS_LOCATION)
+                            {
+                                free(location);
+                            }
+                            
+                            free(object);
+                        }
+                    }
+                    else
+                    {
+                        if (options & ER_OPTIONS_TIMESTAMP)
+                        {
+                            free(timestamp);
+                        }
+                        
+                        if (options & ER_OPTIONS_LOCATION)
+                        {
+                            free(location);
+                        }
+                        
+                        result = ER_NO_MEMORY;
+                    }
+                }
+            }
+        }
+    }
+    
+    return result;
+}
+
+uint8 _add_special(DE_LIST *deque, char *message, uint8 options,
+    char *file, int line)
+{
+    return _report_special(deque, ER_LEVEL_ERROR, message, options, file,
+        line);
+}
+
+uint8 _report_special(DE_LIST *deque, uint8 level, char *message,
+    uint8 options, char *file, int line)
+{
+    ER_LOCATION *location = NULL;
+    char *new_message;
+    ER_OBJECT *object;
+    uint8 result = ER_BAD_ARGUMENT;
+    RT_DATA *timestamp = NULL;
+    
+    if (deque != NULL && message != NULL && file != NULL &&
+        level <= ER_LEVEL_FATAL)
+    {
+        if (level < _threshold)
+        {
+            result = ER_FILTERED;
+        }
+        else if (options & ER_OPTIONS_TIMESTAMP)
+        {
+            result = _create_timestamp(&timestamp);
+        }
+        else
+        {
+            result = ER_SUCCESS;
+        }
+        
+        if ((options & ER_OPTIONS_LOCATION) && result == ER_SUCCESS)
+        {
+            result = _create_location(&location, file, line);
+            
+            if (result != ER_SUCCESS)
+            {
+                if (options & ER_OPTIONS_TIMESTAMP)
+                {
+                    free(timestamp);
+                }
+            }
+        }
+        
+        if (result == ER_SUCCESS)
+        {
+            object = malloc(sizeof(*object));
+            
+            if (object != NULL)
+            {
+                object->error_type = ER_SPECIAL_TYPE;
+                object->level = level;
+                
+                new_message = malloc(strlen(message) + 1);
+                
+                if (new_message != NULL)
+                {
+                    strcpy(new_message, message);
+                    object->error.message = new_message;
+                }
+                else
+                {
+                    free(object);
+                    
+                    result = ER_NO_MEMORY;
+                }
+            }
+            
+            if (result == ER_SUCCESS)
+            {   
+                object->timestamp = timestamp;
+                object->location = location;
+                object->count = 1;
+                object->last = NULL;
+                
+                result = _add_object(deque, object);
+                
+                if (result != DE_SUCCESS)
+                {
+                    if (options & ER_OPTIONS_TIMESTAMP)
+                    {
+                        free(timestamp);
+                    }
+                    
+                    if (options & ER_OPTIONS_LOCATION)
+                    {
+                        free(location);
+                    }
+                    
+                    free(object);
+                }
+            }
+            else
+            {
+                if (options & ER_OPTIONS_TIMESTAMP)
+                {
+                    free(timestamp);
+                }
+                
+                if (options & ER_OPTIONS_LOCATION)
+                {
+                    free(location);
+                }
+                
+                result = ER_NO_MEMORY;
+            }
+        }
+    }
+    
+    return result;
+}
+
+uint8 _log_standard(ER_LOG *log, uint32 number, uint8 options,
+    char *file, int line)
+{
+    return _log_report_standard(log, ER_LEVEL_ERROR, number, options, file,
+        line);
+}
+
+uint8 _log_report_standard(ER_LOG *log, uint8 level, uint32 number,
+    uint8 options, char *file, int line)
+{
+    ER_OBJECT *object;
+    uint8 result = ER_BAD_ARGUMENT;
+    ER_SLOT *slot;
+    
+    if (log != NULL && file != NULL && level <= ER_LEVEL_FATAL)
+    {
+        slot = &log->slots[(log->write - 1) & _MASK];
+        
+        if (level < _threshold)
+        {
+            result = ER_FILTERED;
+        }
+        else if ((options & ER_OPTIONS_COALESCE) &&
+            (log->write != log->read) &&
+            (_is_repeat(&slot->object, number, options, file, line) == 1))
+        {
+            result = _repeat(&slot->object, options, &slot->last);
+        }
+        else
+        {
+            result = _take_token(number);
             
-            if (object != NULL)
+            if (result == ER_SUCCESS)
+            {
+                result = _claim_slot(log, options, file, line, &object);
+            }
+            
+            if (result == ER_SUCCESS)
+            {
+                object->error_type = ER_STANDARD_TYPE;
+                object->level = level;
+                object->error.number = number;
+            }
+        }
+    }
+    
+    return result;
+}
+
+uint8 _log_special(ER_LOG *log, char *message, uint8 options,
+    char *file, int line)
+{
+    return _log_report_special(log, ER_LEVEL_ERROR, message, options, file,
+        line);
+}
+
+uint8 _log_report_special(ER_LOG *log, uint8 level, char *message,
+    uint8 options, char *file, int line)
+{
+    ER_OBJECT *object;
+    uint8 result = ER_BAD_ARGUMENT;
+    
+    if (log != NULL && message != NULL && file != NULL &&
+        level <= ER_LEVEL_FATAL)
+    {
+        if (level < _threshold)
+        {
+            result = ER_FILTERED;
+        }
+        else
+        {
+            result = _claim_slot(log, options, file, line, &object);
+        }
+        
+        if (result == ER_SUCCESS)
+        {
+            object->error_type = ER_SPECIAL_TYPE;
+            object->level = level;
+            object->error.message = message;
+        }
+    }
+    
+    return result;
+}
+
+uint8 _claim_slot(ER_LOG *log, uint8 options, char *file, int line,
+    ER_OBJECT **object)
+{
+    ER_SLOT *slot;
+    RT_DATA timestamp;
+    uint8 result = ER_SUCCESS;
+    
+    if ((log->write - log->read >= ER_LOG_SIZE) &&
+        (log->policy == ER_LOG_DROP))
+    {
+        ++log->lost;
+        
+        result = ER_FULL;
+    }
+    else if (options & ER_OPTIONS_TIMESTAMP)
+    {
+        /*
+         *  Read the clock before claiming the slot, so that a failure
+         *  leaves the oldest error object in place.
+         */
+        result = rt_read(&timestamp);
+    }
+    
+    if (result == ER_SUCCESS)
+    {
+        if (log->write - log->read >= ER_LOG_SIZE)
+        {
+            ++log->read;
+            ++log->lost;
+        }
+        
+        slot = &log->slots[log->write & _MASK];
+        slot->object.timestamp = NULL;
+        slot->object.location = NULL;
+        slot->object.count = 1;
+        slot->object.last = NULL;
+        
+        if (options & ER_OPTIONS_TIMESTAMP)
+        {
+            slot->timestamp = timestamp;
+            slot->object.timestamp = &slot->timestamp;
+        }
+        
+        if (options & ER_OPTIONS_LOCATION)
+        {
+            slot->location.file = _intern(file);
+            slot->location.line = line;
+            slot->object.location = &slot->location;
+        }
+        
+        ++log->write;
+        
+        *object = &slot->object;
+    }
+    
+    return result;
+}
+
+uint8 _encode(ER_OBJECT *object, _FILES *files, uint8 *buffer,
+    uint32 size, uint32 *used)
+{
+    char *file;
+    uint32 file_length = 0;
+    uint8 id = 0;
+    RT_DATA *last;
+    uint32 message_length = 0;
+    uint8 named = 1;
+    uint8 *record;
+    uint8 result = ER_SUCCESS;
+    uint32 tail = ER_RECORD_SIZE;
+    uint32 total;
+    
+    if (object->error_type == ER_SPECIAL_TYPE)
+    {
+        message_length = strlen(object->error.message);
+        
+        if (message_length > 255)
+        {
+            message_length = 255;
+        }
+        
+        tail += 1 + message_length;
+    }
+    
+    total = tail;
+    
+    if (object->count > 1)
+    {
+        total += 4;
+        
+        if (object->timestamp != NULL)
+        {
+            total += 6;
+        }
+    }
+    
+    if (object->location != NULL)
+    {
+        id = object->location->file;
+        
+        if ((files->named[id / 8] & (1 << (id % 8))) == 0)
+        {
+            named = 0;
+            
+            er_get_file(object->location, &file);
+            
+            file_length = strlen(file);
+            
+            if (file_length > 255)
+            {
+                file_length = 255;
+            }
+            
+            total += 3 + file_length;
+        }
+    }
+    
+    if (total <= size)
+    {
+        record = buffer;
+        
+        if (named == 0)
+        {
+            files->named[id / 8] |= 1 << (id % 8);
+            
+            record[0] = ER_RECORD_FILE;
+            record[1] = id;
+            record[2] = file_length;
+            memcpy(&record[3], file, file_length);
+            
+            record = &record[3 + file_length];
+        }
+        
+        memset(record, 0, ER_RECORD_SIZE);
+        
+        if (object->error_type == ER_SPECIAL_TYPE)
+        {
+            record[0] = ER_RECORD_SPECIAL;
+            record[ER_RECORD_SIZE] = message_length;
+            memcpy(&record[ER_RECORD_SIZE + 1], object->error.message,
+                message_length);
+        }
+        else
+        {
+            record[0] = ER_RECORD_STANDARD;
+            record[1] = object->error.number & 0xFF;
+            record[2] = (object->error.number >> 8) & 0xFF;
+        }
+        
+        if (object->location != NULL)
+        {
+            record[0] |= ER_RECORD_LOCATION;
+            record[3] = id;
+            record[4] = object->location->line & 0xFF;
+            record[5] = (object->location->line >> 8) & 0xFF;
+        }
+        
+        if (object->timestamp != NULL)
+        {
+            record[0] |= ER_RECORD_TIMESTAMP;
+            _pack_timestamp(object->timestamp, &record[6]);
+        }
+        
+        record[0] |= (object->level << ER_RECORD_LEVEL_SHIFT) &
+            ER_RECORD_LEVEL;
+        
+        if (object->count > 1)
+        {
+            record[0] |= ER_RECORD_REPEAT;
+            record[tail] = object->count & 0xFF;
+            record[tail + 1] = (object->count >> 8) & 0xFF;
+            record[tail + 2] = (object->count >> 16) & 0xFF;
+            record[tail + 3] = (object->count >> 24) & 0xFF;
+            
+            if (object->timestamp != NULL)
+            {
+                er_get_last_timestamp(object, &last);
+                _pack_timestamp(last, &record[tail + 4]);
+            }
+        }
+        
+        *used = total;
+    }
+    else
+    {
+        result = ER_FULL;
+    }
+    
+    return result;
+}
+
+uint8 _decode_file(uint8 *record, uint32 size, uint8 *files,
+    uint32 *used)
+{
+    char *copy;
+    uint8 index;
+    uint8 result = ER_BAD_ARGUMENT;
+    
+    if ((size >= 3) && (size >= 3u + record[2]))
+    {
+        copy = malloc(record[2] + 1);
+        
+        if (copy != NULL)
+        {
+            memcpy(copy, &record[3], record[2]);
+            copy[record[2]] = '\0';
+            
+            index = _intern(copy);
+            
+            if ((index == ER_FILES_SIZE) || (_files[index] != copy))
+            {
+                free(copy);
+            }
+            
+            files[record[1]] = index;
+            
+            *used = 3 + record[2];
+            
+            result = ER_SUCCESS;
+        }
+        else
+        {
+            result = ER_NO_MEMORY;
+        }
+    }
+    
+    return result;
+}
+
+uint8 _decode(DE_LIST *deque, uint8 *record, uint32 size,
+    uint8 *files, uint32 *used)
+{
+    uint32 length = ER_RECORD_SIZE;
+    ER_OBJECT *object;
+    uint8 result = ER_SUCCESS;
+    uint32 total;
+    
+    if ((size < ER_RECORD_SIZE) ||
+        ((record[0] & ER_RECORD_KIND) > ER_RECORD_SPECIAL) ||
+        ((record[0] >> ER_RECORD_LEVEL_SHIFT) > ER_LEVEL_FATAL))
+    {
+        result = ER_BAD_ARGUMENT;
+    }
+    else if ((record[0] & ER_RECORD_KIND) == ER_RECORD_SPECIAL)
+    {
+        if ((size < ER_RECORD_SIZE + 1u) ||
+            (size < ER_RECORD_SIZE + 1u + record[ER_RECORD_SIZE]))
+        {
+            result = ER_BAD_ARGUMENT;
+        }
+        else
+        {
+            length += 1 + record[ER_RECORD_SIZE];
+        }
+    }
+    else if ((record[1] | (record[2] << 8)) >= ER_MAX)
+    {
+        result = ER_BAD_ARGUMENT;
+    }
+    
+    total = length;
+    
+    if (record[0] & ER_RECORD_REPEAT)
+    {
+        total += 4;
+        
+        if (record[0] & ER_RECORD_TIMESTAMP)
+        {
+            total += 6;
+        }
+    }
+    
+    if ((result == ER_SUCCESS) && (total > size))
+    {
+        result = ER_BAD_ARGUMENT;
+    }
+    
+    if (result == ER_SUCCESS)
+    {
+        object = malloc(sizeof(*object));
+        
+        if (object != NULL)
+        {
+            object->error_type = ER_STANDARD_TYPE;
+            object->level = record[0] >> ER_RECORD_LEVEL_SHIFT;
+            object->error.number = record[1] | (record[2] << 8);
+            object->location = NULL;
+            object->timestamp = NULL;
+            object->count = 1;
+            object->last = NULL;
+            
+            if ((record[0] & ER_RECORD_KIND) == ER_RECORD_SPECIAL)
+            {
+                object->error_type = ER_SPECIAL_TYPE;
+                object->error.message = malloc(record[ER_RECORD_SIZE] + 1);
+                
+                if (object->error.message != NULL)
+                {
+                    memcpy(object->error.message, &record[ER_RECORD_SIZE + 1],
+                        record[ER_RECORD_SIZE]);
+                    object->error.message[record[ER_RECORD_SIZE]] = '\0';
+                }
+                else
+                {
+                    result = ER_NO_MEMORY;
+                }
+            }
+            
+            if ((result == ER_SUCCESS) && (record[0] & ER_RECORD_LOCATION))
+            {
+                object->location = malloc(sizeof(*object->location));
+                
+                if (object->location != NULL)
+                {
+                    object->location->file = files[record[3]];
+                    object->location->line = record[4] | (record[5] << 8);
+                }
+                else
+                {
+                    result = ER_NO_MEMORY;
+                }
+            }
+            
+            if ((result == ER_SUCCESS) && (record[0] & ER_RECORD_TIMESTAMP))
             {
-                object->error_type = ER_STANDARD_TYPE;
-                object->error.number = number;
-                object->timestamp = timestamp;
-                object->location = location;
+                object->timestamp = malloc(sizeof(*object->timestamp));
                 
-                result = de_add_last(deque, _TAG, object);
+                if (object->timestamp != NULL)
+                {
+                    _unpack_timestamp(&record[6], object->timestamp);
+                }
+                else
+                {
+                    result = ER_NO_MEMORY;
+                }
+            }
+            
+            if ((result == ER_SUCCESS) && (record[0] & ER_RECORD_REPEAT))
+            {
+                object->count = record[length] |
+                    (record[length + 1] << 8) |
+                    ((uint32)record[length + 2] << 16) |
+                    ((uint32)record[length + 3] << 24);
                 
-                if (result != DE_SUCCESS)
+                if (record[0] & ER_RECORD_TIMESTAMP)
                 {
-                    if (options & ER_OPTIONS_TIMESTAMP)
+                    object->last = malloc(sizeof(*object->last));
+                    
+                    if (object->last != NULL)
                     {
-                        free(timestamp);
+                        _unpack_timestamp(&record[length + 4], object->last);
                     }
-                    
-                    if (options & ER_OPTIONS_LOCATION)
+                    else
                     {
-                        free(location->file);
-                        free(location);
+                        result = ER_NO_MEMORY;
                     }
-                    
-                    free(object);
                 }
             }
-            else
+            
+            if (result == ER_SUCCESS)
             {
-                if (options & ER_OPTIONS_TIMESTAMP)
-                {
-                    free(timestamp);
-                }
-                
-                if (options & ER_OPTIONS_LOCATION)
-                {
-                    free(location->file);
-                    free(location);
-                }
-                
-                result = ER_NO_MEMORY;
+                result = _add_object(deque, object);
+            }
+            
+            if (result != ER_SUCCESS)
+            {
+                _free_object(object);
             }
         }
+        else
+        {
+            result = ER_NO_MEMORY;
+        }
+    }
+    
+    if (result == ER_SUCCESS)
+    {
+        *used = total;
     }
     
     return result;
 }
 
-uint8 _add_special(DE_LIST *deque, char *message, uint8 options,
+void _free_object(ER_OBJECT *object)
+{
+    if (object == _newest_object)
+    {
+        _newest_object = NULL;
+    }
+    
+    if (object->timestamp != NULL)
+    {
+        free(object->timestamp);
+    }
+    
+    if (object->location != NULL)
+    {
+        free(object->location);
+    }
+    
+    if (object->last != NULL)
+    {
+        free(object->last);
+    }
+    
+    if ((object->error_type == ER_SPECIAL_TYPE) &&
+        (object->error.message != NULL))
+    {
+        free(object->error.message);
+    }
+    
+    free(object);
+}
+
+#ifdef ER_PERSIST_ROWS
+uint8 _read_row(uint16 index, uint8 *row)
+{
+    uint32 address;
+    uint16 i;
+    uint8 valid = 0;
+    
+    address = (uint32)(ER_PERSIST_FIRST_ROW + index) * CYDEV_EEPROM_ROW_SIZE;
+    
+    for (i = 0 ; i < CYDEV_EEPROM_ROW_SIZE ; i++)
+    {
+        row[i] = CY_GET_REG8(CYDEV_EE_BASE + address + i);
+    }
+    
+    if ((row[3] == _get_check(row)) &&
+        ((row[2] & _ROW_LENGTH) <= _ROW_PAYLOAD))
+    {
+        valid = 1;
+    }
+    
+    return valid;
+}
+
+uint8 _write_row(uint8 flags, uint8 *payload)
+{
+    uint8 result = ER_SUCCESS;
+    uint8 row[CYDEV_EEPROM_ROW_SIZE] = {0};
+    
+    row[0] = _next_sequence & 0xFF;
+    row[1] = (_next_sequence >> 8) & 0xFF;
+    row[2] = flags;
+    memcpy(&row[4], payload, flags & _ROW_LENGTH);
+    row[3] = _get_check(row);
+    
+    if (EEPROM_1_Write(row, ER_PERSIST_FIRST_ROW + _next_row) !=
+        CYRET_SUCCESS)
+    {
+        result = ER_FAILURE;
+    }
+    
+    _next_row = (_next_row + 1) % ER_PERSIST_ROWS;
+    ++_next_sequence;
+    
+    return result;
+}
+
+uint8 _get_check(uint8 *row)
+{
+    uint8 check = _ROW_SEED;
+    uint16 i;
+    
+    for (i = 0 ; i < CYDEV_EEPROM_ROW_SIZE ; i++)
+    {
+        if (i != 3)
+        {
+            check ^= row[i];
+        }
+    }
+    
+    return check;
+}
+#endif
+
+uint8 _is_repeat(ER_OBJECT *object, uint32 number, uint8 options,
     char *file, int line)
 {
-    ER_LOCATION *location = NULL;
-    char *new_message;
-    ER_OBJECT *object;
-    uint8 result = ER_BAD_ARGUMENT;
-    RT_DATA *timestamp = NULL;
+    uint8 repeat = 0;
     
-    if (deque != NULL && message != NULL && file != NULL)
+    if ((object->error_type == ER_STANDARD_TYPE) &&
+        (object->error.number == number))
     {
-        if (options & ER_OPTIONS_TIMESTAMP)
+        /*
+         *  Compare pointers before names, as each file passes the same name
+         *  every time, but a name interned by er_import() is a copy. A
+         *  location whose file was not interned never matches.
+         */
+        if (options & ER_OPTIONS_LOCATION)
         {
-            result = _create_timestamp(&timestamp);
+            repeat = (object->location != NULL) &&
+                (object->location->line == (uint16)line) &&
+                (object->location->file < _file_count) &&
+                ((_files[object->location->file] == file) ||
+                (strcmp(_files[object->location->file], file) == 0));
         }
         else
         {
-            result = ER_SUCCESS;
+            repeat = (object->location == NULL);
         }
+    }
+    
+    return repeat;
+}
+
+uint8 _repeat(ER_OBJECT *object, uint8 options, RT_DATA *storage)
+{
+    uint8 result = ER_SUCCESS;
+    RT_DATA timestamp;
+    
+    /*
+     *  The time of the last occurrence is only kept for an error object
+     *  holding the time of its first.
+     */
+    if ((options & ER_OPTIONS_TIMESTAMP) && (object->timestamp != NULL))
+    {
+        result = rt_read(&timestamp);
         
-        if ((options & ER_OPTIONS_LOCATION) && result == ER_SUCCESS)
+        if ((result == RT_SUCCESS) && (object->last == NULL))
         {
-            result = _create_location(&location, file, line);
+            if (storage == NULL)
+            {
+                storage = malloc(sizeof(*storage));
+            }
             
-            if (result != ER_SUCCESS)
+            if (storage != NULL)
             {
-                if (options & ER_OPTIONS_TIMESTAMP)
-                {
-                    free(timestamp);
-                }
+                object->last = storage;
+            }
+            else
+            {
+                result = ER_NO_MEMORY;
             }
         }
         
         if (result == ER_SUCCESS)
         {
-            object = malloc(sizeof(*object));
-            
-            if (object != NULL)
+            *object->last = timestamp;
+        }
+    }
+    
+    if (result == ER_SUCCESS)
+    {
+        ++object->count;
+    }
+    
+    return result;
+}
+
+uint8 _get_newest(DE_LIST *deque, ER_OBJECT **object)
+{
+    uint8 result = ER_EMPTY;
+    
+    if ((deque == _newest_deque) && (_newest_object != NULL))
+    {
+        *object = _newest_object;
+        
+        result = ER_SUCCESS;
+    }
+    else if (de_get_last_object(deque, NULL, (void **)object) == DE_SUCCESS)
+    {
+        _newest_deque = deque;
+        _newest_object = *object;
+        
+        result = ER_SUCCESS;
+    }
+    
+    return result;
+}
+
+uint8 _add_object(DE_LIST *deque, ER_OBJECT *object)
+{
+    uint8 result;
+    
+    result = de_add_last(deque, _TAG, object);
+    
+    if (result == DE_SUCCESS)
+    {
+        _newest_deque = deque;
+        _newest_object = object;
+    }
+    
+    return result;
+}
+
+uint8 _take_token(uint32 number)
+{
+    _BUCKET *bucket;
+    uint32 elapsed;
+    uint32 gained = 0;
+    uint8 result = ER_SUCCESS;
+    uint32 ticks;
+    
+    if ((number < ER_MAX) && (_buckets[number].burst > 0))
+    {
+        bucket = &_buckets[number];
+        ticks = rt_get_ticks();
+        elapsed = ticks - bucket->time;
+        
+        if (bucket->rate > 0)
+        {
+            if (elapsed / _TICKS_PER_SECOND >= bucket->burst)
             {
-                object->error_type = ER_SPECIAL_TYPE;
-                
-                new_message = malloc(strlen(message) + 1);
-                
-                if (new_message != NULL)
-                {
-                    strcpy(new_message, message);
-                    object->error.message = new_message;
-                }
-                else
-                {
-                    free(object);
-                    
-                    result = ER_NO_MEMORY;
-                }
-            }
-            
-            if (result == ER_SUCCESS)
-            {   
-                object->timestamp = timestamp;
-                object->location = location;
-                
-                result = de_add_last(deque, _TAG, object);
-                
-                if (result != DE_SUCCESS)
-                {
-                    if (options & ER_OPTIONS_TIMESTAMP)
-                    {
-                        free(timestamp);
-                    }
-                    
-                    if (options & ER_OPTIONS_LOCATION)
-                    {
-                        free(location->file);
-                        free(location);
-                    }
-                    
-                    free(object);
-                }
+                gained = bucket->burst;
             }
             else
             {
-                if (options & ER_OPTIONS_TIMESTAMP)
-                {
-                    free(timestamp);
-                }
-                
-                if (options & ER_OPTIONS_LOCATION)
-                {
-                    free(location->file);
-                    free(location);
-                }
-                
-                result = ER_NO_MEMORY;
+                gained = elapsed * bucket->rate / _TICKS_PER_SECOND;
             }
         }
+        
+        /*
+         *  Only the ticks that earned whole tokens are used up, so that a
+         *  slow rate still fills the bucket between frequent errors.
+         */
+        if (gained >= (uint32)(bucket->burst - bucket->tokens))
+        {
+            bucket->tokens = bucket->burst;
+            bucket->time = ticks;
+        }
+        else if (gained > 0)
+        {
+            bucket->tokens += gained;
+            bucket->time += gained * _TICKS_PER_SECOND / bucket->rate;
+        }
+        
+        if (bucket->tokens > 0)
+        {
+            --bucket->tokens;
+        }
+        else
+        {
+            ++bucket->limited;
+            
+            result = ER_LIMITED;
+        }
     }
     
     return result;
 }
 
+void _unpack_timestamp(uint8 *field, RT_DATA *timestamp)
+{
+    uint32 packed;
+    
+    packed = field[2] | (field[3] << 8) |
+        ((uint32)field[4] << 16) | ((uint32)field[5] << 24);
+    
+    memset(timestamp, 0, sizeof(*timestamp));
+    timestamp->Sec = packed & 0x3F;
+    timestamp->Min = (packed >> 6) & 0x3F;
+    timestamp->Hour = (packed >> 12) & 0x1F;
+    timestamp->DayOfMonth = (packed >> 17) & 0x1F;
+    timestamp->Month = (packed >> 22) & 0x0F;
+    timestamp->Year = field[0] | (field[1] << 8);
+}
+
+void _pack_timestamp(RT_DATA *timestamp, uint8 *field)
+{
+    uint32 packed;
+    
+    packed = (uint32)timestamp->Sec |
+        ((uint32)timestamp->Min << 6) |
+        ((uint32)timestamp->Hour << 12) |
+        ((uint32)timestamp->DayOfMonth << 17) |
+        ((uint32)timestamp->Month << 22);
+    
+    field[0] = timestamp->Year & 0xFF;
+    field[1] = (timestamp->Year >> 8) & 0xFF;
+    field[2] = packed & 0xFF;
+    field[3] = (packed >> 8) & 0xFF;
+    field[4] = (packed >> 16) & 0xFF;
+    field[5] = (packed >> 24) & 0xFF;
+}
+
 uint8 _create_timestamp(RT_DATA **timestamp)
 {
     RT_DATA *new_timestamp;
@@ -543,7 +2217,6 @@ uint8 _create_timestamp(RT_DATA **timestamp)
 
 uint8 _create_location(ER_LOCATION **location, char *file, int line)
 {
-    char *new_file;
     ER_LOCATION *new_location;
     uint8 result;
     
@@ -551,25 +2224,12 @@ uint8 _create_location(ER_LOCATION **location, char *file, int line)
     
     if (new_location != NULL)
     {
+        new_location->file = _intern(file);
         new_location->line = line;
         
-        new_file = malloc(strlen(file) + 1);
+        *location = new_location;
         
-        if (new_file != NULL)
-        {
-            strcpy(new_file, file);
-            new_location->file = new_file;
-            
-            *location = new_location;
-            
-            result = ER_SUCCESS;
-        }
-        else
-        {
-            free(new_location);
-            
-            result = ER_NO_MEMORY;
-        }
+        result = ER_SUCCESS;
     }
     else
     {
@@ -579,6 +2239,29 @@ uint8 _create_location(ER_LOCATION **location, char *file, int line)
     return result;
 }
 
+uint8 _intern(char *file)
+{
+    uint8 index = 0;
+    
+    /*
+     *  Compare pointers before names, as each file passes the same name
+     *  every time.
+     */
+    while ((index < _file_count) && (_files[index] != file) &&
+        (strcmp(_files[index], file) != 0))
+    {
+        ++index;
+    }
+    
+    if ((index == _file_count) && (_file_count < ER_FILES_SIZE))
+    {
+        _files[_file_count] = file;
+        ++_file_count;
+    }
+    
+    return index;
+}
+
 /****************************************************************************
  *  End of File
  ****************************************************************************/
@@ -96,6 +96,144 @@
  *  er_get_count() returns the number of nodes in the deque, and er_destroy()
  *  deletes all nodes from the deque.
  *
+ *  Location information does not hold a copy of the file name. Instead, the
+ *  first error to be reported from each file adds the name passed by the
+ *  compiler to a table of up to #ER_FILES_SIZE names held by the library, and
+ *  each location holds the index of its file within that table. The function
+ *  er_get_file() returns the name of the file.
+ *
+ *  <H3> Repeated Errors </H3>
+ *
+ *  A fault that repeats in a tight loop can fill a deque or error log with
+ *  identical error objects, displacing the errors that explain it. Two
+ *  remedies are provided.
+ *
+ *  The first is coalescing. If the #ER_OPTIONS_COALESCE option is selected
+ *  when a standard error is added, and the newest error object holds the
+ *  same error number, file, and line, the newest error object is updated
+ *  instead of a new one being added. Its occurrence count is incremented,
+ *  and, if the timestamp option is selected, the time of the latest
+ *  occurrence is recorded. The functions er_get_occurrences() and
+ *  er_get_last_timestamp() return these. Only the first repeat of an error
+ *  object in a deque allocates memory from the heap.
+ *
+ *  The second is rate limiting. The function er_set_rate() gives a standard
+ *  error number a token bucket, which holds up to a given number of tokens,
+ *  and gains a given number of tokens each second. Adding a new error object
+ *  with that number takes a token, and if none are left the error is
+ *  discarded and #ER_LIMITED is returned. The function er_get_limited()
+ *  returns the number of errors discarded in this way. An error that is
+ *  coalesced into the newest error object does not take a token.
+ *
+ *  <H3> Severity </H3>
+ *
+ *  Errors added using the functions described above have the severity
+ *  #ER_LEVEL_ERROR. The macros er_report_standard() and er_report_special()
+ *  instead take a severity level, from #ER_LEVEL_DEBUG up to
+ *  #ER_LEVEL_FATAL, and the function er_get_level() returns the level of an
+ *  error object. Errors below the level #ER_LEVEL_MINIMUM are removed by
+ *  the compiler, so that debugging errors may be reported from within hot
+ *  loops at no cost once #ER_LEVEL_MINIMUM is raised. Errors below the
+ *  threshold set using er_set_threshold() are discarded at run time before
+ *  any memory is allocated or the clock is read.
+ *
+ *  <H3> Error Log </H3>
+ *
+ *  Adding an error object to a deque requires up to four allocations from
+ *  the heap, which may fail at the very moment an error needs to be
+ *  recorded. As an alternative, the library provides an error log - a ring
+ *  of #ER_LOG_SIZE error objects held within an ER_LOG structure. Each slot
+ *  of the ring holds an error object together with its timestamp and
+ *  location, and the location refers to the file name passed by the
+ *  compiler rather than a copy of it. Recording an error in the log
+ *  therefore never calls the heap, and takes the same time however many
+ *  errors have been recorded. The programmer declares an instance of an
+ *  ER_LOG structure, initialised to zero, ie:
+ *
+ *  @code ER_LOG er_log = {0}; @endcode
+ *
+ *  Errors are recorded using the functions er_log_standard() and
+ *  er_log_special(), or the macros er_log_report_standard() and
+ *  er_log_report_special(), which take the same arguments as their deque
+ *  counterparts. Once the log is full, its policy decides what happens to
+ *  a new error. Under the default policy, #ER_LOG_DROP, the new error is
+ *  discarded so that the first errors to occur are preserved. Under the
+ *  #ER_LOG_OVERWRITE policy, the oldest error is discarded to make room.
+ *  Either way, the function er_log_get_lost() returns the number of errors
+ *  that have been discarded. The policy is set using er_log_set_policy().
+ *
+ *  The function er_log_get_object() returns any error object in the log,
+ *  counting from the oldest, and the returned object may be examined using
+ *  the functions described above. er_log_remove() removes the oldest error
+ *  object, er_log_get_count() returns the number of error objects in the
+ *  log, and er_log_clear() empties the log.
+ *
+ *  <H3> Export </H3>
+ *
+ *  Converting each error object to text before sending it elsewhere is slow
+ *  and verbose. Instead, the functions er_export() and er_log_export()
+ *  encode error objects as compact binary records, oldest first, into a
+ *  buffer supplied by the caller, and then remove the encoded error objects.
+ *  If the buffer fills before the deque or log is empty, #ER_FULL is
+ *  returned, and the function may be called again to continue. Each buffer
+ *  can be decoded on its own, and the host decoder host_decode turns a
+ *  stream of them back into text.
+ *
+ *  All multi-byte fields are little-endian. An error record is
+ *  #ER_RECORD_SIZE bytes long, laid out as follows.
+ *
+ *  Offset | Size | Field
+ *  ------ | ---- | ------------------------------------------------------
+ *  0      | 1    | Kind, flags, and level - see #ER_RECORD_KIND.
+ *  1      | 2    | Standard error number, or zero for a special error.
+ *  3      | 1    | File identifier, if #ER_RECORD_LOCATION is set.
+ *  4      | 2    | Line number, if #ER_RECORD_LOCATION is set.
+ *  6      | 2    | Year, if #ER_RECORD_TIMESTAMP is set.
+ *  8      | 4    | Packed time, if #ER_RECORD_TIMESTAMP is set.
+ *
+ *  The packed time holds the second in bits 0-5, the minute in bits 6-11,
+ *  the hour in bits 12-16, the day of the month in bits 17-21, and the month
+ *  in bits 22-25. Line numbers above 65535 keep only their lower 16 bits.
+ *  A special error record is followed by one byte holding the length of the
+ *  message, and then the message itself without its terminator. Messages
+ *  are limited to 255 characters. If #ER_RECORD_REPEAT is set, the record is
+ *  followed by four bytes holding the number of occurrences and then, if
+ *  #ER_RECORD_TIMESTAMP is also set, by the year and packed time of the
+ *  last occurrence.
+ *
+ *  File names are sent once per buffer rather than in every record. The
+ *  first time a buffer refers to a file, a file record is written ahead of
+ *  the error record. It consists of #ER_RECORD_FILE, the file identifier,
+ *  the length of the file name, and the name itself. The file identifier is
+ *  the index of the file in the library's table of file names.
+ *
+ *  The function er_import() reverses the process, adding an error object to
+ *  a deque for each error record in a buffer.
+ *
+ *  <H3> Persistence </H3>
+ *
+ *  Errors held in RAM are lost when the device resets, which is often the
+ *  moment they are most needed. If #ER_PERSIST_ROWS is defined, the library
+ *  is able to keep errors in a region of #ER_PERSIST_ROWS EEPROM rows,
+ *  starting at row #ER_PERSIST_FIRST_ROW.
+ *
+ *  The region is an append-only log. The function er_persist_commit()
+ *  exports the errors of a deque in batches of up to #ER_PERSIST_BATCH rows,
+ *  and appends each batch to the log. Each row holds a sequence number, a
+ *  check byte, flags marking the first and last rows of its batch, and up to
+ *  twelve bytes of export records. Rows are written in turn around the
+ *  region, so that every row is worn equally, and once the region is full
+ *  the oldest rows are overwritten. Writing several errors at once keeps
+ *  the number of rows written, and hence the wear, to a minimum, so errors
+ *  are best gathered in a deque and committed together.
+ *
+ *  At start-up, the function er_persist_start() finds the newest row of the
+ *  log, and er_persist_restore() then adds the errors held by the log to a
+ *  deque, oldest first. A batch is only restored if every one of its rows
+ *  is present, valid, and in sequence, so a batch whose writing was
+ *  interrupted by a reset is skipped rather than restored in part. The log
+ *  is unchanged by restoring it, and er_persist_clear() erases it.
+ *
  *  For further information about these library functions, please refer to the
  *  individual function documentation. For examples of their use, please see
  *  the error management test library.
@@ -107,6 +245,7 @@
  *  requires access to the following components:
  *
  *  - RTC_1
+ *  - EEPROM_1, if #ER_PERSIST_ROWS is defined
  *
  *  The PSoC5 module must be fitted with a 32.768kHz crystal, and the 'XTAL
  *  32kHz' source must be enabled in the clock section of the project design
@@ -169,6 +308,16 @@
  */
 #define ER_FULL                         5
 
+/**
+ *  @brief The error was discarded by its rate limit.
+ */
+#define ER_LIMITED                      6
+
+/**
+ *  @brief The error was below the severity threshold.
+ */
+#define ER_FILTERED                     7
+
 /**
  *  @brief Selects no error options.
  */
@@ -184,6 +333,47 @@
  */
 #define ER_OPTIONS_LOCATION             0x02
 
+/**
+ *  @brief Selects the coalesce error option.
+ */
+#define ER_OPTIONS_COALESCE             0x04
+
+/**
+ *  @brief Identifies a debugging error.
+ */
+#define ER_LEVEL_DEBUG                  0
+
+/**
+ *  @brief Identifies an informational error.
+ */
+#define ER_LEVEL_INFO                   1
+
+/**
+ *  @brief Identifies a warning.
+ */
+#define ER_LEVEL_WARN                   2
+
+/**
+ *  @brief Identifies an error.
+ */
+#define ER_LEVEL_ERROR                  3
+
+/**
+ *  @brief Identifies a fatal error.
+ */
+#define ER_LEVEL_FATAL                  4
+
+/**
+ *  @brief The lowest severity level compiled into the codebase.
+ *
+ *  Errors reported through the severity macros below this level are
+ *  removed by the compiler. Define this on the compiler command line to
+ *  raise it for a release build, eg -DER_LEVEL_MINIMUM=ER_LEVEL_WARN.
+ */
+#ifndef ER_LEVEL_MINIMUM
+#define ER_LEVEL_MINIMUM                ER_LEVEL_DEBUG
+#endif
+
 /**
  *  @brief Identifies a standard error object.
  */
@@ -194,6 +384,117 @@
  */
 #define ER_SPECIAL_TYPE                 1
 
+/**
+ *  @brief The number of error objects held by an error log.
+ *
+ *  The value must be a power of two.
+ */
+#define ER_LOG_SIZE                     16
+
+#if (ER_LOG_SIZE == 0) || ((ER_LOG_SIZE & (ER_LOG_SIZE - 1)) != 0)
+#error ER_LOG_SIZE must be a power of two.
+#endif
+
+/**
+ *  @brief Discard new errors once an error log is full.
+ */
+#define ER_LOG_DROP                     0
+
+/**
+ *  @brief Discard the oldest error once an error log is full.
+ */
+#define ER_LOG_OVERWRITE                1
+
+/**
+ *  @brief The size in bytes of an exported error record.
+ *
+ *  The message of a special error record is not included.
+ */
+#define ER_RECORD_SIZE                  12
+
+/**
+ *  @brief Selects the kind of an exported record from its first byte.
+ */
+#define ER_RECORD_KIND                  0x03
+
+/**
+ *  @brief Identifies an exported standard error record.
+ */
+#define ER_RECORD_STANDARD              0x00
+
+/**
+ *  @brief Identifies an exported special error record.
+ */
+#define ER_RECORD_SPECIAL               0x01
+
+/**
+ *  @brief Identifies an exported file record.
+ */
+#define ER_RECORD_FILE                  0x02
+
+/**
+ *  @brief Flags an exported error record as holding a timestamp.
+ */
+#define ER_RECORD_TIMESTAMP             0x04
+
+/**
+ *  @brief Flags an exported error record as holding a location.
+ */
+#define ER_RECORD_LOCATION              0x08
+
+/**
+ *  @brief Flags an exported error record as having occurred more than once.
+ */
+#define ER_RECORD_REPEAT                0x10
+
+/**
+ *  @brief Selects the severity level of an exported error record from its
+ *      first byte.
+ */
+#define ER_RECORD_LEVEL                 0xE0
+
+/**
+ *  @brief The position of the severity level within the first byte of an
+ *      exported error record.
+ */
+#define ER_RECORD_LEVEL_SHIFT           5
+
+/**
+ *  @brief The number of file names the library can hold.
+ *
+ *  Errors reported from any further files are given the file name
+ *  "unknown". The value must be less than 256.
+ */
+#define ER_FILES_SIZE                   32
+
+#if (ER_FILES_SIZE > 255)
+#error ER_FILES_SIZE must be less than 256.
+#endif
+
+/**
+ *  @brief The number of EEPROM rows used to persist errors.
+ *
+ *  Uncomment this definition in order to build the functions that persist
+ *  errors to EEPROM. The value must be at least #ER_PERSIST_BATCH.
+ */
+//#define ER_PERSIST_ROWS                 64
+
+#ifdef ER_PERSIST_ROWS
+/**
+ *  @brief The first EEPROM row used to persist errors.
+ */
+#define ER_PERSIST_FIRST_ROW            0
+
+/**
+ *  @brief The largest number of EEPROM rows written by one batch of errors.
+ */
+#define ER_PERSIST_BATCH                8
+
+#if (ER_PERSIST_ROWS < ER_PERSIST_BATCH)
+#error ER_PERSIST_ROWS must be at least ER_PERSIST_BATCH.
+#endif
+#endif
+
 #ifdef DOXYGEN
 /**
  *  @brief Add a new standard error object to a deque.
@@ -208,10 +509,13 @@
  *  @b ER_OPTIONS_NONE      | Selects no error options.
  *  @b ER_OPTIONS_TIMESTAMP | Selects the timestamp error option.
  *  @b ER_OPTIONS_LOCATION  | Selects the location error option.
+ *  @b ER_OPTIONS_COALESCE  | Selects the coalesce error option.
  *
  *  @return #ER_SUCCESS if successful, otherwise #ER_BAD_ARGUMENT,
- *      #ER_NO_MEMORY, #ER_FULL, or #ER_FAILURE.
+ *      #ER_NO_MEMORY, #ER_FULL, #ER_LIMITED, #ER_FILTERED, or #ER_FAILURE.
  *  @remark Adds a node to the rear of the deque.
+ *  @remark If the coalesce option is selected and the error repeats the
+ *      newest error object, that object is updated instead.
  *  @warning It is up to the caller to ensure that the real-time clock
  *      component has been started prior to calling this function. Failure
  *      to do so will result in this function returning #ER_FAILURE if the
@@ -219,6 +523,9 @@
  */
 uint8 er_add_standard(DE_LIST *deque, uint32 number, uint8 options);
 #else
+uint8 _add_standard(DE_LIST *deque, uint32 number, uint8 options,
+    char *file, int line);
+
 #define er_add_standard(DEQUE, NUMBER, OPTIONS) _add_standard(DEQUE, \
 NUMBER, OPTIONS, __FILE__, __LINE__)
 #endif
@@ -239,7 +546,7 @@ NUMBER, OPTIONS, __FILE__, __LINE__)
  *  @b ER_OPTIONS_LOCATION  | Selects the location error option.
  *
  *  @return #ER_SUCCESS if successful, otherwise #ER_BAD_ARGUMENT,
- *      #ER_NO_MEMORY, #ER_FULL, or #ER_FAILURE.
+ *      #ER_NO_MEMORY, #ER_FULL, #ER_FILTERED, or #ER_FAILURE.
  *  @remark Adds a node to the rear of the deque.
  *  @warning It is up to the caller to ensure that the real-time clock
  *      component has been started prior to calling this function. Failure
@@ -248,8 +555,92 @@ NUMBER, OPTIONS, __FILE__, __LINE__)
  */
 uint8 er_add_special(DE_LIST *deque, char *message, uint8 options);
 #else
-#define er_add_special(DEQUE, MESSAGE, OPTIONS) _add_standard(DEQUE, \
-MESSSAGE, OPTIONS, __FILE__, __LINE__)
+uint8 _add_special(DE_LIST *deque, char *message, uint8 options,
+    char *file, int line);
+
+#define er_add_special(DEQUE, MESSAGE, OPTIONS) _add_special(DEQUE, \
+MESSAGE, OPTIONS, __FILE__, __LINE__)
+#endif
+
+#ifdef DOXYGEN
+/**
+ *  @brief Add a standard error of a given severity to a deque.
+ *  @param[in] deque A pointer to a deque.
+ *  @param[in] level The severity level of the error, from #ER_LEVEL_DEBUG
+ *      to #ER_LEVEL_FATAL.
+ *  @param[in] number The standard error number.
+ *  @param[in] options The selected error options.
+ *
+ *  This member may be one or more of the following values.
+ *
+ *  Value                | Description
+ *  -------------------- | ------------------------------------
+ *  @b ER_OPTIONS_NONE      | Selects no error options.
+ *  @b ER_OPTIONS_TIMESTAMP | Selects the timestamp error option.
+ *  @b ER_OPTIONS_LOCATION  | Selects the location error option.
+ *  @b ER_OPTIONS_COALESCE  | Selects the coalesce error option.
+ *
+ *  @remark Otherwise the same as er_add_standard().
+ *  @remark Compiled out entirely if the level is below #ER_LEVEL_MINIMUM,
+ *      and discarded before any other work if the level is below the
+ *      threshold set by er_set_threshold(). The macro does not return a
+ *      value.
+ */
+void er_report_standard(DE_LIST *deque, uint8 level, uint32 number,
+    uint8 options);
+#else
+uint8 _report_standard(DE_LIST *deque, uint8 level, uint32 number,
+    uint8 options, char *file, int line);
+
+#define er_report_standard(DEQUE, LEVEL, NUMBER, OPTIONS) \
+do \
+{ \
+    if ((LEVEL) >= ER_LEVEL_MINIMUM) \
+    { \
+        _report_standard(DEQUE, LEVEL, NUMBER, OPTIONS, __FILE__, \
+            __LINE__); \
+    } \
+} while (0)
+#endif
+
+#ifdef DOXYGEN
+/**
+ *  @brief Add a special error of a given severity to a deque.
+ *  @param[in] deque A pointer to a deque.
+ *  @param[in] level The severity level of the error, from #ER_LEVEL_DEBUG
+ *      to #ER_LEVEL_FATAL.
+ *  @param[in] message A pointer to the special message.
+ *  @param[in] options The selected error options.
+ *
+ *  This member may be one or more of the following values.
+ *
+ *  Value                | Description
+ *  -------------------- | ------------------------------------
+ *  @b ER_OPTIONS_NONE      | Selects no error options.
+ *  @b ER_OPTIONS_TIMESTAMP | Selects the timestamp error option.
+ *  @b ER_OPTIONS_LOCATION  | Selects the location error option.
+ *
+ *  @remark Otherwise the same as er_add_special().
+ *  @remark Compiled out entirely if the level is below #ER_LEVEL_MINIMUM,
+ *      and discarded before any other work if the level is below the
+ *      threshold set by er_set_threshold(). The macro does not return a
+ *      value.
+ */
+void er_report_special(DE_LIST *deque, uint8 level, char *message,
+    uint8 options);
+#else
+uint8 _report_special(DE_LIST *deque, uint8 level, char *message,
+    uint8 options, char *file, int line);
+
+#define er_report_special(DEQUE, LEVEL, MESSAGE, OPTIONS) \
+do \
+{ \
+    if ((LEVEL) >= ER_LEVEL_MINIMUM) \
+    { \
+        _report_special(DEQUE, LEVEL, MESSAGE, OPTIONS, __FILE__, \
+            __LINE__); \
+    } \
+} while (0)
 #endif
 
 /****************************************************************************
@@ -261,14 +652,14 @@ MESSSAGE, OPTIONS, __FILE__, __LINE__)
 typedef struct ER_LOCATION
 {
     /**
-     *  @brief The name of the file in which the error occurred.
+     *  @brief The index of the file in which the error occurred.
      */
-    char *file;
+    uint8 file;
     
     /**
      *  @brief The line number at which the error occurred.
      */
-    int line;
+    uint16 line;
 } ER_LOCATION;
 
 /**
@@ -280,6 +671,11 @@ typedef struct ER_OBJECT
      *  @brief The type of error object.
      */
     uint8 error_type;
+    
+    /**
+     *  @brief The severity level of the error.
+     */
+    uint8 level;
 
     union
     {
@@ -306,8 +702,75 @@ typedef struct ER_OBJECT
      *  @brief A pointer to the optional timestamp information.
      */
     RT_DATA *timestamp;
+    
+    /**
+     *  @brief The number of times the error has occurred.
+     */
+    uint32 count;
+    
+    /**
+     *  @brief A pointer to the optional timestamp of the last occurrence.
+     */
+    RT_DATA *last;
 } ER_OBJECT;
 
+/**
+ *  @brief An error log slot.
+ */
+typedef struct ER_SLOT
+{
+    /**
+     *  @brief The error object.
+     */
+    ER_OBJECT object;
+    
+    /**
+     *  @brief The storage for the optional location information.
+     */
+    ER_LOCATION location;
+    
+    /**
+     *  @brief The storage for the optional timestamp information.
+     */
+    RT_DATA timestamp;
+    
+    /**
+     *  @brief The storage for the optional timestamp of the last occurrence.
+     */
+    RT_DATA last;
+} ER_SLOT;
+
+/**
+ *  @brief An error log based upon a ring of slots.
+ */
+typedef struct ER_LOG
+{
+    /**
+     *  @brief The ring of slots.
+     */
+    ER_SLOT slots[ER_LOG_SIZE];
+    
+    /**
+     *  @brief The number of error objects ever removed from the log.
+     */
+    uint32 read;
+    
+    /**
+     *  @brief The number of error objects ever recorded in the log.
+     */
+    uint32 write;
+    
+    /**
+     *  @brief The number of errors discarded because the log was full.
+     */
+    uint32 lost;
+    
+    /**
+     *  @brief The policy applied once the log is full.
+     */
+    uint8 policy;
+} ER_LOG;
+
 /**
  *  @brief Standard error codes.
  */
@@ -454,6 +917,88 @@ uint8 er_get_timestamp(ER_OBJECT *object, RT_DATA **timestamp);
  */
 uint8 er_get_location(ER_OBJECT *object, ER_LOCATION **location);
 
+/**
+ *  @brief Get the name of the file of a location.
+ *  @param[in] location A pointer to a location.
+ *  @param[out] file A pointer to a pointer to the returned file name.
+ *  @return #ER_SUCCESS if successful, otherwise #ER_BAD_ARGUMENT.
+ *  @remark The name "unknown" is returned if the library's table of file
+ *      names was full when the error was reported.
+ */
+uint8 er_get_file(ER_LOCATION *location, char **file);
+
+/**
+ *  @brief Get the number of times an error has occurred.
+ *  @param[in] object A pointer to an error object.
+ *  @param[out] count A pointer to the returned number of occurrences.
+ *  @return #ER_SUCCESS if successful, otherwise #ER_BAD_ARGUMENT.
+ *  @remark The count is greater than one only if later occurrences were
+ *      coalesced into the error object.
+ */
+uint8 er_get_occurrences(ER_OBJECT *object, uint32 *count);
+
+/**
+ *  @brief Get the timestamp of the last occurrence of an error.
+ *  @param[in] object A pointer to an error object.
+ *  @param[out] timestamp A pointer to a pointer to the returned timestamp.
+ *  @return #ER_SUCCESS if successful, otherwise #ER_BAD_ARGUMENT.
+ *  @remark If the error has occurred only once, this is the same as the
+ *      timestamp returned by er_get_timestamp(). If the error object does
+ *      not contain a timestamp structure, this function will return a NULL
+ *      timestamp.
+ */
+uint8 er_get_last_timestamp(ER_OBJECT *object, RT_DATA **timestamp);
+
+/**
+ *  @brief Set the rate limit of a standard error number.
+ *  @param[in] number The standard error number.
+ *  @param[in] burst The number of tokens the bucket holds, or zero to
+ *      remove the rate limit.
+ *  @param[in] rate The number of tokens gained each second.
+ *  @return #ER_SUCCESS if successful, otherwise #ER_BAD_ARGUMENT.
+ *  @remark The bucket starts full, and its count of discarded errors
+ *      starts at zero. The limit applies to both deques and error logs.
+ *  @warning It is up to the caller to ensure that the system tick has been
+ *      started using rt_tick_start() prior to calling this function, and
+ *      for as long as the limit is set. Failure to do so will result in the
+ *      bucket never gaining tokens.
+ */
+uint8 er_set_rate(uint32 number, uint8 burst, uint8 rate);
+
+/**
+ *  @brief Get the number of errors discarded by a rate limit.
+ *  @param[in] number The standard error number.
+ *  @return The number of errors with this number that have been discarded
+ *      since the rate limit was set.
+ *  @remark If the number is not a standard error number, a count of zero
+ *      will be returned.
+ */
+uint32 er_get_limited(uint32 number);
+
+/**
+ *  @brief Get the severity level of an error object.
+ *  @param[in] object A pointer to an error object.
+ *  @param[out] level A pointer to the returned severity level.
+ *  @return #ER_SUCCESS if successful, otherwise #ER_BAD_ARGUMENT.
+ */
+uint8 er_get_level(ER_OBJECT *object, uint8 *level);
+
+/**
+ *  @brief Set the severity threshold.
+ *  @param[in] level The lowest severity level of error to keep.
+ *  @return #ER_SUCCESS if successful, otherwise #ER_BAD_ARGUMENT.
+ *  @remark Errors below the threshold are discarded, and #ER_FILTERED is
+ *      returned. The threshold is initially #ER_LEVEL_DEBUG, so that no
+ *      errors are discarded.
+ */
+uint8 er_set_threshold(uint8 level);
+
+/**
+ *  @brief Get the severity threshold.
+ *  @return The lowest severity level of error to keep.
+ */
+uint8 er_get_threshold(void);
+
 /**
  *  @brief Convert timestamp information to an ASCII string
  *  @param[in] timestamp A pointer to the timestamp to convert.
@@ -490,6 +1035,303 @@ uint8 er_convert_location(ER_LOCATION *location, char *string);
  */
 uint8 er_destroy(DE_LIST *deque);
 
+#ifdef DOXYGEN
+/**
+ *  @brief Record a new standard error object in an error log.
+ *  @param[in] log A pointer to an error log.
+ *  @param[in] number The standard error number.
+ *  @param[in] options The selected error options.
+ *
+ *  This member may be one or more of the following values.
+ *
+ *  Value                | Description
+ *  -------------------- | ------------------------------------
+ *  @b ER_OPTIONS_NONE      | Selects no error options.
+ *  @b ER_OPTIONS_TIMESTAMP | Selects the timestamp error option.
+ *  @b ER_OPTIONS_LOCATION  | Selects the location error option.
+ *  @b ER_OPTIONS_COALESCE  | Selects the coalesce error option.
+ *
+ *  @return #ER_SUCCESS if successful, otherwise #ER_BAD_ARGUMENT,
+ *      #ER_FULL, #ER_LIMITED, #ER_FILTERED, or #ER_FAILURE.
+ *  @remark Never allocates memory from the heap. #ER_FULL is returned if
+ *      the log is full and its policy is #ER_LOG_DROP.
+ *  @remark If the coalesce option is selected and the error repeats the
+ *      newest error object, that object is updated instead.
+ *  @warning It is up to the caller to ensure that the real-time clock
+ *      component has been started prior to calling this function. Failure
+ *      to do so will result in this function returning #ER_FAILURE if the
+ *      timestamp error option is selected.
+ */
+uint8 er_log_standard(ER_LOG *log, uint32 number, uint8 options);
+#else
+uint8 _log_standard(ER_LOG *log, uint32 number, uint8 options,
+    char *file, int line);
+
+#define er_log_standard(LOG, NUMBER, OPTIONS) _log_standard(LOG, \
+NUMBER, OPTIONS, __FILE__, __LINE__)
+#endif
+
+#ifdef DOXYGEN
+/**
+ *  @brief Record a new special error object in an error log.
+ *  @param[in] log A pointer to an error log.
+ *  @param[in] message A pointer to the special message.
+ *  @param[in] options The selected error options.
+ *
+ *  This member may be one or more of the following values.
+ *
+ *  Value                | Description
+ *  -------------------- | ------------------------------------
+ *  @b ER_OPTIONS_NONE      | Selects no error options.
+ *  @b ER_OPTIONS_TIMESTAMP | Selects the timestamp error option.
+ *  @b ER_OPTIONS_LOCATION  | Selects the location error option.
+ *
+ *  @return #ER_SUCCESS if successful, otherwise #ER_BAD_ARGUMENT,
+ *      #ER_FULL, #ER_FILTERED, or #ER_FAILURE.
+ *  @remark Never allocates memory from the heap. #ER_FULL is returned if
+ *      the log is full and its policy is #ER_LOG_DROP.
+ *  @warning The message is not copied, so it is up to the caller to
+ *      ensure that it outlives the error object - a string literal is
+ *      ideal.
+ *  @warning It is up to the caller to ensure that the real-time clock
+ *      component has been started prior to calling this function. Failure
+ *      to do so will result in this function returning #ER_FAILURE if the
+ *      timestamp error option is selected.
+ */
+uint8 er_log_special(ER_LOG *log, char *message, uint8 options);
+#else
+uint8 _log_special(ER_LOG *log, char *message, uint8 options,
+    char *file, int line);
+
+#define er_log_special(LOG, MESSAGE, OPTIONS) _log_special(LOG, \
+MESSAGE, OPTIONS, __FILE__, __LINE__)
+#endif
+
+#ifdef DOXYGEN
+/**
+ *  @brief Record a standard error of a given severity in an error log.
+ *  @param[in] log A pointer to an error log.
+ *  @param[in] level The severity level of the error, from #ER_LEVEL_DEBUG
+ *      to #ER_LEVEL_FATAL.
+ *  @param[in] number The standard error number.
+ *  @param[in] options The selected error options.
+ *
+ *  This member may be one or more of the following values.
+ *
+ *  Value                | Description
+ *  -------------------- | ------------------------------------
+ *  @b ER_OPTIONS_NONE      | Selects no error options.
+ *  @b ER_OPTIONS_TIMESTAMP | Selects the timestamp error option.
+ *  @b ER_OPTIONS_LOCATION  | Selects the location error option.
+ *  @b ER_OPTIONS_COALESCE  | Selects the coalesce error option.
+ *
+ *  @remark Otherwise the same as er_log_standard().
+ *  @remark Compiled out entirely if the level is below #ER_LEVEL_MINIMUM,
+ *      and discarded before any other work if the level is below the
+ *      threshold set by er_set_threshold(). The macro does not return a
+ *      value.
+ */
+void er_log_report_standard(ER_LOG *log, uint8 level, uint32 number,
+    uint8 options);
+#else
+uint8 _log_report_standard(ER_LOG *log, uint8 level, uint32 number,
+    uint8 options, char *file, int line);
+
+#define er_log_report_standard(LOG, LEVEL, NUMBER, OPTIONS) \
+do \
+{ \
+    if ((LEVEL) >= ER_LEVEL_MINIMUM) \
+    { \
+        _log_report_standard(LOG, LEVEL, NUMBER, OPTIONS, __FILE__, \
+            __LINE__); \
+    } \
+} while (0)
+#endif
+
+#ifdef DOXYGEN
+/**
+ *  @brief Record a special error of a given severity in an error log.
+ *  @param[in] log A pointer to an error log.
+ *  @param[in] level The severity level of the error, from #ER_LEVEL_DEBUG
+ *      to #ER_LEVEL_FATAL.
+ *  @param[in] message A pointer to the special message.
+ *  @param[in] options The selected error options.
+ *
+ *  This member may be one or more of the following values.
+ *
+ *  Value                | Description
+ *  -------------------- | ------------------------------------
+ *  @b ER_OPTIONS_NONE      | Selects no error options.
+ *  @b ER_OPTIONS_TIMESTAMP | Selects the timestamp error option.
+ *  @b ER_OPTIONS_LOCATION  | Selects the location error option.
+ *
+ *  @remark Otherwise the same as er_log_special().
+ *  @remark Compiled out entirely if the level is below #ER_LEVEL_MINIMUM,
+ *      and discarded before any other work if the level is below the
+ *      threshold set by er_set_threshold(). The macro does not return a
+ *      value.
+ */
+void er_log_report_special(ER_LOG *log, uint8 level, char *message,
+    uint8 options);
+#else
+uint8 _log_report_special(ER_LOG *log, uint8 level, char *message,
+    uint8 options, char *file, int line);
+
+#define er_log_report_special(LOG, LEVEL, MESSAGE, OPTIONS) \
+do \
+{ \
+    if ((LEVEL) >= ER_LEVEL_MINIMUM) \
+    { \
+        _log_report_special(LOG, LEVEL, MESSAGE, OPTIONS, __FILE__, \
+            __LINE__); \
+    } \
+} while (0)
+#endif
+
+/**
+ *  @brief Get any error object of an error log.
+ *  @param[in] log A pointer to an error log.
+ *  @param[in] index The position of the object, where zero is the oldest.
+ *  @param[out] object A pointer to a pointer to the returned error object.
+ *  @return #ER_SUCCESS if successful, otherwise #ER_BAD_ARGUMENT or
+ *      #ER_EMPTY.
+ *  @remark If the index argument is not less than the number of error
+ *      objects in the log, #ER_BAD_ARGUMENT will be returned.
+ *  @warning The returned object remains within the log. It is overwritten
+ *      once removed, or once discarded under the #ER_LOG_OVERWRITE policy.
+ */
+uint8 er_log_get_object(ER_LOG *log, uint32 index, ER_OBJECT **object);
+
+/**
+ *  @brief Remove the oldest error object from an error log.
+ *  @param[in] log A pointer to an error log.
+ *  @return #ER_SUCCESS if successful, otherwise #ER_BAD_ARGUMENT or
+ *      #ER_EMPTY.
+ */
+uint8 er_log_remove(ER_LOG *log);
+
+/**
+ *  @brief Get the error object count of an error log.
+ *  @param[in] log A pointer to an error log.
+ *  @return The number of error objects in the log.
+ *  @remark If the log argument is NULL, a count of zero will be returned.
+ */
+uint32 er_log_get_count(ER_LOG *log);
+
+/**
+ *  @brief Get the number of errors discarded by an error log.
+ *  @param[in] log A pointer to an error log.
+ *  @return The number of errors discarded because the log was full.
+ *  @remark If the log argument is NULL, a count of zero will be returned.
+ */
+uint32 er_log_get_lost(ER_LOG *log);
+
+/**
+ *  @brief Set the policy of an error log.
+ *  @param[in] log A pointer to an error log.
+ *  @param[in] policy Either #ER_LOG_DROP or #ER_LOG_OVERWRITE.
+ *  @return #ER_SUCCESS if successful, otherwise #ER_BAD_ARGUMENT.
+ */
+uint8 er_log_set_policy(ER_LOG *log, uint8 policy);
+
+/**
+ *  @brief Clear an error log.
+ *  @param[in] log A pointer to an error log.
+ *  @return #ER_SUCCESS if successful, otherwise #ER_BAD_ARGUMENT.
+ *  @remark Removes all error objects from the log, and sets the count of
+ *      discarded errors to zero. The policy is unchanged.
+ */
+uint8 er_log_clear(ER_LOG *log);
+
+/**
+ *  @brief Export the error objects of a deque as binary records.
+ *  @param[in] deque A pointer to a deque.
+ *  @param[out] buffer A pointer to the buffer to receive the records.
+ *  @param[in] size The size of the buffer in bytes.
+ *  @param[out] written A pointer to the returned number of bytes written.
+ *  @return #ER_SUCCESS if the deque was emptied, otherwise #ER_BAD_ARGUMENT
+ *      or #ER_FULL.
+ *  @remark Each error object is removed from the deque as soon as it has
+ *      been written to the buffer. #ER_FULL is returned if the next record
+ *      does not fit in the buffer.
+ */
+uint8 er_export(DE_LIST *deque, uint8 *buffer, uint32 size,
+    uint32 *written);
+
+/**
+ *  @brief Export the error objects of an error log as binary records.
+ *  @param[in] log A pointer to an error log.
+ *  @param[out] buffer A pointer to the buffer to receive the records.
+ *  @param[in] size The size of the buffer in bytes.
+ *  @param[out] written A pointer to the returned number of bytes written.
+ *  @return #ER_SUCCESS if the log was emptied, otherwise #ER_BAD_ARGUMENT
+ *      or #ER_FULL.
+ *  @remark Each error object is removed from the log as soon as it has
+ *      been written to the buffer. #ER_FULL is returned if the next record
+ *      does not fit in the buffer.
+ */
+uint8 er_log_export(ER_LOG *log, uint8 *buffer, uint32 size,
+    uint32 *written);
+
+/**
+ *  @brief Import binary records as error objects.
+ *  @param[in] deque A pointer to a deque.
+ *  @param[in] buffer A pointer to the records.
+ *  @param[in] size The size of the records in bytes.
+ *  @return #ER_SUCCESS if successful, otherwise #ER_BAD_ARGUMENT,
+ *      #ER_NO_MEMORY, or #ER_FULL.
+ *  @remark Adds a node to the rear of the deque for each error record, in
+ *      the order in which they were exported.
+ *  @remark The records must have been written by er_export() or
+ *      er_log_export() into a single buffer. #ER_BAD_ARGUMENT is returned
+ *      at the first record that is malformed or incomplete, and those error
+ *      objects already imported are kept.
+ */
+uint8 er_import(DE_LIST *deque, uint8 *buffer, uint32 size);
+
+#ifdef ER_PERSIST_ROWS
+/**
+ *  @brief Find the newest row of the persisted error log.
+ *  @return #ER_SUCCESS if the log holds any rows, otherwise #ER_EMPTY.
+ *  @warning It is up to the caller to ensure that this function is called
+ *      before any other persistence function, and that the EEPROM component
+ *      has been started prior to calling them.
+ */
+uint8 er_persist_start(void);
+
+/**
+ *  @brief Append the error objects of a deque to the persisted error log.
+ *  @param[in] deque A pointer to a deque.
+ *  @return #ER_SUCCESS if successful, otherwise #ER_BAD_ARGUMENT or
+ *      #ER_FAILURE.
+ *  @remark The error objects are removed from the deque as they are
+ *      written. #ER_FAILURE is returned if a row could not be written, in
+ *      which case the errors of that batch are lost.
+ *  @remark An error object whose records do not fit in a batch of
+ *      #ER_PERSIST_BATCH rows is discarded.
+ */
+uint8 er_persist_commit(DE_LIST *deque);
+
+/**
+ *  @brief Restore the errors held by the persisted error log.
+ *  @param[in] deque A pointer to a deque.
+ *  @return #ER_SUCCESS if successful, otherwise #ER_BAD_ARGUMENT,
+ *      #ER_NO_MEMORY, or #ER_FULL.
+ *  @remark Adds a node to the rear of the deque for each error, oldest
+ *      first. Incomplete batches are skipped.
+ *  @remark Restoring errors into the deque used to commit them will commit
+ *      them again. A separate deque should normally be used.
+ */
+uint8 er_persist_restore(DE_LIST *deque);
+
+/**
+ *  @brief Erase the persisted error log.
+ *  @return #ER_SUCCESS if successful, otherwise #ER_FAILURE.
+ *  @remark Writes every row of the region once.
+ */
+uint8 er_persist_clear(void);
+#endif
+
 #endif
 
 /****************************************************************************
@@ -78,7 +78,9 @@ uint8 ert_test_1(void)
 {
     DE_LIST deque_1 = {0};
     DE_LIST deque_2 = {0};
+    char *file_0;
     ER_LOCATION *location_0;
+    ER_LOCATION location_1;
     char *message_0;
     ER_OBJECT *object_0;
     uint8 result = ERT_SUCCESS;
@@ -315,7 +317,9 @@ uint8 ert_test_1(void)
      */
     if (result == ERT_SUCCESS)
     {
-        if (strcmp(object_0->location->file, ".\\error_test.c") == 0)
+        er_get_file(object_0->location, &file_0);
+        
+        if (strcmp(file_0, ".\\error_test.c") == 0)
         {
             UART_1_PutString("  11\ter_add_standard()\tPASS\r\n");
         }
@@ -376,7 +380,7 @@ uint8 ert_test_1(void)
     
     if (result == ERT_SUCCESS)
     {
-        if (object_0->location->line == 333)
+        if (object_0->location->line == 337)
         {
             UART_1_PutString("  14\ter_add_standard()\tPASS\r\n");
         }
@@ -736,7 +740,9 @@ uint8 ert_test_1(void)
      */
     if (result == ERT_SUCCESS)
     {
-        if (strcmp(object_0->location->file, ".\\error_test.c") == 0)
+        er_get_file(object_0->location, &file_0);
+        
+        if (strcmp(file_0, ".\\error_test.c") == 0)
         {
             UART_1_PutString("  30\ter_add_special()\tPASS\r\n");
         }
@@ -797,7 +803,7 @@ uint8 ert_test_1(void)
     
     if (result == ERT_SUCCESS)
     {
-        if (object_0->location->line == 754)
+        if (object_0->location->line == 760)
         {
             UART_1_PutString("  33\ter_add_special()\tPASS\r\n");
         }
@@ -1601,7 +1607,7 @@ uint8 ert_test_1(void)
     
     if (result == ERT_SUCCESS)
     {
-        if (strcmp(string_0, "file .\\error_test.c line 754") == ER_SUCCESS)
+        if (strcmp(string_0, "file .\\error_test.c line 760") == ER_SUCCESS)
         {
             UART_1_PutString("  86\ter_convert_location()\tPASS\r\n");
         }
@@ -1699,6 +1705,2836 @@ uint8 ert_test_1(void)
         }
     }
     
+    /*
+     *  Test er_get_file().
+     */
+    if (result == ERT_SUCCESS)
+    {
+        if (er_get_file(NULL, &file_0) == ER_BAD_ARGUMENT)
+        {
+            UART_1_PutString("  93\ter_get_file()\t\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("  93\ter_get_file()\t\tFAIL\r\n");
+            result = ERT_FAILURE;
+        }
+    }
+    
+    if (result == ERT_SUCCESS)
+    {
+        if (er_get_file(&location_1, NULL) == ER_BAD_ARGUMENT)
+        {
+            UART_1_PutString("  94\ter_get_file()\t\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("  94\ter_get_file()\t\tFAIL\r\n");
+            result = ERT_FAILURE;
+        }
+    }
+    
+    if (result == ERT_SUCCESS)
+    {
+        location_1.file = ER_FILES_SIZE;
+        
+        if (er_get_file(&location_1, &file_0) == ER_SUCCESS)
+        {
+            UART_1_PutString("  95\ter_get_file()\t\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("  95\ter_get_file()\t\tFAIL\r\n");
+            result = ERT_FAILURE;
+        }
+    }
+    
+    if (result == ERT_SUCCESS)
+    {
+        if (strcmp(file_0, "unknown") == 0)
+        {
+            UART_1_PutString("  96\ter_get_file()\t\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("  96\ter_get_file()\t\tFAIL\r\n");
+            result = ERT_FAILURE;
+        }
+    }
+    
+    /*
+     *  Report test result.
+     */
+    if (result == ERT_SUCCESS)
+    {
+        UART_1_PutString("\r\n");
+        UART_1_PutString("TEST PASSED\r\n");
+    }
+    else
+    {
+        UART_1_PutString("\r\n");
+        UART_1_PutString("TEST FAILED\r\n");
+    }
+    
+    /*
+     *  Clean-up test.
+     */
+    while ((UART_1_ReadTxStatus() & UART_1_TX_STS_FIFO_EMPTY) !=
+        UART_1_TX_STS_FIFO_EMPTY)
+    {
+        CyDelay(1);
+    }
+    
+    UART_1_Stop();
+    
+    return result;
+}
+
+uint8 ert_test_2(void)
+{
+    char *file_0;
+    uint32 i;
+    ER_LOG log_1 = {0};
+    char *message_0;
+    ER_OBJECT *object_0;
+    uint8 result = ERT_SUCCESS;
+    
+    UART_1_Start();
+    
+    UART_1_PutString("\x1b\x5b\x32\x4a");
+    UART_1_PutString("ERROR LOG TEST\r\n");
+    UART_1_PutString("\r\n");
+    UART_1_PutString("Test\tFunction\t\tResult\r\n");
+    UART_1_PutString("----\t--------\t\t------\r\n");
+    
+    /*
+     *  Test er_log_standard().
+     */
+    if (result == ERT_SUCCESS)
+    {
+        if (_log_standard(NULL, E00900, ER_OPTIONS_NONE,
+            __FILE__, __LINE__) == ER_BAD_ARGUMENT)
+        {
+            UART_1_PutString("   1\ter_log_standard()\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("   1\ter_log_standard()\tFAIL\r\n");
+            result = ERT_FAILURE;
+        }
+    }
+    
+    if (result == ERT_SUCCESS)
+    {
+        if (_log_standard(&log_1, E00900, ER_OPTIONS_NONE,
+            NULL, __LINE__) == ER_BAD_ARGUMENT)
+        {
+            UART_1_PutString("   2\ter_log_standard()\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("   2\ter_log_standard()\tFAIL\r\n");
+            result = ERT_FAILURE;
+        }
+    }
+    
+    if (result == ERT_SUCCESS)
+    {
+        if (er_log_standard(&log_1, E00900, ER_OPTIONS_NONE) == ER_SUCCESS)
+        {
+            UART_1_PutString("   3\ter_log_standard()\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("   3\ter_log_standard()\tFAIL\r\n");
+            result = ERT_FAILURE;
+        }
+    }
+    
+    if (result == ERT_SUCCESS)
+    {
+        er_log_get_object(&log_1, 0, &object_0);
+        
+        if ((object_0->error_type == ER_STANDARD_TYPE) &&
+            (object_0->error.number == E00900) &&
+            (object_0->timestamp == NULL) &&
+            (object_0->location == NULL))
+        {
+            UART_1_PutString("   4\ter_log_standard()\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("   4\ter_log_standard()\tFAIL\r\n");
+            result = ERT_FAILURE;
+        }
+    }
+    
+    /*
+     *  Initialise er_log_standard() test.
+     */
+    if (result == ERT_SUCCESS)
+    {
+        if (rt_start() == RT_SUCCESS)
+        {
+            UART_1_PutString("   -\tInitialise test...\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("   -\tInitialise test...\tFAIL\r\n");
+            result = ERT_FAILURE;
+        }
+    }
+    
+    /*
+     *  Initialise er_log_standard() test.
+     */
+    if (result == ERT_SUCCESS)
+    {
+        if (rt_stop() == RT_SUCCESS)
+        {
+            UART_1_PutString("   -\tInitialise test...\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("   -\tInitialise test...\tFAIL\r\n");
+            result = ERT_FAILURE;
+        }
+    }
+    
+    /*
+     *  Test er_log_standard().
+     */
+    if (result == ERT_SUCCESS)
+    {
+        if (er_log_standard(&log_1, E00900, ER_OPTIONS_TIMESTAMP) == ER_FAILURE)
+        {
+            UART_1_PutString("   5\ter_log_standard()\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("   5\ter_log_standard()\tFAIL\r\n");
+            result = ERT_FAILURE;
+        }
+    }
+    
+    if (result == ERT_SUCCESS)
+    {
+        if (er_log_get_count(&log_1) == 1)
+        {
+            UART_1_PutString("   6\ter_log_standard()\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("   6\ter_log_standard()\tFAIL\r\n");
+            result = ERT_FAILURE;
+        }
+    }
+    
+    /*
+     *  Initialise er_log_standard() test.
+     */
+    if (result == ERT_SUCCESS)
+    {
+        if (rt_start() == RT_SUCCESS)
+        {
+            UART_1_PutString("   -\tInitialise test...\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("   -\tInitialise test...\tFAIL\r\n");
+            result = ERT_FAILURE;
+        }
+    }
+    
+    /*
+     *  Test er_log_standard().
+     */
+    if (result == ERT_SUCCESS)
+    {
+        if (er_log_standard(&log_1, E00800,
+            ER_OPTIONS_TIMESTAMP | ER_OPTIONS_LOCATION) == ER_SUCCESS)
+        {
+            UART_1_PutString("   7\ter_log_standard()\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("   7\ter_log_standard()\tFAIL\r\n");
+            result = ERT_FAILURE;
+        }
+    }
+    
+    if (result == ERT_SUCCESS)
+    {
+        er_log_get_object(&log_1, 1, &object_0);
+        er_get_file(object_0->location, &file_0);
+        
+        if ((object_0->error.number == E00800) &&
+            (object_0->timestamp->Year == 1918) &&
+            (strcmp(file_0, __FILE__) == 0))
+        {
+            UART_1_PutString("   8\ter_log_standard()\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("   8\ter_log_standard()\tFAIL\r\n");
+            result = ERT_FAILURE;
+        }
+    }
+    
+    /*
+     *  Test er_log_special().
+     */
+    if (result == ERT_SUCCESS)
+    {
+        if (_log_special(&log_1, NULL, ER_OPTIONS_NONE,
+            __FILE__, __LINE__) == ER_BAD_ARGUMENT)
+        {
+            UART_1_PutString("   9\ter_log_special()\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("   9\ter_log_special()\tFAIL\r\n");
+            result = ERT_FAILURE;
+        }
+    }
+    
+    if (result == ERT_SUCCESS)
+    {
+        if (er_log_special(&log_1, "Special message.",
+            ER_OPTIONS_LOCATION) == ER_SUCCESS)
+        {
+            UART_1_PutString("  10\ter_log_special()\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("  10\ter_log_special()\tFAIL\r\n");
+            result = ERT_FAILURE;
+        }
+    }
+    
+    if (result == ERT_SUCCESS)
+    {
+        er_log_get_object(&log_1, 2, &object_0);
+        er_get_message(object_0, &message_0);
+        
+        if ((object_0->error_type == ER_SPECIAL_TYPE) &&
+            (strcmp(message_0, "Special message.") == 0) &&
+            (object_0->timestamp == NULL) &&
+            (object_0->location != NULL))
+        {
+            UART_1_PutString("  11\ter_log_special()\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("  11\ter_log_special()\tFAIL\r\n");
+            result = ERT_FAILURE;
+        }
+    }
+    
+    /*
+     *  Test er_log_get_object().
+     */
+    if (result == ERT_SUCCESS)
+    {
+        if (er_log_get_object(NULL, 0, &object_0) == ER_BAD_ARGUMENT)
+        {
+            UART_1_PutString("  12\ter_log_get_object()\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("  12\ter_log_get_object()\tFAIL\r\n");
+            result = ERT_FAILURE;
+        }
+    }
+    
+    if (result == ERT_SUCCESS)
+    {
+        if (er_log_get_object(&log_1, 0, NULL) == ER_BAD_ARGUMENT)
+        {
+            UART_1_PutString("  13\ter_log_get_object()\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("  13\ter_log_get_object()\tFAIL\r\n");
+            result = ERT_FAILURE;
+        }
+    }
+    
+    if (result == ERT_SUCCESS)
+    {
+        if (er_log_get_object(&log_1, 3, &object_0) == ER_BAD_ARGUMENT)
+        {
+            UART_1_PutString("  14\ter_log_get_object()\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("  14\ter_log_get_object()\tFAIL\r\n");
+            result = ERT_FAILURE;
+        }
+    }
+    
+    /*
+     *  Test er_log_get_count().
+     */
+    if (result == ERT_SUCCESS)
+    {
+        if (er_log_get_count(NULL) == 0)
+        {
+            UART_1_PutString("  15\ter_log_get_count()\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("  15\ter_log_get_count()\tFAIL\r\n");
+            result = ERT_FAILURE;
+        }
+    }
+    
+    if (result == ERT_SUCCESS)
+    {
+        if (er_log_get_count(&log_1) == 3)
+        {
+            UART_1_PutString("  16\ter_log_get_count()\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("  16\ter_log_get_count()\tFAIL\r\n");
+            result = ERT_FAILURE;
+        }
+    }
+    
+    /*
+     *  Test er_log_set_policy().
+     */
+    if (result == ERT_SUCCESS)
+    {
+        if (er_log_set_policy(NULL, ER_LOG_DROP) == ER_BAD_ARGUMENT)
+        {
+            UART_1_PutString("  17\ter_log_set_policy()\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("  17\ter_log_set_policy()\tFAIL\r\n");
+            result = ERT_FAILURE;
+        }
+    }
+    
+    if (result == ERT_SUCCESS)
+    {
+        if (er_log_set_policy(&log_1, 2) == ER_BAD_ARGUMENT)
+        {
+            UART_1_PutString("  18\ter_log_set_policy()\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("  18\ter_log_set_policy()\tFAIL\r\n");
+            result = ERT_FAILURE;
+        }
+    }
+    
+    /*
+     *  Test er_log_standard().
+     */
+    if (result == ERT_SUCCESS)
+    {
+        for (i = 3 ; i < ER_LOG_SIZE ; i++)
+        {
+            er_log_standard(&log_1, E00100, ER_OPTIONS_NONE);
+        }
+        
+        if (er_log_standard(&log_1, E00200, ER_OPTIONS_NONE) == ER_FULL)
+        {
+            UART_1_PutString("  19\ter_log_standard()\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("  19\ter_log_standard()\tFAIL\r\n");
+            result = ERT_FAILURE;
+        }
+    }
+    
+    if (result == ERT_SUCCESS)
+    {
+        if ((er_log_get_count(&log_1) == ER_LOG_SIZE) &&
+            (er_log_get_lost(&log_1) == 1))
+        {
+            UART_1_PutString("  20\ter_log_standard()\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("  20\ter_log_standard()\tFAIL\r\n");
+            result = ERT_FAILURE;
+        }
+    }
+    
+    if (result == ERT_SUCCESS)
+    {
+        er_log_get_object(&log_1, 0, &object_0);
+        
+        if (object_0->error.number == E00900)
+        {
+            UART_1_PutString("  21\ter_log_standard()\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("  21\ter_log_standard()\tFAIL\r\n");
+            result = ERT_FAILURE;
+        }
+    }
+    
+    /*
+     *  Test er_log_set_policy().
+     */
+    if (result == ERT_SUCCESS)
+    {
+        if (er_log_set_policy(&log_1, ER_LOG_OVERWRITE) == ER_SUCCESS)
+        {
+            UART_1_PutString("  22\ter_log_set_policy()\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("  22\ter_log_set_policy()\tFAIL\r\n");
+            result = ERT_FAILURE;
+        }
+    }
+    
+    /*
+     *  Test er_log_standard().
+     */
+    if (result == ERT_SUCCESS)
+    {
+        if (er_log_standard(&log_1, E00200, ER_OPTIONS_NONE) == ER_SUCCESS)
+        {
+            UART_1_PutString("  23\ter_log_standard()\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("  23\ter_log_standard()\tFAIL\r\n");
+            result = ERT_FAILURE;
+        }
+    }
+    
+    if (result == ERT_SUCCESS)
+    {
+        if ((er_log_get_count(&log_1) == ER_LOG_SIZE) &&
+            (er_log_get_lost(&log_1) == 2))
+        {
+            UART_1_PutString("  24\ter_log_standard()\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("  24\ter_log_standard()\tFAIL\r\n");
+            result = ERT_FAILURE;
+        }
+    }
+    
+    if (result == ERT_SUCCESS)
+    {
+        er_log_get_object(&log_1, 0, &object_0);
+        
+        if (object_0->error.number == E00800)
+        {
+            UART_1_PutString("  25\ter_log_standard()\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("  25\ter_log_standard()\tFAIL\r\n");
+            result = ERT_FAILURE;
+        }
+    }
+    
+    if (result == ERT_SUCCESS)
+    {
+        er_log_get_object(&log_1, ER_LOG_SIZE - 1, &object_0);
+        
+        if (object_0->error.number == E00200)
+        {
+            UART_1_PutString("  26\ter_log_standard()\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("  26\ter_log_standard()\tFAIL\r\n");
+            result = ERT_FAILURE;
+        }
+    }
+    
+    /*
+     *  Test er_log_get_lost().
+     */
+    if (result == ERT_SUCCESS)
+    {
+        if (er_log_get_lost(NULL) == 0)
+        {
+            UART_1_PutString("  27\ter_log_get_lost()\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("  27\ter_log_get_lost()\tFAIL\r\n");
+            result = ERT_FAILURE;
+        }
+    }
+    
+    /*
+     *  Test er_log_remove().
+     */
+    if (result == ERT_SUCCESS)
+    {
+        if (er_log_remove(NULL) == ER_BAD_ARGUMENT)
+        {
+            UART_1_PutString("  28\ter_log_remove()\t\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("  28\ter_log_remove()\t\tFAIL\r\n");
+            result = ERT_FAILURE;
+        }
+    }
+    
+    if (result == ERT_SUCCESS)
+    {
+        if (er_log_remove(&log_1) == ER_SUCCESS)
+        {
+            UART_1_PutString("  29\ter_log_remove()\t\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("  29\ter_log_remove()\t\tFAIL\r\n");
+            result = ERT_FAILURE;
+        }
+    }
+    
+    if (result == ERT_SUCCESS)
+    {
+        er_log_get_object(&log_1, 0, &object_0);
+        
+        if ((er_log_get_count(&log_1) == ER_LOG_SIZE - 1) &&
+            (object_0->error_type == ER_SPECIAL_TYPE))
+        {
+            UART_1_PutString("  30\ter_log_remove()\t\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("  30\ter_log_remove()\t\tFAIL\r\n");
+            result = ERT_FAILURE;
+        }
+    }
+    
+    /*
+     *  Test er_log_clear().
+     */
+    if (result == ERT_SUCCESS)
+    {
+        if (er_log_clear(NULL) == ER_BAD_ARGUMENT)
+        {
+            UART_1_PutString("  31\ter_log_clear()\t\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("  31\ter_log_clear()\t\tFAIL\r\n");
+            result = ERT_FAILURE;
+        }
+    }
+    
+    if (result == ERT_SUCCESS)
+    {
+        if (er_log_clear(&log_1) == ER_SUCCESS)
+        {
+            UART_1_PutString("  32\ter_log_clear()\t\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("  32\ter_log_clear()\t\tFAIL\r\n");
+            result = ERT_FAILURE;
+        }
+    }
+    
+    if (result == ERT_SUCCESS)
+    {
+        if ((er_log_get_count(&log_1) == 0) && (er_log_get_lost(&log_1) == 0))
+        {
+            UART_1_PutString("  33\ter_log_clear()\t\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("  33\ter_log_clear()\t\tFAIL\r\n");
+            result = ERT_FAILURE;
+        }
+    }
+    
+    if (result == ERT_SUCCESS)
+    {
+        if (er_log_remove(&log_1) == ER_EMPTY)
+        {
+            UART_1_PutString("  34\ter_log_clear()\t\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("  34\ter_log_clear()\t\tFAIL\r\n");
+            result = ERT_FAILURE;
+        }
+    }
+    
+    if (result == ERT_SUCCESS)
+    {
+        if (er_log_get_object(&log_1, 0, &object_0) == ER_EMPTY)
+        {
+            UART_1_PutString("  35\ter_log_clear()\t\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("  35\ter_log_clear()\t\tFAIL\r\n");
+            result = ERT_FAILURE;
+        }
+    }
+    
+    /*
+     *  Report test result.
+     */
+    if (result == ERT_SUCCESS)
+    {
+        UART_1_PutString("\r\n");
+        UART_1_PutString("TEST PASSED\r\n");
+    }
+    else
+    {
+        UART_1_PutString("\r\n");
+        UART_1_PutString("TEST FAILED\r\n");
+    }
+    
+    /*
+     *  Clean-up test.
+     */
+    rt_stop();
+    
+    while ((UART_1_ReadTxStatus() & UART_1_TX_STS_FIFO_EMPTY) !=
+        UART_1_TX_STS_FIFO_EMPTY)
+    {
+        CyDelay(1);
+    }
+    
+    UART_1_Stop();
+    
+    return result;
+}
+
+uint8 ert_test_3(void)
+{
+    uint8 buffer_0[64];
+    uint32 count_0;
+    DE_LIST deque_1 = {0};
+    char *file_0;
+    uint8 level_0;
+    ER_LOCATION *location_0;
+    ER_LOG log_1 = {0};
+    char *message_0;
+    ER_OBJECT *object_0;
+    uint8 options_0;
+    uint32 packed_0;
+    uint8 result = ERT_SUCCESS;
+    RT_DATA *timestamp_0;
+    uint32 written;
+    
+    UART_1_Start();
+    
+    UART_1_PutString("\x1b\x5b\x32\x4a");
+    UART_1_PutString("ERROR EXPORT TEST\r\n");
+    UART_1_PutString("\r\n");
+    UART_1_PutString("Test\tFunction\t\tResult\r\n");
+    UART_1_PutString("----\t--------\t\t------\r\n");
+    
+    /*
+     *  Test er_export().
+     */
+    if (result == ERT_SUCCESS)
+    {
+        if (er_export(NULL, buffer_0, 64, &written) == ER_BAD_ARGUMENT)
+        {
+            UART_1_PutString("   1\ter_export()\t\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("   1\ter_export()\t\tFAIL\r\n");
+            result = ERT_FAILURE;
+        }
+    }
+    
+    if (result == ERT_SUCCESS)
+    {
+        if (er_export(&deque_1, NULL, 64, &written) == ER_BAD_ARGUMENT)
+        {
+            UART_1_PutString("   2\ter_export()\t\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("   2\ter_export()\t\tFAIL\r\n");
+            result = ERT_FAILURE;
+        }
+    }
+    
+    if (result == ERT_SUCCESS)
+    {
+        if (er_export(&deque_1, buffer_0, 64, NULL) == ER_BAD_ARGUMENT)
+        {
+            UART_1_PutString("   3\ter_export()\t\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("   3\ter_export()\t\tFAIL\r\n");
+            result = ERT_FAILURE;
+        }
+    }
+    
+    if (result == ERT_SUCCESS)
+    {
+        if ((er_export(&deque_1, buffer_0, 64, &written) == ER_SUCCESS) &&
+            (written == 0))
+        {
+            UART_1_PutString("   4\ter_export()\t\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("   4\ter_export()\t\tFAIL\r\n");
+            result = ERT_FAILURE;
+        }
+    }
+    
+    /*
+     *  Initialise er_export() test.
+     */
+    if (result == ERT_SUCCESS)
+    {
+        if ((_add_standard(&deque_1, E00900, ER_OPTIONS_LOCATION,
+            "file.c", 42) == ER_SUCCESS) &&
+            (_add_special(&deque_1, "Special.", ER_OPTIONS_LOCATION,
+            "file.c", 300) == ER_SUCCESS))
+        {
+            UART_1_PutString("   -\tInitialise test...\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("   -\tInitialise test...\tFAIL\r\n");
+            result = ERT_FAILURE;
+        }
+    }
+    
+    /*
+     *  Test er_export().
+     */
+    if (result == ERT_SUCCESS)
+    {
+        if (er_export(&deque_1, buffer_0, 20, &written) == ER_FULL)
+        {
+            UART_1_PutString("   5\ter_export()\t\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("   5\ter_export()\t\tFAIL\r\n");
+            result = ERT_FAILURE;
+        }
+    }
+    
+    if (result == ERT_SUCCESS)
+    {
+        if ((written == 0) && (er_get_count(&deque_1) == 2))
+        {
+            UART_1_PutString("   6\ter_export()\t\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("   6\ter_export()\t\tFAIL\r\n");
+            result = ERT_FAILURE;
+        }
+    }
+    
+    if (result == ERT_SUCCESS)
+    {
+        if (er_export(&deque_1, buffer_0, 64, &written) == ER_SUCCESS)
+        {
+            UART_1_PutString("   7\ter_export()\t\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("   7\ter_export()\t\tFAIL\r\n");
+            result = ERT_FAILURE;
+        }
+    }
+    
+    if (result == ERT_SUCCESS)
+    {
+        if ((written == 42) && (er_get_count(&deque_1) == 0))
+        {
+            UART_1_PutString("   8\ter_export()\t\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("   8\ter_export()\t\tFAIL\r\n");
+            result = ERT_FAILURE;
+        }
+    }
+    
+    if (result == ERT_SUCCESS)
+    {
+        if ((buffer_0[0] == ER_RECORD_FILE) &&
+            (buffer_0[2] == 6) &&
+            (memcmp(&buffer_0[3], "file.c", 6) == 0))
+        {
+            UART_1_PutString("   9\ter_export()\t\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("   9\ter_export()\t\tFAIL\r\n");
+            result = ERT_FAILURE;
+        }
+    }
+    
+    if (result == ERT_SUCCESS)
+    {
+        if ((buffer_0[9] == (ER_RECORD_LOCATION |
+            (ER_LEVEL_ERROR << ER_RECORD_LEVEL_SHIFT))) &&
+            (buffer_0[10] == E00900) &&
+            (buffer_0[11] == 0) &&
+            (buffer_0[12] == buffer_0[1]) &&
+            (buffer_0[13] == 42) &&
+            (buffer_0[14] == 0))
+        {
+            UART_1_PutString("  10\ter_export()\t\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("  10\ter_export()\t\tFAIL\r\n");
+            result = ERT_FAILURE;
+        }
+    }
+    
+    if (result == ERT_SUCCESS)
+    {
+        if ((buffer_0[21] == (ER_RECORD_SPECIAL | ER_RECORD_LOCATION |
+            (ER_LEVEL_ERROR << ER_RECORD_LEVEL_SHIFT))) &&
+            (buffer_0[24] == buffer_0[1]) &&
+            (buffer_0[25] == (300 & 0xFF)) &&
+            (buffer_0[26] == (300 >> 8)))
+        {
+            UART_1_PutString("  11\ter_export()\t\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("  11\ter_export()\t\tFAIL\r\n");
+            result = ERT_FAILURE;
+        }
+    }
+    
+    if (result == ERT_SUCCESS)
+    {
+        if ((buffer_0[33] == 8) && (memcmp(&buffer_0[34], "Special.", 8) == 0))
+        {
+            UART_1_PutString("  12\ter_export()\t\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("  12\ter_export()\t\tFAIL\r\n");
+            result = ERT_FAILURE;
+        }
+    }
+    
+    /*
+     *  Initialise er_export() test.
+     */
+    if (result == ERT_SUCCESS)
+    {
+        _add_standard(&deque_1, E00100, ER_OPTIONS_LOCATION, "a.c", 1);
+        _add_standard(&deque_1, E00100, ER_OPTIONS_LOCATION, "b.c", 2);
+        _add_standard(&deque_1, E00100, ER_OPTIONS_LOCATION, "a.c", 3);
+        
+        if (er_get_count(&deque_1) == 3)
+        {
+            UART_1_PutString("   -\tInitialise test...\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("   -\tInitialise test...\tFAIL\r\n");
+            result = ERT_FAILURE;
+        }
+    }
+    
+    /*
+     *  Test er_export().
+     */
+    if (result == ERT_SUCCESS)
+    {
+        if (er_export(&deque_1, buffer_0, 64, &written) == ER_SUCCESS)
+        {
+            UART_1_PutString("  13\ter_export()\t\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("  13\ter_export()\t\tFAIL\r\n");
+            result = ERT_FAILURE;
+        }
+    }
+    
+    if (result == ERT_SUCCESS)
+    {
+        if ((written == 48) && (buffer_0[1] != buffer_0[19]))
+        {
+            UART_1_PutString("  14\ter_export()\t\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("  14\ter_export()\t\tFAIL\r\n");
+            result = ERT_FAILURE;
+        }
+    }
+    
+    if (result == ERT_SUCCESS)
+    {
+        if ((buffer_0[18] == ER_RECORD_FILE) && (buffer_0[21] == 'b'))
+        {
+            UART_1_PutString("  15\ter_export()\t\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("  15\ter_export()\t\tFAIL\r\n");
+            result = ERT_FAILURE;
+        }
+    }
+    
+    if (result == ERT_SUCCESS)
+    {
+        if ((buffer_0[36] == (ER_RECORD_LOCATION |
+            (ER_LEVEL_ERROR << ER_RECORD_LEVEL_SHIFT))) &&
+            (buffer_0[39] == buffer_0[1]) &&
+            (buffer_0[40] == 3))
+        {
+            UART_1_PutString("  16\ter_export()\t\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("  16\ter_export()\t\tFAIL\r\n");
+            result = ERT_FAILURE;
+        }
+    }
+    
+    /*
+     *  Test er_log_export().
+     */
+    if (result == ERT_SUCCESS)
+    {
+        if (er_log_export(NULL, buffer_0, 64, &written) == ER_BAD_ARGUMENT)
+        {
+            UART_1_PutString("  17\ter_log_export()\t\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("  17\ter_log_export()\t\tFAIL\r\n");
+            result = ERT_FAILURE;
+        }
+    }
+    
+    /*
+     *  Initialise er_log_export() test.
+     */
+    if (result == ERT_SUCCESS)
+    {
+        if (rt_start() == RT_SUCCESS)
+        {
+            UART_1_PutString("   -\tInitialise test...\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("   -\tInitialise test...\tFAIL\r\n");
+            result = ERT_FAILURE;
+        }
+    }
+    
+    /*
+     *  Test er_log_export().
+     */
+    if (result == ERT_SUCCESS)
+    {
+        _log_standard(&log_1, E00800, ER_OPTIONS_TIMESTAMP, "file.c", 42);
+        
+        if (er_log_export(&log_1, buffer_0, 64, &written) == ER_SUCCESS)
+        {
+            UART_1_PutString("  18\ter_log_export()\t\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("  18\ter_log_export()\t\tFAIL\r\n");
+            result = ERT_FAILURE;
+        }
+    }
+    
+    if (result == ERT_SUCCESS)
+    {
+        if ((written == ER_RECORD_SIZE) && (er_log_get_count(&log_1) == 0))
+        {
+            UART_1_PutString("  19\ter_log_export()\t\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("  19\ter_log_export()\t\tFAIL\r\n");
+            result = ERT_FAILURE;
+        }
+    }
+    
+    if (result == ERT_SUCCESS)
+    {
+        if ((buffer_0[0] == (ER_RECORD_TIMESTAMP |
+            (ER_LEVEL_ERROR << ER_RECORD_LEVEL_SHIFT))) &&
+            (buffer_0[1] == E00800) &&
+            (buffer_0[4] == 0) &&
+            (buffer_0[5] == 0))
+        {
+            UART_1_PutString("  20\ter_log_export()\t\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("  20\ter_log_export()\t\tFAIL\r\n");
+            result = ERT_FAILURE;
+        }
+    }
+    
+    if (result == ERT_SUCCESS)
+    {
+        packed_0 = buffer_0[8] | (buffer_0[9] << 8) |
+            ((uint32)buffer_0[10] << 16) | ((uint32)buffer_0[11] << 24);
+        
+        if ((buffer_0[6] == (1918 & 0xFF)) &&
+            (buffer_0[7] == (1918 >> 8)) &&
+            (packed_0 == ((11UL << 12) | (11UL << 17) | (11UL << 22))))
+        {
+            UART_1_PutString("  21\ter_log_export()\t\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("  21\ter_log_export()\t\tFAIL\r\n");
+            result = ERT_FAILURE;
+        }
+    }
+    
+    /*
+     *  Test er_import().
+     */
+    if (result == ERT_SUCCESS)
+    {
+        if (er_import(NULL, buffer_0, 64) == ER_BAD_ARGUMENT)
+        {
+            UART_1_PutString("  22\ter_import()\t\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("  22\ter_import()\t\tFAIL\r\n");
+            result = ERT_FAILURE;
+        }
+    }
+    
+    if (result == ERT_SUCCESS)
+    {
+        if (er_import(&deque_1, NULL, 64) == ER_BAD_ARGUMENT)
+        {
+            UART_1_PutString("  23\ter_import()\t\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("  23\ter_import()\t\tFAIL\r\n");
+            result = ERT_FAILURE;
+        }
+    }
+    
+    if (result == ERT_SUCCESS)
+    {
+        if ((er_import(&deque_1, buffer_0, 0) == ER_SUCCESS) &&
+            (er_get_count(&deque_1) == 0))
+        {
+            UART_1_PutString("  24\ter_import()\t\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("  24\ter_import()\t\tFAIL\r\n");
+            result = ERT_FAILURE;
+        }
+    }
+    
+    /*
+     *  Initialise er_import() test.
+     */
+    if (result == ERT_SUCCESS)
+    {
+        options_0 = ER_OPTIONS_TIMESTAMP | ER_OPTIONS_LOCATION;
+        
+        if ((_add_standard(&deque_1, E00700, options_0, "import.c", 7) ==
+            ER_SUCCESS) &&
+            (_report_special(&deque_1, ER_LEVEL_WARN, "Imported.",
+            ER_OPTIONS_LOCATION, "import.c", 8) == ER_SUCCESS) &&
+            (er_export(&deque_1, buffer_0, 64, &written) == ER_SUCCESS))
+        {
+            UART_1_PutString("   -\tInitialise test...\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("   -\tInitialise test...\tFAIL\r\n");
+            result = ERT_FAILURE;
+        }
+    }
+    
+    /*
+     *  Test er_import().
+     */
+    if (result == ERT_SUCCESS)
+    {
+        if ((er_import(&deque_1, buffer_0, written - 1) == ER_BAD_ARGUMENT) &&
+            (er_get_count(&deque_1) == 1))
+        {
+            UART_1_PutString("  25\ter_import()\t\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("  25\ter_import()\t\tFAIL\r\n");
+            result = ERT_FAILURE;
+        }
+    }
+    
+    if (result == ERT_SUCCESS)
+    {
+        er_destroy(&deque_1);
+        
+        if ((er_import(&deque_1, buffer_0, written) == ER_SUCCESS) &&
+            (er_get_count(&deque_1) == 2))
+        {
+            UART_1_PutString("  26\ter_import()\t\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("  26\ter_import()\t\tFAIL\r\n");
+            result = ERT_FAILURE;
+        }
+    }
+    
+    if (result == ERT_SUCCESS)
+    {
+        er_get_first_object(&deque_1, &object_0);
+        er_get_location(object_0, &location_0);
+        er_get_file(location_0, &file_0);
+        
+        if ((object_0->error.number == E00700) &&
+            (location_0->line == 7) &&
+            (strcmp(file_0, "import.c") == 0))
+        {
+            UART_1_PutString("  27\ter_import()\t\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("  27\ter_import()\t\tFAIL\r\n");
+            result = ERT_FAILURE;
+        }
+    }
+    
+    if (result == ERT_SUCCESS)
+    {
+        er_get_timestamp(object_0, &timestamp_0);
+        er_get_level(object_0, &level_0);
+        
+        if ((timestamp_0->Year == 1918) &&
+            (timestamp_0->Hour == 11) &&
+            (level_0 == ER_LEVEL_ERROR))
+        {
+            UART_1_PutString("  28\ter_import()\t\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("  28\ter_import()\t\tFAIL\r\n");
+            result = ERT_FAILURE;
+        }
+    }
+    
+    if (result == ERT_SUCCESS)
+    {
+        er_get_last_object(&deque_1, &object_0);
+        er_get_message(object_0, &message_0);
+        er_get_location(object_0, &location_0);
+        er_get_level(object_0, &level_0);
+        
+        if ((strcmp(message_0, "Imported.") == 0) &&
+            (location_0->line == 8) && (level_0 == ER_LEVEL_WARN))
+        {
+            UART_1_PutString("  29\ter_import()\t\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("  29\ter_import()\t\tFAIL\r\n");
+            result = ERT_FAILURE;
+        }
+    }
+    
+    if (result == ERT_SUCCESS)
+    {
+        er_destroy(&deque_1);
+        memset(buffer_0, 0, ER_RECORD_SIZE);
+        buffer_0[0] = ER_RECORD_LOCATION;
+        buffer_0[3] = 200;
+        er_import(&deque_1, buffer_0, ER_RECORD_SIZE);
+        er_get_first_object(&deque_1, &object_0);
+        er_get_location(object_0, &location_0);
+        
+        if ((er_get_file(location_0, &file_0) == ER_SUCCESS) &&
+            (strcmp(file_0, "unknown") == 0))
+        {
+            UART_1_PutString("  30\ter_import()\t\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("  30\ter_import()\t\tFAIL\r\n");
+            result = ERT_FAILURE;
+        }
+    }
+    
+    if (result == ERT_SUCCESS)
+    {
+        buffer_0[0] = ER_RECORD_KIND;
+        
+        if (er_import(&deque_1, buffer_0, ER_RECORD_SIZE) == ER_BAD_ARGUMENT)
+        {
+            UART_1_PutString("  31\ter_import()\t\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("  31\ter_import()\t\tFAIL\r\n");
+            result = ERT_FAILURE;
+        }
+    }
+    
+    if (result == ERT_SUCCESS)
+    {
+        buffer_0[0] = ER_RECORD_STANDARD;
+        buffer_0[1] = 0xFF;
+        buffer_0[2] = 0xFF;
+        written = ER_RECORD_SIZE;
+        
+        if ((er_import(&deque_1, buffer_0, written) == ER_BAD_ARGUMENT) &&
+            (er_get_count(&deque_1) == 1))
+        {
+            UART_1_PutString("  32\ter_import()\t\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("  32\ter_import()\t\tFAIL\r\n");
+            result = ERT_FAILURE;
+        }
+    }
+    
+    /*
+     *  Test er_add_standard() after er_import(). The file is first named by
+     *  the import, so that the library holds a copy of its name.
+     */
+    if (result == ERT_SUCCESS)
+    {
+        er_destroy(&deque_1);
+        memset(buffer_0, 0, sizeof(buffer_0));
+        buffer_0[0] = ER_RECORD_FILE;
+        buffer_0[2] = 10;
+        memcpy(&buffer_0[3], "coalesce.c", 10);
+        buffer_0[13] = ER_RECORD_LOCATION;
+        buffer_0[17] = 1;
+        er_import(&deque_1, buffer_0, 13 + ER_RECORD_SIZE);
+        
+        options_0 = ER_OPTIONS_LOCATION | ER_OPTIONS_COALESCE;
+        _add_standard(&deque_1, E00900, options_0, "coalesce.c", 2);
+        _add_standard(&deque_1, E00900, options_0, "coalesce.c", 2);
+        _add_standard(&deque_1, E00900, options_0, "coalesce.c", 2);
+        er_get_last_object(&deque_1, &object_0);
+        er_get_occurrences(object_0, &count_0);
+        
+        if ((er_get_count(&deque_1) == 2) && (count_0 == 3))
+        {
+            UART_1_PutString("  33\ter_add_standard()\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("  33\ter_add_standard()\tFAIL\r\n");
+            result = ERT_FAILURE;
+        }
+    }
+    
+    /*
+     *  Report test result.
+     */
+    if (result == ERT_SUCCESS)
+    {
+        UART_1_PutString("\r\n");
+        UART_1_PutString("TEST PASSED\r\n");
+    }
+    else
+    {
+        UART_1_PutString("\r\n");
+        UART_1_PutString("TEST FAILED\r\n");
+    }
+    
+    /*
+     *  Clean-up test.
+     */
+    er_destroy(&deque_1);
+    rt_stop();
+    
+    while ((UART_1_ReadTxStatus() & UART_1_TX_STS_FIFO_EMPTY) !=
+        UART_1_TX_STS_FIFO_EMPTY)
+    {
+        CyDelay(1);
+    }
+    
+    UART_1_Stop();
+    
+    return result;
+}
+
+uint8 ert_test_4(void)
+{
+    uint8 buffer_0[128];
+    uint32 count_0;
+    DE_LIST deque_1 = {0};
+    ER_LOG log_1 = {0};
+    ER_OBJECT *object_0;
+    uint32 packed_0;
+    uint8 result = ERT_SUCCESS;
+    uint32 ticks_0;
+    RT_DATA *timestamp_0;
+    uint32 written;
+    
+    UART_1_Start();
+    
+    UART_1_PutString("\x1b\x5b\x32\x4a");
+    UART_1_PutString("ERROR REPEAT TEST\r\n");
+    UART_1_PutString("\r\n");
+    UART_1_PutString("Test\tFunction\t\tResult\r\n");
+    UART_1_PutString("----\t--------\t\t------\r\n");
+    
+    /*
+     *  Test er_get_occurrences().
+     */
+    if (result == ERT_SUCCESS)
+    {
+        if (er_get_occurrences(NULL, &count_0) == ER_BAD_ARGUMENT)
+        {
+            UART_1_PutString("   1\ter_get_occurrences()\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("   1\ter_get_occurrences()\tFAIL\r\n");
+            result = ERT_FAILURE;
+        }
+    }
+    
+    /*
+     *  Initialise er_get_occurrences() test.
+     */
+    if (result == ERT_SUCCESS)
+    {
+        if ((rt_start() == RT_SUCCESS) &&
+            (_add_standard(&deque_1, E00900,
+            (ER_OPTIONS_TIMESTAMP | ER_OPTIONS_LOCATION), "file.c", 10) ==
+            ER_SUCCESS) &&
+            (er_get_last_object(&deque_1, &object_0) == ER_SUCCESS))
+        {
+            UART_1_PutString("   -\tInitialise test...\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("   -\tInitialise test...\tFAIL\r\n");
+            result = ERT_FAILURE;
+        }
+    }
+    
+    /*
+     *  Test er_get_occurrences().
+     */
+    if (result == ERT_SUCCESS)
+    {
+        if (er_get_occurrences(object_0, NULL) == ER_BAD_ARGUMENT)
+        {
+            UART_1_PutString("   2\ter_get_occurrences()\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("   2\ter_get_occurrences()\tFAIL\r\n");
+            result = ERT_FAILURE;
+        }
+    }
+    
+    if (result == ERT_SUCCESS)
+    {
+        if ((er_get_occurrences(object_0, &count_0) == ER_SUCCESS) &&
+            (count_0 == 1))
+        {
+            UART_1_PutString("   3\ter_get_occurrences()\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("   3\ter_get_occurrences()\tFAIL\r\n");
+            result = ERT_FAILURE;
+        }
+    }
+    
+    /*
+     *  Test er_get_last_timestamp().
+     */
+    if (result == ERT_SUCCESS)
+    {
+        if (er_get_last_timestamp(NULL, &timestamp_0) ==
+            ER_BAD_ARGUMENT)
+        {
+            UART_1_PutString("   4\ter_get_last_timestamp()\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("   4\ter_get_last_timestamp()\tFAIL\r\n");
+            result = ERT_FAILURE;
+        }
+    }
+    
+    if (result == ERT_SUCCESS)
+    {
+        if (er_get_last_timestamp(object_0, NULL) == ER_BAD_ARGUMENT)
+        {
+            UART_1_PutString("   5\ter_get_last_timestamp()\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("   5\ter_get_last_timestamp()\tFAIL\r\n");
+            result = ERT_FAILURE;
+        }
+    }
+    
+    if (result == ERT_SUCCESS)
+    {
+        if ((er_get_last_timestamp(object_0, &timestamp_0) == ER_SUCCESS) &&
+            (timestamp_0 == object_0->timestamp))
+        {
+            UART_1_PutString("   6\ter_get_last_timestamp()\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("   6\ter_get_last_timestamp()\tFAIL\r\n");
+            result = ERT_FAILURE;
+        }
+    }
+    
+    /*
+     *  Test er_add_standard().
+     */
+    if (result == ERT_SUCCESS)
+    {
+        rt_set_time(12, 0, 0);
+        rt_write();
+        
+        if (_add_standard(&deque_1, E00900,
+            (ER_OPTIONS_TIMESTAMP | ER_OPTIONS_LOCATION | ER_OPTIONS_COALESCE),
+            "file.c", 10) == ER_SUCCESS)
+        {
+            UART_1_PutString("   7\ter_add_standard()\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("   7\ter_add_standard()\tFAIL\r\n");
+            result = ERT_FAILURE;
+        }
+    }
+    
+    if (result == ERT_SUCCESS)
+    {
+        er_get_occurrences(object_0, &count_0);
+        
+        if ((er_get_count(&deque_1) == 1) && (count_0 == 2))
+        {
+            UART_1_PutString("   8\ter_add_standard()\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("   8\ter_add_standard()\tFAIL\r\n");
+            result = ERT_FAILURE;
+        }
+    }
+    
+    if (result == ERT_SUCCESS)
+    {
+        er_get_last_timestamp(object_0, &timestamp_0);
+        
+        if ((timestamp_0->Hour == 12) && (object_0->timestamp->Hour == 11))
+        {
+            UART_1_PutString("   9\ter_add_standard()\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("   9\ter_add_standard()\tFAIL\r\n");
+            result = ERT_FAILURE;
+        }
+    }
+    
+    if (result == ERT_SUCCESS)
+    {
+        _add_standard(&deque_1, E00900,
+            (ER_OPTIONS_TIMESTAMP | ER_OPTIONS_LOCATION | ER_OPTIONS_COALESCE),
+            "file.c", 11);
+        
+        if (er_get_count(&deque_1) == 2)
+        {
+            UART_1_PutString("  10\ter_add_standard()\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("  10\ter_add_standard()\tFAIL\r\n");
+            result = ERT_FAILURE;
+        }
+    }
+    
+    if (result == ERT_SUCCESS)
+    {
+        _add_standard(&deque_1, E00900, ER_OPTIONS_COALESCE, "file.c", 11);
+        
+        if (er_get_count(&deque_1) == 3)
+        {
+            UART_1_PutString("  11\ter_add_standard()\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("  11\ter_add_standard()\tFAIL\r\n");
+            result = ERT_FAILURE;
+        }
+    }
+    
+    if (result == ERT_SUCCESS)
+    {
+        _add_standard(&deque_1, E00900, ER_OPTIONS_COALESCE, "file.c", 12);
+        er_get_last_object(&deque_1, &object_0);
+        er_get_occurrences(object_0, &count_0);
+        
+        if ((er_get_count(&deque_1) == 3) && (count_0 == 2))
+        {
+            UART_1_PutString("  12\ter_add_standard()\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("  12\ter_add_standard()\tFAIL\r\n");
+            result = ERT_FAILURE;
+        }
+    }
+    
+    if (result == ERT_SUCCESS)
+    {
+        _add_standard(&deque_1, E00900, ER_OPTIONS_NONE, "file.c", 12);
+        
+        if (er_get_count(&deque_1) == 4)
+        {
+            UART_1_PutString("  13\ter_add_standard()\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("  13\ter_add_standard()\tFAIL\r\n");
+            result = ERT_FAILURE;
+        }
+    }
+    
+    /*
+     *  Test er_export().
+     */
+    if (result == ERT_SUCCESS)
+    {
+        if ((er_export(&deque_1, buffer_0, 128, &written) == ER_SUCCESS) &&
+            (written == 71))
+        {
+            UART_1_PutString("  14\ter_export()\t\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("  14\ter_export()\t\tFAIL\r\n");
+            result = ERT_FAILURE;
+        }
+    }
+    
+    if (result == ERT_SUCCESS)
+    {
+        if ((buffer_0[9] == (ER_RECORD_TIMESTAMP | ER_RECORD_LOCATION |
+            ER_RECORD_REPEAT | (ER_LEVEL_ERROR << ER_RECORD_LEVEL_SHIFT))) &&
+            (buffer_0[21] == 2) &&
+            (buffer_0[22] == 0))
+        {
+            UART_1_PutString("  15\ter_export()\t\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("  15\ter_export()\t\tFAIL\r\n");
+            result = ERT_FAILURE;
+        }
+    }
+    
+    if (result == ERT_SUCCESS)
+    {
+        packed_0 = buffer_0[27] | (buffer_0[28] << 8) |
+            ((uint32)buffer_0[29] << 16) | ((uint32)buffer_0[30] << 24);
+        
+        if ((buffer_0[25] == (1918 & 0xFF)) &&
+            (((packed_0 >> 12) & 0x1F) == 12))
+        {
+            UART_1_PutString("  16\ter_export()\t\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("  16\ter_export()\t\tFAIL\r\n");
+            result = ERT_FAILURE;
+        }
+    }
+    
+    if (result == ERT_SUCCESS)
+    {
+        if ((buffer_0[43] == (ER_RECORD_REPEAT |
+            (ER_LEVEL_ERROR << ER_RECORD_LEVEL_SHIFT))) &&
+            (buffer_0[55] == 2) &&
+            (buffer_0[59] == (ER_RECORD_STANDARD |
+            (ER_LEVEL_ERROR << ER_RECORD_LEVEL_SHIFT))))
+        {
+            UART_1_PutString("  17\ter_export()\t\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("  17\ter_export()\t\tFAIL\r\n");
+            result = ERT_FAILURE;
+        }
+    }
+    
+    /*
+     *  Test er_log_standard().
+     */
+    if (result == ERT_SUCCESS)
+    {
+        _log_standard(&log_1, E00800, ER_OPTIONS_COALESCE, "file.c", 20);
+        
+        if (_log_standard(&log_1, E00800, ER_OPTIONS_COALESCE, "file.c", 20) ==
+            ER_SUCCESS)
+        {
+            UART_1_PutString("  18\ter_log_standard()\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("  18\ter_log_standard()\tFAIL\r\n");
+            result = ERT_FAILURE;
+        }
+    }
+    
+    if (result == ERT_SUCCESS)
+    {
+        er_log_get_object(&log_1, 0, &object_0);
+        er_get_occurrences(object_0, &count_0);
+        
+        if ((er_log_get_count(&log_1) == 1) && (count_0 == 2))
+        {
+            UART_1_PutString("  19\ter_log_standard()\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("  19\ter_log_standard()\tFAIL\r\n");
+            result = ERT_FAILURE;
+        }
+    }
+    
+    if (result == ERT_SUCCESS)
+    {
+        _log_standard(&log_1, E00800, (ER_OPTIONS_TIMESTAMP |
+            ER_OPTIONS_COALESCE), "file.c", 20);
+        er_get_occurrences(object_0, &count_0);
+        er_get_last_timestamp(object_0, &timestamp_0);
+        
+        if ((count_0 == 3) && (timestamp_0 == NULL))
+        {
+            UART_1_PutString("  20\ter_log_standard()\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("  20\ter_log_standard()\tFAIL\r\n");
+            result = ERT_FAILURE;
+        }
+    }
+    
+    /*
+     *  Test er_set_rate().
+     */
+    if (result == ERT_SUCCESS)
+    {
+        if (er_set_rate(ER_MAX, 1, 1) == ER_BAD_ARGUMENT)
+        {
+            UART_1_PutString("  21\ter_set_rate()\t\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("  21\ter_set_rate()\t\tFAIL\r\n");
+            result = ERT_FAILURE;
+        }
+    }
+    
+    if (result == ERT_SUCCESS)
+    {
+        if ((rt_tick_start() == RT_SUCCESS) &&
+            (er_set_rate(E00700, 2, 1) == ER_SUCCESS))
+        {
+            UART_1_PutString("  22\ter_set_rate()\t\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("  22\ter_set_rate()\t\tFAIL\r\n");
+            result = ERT_FAILURE;
+        }
+    }
+    
+    /*
+     *  Test er_get_limited().
+     */
+    if (result == ERT_SUCCESS)
+    {
+        if ((er_get_limited(ER_MAX) == 0) && (er_get_limited(E00700) == 0))
+        {
+            UART_1_PutString("  23\ter_get_limited()\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("  23\ter_get_limited()\tFAIL\r\n");
+            result = ERT_FAILURE;
+        }
+    }
+    
+    /*
+     *  Test er_add_standard().
+     */
+    if (result == ERT_SUCCESS)
+    {
+        _add_standard(&deque_1, E00700, ER_OPTIONS_NONE, "file.c", 30);
+        
+        if (_add_standard(&deque_1, E00700, ER_OPTIONS_NONE, "file.c", 31) ==
+            ER_SUCCESS)
+        {
+            UART_1_PutString("  24\ter_add_standard()\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("  24\ter_add_standard()\tFAIL\r\n");
+            result = ERT_FAILURE;
+        }
+    }
+    
+    if (result == ERT_SUCCESS)
+    {
+        if (_add_standard(&deque_1, E00700, ER_OPTIONS_NONE, "file.c", 32) ==
+            ER_LIMITED)
+        {
+            UART_1_PutString("  25\ter_add_standard()\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("  25\ter_add_standard()\tFAIL\r\n");
+            result = ERT_FAILURE;
+        }
+    }
+    
+    if (result == ERT_SUCCESS)
+    {
+        if ((er_get_count(&deque_1) == 2) && (er_get_limited(E00700) == 1))
+        {
+            UART_1_PutString("  26\ter_add_standard()\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("  26\ter_add_standard()\tFAIL\r\n");
+            result = ERT_FAILURE;
+        }
+    }
+    
+    if (result == ERT_SUCCESS)
+    {
+        if (_add_standard(&deque_1, E00700, ER_OPTIONS_COALESCE,
+            "file.c", 33) == ER_SUCCESS)
+        {
+            UART_1_PutString("  27\ter_add_standard()\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("  27\ter_add_standard()\tFAIL\r\n");
+            result = ERT_FAILURE;
+        }
+    }
+    
+    if (result == ERT_SUCCESS)
+    {
+        ticks_0 = rt_get_ticks();
+        
+        while (rt_get_ticks() - ticks_0 < 1000)
+        {
+            CyDelay(1);
+        }
+        
+        if (_add_standard(&deque_1, E00700, ER_OPTIONS_NONE, "file.c", 34) ==
+            ER_SUCCESS)
+        {
+            UART_1_PutString("  28\ter_add_standard()\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("  28\ter_add_standard()\tFAIL\r\n");
+            result = ERT_FAILURE;
+        }
+    }
+    
+    if (result == ERT_SUCCESS)
+    {
+        _add_standard(&deque_1, E00700, ER_OPTIONS_NONE, "file.c", 35);
+        
+        if ((er_get_count(&deque_1) == 3) && (er_get_limited(E00700) == 2))
+        {
+            UART_1_PutString("  29\ter_add_standard()\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("  29\ter_add_standard()\tFAIL\r\n");
+            result = ERT_FAILURE;
+        }
+    }
+    
+    /*
+     *  Test er_log_standard().
+     */
+    if (result == ERT_SUCCESS)
+    {
+        if (_log_standard(&log_1, E00700, ER_OPTIONS_NONE, "file.c", 36) ==
+            ER_LIMITED)
+        {
+            UART_1_PutString("  30\ter_log_standard()\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("  30\ter_log_standard()\tFAIL\r\n");
+            result = ERT_FAILURE;
+        }
+    }
+    
+    /*
+     *  Test er_set_rate().
+     */
+    if (result == ERT_SUCCESS)
+    {
+        if (er_set_rate(E00700, 0, 0) == ER_SUCCESS)
+        {
+            UART_1_PutString("  31\ter_set_rate()\t\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("  31\ter_set_rate()\t\tFAIL\r\n");
+            result = ERT_FAILURE;
+        }
+    }
+    
+    /*
+     *  Test er_add_standard().
+     */
+    if (result == ERT_SUCCESS)
+    {
+        if (_add_standard(&deque_1, E00700, ER_OPTIONS_NONE, "file.c", 37) ==
+            ER_SUCCESS)
+        {
+            UART_1_PutString("  32\ter_add_standard()\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("  32\ter_add_standard()\tFAIL\r\n");
+            result = ERT_FAILURE;
+        }
+    }
+    
+    /*
+     *  Test er_get_limited().
+     */
+    if (result == ERT_SUCCESS)
+    {
+        if (er_get_limited(E00700) == 0)
+        {
+            UART_1_PutString("  33\ter_get_limited()\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("  33\ter_get_limited()\tFAIL\r\n");
+            result = ERT_FAILURE;
+        }
+    }
+    
+    /*
+     *  Report test result.
+     */
+    if (result == ERT_SUCCESS)
+    {
+        UART_1_PutString("\r\n");
+        UART_1_PutString("TEST PASSED\r\n");
+    }
+    else
+    {
+        UART_1_PutString("\r\n");
+        UART_1_PutString("TEST FAILED\r\n");
+    }
+    
+    /*
+     *  Clean-up test.
+     */
+    er_destroy(&deque_1);
+    er_set_rate(E00700, 0, 0);
+    rt_stop();
+    
+    while ((UART_1_ReadTxStatus() & UART_1_TX_STS_FIFO_EMPTY) !=
+        UART_1_TX_STS_FIFO_EMPTY)
+    {
+        CyDelay(1);
+    }
+    
+    UART_1_Stop();
+    
+    return result;
+}
+
+uint8 ert_test_5(void)
+{
+    uint32 debug_0 = (ER_LEVEL_MINIMUM <= ER_LEVEL_DEBUG);
+    DE_LIST deque_1 = {0};
+    uint8 level_0;
+    ER_LOG log_1 = {0};
+    uint32 number_0;
+    ER_OBJECT *object_0;
+    uint8 result = ERT_SUCCESS;
+    
+    UART_1_Start();
+    
+    UART_1_PutString("\x1b\x5b\x32\x4a");
+    UART_1_PutString("ERROR SEVERITY TEST\r\n");
+    UART_1_PutString("\r\n");
+    UART_1_PutString("Test\tFunction\t\tResult\r\n");
+    UART_1_PutString("----\t--------\t\t------\r\n");
+    
+    /*
+     *  Test er_set_threshold().
+     */
+    if (result == ERT_SUCCESS)
+    {
+        if (er_set_threshold(ER_LEVEL_FATAL + 1) == ER_BAD_ARGUMENT)
+        {
+            UART_1_PutString("   1\ter_set_threshold()\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("   1\ter_set_threshold()\tFAIL\r\n");
+            result = ERT_FAILURE;
+        }
+    }
+    
+    /*
+     *  Test er_get_threshold().
+     */
+    if (result == ERT_SUCCESS)
+    {
+        if (er_get_threshold() == ER_LEVEL_DEBUG)
+        {
+            UART_1_PutString("   2\ter_get_threshold()\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("   2\ter_get_threshold()\tFAIL\r\n");
+            result = ERT_FAILURE;
+        }
+    }
+    
+    /*
+     *  Test er_report_standard().
+     */
+    if (result == ERT_SUCCESS)
+    {
+        if (_report_standard(&deque_1, ER_LEVEL_FATAL + 1, E00100,
+            ER_OPTIONS_NONE, "file.c", 1) == ER_BAD_ARGUMENT)
+        {
+            UART_1_PutString("   3\ter_report_standard()\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("   3\ter_report_standard()\tFAIL\r\n");
+            result = ERT_FAILURE;
+        }
+    }
+    
+    if (result == ERT_SUCCESS)
+    {
+        if (_report_standard(&deque_1, ER_LEVEL_WARN, E00100,
+            ER_OPTIONS_NONE, "file.c", 1) == ER_SUCCESS)
+        {
+            UART_1_PutString("   4\ter_report_standard()\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("   4\ter_report_standard()\tFAIL\r\n");
+            result = ERT_FAILURE;
+        }
+    }
+    
+    /*
+     *  Test er_get_level().
+     */
+    if (result == ERT_SUCCESS)
+    {
+        if (er_get_level(NULL, &level_0) == ER_BAD_ARGUMENT)
+        {
+            UART_1_PutString("   5\ter_get_level()\t\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("   5\ter_get_level()\t\tFAIL\r\n");
+            result = ERT_FAILURE;
+        }
+    }
+    
+    if (result == ERT_SUCCESS)
+    {
+        er_get_last_object(&deque_1, &object_0);
+        
+        if (er_get_level(object_0, NULL) == ER_BAD_ARGUMENT)
+        {
+            UART_1_PutString("   6\ter_get_level()\t\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("   6\ter_get_level()\t\tFAIL\r\n");
+            result = ERT_FAILURE;
+        }
+    }
+    
+    if (result == ERT_SUCCESS)
+    {
+        if ((er_get_level(object_0, &level_0) == ER_SUCCESS) &&
+            (level_0 == ER_LEVEL_WARN))
+        {
+            UART_1_PutString("   7\ter_get_level()\t\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("   7\ter_get_level()\t\tFAIL\r\n");
+            result = ERT_FAILURE;
+        }
+    }
+    
+    if (result == ERT_SUCCESS)
+    {
+        _add_standard(&deque_1, E00100, ER_OPTIONS_NONE, "file.c", 2);
+        er_get_last_object(&deque_1, &object_0);
+        er_get_level(object_0, &level_0);
+        
+        if (level_0 == ER_LEVEL_ERROR)
+        {
+            UART_1_PutString("   8\ter_get_level()\t\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("   8\ter_get_level()\t\tFAIL\r\n");
+            result = ERT_FAILURE;
+        }
+    }
+    
+    /*
+     *  Test er_set_threshold().
+     */
+    if (result == ERT_SUCCESS)
+    {
+        if ((er_set_threshold(ER_LEVEL_ERROR) == ER_SUCCESS) &&
+            (er_get_threshold() == ER_LEVEL_ERROR))
+        {
+            UART_1_PutString("   9\ter_set_threshold()\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("   9\ter_set_threshold()\tFAIL\r\n");
+            result = ERT_FAILURE;
+        }
+    }
+    
+    /*
+     *  Test er_report_standard().
+     */
+    if (result == ERT_SUCCESS)
+    {
+        if (_report_standard(&deque_1, ER_LEVEL_WARN, E00100,
+            ER_OPTIONS_NONE, "file.c", 3) == ER_FILTERED)
+        {
+            UART_1_PutString("  10\ter_report_standard()\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("  10\ter_report_standard()\tFAIL\r\n");
+            result = ERT_FAILURE;
+        }
+    }
+    
+    /*
+     *  Test er_report_special().
+     */
+    if (result == ERT_SUCCESS)
+    {
+        if (_report_special(&deque_1, ER_LEVEL_WARN, "Special.",
+            ER_OPTIONS_NONE, "file.c", 4) == ER_FILTERED)
+        {
+            UART_1_PutString("  11\ter_report_special()\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("  11\ter_report_special()\tFAIL\r\n");
+            result = ERT_FAILURE;
+        }
+    }
+    
+    if (result == ERT_SUCCESS)
+    {
+        if (_report_special(&deque_1, ER_LEVEL_FATAL, "Special.",
+            ER_OPTIONS_NONE, "file.c", 5) == ER_SUCCESS)
+        {
+            UART_1_PutString("  12\ter_report_special()\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("  12\ter_report_special()\tFAIL\r\n");
+            result = ERT_FAILURE;
+        }
+    }
+    
+    if (result == ERT_SUCCESS)
+    {
+        er_get_last_object(&deque_1, &object_0);
+        er_get_level(object_0, &level_0);
+        
+        if ((er_get_count(&deque_1) == 3) && (level_0 == ER_LEVEL_FATAL))
+        {
+            UART_1_PutString("  13\ter_report_special()\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("  13\ter_report_special()\tFAIL\r\n");
+            result = ERT_FAILURE;
+        }
+    }
+    
+    /*
+     *  Test er_log_report_standard().
+     */
+    if (result == ERT_SUCCESS)
+    {
+        if (_log_report_standard(&log_1, ER_LEVEL_WARN, E00100,
+            ER_OPTIONS_NONE, "file.c", 6) == ER_FILTERED)
+        {
+            UART_1_PutString("  14\ter_log_report_standard()\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("  14\ter_log_report_standard()\tFAIL\r\n");
+            result = ERT_FAILURE;
+        }
+    }
+    
+    /*
+     *  Test er_log_report_special().
+     */
+    if (result == ERT_SUCCESS)
+    {
+        if (_log_report_special(&log_1, ER_LEVEL_FATAL, "Special.",
+            ER_OPTIONS_NONE, "file.c", 7) == ER_SUCCESS)
+        {
+            UART_1_PutString("  15\ter_log_report_special()\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("  15\ter_log_report_special()\tFAIL\r\n");
+            result = ERT_FAILURE;
+        }
+    }
+    
+    if (result == ERT_SUCCESS)
+    {
+        er_log_get_object(&log_1, 0, &object_0);
+        er_get_level(object_0, &level_0);
+        
+        if ((er_log_get_count(&log_1) == 1) && (level_0 == ER_LEVEL_FATAL))
+        {
+            UART_1_PutString("  16\ter_log_report_special()\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("  16\ter_log_report_special()\tFAIL\r\n");
+            result = ERT_FAILURE;
+        }
+    }
+    
+    /*
+     *  Test er_log_standard().
+     */
+    if (result == ERT_SUCCESS)
+    {
+        if (_log_standard(&log_1, E00100, ER_OPTIONS_NONE, "file.c", 8) ==
+            ER_SUCCESS)
+        {
+            UART_1_PutString("  17\ter_log_standard()\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("  17\ter_log_standard()\tFAIL\r\n");
+            result = ERT_FAILURE;
+        }
+    }
+    
+    /*
+     *  Test er_add_standard().
+     */
+    if (result == ERT_SUCCESS)
+    {
+        er_set_threshold(ER_LEVEL_FATAL);
+        
+        if (_add_standard(&deque_1, E00100, ER_OPTIONS_NONE, "file.c", 9) ==
+            ER_FILTERED)
+        {
+            UART_1_PutString("  18\ter_add_standard()\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("  18\ter_add_standard()\tFAIL\r\n");
+            result = ERT_FAILURE;
+        }
+    }
+    
+    /*
+     *  Test er_report_standard().
+     */
+    if (result == ERT_SUCCESS)
+    {
+        er_set_threshold(ER_LEVEL_DEBUG);
+        number_0 = E00100;
+        er_report_standard(&deque_1, ER_LEVEL_DEBUG, number_0++,
+            ER_OPTIONS_NONE);
+        
+        if ((er_get_count(&deque_1) == 3 + debug_0) &&
+            (number_0 == E00100 + debug_0))
+        {
+            UART_1_PutString("  19\ter_report_standard()\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("  19\ter_report_standard()\tFAIL\r\n");
+            result = ERT_FAILURE;
+        }
+    }
+    
+    /*
+     *  Test er_report_special().
+     */
+    if (result == ERT_SUCCESS)
+    {
+        er_report_special(&deque_1, ER_LEVEL_FATAL, "Special.",
+            ER_OPTIONS_NONE);
+        
+        if (er_get_count(&deque_1) == 4 + debug_0)
+        {
+            UART_1_PutString("  20\ter_report_special()\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("  20\ter_report_special()\tFAIL\r\n");
+            result = ERT_FAILURE;
+        }
+    }
+    
+    /*
+     *  Test er_log_report_standard().
+     */
+    if (result == ERT_SUCCESS)
+    {
+        er_log_report_standard(&log_1, ER_LEVEL_DEBUG, number_0++,
+            ER_OPTIONS_NONE);
+        
+        if ((er_log_get_count(&log_1) == 2 + debug_0) &&
+            (number_0 == E00100 + 2 * debug_0))
+        {
+            UART_1_PutString("  21\ter_log_report_standard()\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("  21\ter_log_report_standard()\tFAIL\r\n");
+            result = ERT_FAILURE;
+        }
+    }
+    
+    /*
+     *  Test er_log_report_special().
+     */
+    if (result == ERT_SUCCESS)
+    {
+        er_log_report_special(&log_1, ER_LEVEL_FATAL, "Special.",
+            ER_OPTIONS_NONE);
+        
+        if (er_log_get_count(&log_1) == 3 + debug_0)
+        {
+            UART_1_PutString("  22\ter_log_report_special()\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("  22\ter_log_report_special()\tFAIL\r\n");
+            result = ERT_FAILURE;
+        }
+    }
+    
+    /*
+     *  Report test result.
+     */
+    if (result == ERT_SUCCESS)
+    {
+        UART_1_PutString("\r\n");
+        UART_1_PutString("TEST PASSED\r\n");
+    }
+    else
+    {
+        UART_1_PutString("\r\n");
+        UART_1_PutString("TEST FAILED\r\n");
+    }
+    
+    /*
+     *  Clean-up test.
+     */
+    er_destroy(&deque_1);
+    er_set_threshold(ER_LEVEL_DEBUG);
+    
+    while ((UART_1_ReadTxStatus() & UART_1_TX_STS_FIFO_EMPTY) !=
+        UART_1_TX_STS_FIFO_EMPTY)
+    {
+        CyDelay(1);
+    }
+    
+    UART_1_Stop();
+    
+    return result;
+}
+
+#ifdef ER_PERSIST_ROWS
+uint8 ert_test_6(void)
+{
+    uint32 count_0;
+    DE_LIST deque_1 = {0};
+    DE_LIST deque_2 = {0};
+    char *file_0;
+    uint32 i;
+    ER_LOCATION *location_0;
+    char *message_0;
+    char message_1[201];
+    ER_OBJECT *object_0;
+    uint8 options_0;
+    uint8 result = ERT_SUCCESS;
+    uint8 row_0[CYDEV_EEPROM_ROW_SIZE] = {0};
+    RT_DATA *timestamp_0;
+    
+    UART_1_Start();
+    
+    UART_1_PutString("\x1b\x5b\x32\x4a");
+    UART_1_PutString("ERROR PERSIST TEST\r\n");
+    UART_1_PutString("\r\n");
+    UART_1_PutString("Test\tFunction\t\tResult\r\n");
+    UART_1_PutString("----\t--------\t\t------\r\n");
+    
+    /*
+     *  Initialise er_persist_start() test.
+     */
+    if (result == ERT_SUCCESS)
+    {
+        EEPROM_1_Start();
+        
+        if ((er_persist_clear() == ER_SUCCESS) &&
+            (rt_start() == RT_SUCCESS))
+        {
+            UART_1_PutString("   -\tInitialise test...\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("   -\tInitialise test...\tFAIL\r\n");
+            result = ERT_FAILURE;
+        }
+    }
+    
+    /*
+     *  Test er_persist_start().
+     */
+    if (result == ERT_SUCCESS)
+    {
+        if (er_persist_start() == ER_EMPTY)
+        {
+            UART_1_PutString("   1\ter_persist_start()\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("   1\ter_persist_start()\tFAIL\r\n");
+            result = ERT_FAILURE;
+        }
+    }
+    
+    /*
+     *  Test er_persist_commit().
+     */
+    if (result == ERT_SUCCESS)
+    {
+        if (er_persist_commit(NULL) == ER_BAD_ARGUMENT)
+        {
+            UART_1_PutString("   2\ter_persist_commit()\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("   2\ter_persist_commit()\tFAIL\r\n");
+            result = ERT_FAILURE;
+        }
+    }
+    
+    if (result == ERT_SUCCESS)
+    {
+        if (er_persist_commit(&deque_1) == ER_SUCCESS)
+        {
+            UART_1_PutString("   3\ter_persist_commit()\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("   3\ter_persist_commit()\tFAIL\r\n");
+            result = ERT_FAILURE;
+        }
+    }
+    
+    /*
+     *  Test er_persist_restore().
+     */
+    if (result == ERT_SUCCESS)
+    {
+        if (er_persist_restore(NULL) == ER_BAD_ARGUMENT)
+        {
+            UART_1_PutString("   4\ter_persist_restore()\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("   4\ter_persist_restore()\tFAIL\r\n");
+            result = ERT_FAILURE;
+        }
+    }
+    
+    if (result == ERT_SUCCESS)
+    {
+        if ((er_persist_restore(&deque_2) == ER_SUCCESS) &&
+            (er_get_count(&deque_2) == 0))
+        {
+            UART_1_PutString("   5\ter_persist_restore()\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("   5\ter_persist_restore()\tFAIL\r\n");
+            result = ERT_FAILURE;
+        }
+    }
+    
+    /*
+     *  Initialise er_persist_commit() test.
+     */
+    if (result == ERT_SUCCESS)
+    {
+        options_0 = ER_OPTIONS_TIMESTAMP | ER_OPTIONS_LOCATION;
+        _add_standard(&deque_1, E00900, options_0, "persist.c", 10);
+        _add_special(&deque_1, "Persisted.", ER_OPTIONS_LOCATION,
+            "persist.c", 11);
+        for (i = 0 ; i < 3 ; i++)
+        {
+            _add_standard(&deque_1, E00100, ER_OPTIONS_COALESCE,
+                "persist.c", 12);
+        }
+        
+        if (er_get_count(&deque_1) == 3)
+        {
+            UART_1_PutString("   -\tInitialise test...\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("   -\tInitialise test...\tFAIL\r\n");
+            result = ERT_FAILURE;
+        }
+    }
+    
+    /*
+     *  Test er_persist_commit().
+     */
+    if (result == ERT_SUCCESS)
+    {
+        if ((er_persist_commit(&deque_1) == ER_SUCCESS) &&
+            (er_get_count(&deque_1) == 0))
+        {
+            UART_1_PutString("   6\ter_persist_commit()\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("   6\ter_persist_commit()\tFAIL\r\n");
+            result = ERT_FAILURE;
+        }
+    }
+    
+    /*
+     *  Test er_persist_start().
+     */
+    if (result == ERT_SUCCESS)
+    {
+        if (er_persist_start() == ER_SUCCESS)
+        {
+            UART_1_PutString("   7\ter_persist_start()\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("   7\ter_persist_start()\tFAIL\r\n");
+            result = ERT_FAILURE;
+        }
+    }
+    
+    /*
+     *  Test er_persist_restore().
+     */
+    if (result == ERT_SUCCESS)
+    {
+        if ((er_persist_restore(&deque_2) == ER_SUCCESS) &&
+            (er_get_count(&deque_2) == 3))
+        {
+            UART_1_PutString("   8\ter_persist_restore()\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("   8\ter_persist_restore()\tFAIL\r\n");
+            result = ERT_FAILURE;
+        }
+    }
+    
+    if (result == ERT_SUCCESS)
+    {
+        er_get_first_object(&deque_2, &object_0);
+        er_get_location(object_0, &location_0);
+        er_get_file(location_0, &file_0);
+        
+        if ((object_0->error.number == E00900) &&
+            (location_0->line == 10) &&
+            (strcmp(file_0, "persist.c") == 0))
+        {
+            UART_1_PutString("   9\ter_persist_restore()\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("   9\ter_persist_restore()\tFAIL\r\n");
+            result = ERT_FAILURE;
+        }
+    }
+    
+    if (result == ERT_SUCCESS)
+    {
+        er_get_timestamp(object_0, &timestamp_0);
+        
+        if ((timestamp_0->Year == 1918) && (timestamp_0->Hour == 11))
+        {
+            UART_1_PutString("  10\ter_persist_restore()\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("  10\ter_persist_restore()\tFAIL\r\n");
+            result = ERT_FAILURE;
+        }
+    }
+    
+    if (result == ERT_SUCCESS)
+    {
+        er_remove(&deque_2);
+        er_get_first_object(&deque_2, &object_0);
+        er_get_message(object_0, &message_0);
+        
+        if (strcmp(message_0, "Persisted.") == 0)
+        {
+            UART_1_PutString("  11\ter_persist_restore()\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("  11\ter_persist_restore()\tFAIL\r\n");
+            result = ERT_FAILURE;
+        }
+    }
+    
+    if (result == ERT_SUCCESS)
+    {
+        er_remove(&deque_2);
+        er_get_first_object(&deque_2, &object_0);
+        er_get_occurrences(object_0, &count_0);
+        
+        if ((object_0->error.number == E00100) && (count_0 == 3))
+        {
+            UART_1_PutString("  12\ter_persist_restore()\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("  12\ter_persist_restore()\tFAIL\r\n");
+            result = ERT_FAILURE;
+        }
+    }
+    
+    if (result == ERT_SUCCESS)
+    {
+        er_destroy(&deque_2);
+        _add_special(&deque_1, "Interrupted by reset.", ER_OPTIONS_NONE,
+            "persist.c", 13);
+        er_persist_commit(&deque_1);
+        EEPROM_1_Write(row_0, ER_PERSIST_FIRST_ROW + 8);
+        er_persist_start();
+        
+        if ((er_persist_restore(&deque_2) == ER_SUCCESS) &&
+            (er_get_count(&deque_2) == 3))
+        {
+            UART_1_PutString("  13\ter_persist_restore()\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("  13\ter_persist_restore()\tFAIL\r\n");
+            result = ERT_FAILURE;
+        }
+    }
+    
+    if (result == ERT_SUCCESS)
+    {
+        er_destroy(&deque_2);
+        _add_standard(&deque_1, E00300, ER_OPTIONS_NONE, "persist.c", 14);
+        er_persist_commit(&deque_1);
+        er_persist_start();
+        er_persist_restore(&deque_2);
+        er_get_last_object(&deque_2, &object_0);
+        
+        if ((er_get_count(&deque_2) == 4) && (object_0->error.number == E00300))
+        {
+            UART_1_PutString("  14\ter_persist_restore()\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("  14\ter_persist_restore()\tFAIL\r\n");
+            result = ERT_FAILURE;
+        }
+    }
+    
+    if (result == ERT_SUCCESS)
+    {
+        er_destroy(&deque_2);
+        for (i = 0 ; i < ER_PERSIST_ROWS ; i++)
+        {
+            _add_standard(&deque_1, E00400, ER_OPTIONS_NONE, "persist.c", 15);
+            er_persist_commit(&deque_1);
+        }
+        er_persist_start();
+        er_persist_restore(&deque_2);
+        er_get_first_object(&deque_2, &object_0);
+        
+        if ((er_get_count(&deque_2) == ER_PERSIST_ROWS) &&
+            (object_0->error.number == E00400))
+        {
+            UART_1_PutString("  15\ter_persist_restore()\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("  15\ter_persist_restore()\tFAIL\r\n");
+            result = ERT_FAILURE;
+        }
+    }
+    
+    /*
+     *  Test er_persist_commit().
+     */
+    if (result == ERT_SUCCESS)
+    {
+        memset(message_1, 'x', sizeof(message_1) - 1);
+        message_1[sizeof(message_1) - 1] = '\0';
+        _add_special(&deque_1, message_1, ER_OPTIONS_NONE, "persist.c", 16);
+        
+        if ((er_persist_commit(&deque_1) == ER_SUCCESS) &&
+            (er_get_count(&deque_1) == 0))
+        {
+            UART_1_PutString("  16\ter_persist_commit()\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("  16\ter_persist_commit()\tFAIL\r\n");
+            result = ERT_FAILURE;
+        }
+    }
+    
+    if (result == ERT_SUCCESS)
+    {
+        for (i = 0 ; i < ER_PERSIST_BATCH + 2 ; i++)
+        {
+            _add_standard(&deque_1, E00500, ER_OPTIONS_NONE, "persist.c", 17);
+        }
+        
+        if ((er_persist_commit(&deque_1) == ER_SUCCESS) &&
+            (er_get_count(&deque_1) == 0))
+        {
+            UART_1_PutString("  17\ter_persist_commit()\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("  17\ter_persist_commit()\tFAIL\r\n");
+            result = ERT_FAILURE;
+        }
+    }
+    
+    /*
+     *  Test er_persist_restore().
+     */
+    if (result == ERT_SUCCESS)
+    {
+        er_destroy(&deque_2);
+        er_persist_start();
+        er_persist_restore(&deque_2);
+        er_get_last_object(&deque_2, &object_0);
+        
+        if ((er_get_count(&deque_2) == ER_PERSIST_ROWS) &&
+            (object_0->error.number == E00500))
+        {
+            UART_1_PutString("  18\ter_persist_restore()\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("  18\ter_persist_restore()\tFAIL\r\n");
+            result = ERT_FAILURE;
+        }
+    }
+    
+    /*
+     *  Test er_persist_clear().
+     */
+    if (result == ERT_SUCCESS)
+    {
+        er_destroy(&deque_2);
+        
+        if ((er_persist_clear() == ER_SUCCESS) &&
+            (er_persist_start() == ER_EMPTY))
+        {
+            UART_1_PutString("  19\ter_persist_clear()\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("  19\ter_persist_clear()\tFAIL\r\n");
+            result = ERT_FAILURE;
+        }
+    }
+    
+    if (result == ERT_SUCCESS)
+    {
+        if ((er_persist_restore(&deque_2) == ER_SUCCESS) &&
+            (er_get_count(&deque_2) == 0))
+        {
+            UART_1_PutString("  20\ter_persist_clear()\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("  20\ter_persist_clear()\tFAIL\r\n");
+            result = ERT_FAILURE;
+        }
+    }
+    
     /*
      *  Report test result.
      */
@@ -1716,6 +4552,12 @@ uint8 ert_test_1(void)
     /*
      *  Clean-up test.
      */
+    er_destroy(&deque_1);
+    er_destroy(&deque_2);
+    er_persist_clear();
+    EEPROM_1_Stop();
+    rt_stop();
+    
     while ((UART_1_ReadTxStatus() & UART_1_TX_STS_FIFO_EMPTY) !=
         UART_1_TX_STS_FIFO_EMPTY)
     {
@@ -1726,6 +4568,7 @@ uint8 ert_test_1(void)
     
     return result;
 }
+#endif
 
 /****************************************************************************
  *  Local Functions
@@ -36,10 +36,17 @@
  *
  *  <H3> Introduction </H3>
  *
- *  The error management test library contains a single function that tests
- *  each of the functions that comprise the error management library.
+ *  The error management test library contains six functions that test the
+ *  error management library. The first, ert_test_1(), tests each of the
+ *  functions that manage errors held in a deque, the second, ert_test_2(),
+ *  tests the functions of the error log, the third, ert_test_3(), tests the
+ *  binary export and import of both, the fourth, ert_test_4(), tests the
+ *  handling of repeated errors, and the fifth, ert_test_5(), tests severity
+ *  levels. The sixth, ert_test_6(), is only built if #ER_PERSIST_ROWS is
+ *  defined, and tests the persisted error log. It erases the log both before
+ *  and after running.
  *
- *  This function, ert_test_1(), provides complete coverage of the error
+ *  Together, these functions provide complete coverage of the error
  *  management library codebase, with one exception. Those error management
  *  library functions that call malloc(), either directly or indirectly,
  *  have not had their #ER_NO_MEMORY return value tested.
@@ -47,9 +54,9 @@
  *  <H3> Use </H3>
  *
  *  In order to use the library, the programmer must first connect the target
- *  system to a serial terminal configured as 57600 8-N-1. To run the test,
- *  simply call the function ert_test_1() and observe the serial output, which
- *  should be as follows.
+ *  system to a serial terminal configured as 57600 8-N-1. To run a test,
+ *  simply call the appropriate function and observe the serial output.
+ *  Running ert_test_1() should produce the following serial output.
  *
  *  @code
  *  ERROR MANAGEMENT LIBRARY TEST
@@ -166,12 +173,225 @@
  *    90    er_set_limit()          PASS
  *    91    er_destroy()            PASS
  *    92    er_destroy()            PASS
+ *    93    er_get_file()           PASS
+ *    94    er_get_file()           PASS
+ *    95    er_get_file()           PASS
+ *    96    er_get_file()           PASS
  *
  *  TEST PASSED
  *  @endcode
  *
- *  Alternatively, if no serial terminal is available, the ert_test_1() return
- *  value may be checked to see if the test completed successfully or not.
+ *  Running ert_test_2() should produce the following serial output.
+ *
+ *  @code
+ *  ERROR LOG TEST
+ *
+ *  Test    Function                Result
+ *  ----    --------                ------
+ *     1    er_log_standard()       PASS
+ *     2    er_log_standard()       PASS
+ *     3    er_log_standard()       PASS
+ *     4    er_log_standard()       PASS
+ *     -    Initialise test...      PASS
+ *     -    Initialise test...      PASS
+ *     5    er_log_standard()       PASS
+ *     6    er_log_standard()       PASS
+ *     -    Initialise test...      PASS
+ *     7    er_log_standard()       PASS
+ *     8    er_log_standard()       PASS
+ *     9    er_log_special()        PASS
+ *    10    er_log_special()        PASS
+ *    11    er_log_special()        PASS
+ *    12    er_log_get_object()     PASS
+ *    13    er_log_get_object()     PASS
+ *    14    er_log_get_object()     PASS
+ *    15    er_log_get_count()      PASS
+ *    16    er_log_get_count()      PASS
+ *    17    er_log_set_policy()     PASS
+ *    18    er_log_set_policy()     PASS
+ *    19    er_log_standard()       PASS
+ *    20    er_log_standard()       PASS
+ *    21    er_log_standard()       PASS
+ *    22    er_log_set_policy()     PASS
+ *    23    er_log_standard()       PASS
+ *    24    er_log_standard()       PASS
+ *    25    er_log_standard()       PASS
+ *    26    er_log_standard()       PASS
+ *    27    er_log_get_lost()       PASS
+ *    28    er_log_remove()         PASS
+ *    29    er_log_remove()         PASS
+ *    30    er_log_remove()         PASS
+ *    31    er_log_clear()          PASS
+ *    32    er_log_clear()          PASS
+ *    33    er_log_clear()          PASS
+ *    34    er_log_clear()          PASS
+ *    35    er_log_clear()          PASS
+ *
+ *  TEST PASSED
+ *  @endcode
+ *
+ *  Running ert_test_3() should produce the following serial output.
+ *
+ *  @code
+ *  ERROR EXPORT TEST
+ *
+ *  Test    Function                Result
+ *  ----    --------                ------
+ *     1    er_export()             PASS
+ *     2    er_export()             PASS
+ *     3    er_export()             PASS
+ *     4    er_export()             PASS
+ *     -    Initialise test...      PASS
+ *     5    er_export()             PASS
+ *     6    er_export()             PASS
+ *     7    er_export()             PASS
+ *     8    er_export()             PASS
+ *     9    er_export()             PASS
+ *    10    er_export()             PASS
+ *    11    er_export()             PASS
+ *    12    er_export()             PASS
+ *     -    Initialise test...      PASS
+ *    13    er_export()             PASS
+ *    14    er_export()             PASS
+ *    15    er_export()             PASS
+ *    16    er_export()             PASS
+ *    17    er_log_export()         PASS
+ *     -    Initialise test...      PASS
+ *    18    er_log_export()         PASS
+ *    19    er_log_export()         PASS
+ *    20    er_log_export()         PASS
+ *    21    er_log_export()         PASS
+ *    22    er_import()             PASS
+ *    23    er_import()             PASS
+ *    24    er_import()             PASS
+ *     -    Initialise test...      PASS
+ *    25    er_import()             PASS
+ *    26    er_import()             PASS
+ *    27    er_import()             PASS
+ *    28    er_import()             PASS
+ *    29    er_import()             PASS
+ *    30    er_import()             PASS
+ *    31    er_import()             PASS
+ *    32    er_import()             PASS
+ *    33    er_add_standard()       PASS
+ *
+ *  TEST PASSED
+ *  @endcode
+ *
+ *  Running ert_test_4() should produce the following serial output.
+ *
+ *  @code
+ *  ERROR REPEAT TEST
+ *
+ *  Test    Function                Result
+ *  ----    --------                ------
+ *     1    er_get_occurrences()    PASS
+ *     -    Initialise test...      PASS
+ *     2    er_get_occurrences()    PASS
+ *     3    er_get_occurrences()    PASS
+ *     4    er_get_last_timestamp() PASS
+ *     5    er_get_last_timestamp() PASS
+ *     6    er_get_last_timestamp() PASS
+ *     7    er_add_standard()       PASS
+ *     8    er_add_standard()       PASS
+ *     9    er_add_standard()       PASS
+ *    10    er_add_standard()       PASS
+ *    11    er_add_standard()       PASS
+ *    12    er_add_standard()       PASS
+ *    13    er_add_standard()       PASS
+ *    14    er_export()             PASS
+ *    15    er_export()             PASS
+ *    16    er_export()             PASS
+ *    17    er_export()             PASS
+ *    18    er_log_standard()       PASS
+ *    19    er_log_standard()       PASS
+ *    20    er_log_standard()       PASS
+ *    21    er_set_rate()           PASS
+ *    22    er_set_rate()           PASS
+ *    23    er_get_limited()        PASS
+ *    24    er_add_standard()       PASS
+ *    25    er_add_standard()       PASS
+ *    26    er_add_standard()       PASS
+ *    27    er_add_standard()       PASS
+ *    28    er_add_standard()       PASS
+ *    29    er_add_standard()       PASS
+ *    30    er_log_standard()       PASS
+ *    31    er_set_rate()           PASS
+ *    32    er_add_standard()       PASS
+ *    33    er_get_limited()        PASS
+ *
+ *  TEST PASSED
+ *  @endcode
+ *
+ *  Running ert_test_5() should produce the following serial output.
+ *
+ *  @code
+ *  ERROR SEVERITY TEST
+ *
+ *  Test    Function                Result
+ *  ----    --------                ------
+ *     1    er_set_threshold()      PASS
+ *     2    er_get_threshold()      PASS
+ *     3    er_report_standard()    PASS
+ *     4    er_report_standard()    PASS
+ *     5    er_get_level()          PASS
+ *     6    er_get_level()          PASS
+ *     7    er_get_level()          PASS
+ *     8    er_get_level()          PASS
+ *     9    er_set_threshold()      PASS
+ *    10    er_report_standard()    PASS
+ *    11    er_report_special()     PASS
+ *    12    er_report_special()     PASS
+ *    13    er_report_special()     PASS
+ *    14    er_log_report_standard()        PASS
+ *    15    er_log_report_special() PASS
+ *    16    er_log_report_special() PASS
+ *    17    er_log_standard()       PASS
+ *    18    er_add_standard()       PASS
+ *    19    er_report_standard()    PASS
+ *    20    er_report_special()     PASS
+ *    21    er_log_report_standard()        PASS
+ *    22    er_log_report_special() PASS
+ *
+ *  TEST PASSED
+ *  @endcode
+ *
+ *  Running ert_test_6() should produce the following serial output.
+ *
+ *  @code
+ *  ERROR PERSIST TEST
+ *
+ *  Test    Function                Result
+ *  ----    --------                ------
+ *     -    Initialise test...      PASS
+ *     1    er_persist_start()      PASS
+ *     2    er_persist_commit()     PASS
+ *     3    er_persist_commit()     PASS
+ *     4    er_persist_restore()    PASS
+ *     5    er_persist_restore()    PASS
+ *     -    Initialise test...      PASS
+ *     6    er_persist_commit()     PASS
+ *     7    er_persist_start()      PASS
+ *     8    er_persist_restore()    PASS
+ *     9    er_persist_restore()    PASS
+ *    10    er_persist_restore()    PASS
+ *    11    er_persist_restore()    PASS
+ *    12    er_persist_restore()    PASS
+ *    13    er_persist_restore()    PASS
+ *    14    er_persist_restore()    PASS
+ *    15    er_persist_restore()    PASS
+ *    16    er_persist_commit()     PASS
+ *    17    er_persist_commit()     PASS
+ *    18    er_persist_restore()    PASS
+ *    19    er_persist_clear()      PASS
+ *    20    er_persist_clear()      PASS
+ *
+ *  TEST PASSED
+ *  @endcode
+ *
+ *  Alternatively, if no serial terminal is available, the return value of
+ *  each test function may be checked to see if the test completed
+ *  successfully or not.
  *
  *  <H3> Hardware </H3>
  *
@@ -180,6 +400,7 @@
  *  requires access to the following components:
  *
  *  - RTC_1
+ *  - EEPROM_1, if #ER_PERSIST_ROWS is defined
  *  - UART_1
  *
  *  The PSoC5 module must be fitted with a 32.768kHz crystal, and the 'XTAL
@@ -238,6 +459,40 @@
  */
 uint8 ert_test_1(void);
 
+/**
+ *  @brief Tests the error log functions of the error management library.
+ *  @return #ERT_SUCCESS if successful, otherwise #ERT_FAILURE.
+ */
+uint8 ert_test_2(void);
+
+/**
+ *  @brief Tests the export and import functions of the error management
+ *      library.
+ *  @return #ERT_SUCCESS if successful, otherwise #ERT_FAILURE.
+ */
+uint8 ert_test_3(void);
+
+/**
+ *  @brief Tests the repeated error functions of the error management
+ *      library.
+ *  @return #ERT_SUCCESS if successful, otherwise #ERT_FAILURE.
+ */
+uint8 ert_test_4(void);
+
+/**
+ *  @brief Tests the severity functions of the error management library.
+ *  @return #ERT_SUCCESS if successful, otherwise #ERT_FAILURE.
+ */
+uint8 ert_test_5(void);
+
+#ifdef ER_PERSIST_ROWS
+/**
+ *  @brief Tests the persistence functions of the error management library.
+ *  @return #ERT_SUCCESS if successful, otherwise #ERT_FAILURE.
+ */
+uint8 ert_test_6(void);
+#endif
+
 #endif
 
 /****************************************************************************
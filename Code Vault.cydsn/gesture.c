@@ -0,0 +1,418 @@
+/****************************************************************************
+ *
+ *  File:           gesture.c
+ *  Module:         Gesture Library
+ *  Project:        Code Vault
+ *  Workspace:      PSoC Tools
+ *
+ *  Author:         Rodney B. Elliott
+ *  Date:           17 October 2026
+ *
+ ****************************************************************************
+ *
+ *  Copyright:      2013 Rodney B. Elliott
+ *
+ *  This file is part of PSoC Tools.
+ *
+ *  PSoC Tools is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  PSoC Tools is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with PSoC Tools. If not, see <http://www.gnu.org/licenses/>.
+ *
+ ****************************************************************************/
+/**
+ *  @file gesture.c
+ *  @brief Gesture library implementation.
+ */
+
+/****************************************************************************
+ *  Modules
+ ****************************************************************************/
+#include <device.h>
+#include <string.h>
+
+#include "gesture.h"
+
+/****************************************************************************
+ *  Definitions and Macros
+ ****************************************************************************/
+/**
+ *  @brief The mask used to find the index of a gesture within a gesture
+ *      list.
+ */
+#define _MASK                           (GS_LIST_SIZE - 1)
+
+/**
+ *  @brief Half the range of a masked millisecond count.
+ *
+ *  A count that lies less than this far after another is taken to follow
+ *  it, and one that lies further is taken to precede it.
+ */
+#define _HALF                           ((BU_TICKS_MASK >> 1) + 1)
+
+/****************************************************************************
+ *  Typedefs and Structures
+ ****************************************************************************/
+
+/****************************************************************************
+ *  Prototypes of Local Functions
+ ****************************************************************************/
+/**
+ *  @brief Process the press of a button.
+ *  @param[in] list A pointer to a gesture list.
+ *  @param[in] index The button number less one.
+ *  @param[in] ticks The masked millisecond count of the press.
+ */
+static void _press(GS_LIST *list, uint8 index, uint32 ticks);
+
+/**
+ *  @brief Process the release of a button.
+ *  @param[in] list A pointer to a gesture list.
+ *  @param[in] index The button number less one.
+ *  @param[in] ticks The masked millisecond count of the release.
+ */
+static void _release(GS_LIST *list, uint8 index, uint32 ticks);
+
+/**
+ *  @brief Add a recognised gesture to a gesture list.
+ *  @param[in] list A pointer to a gesture list.
+ *  @param[in] gesture The gesture, eg #GS_CLICK.
+ *  @param[in] buttons The buttons that made the gesture.
+ *  @param[in] ticks The masked millisecond count of the gesture.
+ *  @remark Should the list be full, the gesture is discarded and counted.
+ */
+static void _report(GS_LIST *list, uint8 gesture, uint8 buttons,
+    uint32 ticks);
+
+/**
+ *  @brief Get the time between two masked millisecond counts.
+ *  @param[in] from The earlier count.
+ *  @param[in] to The later count.
+ *  @return The number of milliseconds between the counts, masked with
+ *      #BU_TICKS_MASK.
+ */
+static uint32 _elapsed(uint32 from, uint32 to);
+
+/****************************************************************************
+ *  Exported Variables
+ ****************************************************************************/
+
+/****************************************************************************
+ *  Global Variables
+ ****************************************************************************/
+
+/****************************************************************************
+ *  Exported Functions
+ ****************************************************************************/
+uint8 gs_init(GS_LIST *list)
+{
+    uint8 result = GS_BAD_ARGUMENT;
+    
+    if (list != NULL)
+    {
+        memset(list, 0, sizeof(*list));
+        
+        list->times[GS_TIME_DOUBLE] = GS_DEFAULT_DOUBLE;
+        list->times[GS_TIME_LONG] = GS_DEFAULT_LONG;
+        list->times[GS_TIME_REPEAT] = GS_DEFAULT_REPEAT;
+        list->times[GS_TIME_CHORD] = GS_DEFAULT_CHORD;
+        
+        result = GS_SUCCESS;
+    }
+    
+    return result;
+}
+
+uint8 gs_set_time(GS_LIST *list, uint8 time, uint16 value)
+{
+    uint8 result = GS_BAD_ARGUMENT;
+    
+    if (list != NULL && time < GS_TIME_COUNT)
+    {
+        list->times[time] = value;
+        
+        result = GS_SUCCESS;
+    }
+    
+    return result;
+}
+
+uint16 gs_get_time(GS_LIST *list, uint8 time)
+{
+    uint16 value = 0;
+    
+    if (list != NULL && time < GS_TIME_COUNT)
+    {
+        value = list->times[time];
+    }
+    
+    return value;
+}
+
+uint8 gs_add_event(GS_LIST *list, BU_OBJECT *object)
+{
+    uint8 result = GS_BAD_ARGUMENT;
+    
+    if (list != NULL && object != NULL &&
+        object->number >= 1 && object->number <= BU_BUTTON_COUNT)
+    {
+        if (object->state == BU_PRESSED)
+        {
+            _press(list, object->number - 1, object->ticks & BU_TICKS_MASK);
+        }
+        else
+        {
+            _release(list, object->number - 1,
+                object->ticks & BU_TICKS_MASK);
+        }
+        
+        result = GS_SUCCESS;
+    }
+    
+    return result;
+}
+
+uint8 gs_add_events(GS_LIST *list, BU_LIST *buffer)
+{
+    BU_OBJECT object;
+    uint8 result = GS_BAD_ARGUMENT;
+    
+    if (list != NULL && buffer != NULL)
+    {
+        while (bu_get_old_object(buffer, &object) == BU_SUCCESS)
+        {
+            gs_add_event(list, &object);
+            bu_remove_old(buffer);
+        }
+        
+        result = GS_SUCCESS;
+    }
+    
+    return result;
+}
+
+uint8 gs_update(GS_LIST *list, uint32 ticks)
+{
+    GS_BUTTON *button;
+    uint8 index;
+    uint8 mask;
+    uint8 pending;
+    uint8 result = GS_BAD_ARGUMENT;
+    
+    if (list != NULL)
+    {
+        ticks &= BU_TICKS_MASK;
+        pending = list->timed;
+        
+        /*
+         *  Only those buttons awaiting a long press or a repeat are visited,
+         *  stopping as soon as none remain.
+         */
+        for (index = 0, mask = 0x01 ; pending != 0 ; index++, mask <<= 1)
+        {
+            if ((pending & mask) == mask)
+            {
+                pending ^= mask;
+                button = &list->buttons[index];
+                
+                if (_elapsed(button->due, ticks) < _HALF)
+                {
+                    if (button->held == 0)
+                    {
+                        _report(list, GS_LONG_PRESS, mask, ticks);
+                        button->held = 1;
+                    }
+                    else
+                    {
+                        _report(list, GS_REPEAT, mask, ticks);
+                    }
+                    
+                    if (list->times[GS_TIME_REPEAT] != 0)
+                    {
+                        button->due = (button->due +
+                            list->times[GS_TIME_REPEAT]) & BU_TICKS_MASK;
+                    }
+                    else
+                    {
+                        list->timed &= ~mask;
+                    }
+                }
+            }
+        }
+        
+        result = GS_SUCCESS;
+    }
+    
+    return result;
+}
+
+uint8 gs_get_gesture(GS_LIST *list, GS_OBJECT *object)
+{
+    uint8 result = GS_BAD_ARGUMENT;
+    
+    if (list != NULL && object != NULL)
+    {
+        if (list->write != list->read)
+        {
+            *object = list->gestures[list->read & _MASK];
+            
+            ++list->read;
+            
+            result = GS_SUCCESS;
+        }
+        else
+        {
+            result = GS_EMPTY;
+        }
+    }
+    
+    return result;
+}
+
+uint32 gs_get_count(GS_LIST *list)
+{
+    uint32 count = 0;
+    
+    if (list != NULL)
+    {
+        count = list->write - list->read;
+    }
+    
+    return count;
+}
+
+uint32 gs_get_dropped(GS_LIST *list)
+{
+    uint32 dropped = 0;
+    
+    if (list != NULL)
+    {
+        dropped = list->dropped;
+    }
+    
+    return dropped;
+}
+
+/****************************************************************************
+ *  Local Functions
+ ****************************************************************************/
+void _press(GS_LIST *list, uint8 index, uint32 ticks)
+{
+    GS_BUTTON *button = &list->buttons[index];
+    uint8 mask = 0x01 << index;
+    
+    if ((list->down & mask) == 0)
+    {
+        /*
+         *  A press starts a new chord when no other button is held down, and
+         *  joins the current chord if it follows the last press closely
+         *  enough, whilst every button of the chord is still held down.
+         */
+        if (list->down == 0)
+        {
+            list->chord = mask;
+            list->chorded = 0;
+        }
+        else if ((list->chord & list->down) == list->chord &&
+            _elapsed(list->last, ticks) <= list->times[GS_TIME_CHORD])
+        {
+            list->chord |= mask;
+            list->timed &= ~list->chord;
+        }
+        
+        list->down |= mask;
+        list->last = ticks;
+        
+        button->pressed = ticks;
+        button->held = 0;
+        
+        if ((list->chord & mask) == 0 || list->chord == mask)
+        {
+            button->due = (ticks + list->times[GS_TIME_LONG]) &
+                BU_TICKS_MASK;
+            list->timed |= mask;
+        }
+    }
+}
+
+void _release(GS_LIST *list, uint8 index, uint32 ticks)
+{
+    GS_BUTTON *button = &list->buttons[index];
+    uint8 mask = 0x01 << index;
+    
+    if ((list->down & mask) == mask)
+    {
+        list->down &= ~mask;
+        list->timed &= ~mask;
+        
+        if ((list->chord & mask) == mask && list->chord != mask)
+        {
+            if (list->chorded == 0)
+            {
+                _report(list, GS_CHORD, list->chord, ticks);
+                list->chorded = 1;
+            }
+            
+            button->clicked = 0;
+        }
+        else if (button->held == 0)
+        {
+            _report(list, GS_CLICK, mask, ticks);
+            
+            if (button->clicked != 0 &&
+                _elapsed(button->released, button->pressed) <=
+                list->times[GS_TIME_DOUBLE])
+            {
+                _report(list, GS_DOUBLE_CLICK, mask, ticks);
+                button->clicked = 0;
+            }
+            else
+            {
+                button->clicked = 1;
+                button->released = ticks;
+            }
+        }
+        
+        if ((list->chord & list->down) == 0)
+        {
+            list->chord = 0;
+        }
+    }
+}
+
+void _report(GS_LIST *list, uint8 gesture, uint8 buttons, uint32 ticks)
+{
+    GS_OBJECT *object;
+    
+    if (list->write - list->read >= GS_LIST_SIZE)
+    {
+        ++list->dropped;
+    }
+    else
+    {
+        object = &list->gestures[list->write & _MASK];
+        
+        object->gesture = gesture;
+        object->buttons = buttons;
+        object->ticks = ticks;
+        
+        ++list->write;
+    }
+}
+
+uint32 _elapsed(uint32 from, uint32 to)
+{
+    return (to - from) & BU_TICKS_MASK;
+}
+
+/****************************************************************************
+ *  End of File
+ ****************************************************************************/
@@ -0,0 +1,464 @@
+/****************************************************************************
+ *
+ *  File:           gesture.h
+ *  Module:         Gesture Library
+ *  Project:        Code Vault
+ *  Workspace:      PSoC Tools
+ *
+ *  Author:         Rodney B. Elliott
+ *  Date:           17 October 2026
+ *
+ ****************************************************************************
+ *
+ *  Copyright:      2013 Rodney B. Elliott
+ *
+ *  This file is part of PSoC Tools.
+ *
+ *  PSoC Tools is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  PSoC Tools is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with PSoC Tools. If not, see <http://www.gnu.org/licenses/>.
+ *
+ ****************************************************************************/
+#ifndef GESTURE_H
+#define GESTURE_H
+/**
+ *  @file gesture.h
+ *  @brief Gesture library interface.
+ *
+ *  <H3> Introduction </H3>
+ *
+ *  The gesture library is a collection of functions that turn the raw button
+ *  events reported by the button library into the gestures that a user
+ *  interface actually responds to. The following gestures are recognised:
+ *
+ *  Gesture  | Description
+ *  -------- | ------------
+ *  @b GS_CLICK        | A button was pressed and released.
+ *  @b GS_DOUBLE_CLICK | A button was clicked twice in quick succession.
+ *  @b GS_LONG_PRESS   | A button has been held down.
+ *  @b GS_REPEAT       | A button is still being held down.
+ *  @b GS_CHORD        | Two or more buttons were pressed together.
+ *
+ *  Each raw button event is processed as it arrives, using only the state
+ *  kept for its own button, so the cost of recognising a gesture does not
+ *  depend upon the number of events that came before it. A click is
+ *  reported as soon as its button is released. Should a second click of the
+ *  same button begin within #GS_TIME_DOUBLE milliseconds of the first, a
+ *  double-click is reported as well.
+ *
+ *  A long press and the repeats that follow it occur whilst a button is held
+ *  down, when no raw event arrives to report them. The function gs_update()
+ *  must therefore be called regularly from the main loop with the current
+ *  millisecond count. It only examines those buttons that are being held
+ *  down, and reports a long press once a button has been held for
+ *  #GS_TIME_LONG milliseconds, followed by a repeat every #GS_TIME_REPEAT
+ *  milliseconds until the button is released. A button released after a
+ *  long press does not also report a click.
+ *
+ *  Buttons pressed within #GS_TIME_CHORD milliseconds of one another, whilst
+ *  the earlier ones are still held down, form a chord. A chord is reported
+ *  once, when the first of its buttons is released, and its buttons report
+ *  no other gestures until they have all been released.
+ *
+ *  Recognised gestures are held in a ring of #GS_LIST_SIZE gestures within
+ *  the GS_LIST structure itself, so the library makes no calls to the heap.
+ *  Should a gesture be recognised whilst the ring is full, the gesture is
+ *  discarded and counted.
+ *
+ *  <H3> Use </H3>
+ *
+ *  In order to use the library, the programmer must start by declaring an
+ *  instance of a GS_LIST structure with scope appropriate to the intended
+ *  application. This instance must then be passed to gs_init(), ie:
+ *
+ *  @code
+ *  GS_LIST gs_list;
+ *
+ *  gs_init(&gs_list);
+ *  @endcode
+ *
+ *  The times used to recognise each gesture may then be changed using the
+ *  function gs_set_time(), and examined using gs_get_time().
+ *
+ *  Raw button events are passed to the library one at a time using the
+ *  function gs_add_event(), or all at once using gs_add_events(), which
+ *  removes each event from a button list as it is passed. Together with
+ *  gs_update(), these functions are typically called each time around the
+ *  main loop. Recognised gestures are then removed, oldest first, using the
+ *  function gs_get_gesture(). The function gs_get_count() returns the number
+ *  of gestures waiting to be removed, whilst gs_get_dropped() returns the
+ *  number of gestures discarded because the ring was full.
+ *
+ *  For further information about these library functions, please refer to
+ *  the individual function documentation. For examples of their use, please
+ *  see the gesture test library.
+ *
+ *  <H3> Hardware </H3>
+ *
+ *  The gesture library has no hardware requirements of its own. Its raw
+ *  button events are normally supplied by the button library.
+ *
+ *  <H3> Further Reading </H3>
+ *
+ *  Button library (button.h)
+ *
+ *  Real-time clock library (rtime.h)
+ */
+
+/****************************************************************************
+ *  Modules
+ ****************************************************************************/
+#include "button.h"
+
+/****************************************************************************
+ *  Definitions and Macros
+ ****************************************************************************/
+/**
+ *  @brief Generic success.
+ */
+#define GS_SUCCESS                      0
+
+/**
+ *  @brief Generic failure.
+ */
+#define GS_FAILURE                      1
+
+/**
+ *  @brief A bad argument was passed to a function.
+ */
+#define GS_BAD_ARGUMENT                 3
+
+/**
+ *  @brief There are no gestures to remove.
+ */
+#define GS_EMPTY                        4
+
+/**
+ *  @brief A button was pressed and released.
+ */
+#define GS_CLICK                        0
+
+/**
+ *  @brief A button was clicked twice in quick succession.
+ */
+#define GS_DOUBLE_CLICK                 1
+
+/**
+ *  @brief A button has been held down.
+ */
+#define GS_LONG_PRESS                   2
+
+/**
+ *  @brief A button is still being held down.
+ */
+#define GS_REPEAT                       3
+
+/**
+ *  @brief Two or more buttons were pressed together.
+ */
+#define GS_CHORD                        4
+
+/**
+ *  @brief The greatest time between the release of a click and the press
+ *      that begins a double-click.
+ */
+#define GS_TIME_DOUBLE                  0
+
+/**
+ *  @brief The time a button must be held down for a long press.
+ */
+#define GS_TIME_LONG                    1
+
+/**
+ *  @brief The time between repeats.
+ *
+ *  Set this time to zero in order to disable repeats.
+ */
+#define GS_TIME_REPEAT                  2
+
+/**
+ *  @brief The greatest time between the presses of the buttons of a chord.
+ */
+#define GS_TIME_CHORD                   3
+
+/**
+ *  @brief The number of times used to recognise gestures.
+ */
+#define GS_TIME_COUNT                   4
+
+/**
+ *  @brief The default double-click time, in milliseconds.
+ */
+#define GS_DEFAULT_DOUBLE               300
+
+/**
+ *  @brief The default long press time, in milliseconds.
+ */
+#define GS_DEFAULT_LONG                 800
+
+/**
+ *  @brief The default repeat time, in milliseconds.
+ */
+#define GS_DEFAULT_REPEAT               200
+
+/**
+ *  @brief The default chord time, in milliseconds.
+ */
+#define GS_DEFAULT_CHORD                50
+
+/**
+ *  @brief The number of gestures a gesture list is able to hold.
+ *
+ *  The value must be a power of two.
+ */
+#define GS_LIST_SIZE                    16
+
+#if (GS_LIST_SIZE == 0) || ((GS_LIST_SIZE & (GS_LIST_SIZE - 1)) != 0)
+#error GS_LIST_SIZE must be a power of two.
+#endif
+
+/****************************************************************************
+ *  Typedefs and Structures
+ ****************************************************************************/
+/**
+ *  @brief Gesture information.
+ */
+typedef struct GS_OBJECT
+{
+    /**
+     *  @brief The gesture.
+     *
+     *  This member may be one of the following values.
+     *
+     *  Value       | Description
+     *  ----------- | -------------------------
+     *  @b GS_CLICK        | A button was pressed and released.
+     *  @b GS_DOUBLE_CLICK | A button was clicked twice in quick succession.
+     *  @b GS_LONG_PRESS   | A button has been held down.
+     *  @b GS_REPEAT       | A button is still being held down.
+     *  @b GS_CHORD        | Two or more buttons were pressed together.
+     */
+    uint8 gesture;
+    
+    /**
+     *  @brief The buttons that made the gesture.
+     *
+     *  One bit is set for each button, using the button register masks, eg
+     *  #BU_BUTTON_1. Only a chord sets more than one bit.
+     */
+    uint8 buttons;
+    
+    /**
+     *  @brief The millisecond count at which the gesture was recognised,
+     *      masked with #BU_TICKS_MASK.
+     */
+    uint32 ticks;
+} GS_OBJECT;
+
+/**
+ *  @brief The state kept for each button.
+ */
+typedef struct GS_BUTTON
+{
+    /**
+     *  @brief The millisecond count at which the button was last pressed.
+     */
+    uint32 pressed;
+    
+    /**
+     *  @brief The millisecond count at which the last click was released.
+     */
+    uint32 released;
+    
+    /**
+     *  @brief The millisecond count at which the next long press or repeat
+     *      is due.
+     */
+    uint32 due;
+    
+    /**
+     *  @brief Set once a click has been reported that a further click may
+     *      turn into a double-click.
+     */
+    uint8 clicked;
+    
+    /**
+     *  @brief Set once a long press has been reported for the button.
+     */
+    uint8 held;
+} GS_BUTTON;
+
+/**
+ *  @brief A gesture list.
+ */
+typedef struct GS_LIST
+{
+    /**
+     *  @brief The times used to recognise gestures, in milliseconds,
+     *      indexed by #GS_TIME_DOUBLE, #GS_TIME_LONG, #GS_TIME_REPEAT and
+     *      #GS_TIME_CHORD.
+     */
+    uint16 times[GS_TIME_COUNT];
+    
+    /**
+     *  @brief The state of each button, indexed by button number less one.
+     */
+    GS_BUTTON buttons[BU_BUTTON_COUNT];
+    
+    /**
+     *  @brief The buttons that are being held down.
+     */
+    uint8 down;
+    
+    /**
+     *  @brief The buttons awaiting a long press or a repeat.
+     */
+    uint8 timed;
+    
+    /**
+     *  @brief The buttons of the current chord.
+     */
+    uint8 chord;
+    
+    /**
+     *  @brief Set once the current chord has been reported.
+     */
+    uint8 chorded;
+    
+    /**
+     *  @brief The millisecond count at which the last button was pressed.
+     */
+    uint32 last;
+    
+    /**
+     *  @brief The number of gestures ever removed from the list.
+     */
+    uint32 read;
+    
+    /**
+     *  @brief The number of gestures ever added to the list.
+     */
+    uint32 write;
+    
+    /**
+     *  @brief The number of gestures discarded because the list was full.
+     */
+    uint32 dropped;
+    
+    /**
+     *  @brief The array of gestures.
+     */
+    GS_OBJECT gestures[GS_LIST_SIZE];
+} GS_LIST;
+
+/****************************************************************************
+ *  Exported Variables
+ ****************************************************************************/
+
+/****************************************************************************
+ *  Exported Functions
+ ****************************************************************************/
+/**
+ *  @brief Initialise a gesture list.
+ *  @param[out] list A pointer to a gesture list.
+ *  @return #GS_SUCCESS if successful, otherwise #GS_BAD_ARGUMENT.
+ *  @remark Every time is set to its default value, eg #GS_DEFAULT_LONG.
+ */
+uint8 gs_init(GS_LIST *list);
+
+/**
+ *  @brief Set a time used to recognise gestures.
+ *  @param[in] list A pointer to a gesture list.
+ *  @param[in] time The time to set.
+ *
+ *  This member may be one of the following values.
+ *
+ *  Value       | Description
+ *  ----------- | -------------------------
+ *  @b GS_TIME_DOUBLE | The double-click time.
+ *  @b GS_TIME_LONG   | The long press time.
+ *  @b GS_TIME_REPEAT | The repeat time.
+ *  @b GS_TIME_CHORD  | The chord time.
+ *
+ *  @param[in] value The new time, in milliseconds.
+ *  @return #GS_SUCCESS if successful, otherwise #GS_BAD_ARGUMENT.
+ */
+uint8 gs_set_time(GS_LIST *list, uint8 time, uint16 value);
+
+/**
+ *  @brief Get a time used to recognise gestures.
+ *  @param[in] list A pointer to a gesture list.
+ *  @param[in] time The time to get, eg #GS_TIME_LONG.
+ *  @return The time, in milliseconds.
+ *  @remark If either argument is invalid, a time of zero will be returned.
+ */
+uint16 gs_get_time(GS_LIST *list, uint8 time);
+
+/**
+ *  @brief Pass a raw button event to a gesture list.
+ *  @param[in] list A pointer to a gesture list.
+ *  @param[in] object A pointer to the button object of the event.
+ *  @return #GS_SUCCESS if successful, otherwise #GS_BAD_ARGUMENT.
+ *  @remark Events must be passed in the order in which they occurred.
+ */
+uint8 gs_add_event(GS_LIST *list, BU_OBJECT *object);
+
+/**
+ *  @brief Pass every raw button event held by a button list to a gesture
+ *      list.
+ *  @param[in] list A pointer to a gesture list.
+ *  @param[in] buffer A pointer to a button list.
+ *  @return #GS_SUCCESS if successful, otherwise #GS_BAD_ARGUMENT.
+ *  @remark Each event is removed from the button list once it has been
+ *      passed.
+ */
+uint8 gs_add_events(GS_LIST *list, BU_LIST *buffer);
+
+/**
+ *  @brief Report any long presses and repeats that have fallen due.
+ *  @param[in] list A pointer to a gesture list.
+ *  @param[in] ticks The current millisecond count, ie rt_get_ticks().
+ *  @return #GS_SUCCESS if successful, otherwise #GS_BAD_ARGUMENT.
+ *  @remark At most one gesture is reported for each button per call.
+ */
+uint8 gs_update(GS_LIST *list, uint32 ticks);
+
+/**
+ *  @brief Remove the oldest gesture from a gesture list.
+ *  @param[in] list A pointer to a gesture list.
+ *  @param[out] object A pointer to the returned gesture.
+ *  @return #GS_SUCCESS if successful, otherwise #GS_BAD_ARGUMENT or
+ *      #GS_EMPTY.
+ */
+uint8 gs_get_gesture(GS_LIST *list, GS_OBJECT *object);
+
+/**
+ *  @brief Get the gesture count of a gesture list.
+ *  @param[in] list A pointer to a gesture list.
+ *  @return The number of gestures waiting to be removed.
+ *  @remark If the list argument is NULL, a count of zero will be returned.
+ */
+uint32 gs_get_count(GS_LIST *list);
+
+/**
+ *  @brief Get the dropped gesture count of a gesture list.
+ *  @param[in] list A pointer to a gesture list.
+ *  @return The number of gestures discarded because the list was full.
+ *  @remark If the list argument is NULL, a count of zero will be returned.
+ */
+uint32 gs_get_dropped(GS_LIST *list);
+
+#endif
+
+/****************************************************************************
+ *  End of File
+ ****************************************************************************/
@@ -0,0 +1,782 @@
+/****************************************************************************
+ *
+ *  File:           gesture_test.c
+ *  Module:         Gesture Test Library
+ *  Project:        Code Vault
+ *  Workspace:      PSoC Tools
+ *
+ *  Author:         Rodney B. Elliott
+ *  Date:           17 October 2026
+ *
+ ****************************************************************************
+ *
+ *  Copyright:      2013 Rodney B. Elliott
+ *
+ *  This file is part of PSoC Tools.
+ *
+ *  PSoC Tools is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  PSoC Tools is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with PSoC Tools. If not, see <http://www.gnu.org/licenses/>.
+ *
+ ****************************************************************************/
+/**
+ *  @file gesture_test.c
+ *  @brief Gesture test library implementation.
+ */
+
+/****************************************************************************
+ *  Modules
+ ****************************************************************************/
+#include <device.h>
+
+#include "gesture.h"
+#include "gesture_test.h"
+
+/****************************************************************************
+ *  Definitions and Macros
+ ****************************************************************************/
+/**
+ *  @brief Cypress CY8CKIT-001 development kit serial RX output pin.
+ */
+#define _CY8CKIT_RX                     CYREG_PRT1_PC2
+
+/**
+ *  @brief Cypress CY8CKIT-001 development kit serial TX output pin.
+ */
+#define _CY8CKIT_TX                     CYREG_PRT1_PC7
+
+/****************************************************************************
+ *  Typedefs and Structures
+ ****************************************************************************/
+
+/****************************************************************************
+ *  Prototypes of Local Functions
+ ****************************************************************************/
+/**
+ *  @brief Pass a raw button event to a gesture list.
+ *  @param[in] list A pointer to a gesture list.
+ *  @param[in] number The button number.
+ *  @param[in] state The button state.
+ *  @param[in] ticks The millisecond count of the event.
+ *  @return The value returned by gs_add_event().
+ */
+static uint8 _add_event(GS_LIST *list, uint8 number, uint8 state,
+    uint32 ticks);
+
+/****************************************************************************
+ *  Exported Variables
+ ****************************************************************************/
+
+/****************************************************************************
+ *  Global Variables
+ ****************************************************************************/
+
+/****************************************************************************
+ *  Exported Functions
+ ****************************************************************************/
+uint8 gst_test_1(void)
+{
+    BU_LIST buffer_1 = {0};
+    BU_OBJECT button_0;
+    uint32 i;
+    GS_LIST list_1;
+    GS_OBJECT object_0;
+    GS_OBJECT object_1;
+    uint8 result = GST_SUCCESS;
+    
+    UART_1_Start();
+    
+    UART_1_PutString("\x1b\x5b\x32\x4a");
+    UART_1_PutString("GESTURE LIBRARY TEST\r\n");
+    UART_1_PutString("\r\n");
+    UART_1_PutString("Test\tFunction\t\tResult\r\n");
+    UART_1_PutString("----\t--------\t\t------\r\n");
+    
+    /*
+     *  Test gs_init().
+     */
+    if (result == GST_SUCCESS)
+    {
+        if (gs_init(NULL) == GS_BAD_ARGUMENT)
+        {
+            UART_1_PutString("   1\tgs_init()\t\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("   1\tgs_init()\t\tFAIL\r\n");
+            result = GST_FAILURE;
+        }
+    }
+    
+    if (result == GST_SUCCESS)
+    {
+        if ((gs_init(&list_1) == GS_SUCCESS) && (gs_get_count(&list_1) == 0))
+        {
+            UART_1_PutString("   2\tgs_init()\t\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("   2\tgs_init()\t\tFAIL\r\n");
+            result = GST_FAILURE;
+        }
+    }
+    
+    /*
+     *  Test gs_get_time().
+     */
+    if (result == GST_SUCCESS)
+    {
+        if (gs_get_time(&list_1, GS_TIME_LONG) == GS_DEFAULT_LONG)
+        {
+            UART_1_PutString("   3\tgs_get_time()\t\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("   3\tgs_get_time()\t\tFAIL\r\n");
+            result = GST_FAILURE;
+        }
+    }
+    
+    if (result == GST_SUCCESS)
+    {
+        if (gs_get_time(NULL, GS_TIME_LONG) == 0)
+        {
+            UART_1_PutString("   4\tgs_get_time()\t\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("   4\tgs_get_time()\t\tFAIL\r\n");
+            result = GST_FAILURE;
+        }
+    }
+    
+    if (result == GST_SUCCESS)
+    {
+        if (gs_get_time(&list_1, GS_TIME_COUNT) == 0)
+        {
+            UART_1_PutString("   5\tgs_get_time()\t\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("   5\tgs_get_time()\t\tFAIL\r\n");
+            result = GST_FAILURE;
+        }
+    }
+    
+    /*
+     *  Test gs_set_time().
+     */
+    if (result == GST_SUCCESS)
+    {
+        if (gs_set_time(NULL, GS_TIME_REPEAT, 100) == GS_BAD_ARGUMENT)
+        {
+            UART_1_PutString("   6\tgs_set_time()\t\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("   6\tgs_set_time()\t\tFAIL\r\n");
+            result = GST_FAILURE;
+        }
+    }
+    
+    if (result == GST_SUCCESS)
+    {
+        if (gs_set_time(&list_1, GS_TIME_COUNT, 100) == GS_BAD_ARGUMENT)
+        {
+            UART_1_PutString("   7\tgs_set_time()\t\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("   7\tgs_set_time()\t\tFAIL\r\n");
+            result = GST_FAILURE;
+        }
+    }
+    
+    if (result == GST_SUCCESS)
+    {
+        if ((gs_set_time(&list_1, GS_TIME_REPEAT, 100) == GS_SUCCESS) &&
+            (gs_get_time(&list_1, GS_TIME_REPEAT) == 100))
+        {
+            UART_1_PutString("   8\tgs_set_time()\t\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("   8\tgs_set_time()\t\tFAIL\r\n");
+            result = GST_FAILURE;
+        }
+    }
+    
+    /*
+     *  Test gs_add_event().
+     */
+    if (result == GST_SUCCESS)
+    {
+        button_0.number = 1;
+        button_0.state = BU_PRESSED;
+        button_0.ticks = 0;
+        
+        if (gs_add_event(NULL, &button_0) == GS_BAD_ARGUMENT)
+        {
+            UART_1_PutString("   9\tgs_add_event()\t\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("   9\tgs_add_event()\t\tFAIL\r\n");
+            result = GST_FAILURE;
+        }
+    }
+    
+    if (result == GST_SUCCESS)
+    {
+        if (gs_add_event(&list_1, NULL) == GS_BAD_ARGUMENT)
+        {
+            UART_1_PutString("  10\tgs_add_event()\t\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("  10\tgs_add_event()\t\tFAIL\r\n");
+            result = GST_FAILURE;
+        }
+    }
+    
+    if (result == GST_SUCCESS)
+    {
+        button_0.number = BU_BUTTON_COUNT + 1;
+        
+        if (gs_add_event(&list_1, &button_0) == GS_BAD_ARGUMENT)
+        {
+            UART_1_PutString("  11\tgs_add_event()\t\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("  11\tgs_add_event()\t\tFAIL\r\n");
+            result = GST_FAILURE;
+        }
+    }
+    
+    if (result == GST_SUCCESS)
+    {
+        _add_event(&list_1, 1, BU_PRESSED, 1000);
+        _add_event(&list_1, 1, BU_RELEASED, 1100);
+        
+        if (gs_get_count(&list_1) == 1)
+        {
+            UART_1_PutString("  12\tgs_add_event()\t\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("  12\tgs_add_event()\t\tFAIL\r\n");
+            result = GST_FAILURE;
+        }
+    }
+    
+    /*
+     *  Test gs_get_gesture().
+     */
+    if (result == GST_SUCCESS)
+    {
+        if (gs_get_gesture(NULL, &object_0) == GS_BAD_ARGUMENT)
+        {
+            UART_1_PutString("  13\tgs_get_gesture()\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("  13\tgs_get_gesture()\tFAIL\r\n");
+            result = GST_FAILURE;
+        }
+    }
+    
+    if (result == GST_SUCCESS)
+    {
+        if (gs_get_gesture(&list_1, NULL) == GS_BAD_ARGUMENT)
+        {
+            UART_1_PutString("  14\tgs_get_gesture()\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("  14\tgs_get_gesture()\tFAIL\r\n");
+            result = GST_FAILURE;
+        }
+    }
+    
+    if (result == GST_SUCCESS)
+    {
+        if ((gs_get_gesture(&list_1, &object_0) == GS_SUCCESS) &&
+            (object_0.gesture == GS_CLICK) &&
+            (object_0.buttons == BU_BUTTON_1) &&
+            (object_0.ticks == 1100))
+        {
+            UART_1_PutString("  15\tgs_get_gesture()\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("  15\tgs_get_gesture()\tFAIL\r\n");
+            result = GST_FAILURE;
+        }
+    }
+    
+    if (result == GST_SUCCESS)
+    {
+        if (gs_get_gesture(&list_1, &object_0) == GS_EMPTY)
+        {
+            UART_1_PutString("  16\tgs_get_gesture()\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("  16\tgs_get_gesture()\tFAIL\r\n");
+            result = GST_FAILURE;
+        }
+    }
+    
+    /*
+     *  Test gs_add_event().
+     */
+    if (result == GST_SUCCESS)
+    {
+        _add_event(&list_1, 1, BU_PRESSED, 1300);
+        _add_event(&list_1, 1, BU_RELEASED, 1350);
+        
+        if (gs_get_count(&list_1) == 2)
+        {
+            UART_1_PutString("  17\tgs_add_event()\t\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("  17\tgs_add_event()\t\tFAIL\r\n");
+            result = GST_FAILURE;
+        }
+    }
+    
+    if (result == GST_SUCCESS)
+    {
+        gs_get_gesture(&list_1, &object_0);
+        
+        if (object_0.gesture == GS_CLICK)
+        {
+            UART_1_PutString("  18\tgs_add_event()\t\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("  18\tgs_add_event()\t\tFAIL\r\n");
+            result = GST_FAILURE;
+        }
+    }
+    
+    if (result == GST_SUCCESS)
+    {
+        gs_get_gesture(&list_1, &object_0);
+        
+        if ((object_0.gesture == GS_DOUBLE_CLICK) &&
+            (object_0.buttons == BU_BUTTON_1))
+        {
+            UART_1_PutString("  19\tgs_add_event()\t\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("  19\tgs_add_event()\t\tFAIL\r\n");
+            result = GST_FAILURE;
+        }
+    }
+    
+    if (result == GST_SUCCESS)
+    {
+        _add_event(&list_1, 1, BU_PRESSED, 1400);
+        _add_event(&list_1, 1, BU_RELEASED, 1450);
+        _add_event(&list_1, 1, BU_PRESSED, 1800);
+        _add_event(&list_1, 1, BU_RELEASED, 1850);
+        
+        if (gs_get_count(&list_1) == 2)
+        {
+            UART_1_PutString("  20\tgs_add_event()\t\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("  20\tgs_add_event()\t\tFAIL\r\n");
+            result = GST_FAILURE;
+        }
+    }
+    
+    if (result == GST_SUCCESS)
+    {
+        gs_get_gesture(&list_1, &object_0);
+        gs_get_gesture(&list_1, &object_1);
+        
+        if ((object_0.gesture == GS_CLICK) && (object_1.gesture == GS_CLICK))
+        {
+            UART_1_PutString("  21\tgs_add_event()\t\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("  21\tgs_add_event()\t\tFAIL\r\n");
+            result = GST_FAILURE;
+        }
+    }
+    
+    /*
+     *  Test gs_update().
+     */
+    if (result == GST_SUCCESS)
+    {
+        if (gs_update(NULL, 0) == GS_BAD_ARGUMENT)
+        {
+            UART_1_PutString("  22\tgs_update()\t\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("  22\tgs_update()\t\tFAIL\r\n");
+            result = GST_FAILURE;
+        }
+    }
+    
+    if (result == GST_SUCCESS)
+    {
+        _add_event(&list_1, 2, BU_PRESSED, 3000);
+        
+        if ((gs_update(&list_1, 3799) == GS_SUCCESS) &&
+            (gs_get_count(&list_1) == 0))
+        {
+            UART_1_PutString("  23\tgs_update()\t\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("  23\tgs_update()\t\tFAIL\r\n");
+            result = GST_FAILURE;
+        }
+    }
+    
+    if (result == GST_SUCCESS)
+    {
+        gs_update(&list_1, 3800);
+        gs_get_gesture(&list_1, &object_0);
+        
+        if ((object_0.gesture == GS_LONG_PRESS) &&
+            (object_0.buttons == BU_BUTTON_2) &&
+            (object_0.ticks == 3800))
+        {
+            UART_1_PutString("  24\tgs_update()\t\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("  24\tgs_update()\t\tFAIL\r\n");
+            result = GST_FAILURE;
+        }
+    }
+    
+    if (result == GST_SUCCESS)
+    {
+        gs_update(&list_1, 3850);
+        
+        if (gs_get_count(&list_1) == 0)
+        {
+            UART_1_PutString("  25\tgs_update()\t\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("  25\tgs_update()\t\tFAIL\r\n");
+            result = GST_FAILURE;
+        }
+    }
+    
+    if (result == GST_SUCCESS)
+    {
+        gs_update(&list_1, 3900);
+        gs_get_gesture(&list_1, &object_0);
+        
+        if ((object_0.gesture == GS_REPEAT) &&
+            (object_0.buttons == BU_BUTTON_2))
+        {
+            UART_1_PutString("  26\tgs_update()\t\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("  26\tgs_update()\t\tFAIL\r\n");
+            result = GST_FAILURE;
+        }
+    }
+    
+    if (result == GST_SUCCESS)
+    {
+        _add_event(&list_1, 2, BU_RELEASED, 3950);
+        
+        if (gs_get_count(&list_1) == 0)
+        {
+            UART_1_PutString("  27\tgs_update()\t\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("  27\tgs_update()\t\tFAIL\r\n");
+            result = GST_FAILURE;
+        }
+    }
+    
+    if (result == GST_SUCCESS)
+    {
+        gs_set_time(&list_1, GS_TIME_REPEAT, 0);
+        _add_event(&list_1, 2, BU_PRESSED, 4000);
+        gs_update(&list_1, 4800);
+        gs_update(&list_1, 6000);
+        _add_event(&list_1, 2, BU_RELEASED, 6000);
+        gs_get_gesture(&list_1, &object_0);
+        
+        if ((gs_get_count(&list_1) == 0) && (object_0.gesture == GS_LONG_PRESS))
+        {
+            UART_1_PutString("  28\tgs_update()\t\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("  28\tgs_update()\t\tFAIL\r\n");
+            result = GST_FAILURE;
+        }
+    }
+    
+    /*
+     *  Test gs_add_event().
+     */
+    if (result == GST_SUCCESS)
+    {
+        _add_event(&list_1, 1, BU_PRESSED, 7000);
+        _add_event(&list_1, 3, BU_PRESSED, 7020);
+        gs_update(&list_1, 8000);
+        
+        if (gs_get_count(&list_1) == 0)
+        {
+            UART_1_PutString("  29\tgs_add_event()\t\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("  29\tgs_add_event()\t\tFAIL\r\n");
+            result = GST_FAILURE;
+        }
+    }
+    
+    if (result == GST_SUCCESS)
+    {
+        _add_event(&list_1, 3, BU_RELEASED, 8010);
+        _add_event(&list_1, 1, BU_RELEASED, 8020);
+        gs_get_gesture(&list_1, &object_0);
+        
+        if ((gs_get_count(&list_1) == 0) &&
+            (object_0.gesture == GS_CHORD) &&
+            (object_0.buttons == (BU_BUTTON_1 | BU_BUTTON_3)) &&
+            (object_0.ticks == 8010))
+        {
+            UART_1_PutString("  30\tgs_add_event()\t\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("  30\tgs_add_event()\t\tFAIL\r\n");
+            result = GST_FAILURE;
+        }
+    }
+    
+    if (result == GST_SUCCESS)
+    {
+        _add_event(&list_1, 1, BU_PRESSED, 9000);
+        _add_event(&list_1, 2, BU_PRESSED, 9100);
+        _add_event(&list_1, 2, BU_RELEASED, 9150);
+        _add_event(&list_1, 1, BU_RELEASED, 9200);
+        gs_get_gesture(&list_1, &object_0);
+        gs_get_gesture(&list_1, &object_1);
+        
+        if ((object_0.gesture == GS_CLICK) &&
+            (object_0.buttons == BU_BUTTON_2) &&
+            (object_1.gesture == GS_CLICK) &&
+            (object_1.buttons == BU_BUTTON_1))
+        {
+            UART_1_PutString("  31\tgs_add_event()\t\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("  31\tgs_add_event()\t\tFAIL\r\n");
+            result = GST_FAILURE;
+        }
+    }
+    
+    if (result == GST_SUCCESS)
+    {
+        gs_init(&list_1);
+        _add_event(&list_1, 4, BU_PRESSED, BU_TICKS_MASK - 100);
+        gs_update(&list_1, BU_TICKS_MASK);
+        gs_update(&list_1, 700);
+        gs_get_gesture(&list_1, &object_0);
+        
+        if ((object_0.gesture == GS_LONG_PRESS) && (object_0.ticks == 700))
+        {
+            UART_1_PutString("  32\tgs_add_event()\t\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("  32\tgs_add_event()\t\tFAIL\r\n");
+            result = GST_FAILURE;
+        }
+    }
+    
+    /*
+     *  Test gs_add_events().
+     */
+    if (result == GST_SUCCESS)
+    {
+        if (gs_add_events(NULL, &buffer_1) == GS_BAD_ARGUMENT)
+        {
+            UART_1_PutString("  33\tgs_add_events()\t\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("  33\tgs_add_events()\t\tFAIL\r\n");
+            result = GST_FAILURE;
+        }
+    }
+    
+    if (result == GST_SUCCESS)
+    {
+        if (gs_add_events(&list_1, NULL) == GS_BAD_ARGUMENT)
+        {
+            UART_1_PutString("  34\tgs_add_events()\t\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("  34\tgs_add_events()\t\tFAIL\r\n");
+            result = GST_FAILURE;
+        }
+    }
+    
+    if (result == GST_SUCCESS)
+    {
+        gs_init(&list_1);
+        bu_add_new(&buffer_1, 5, BU_PRESSED);
+        bu_add_new(&buffer_1, 5, BU_RELEASED);
+        
+        if ((gs_add_events(&list_1, &buffer_1) == GS_SUCCESS) &&
+            (bu_get_count(&buffer_1) == 0) &&
+            (gs_get_count(&list_1) == 1))
+        {
+            UART_1_PutString("  35\tgs_add_events()\t\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("  35\tgs_add_events()\t\tFAIL\r\n");
+            result = GST_FAILURE;
+        }
+    }
+    
+    if (result == GST_SUCCESS)
+    {
+        gs_get_gesture(&list_1, &object_0);
+        
+        if ((object_0.gesture == GS_CLICK) && (object_0.buttons == BU_BUTTON_5))
+        {
+            UART_1_PutString("  36\tgs_add_events()\t\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("  36\tgs_add_events()\t\tFAIL\r\n");
+            result = GST_FAILURE;
+        }
+    }
+    
+    /*
+     *  Test gs_get_count().
+     */
+    if (result == GST_SUCCESS)
+    {
+        if (gs_get_count(NULL) == 0)
+        {
+            UART_1_PutString("  37\tgs_get_count()\t\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("  37\tgs_get_count()\t\tFAIL\r\n");
+            result = GST_FAILURE;
+        }
+    }
+    
+    /*
+     *  Test gs_get_dropped().
+     */
+    if (result == GST_SUCCESS)
+    {
+        if (gs_get_dropped(NULL) == 0)
+        {
+            UART_1_PutString("  38\tgs_get_dropped()\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("  38\tgs_get_dropped()\tFAIL\r\n");
+            result = GST_FAILURE;
+        }
+    }
+    
+    if (result == GST_SUCCESS)
+    {
+        for (i = 0 ; i <= GS_LIST_SIZE ; i++)
+        {
+            _add_event(&list_1, 6, BU_PRESSED, i * 1000);
+            _add_event(&list_1, 6, BU_RELEASED, i * 1000 + 100);
+        }
+        
+        if ((gs_get_count(&list_1) == GS_LIST_SIZE) &&
+            (gs_get_dropped(&list_1) == 1))
+        {
+            UART_1_PutString("  39\tgs_get_dropped()\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("  39\tgs_get_dropped()\tFAIL\r\n");
+            result = GST_FAILURE;
+        }
+    }
+    
+    /*
+     *  Report test result.
+     */
+    if (result == GST_SUCCESS)
+    {
+        UART_1_PutString("\r\n");
+        UART_1_PutString("TEST PASSED\r\n");
+    }
+    else
+    {
+        UART_1_PutString("\r\n");
+        UART_1_PutString("TEST FAILED\r\n");
+    }
+    
+    /*
+     *  Clean-up test.
+     */
+    while ((UART_1_ReadTxStatus() & UART_1_TX_STS_FIFO_EMPTY) !=
+        UART_1_TX_STS_FIFO_EMPTY)
+    {
+        CyDelay(1);
+    }
+    
+    UART_1_Stop();
+    
+    return result;
+}
+
+/****************************************************************************
+ *  Local Functions
+ ****************************************************************************/
+uint8 _add_event(GS_LIST *list, uint8 number, uint8 state, uint32 ticks)
+{
+    BU_OBJECT object;
+    
+    object.number = number;
+    object.state = state;
+    object.ticks = ticks;
+    
+    return gs_add_event(list, &object);
+}
+
+/****************************************************************************
+ *  End of File
+ ****************************************************************************/
@@ -0,0 +1,154 @@
+/****************************************************************************
+ *
+ *  File:           gesture_test.h
+ *  Module:         Gesture Test Library
+ *  Project:        Code Vault
+ *  Workspace:      PSoC Tools
+ *
+ *  Author:         Rodney B. Elliott
+ *  Date:           17 October 2026
+ *
+ ****************************************************************************
+ *
+ *  Copyright:      2013 Rodney B. Elliott
+ *
+ *  This file is part of PSoC Tools.
+ *
+ *  PSoC Tools is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  PSoC Tools is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with PSoC Tools. If not, see <http://www.gnu.org/licenses/>.
+ *
+ ****************************************************************************/
+#ifndef GESTURE_TEST_H
+#define GESTURE_TEST_H
+/**
+ *  @file gesture_test.h
+ *  @brief Gesture test library interface.
+ *
+ *  <H3> Introduction </H3>
+ *
+ *  The gesture test library contains a single function that tests each of
+ *  the functions that comprise the gesture library. Raw button events are
+ *  passed to the library with chosen millisecond counts, so the test does
+ *  not require any buttons to be pressed, and its results do not depend upon
+ *  how quickly it runs.
+ *
+ *  <H3> Use </H3>
+ *
+ *  In order to use the library, the programmer must first connect the target
+ *  system to a serial terminal configured as 57600 8-N-1. To run the test,
+ *  simply call the function gst_test_1() and observe the serial output, which
+ *  should be as follows.
+ *
+ *  @code
+ *  GESTURE LIBRARY TEST
+ *
+ *  Test    Function                Result
+ *  ----    --------                ------
+ *     1    gs_init()               PASS
+ *     2    gs_init()               PASS
+ *     3    gs_get_time()           PASS
+ *     4    gs_get_time()           PASS
+ *     5    gs_get_time()           PASS
+ *     6    gs_set_time()           PASS
+ *     7    gs_set_time()           PASS
+ *     8    gs_set_time()           PASS
+ *     9    gs_add_event()          PASS
+ *    10    gs_add_event()          PASS
+ *    11    gs_add_event()          PASS
+ *    12    gs_add_event()          PASS
+ *    13    gs_get_gesture()        PASS
+ *    14    gs_get_gesture()        PASS
+ *    15    gs_get_gesture()        PASS
+ *    16    gs_get_gesture()        PASS
+ *    17    gs_add_event()          PASS
+ *    18    gs_add_event()          PASS
+ *    19    gs_add_event()          PASS
+ *    20    gs_add_event()          PASS
+ *    21    gs_add_event()          PASS
+ *    22    gs_update()             PASS
+ *    23    gs_update()             PASS
+ *    24    gs_update()             PASS
+ *    25    gs_update()             PASS
+ *    26    gs_update()             PASS
+ *    27    gs_update()             PASS
+ *    28    gs_update()             PASS
+ *    29    gs_add_event()          PASS
+ *    30    gs_add_event()          PASS
+ *    31    gs_add_event()          PASS
+ *    32    gs_add_event()          PASS
+ *    33    gs_add_events()         PASS
+ *    34    gs_add_events()         PASS
+ *    35    gs_add_events()         PASS
+ *    36    gs_add_events()         PASS
+ *    37    gs_get_count()          PASS
+ *    38    gs_get_dropped()        PASS
+ *    39    gs_get_dropped()        PASS
+ *
+ *  TEST PASSED
+ *  @endcode
+ *
+ *  Alternatively, if no serial terminal is available, the gst_test_1() return
+ *  value may be checked to see if the test completed successfully or not.
+ *
+ *  <H3> Hardware </H3>
+ *
+ *  The gesture test library has been designed to run on a Cypress
+ *  CY8CKIT-001 development kit fitted with a PSoC5 CY8C5568AXI-060 module. It
+ *  requires access to the following components:
+ *
+ *  - UART_1
+ *
+ *  Pin P1_2 on the development kit prototype area must be connected to the
+ *  UART RX pin, and pin P1_7 must be connected to the UART TX pin. Ensure
+ *  that the RS_232PWR jumper is also set.
+ */
+
+/****************************************************************************
+ *  Modules
+ ****************************************************************************/
+
+/****************************************************************************
+ *  Definitions and Macros
+ ****************************************************************************/
+/**
+ *  @brief Generic success.
+ */
+#define GST_SUCCESS                     0
+
+/**
+ *  @brief Generic failure.
+ */
+#define GST_FAILURE                     1
+
+/****************************************************************************
+ *  Typedefs and Structures
+ ****************************************************************************/
+
+/****************************************************************************
+ *  Exported Variables
+ ****************************************************************************/
+
+/****************************************************************************
+ *  Exported Functions
+ ****************************************************************************/
+/**
+ *  @brief Tests the functions of the gesture library.
+ *  @return #GST_SUCCESS if successful, otherwise #GST_FAILURE.
+ */
+uint8 gst_test_1(void);
+
+#endif
+
+/****************************************************************************
+ *  End of File
+ ****************************************************************************/
@@ -0,0 +1,299 @@
+/****************************************************************************
+ *
+ *  File:           ilist.c
+ *  Module:         Intrusive Linked List Library
+ *  Project:        Code Vault
+ *  Workspace:      PSoC Tools
+ *
+ *  Author:         Rodney B. Elliott
+ *  Date:           16 October 2026
+ *
+ ****************************************************************************
+ *
+ *  Copyright:      2013 Rodney B. Elliott
+ *
+ *  This file is part of PSoC Tools.
+ *
+ *  PSoC Tools is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  PSoC Tools is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with PSoC Tools. If not, see <http://www.gnu.org/licenses/>.
+ *
+ ****************************************************************************/
+/**
+ *  @file ilist.c
+ *  @brief Intrusive linked list library implementation.
+ */
+
+/****************************************************************************
+ *  Modules
+ ****************************************************************************/
+#include <device.h>
+
+#include "ilist.h"
+
+/****************************************************************************
+ *  Definitions and Macros
+ ****************************************************************************/
+
+/****************************************************************************
+ *  Typedefs and Structures
+ ****************************************************************************/
+
+/****************************************************************************
+ *  Prototypes of Local Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ *  Exported Variables
+ ****************************************************************************/
+
+/****************************************************************************
+ *  Global Variables
+ ****************************************************************************/
+
+/****************************************************************************
+ *  Exported Functions
+ ****************************************************************************/
+uint8 il_init(IL_LINK *link)
+{
+    uint8 result = IL_BAD_ARGUMENT;
+    
+    if (link != NULL)
+    {
+        link->previous = NULL;
+        link->next = NULL;
+        
+        result = IL_SUCCESS;
+    }
+    
+    return result;
+}
+
+uint8 il_insert_before(IL_LINK *link, IL_LINK *new_link)
+{
+    uint8 result = IL_BAD_ARGUMENT;
+    
+    if (link != NULL && new_link != NULL)
+    {
+        new_link->next = link;
+        new_link->previous = link->previous;
+        
+        link->previous = new_link;
+        
+        if (new_link->previous != NULL)
+        {
+            new_link->previous->next = new_link;
+        }
+        
+        result = IL_SUCCESS;
+    }
+    
+    return result;
+}
+
+uint8 il_insert_after(IL_LINK *link, IL_LINK *new_link)
+{
+    uint8 result = IL_BAD_ARGUMENT;
+    
+    if (link != NULL && new_link != NULL)
+    {
+        new_link->previous = link;
+        new_link->next = link->next;
+        
+        link->next = new_link;
+        
+        if (new_link->next != NULL)
+        {
+            new_link->next->previous = new_link;
+        }
+        
+        result = IL_SUCCESS;
+    }
+    
+    return result;
+}
+
+IL_LINK *il_get_first(IL_LINK *list)
+{
+    if (list != NULL)
+    {
+        while (list->previous != NULL)
+        {
+            list = list->previous;
+        }
+    }
+    
+    return list;
+}
+
+IL_LINK *il_get_last(IL_LINK *list)
+{
+    if (list != NULL)
+    {
+        while (list->next != NULL)
+        {
+            list = list->next;
+        }
+    }
+    
+    return list;
+}
+
+IL_LINK *il_get_previous(IL_LINK *link)
+{
+    if (link != NULL)
+    {
+        link = link->previous;
+    }
+    
+    return link;
+}
+
+IL_LINK *il_get_next(IL_LINK *link)
+{
+    if (link != NULL)
+    {
+        link = link->next;
+    }
+    
+    return link;
+}
+
+uint32 il_get_count(IL_LINK *list)
+{
+    uint32 count = 0;
+    IL_LINK *next_link = list;
+    IL_LINK *previous_link = list;
+    
+    if (list != NULL)
+    {
+        ++count;
+        
+        while ((previous_link = previous_link->previous) != NULL)
+        {
+            ++count;
+        }
+        
+        while ((next_link = next_link->next) != NULL)
+        {
+            ++count;
+        }
+    }
+    
+    return count;
+}
+
+uint8 il_extract(IL_LINK *link)
+{
+    uint8 result = IL_BAD_ARGUMENT;
+    
+    if (link != NULL)
+    {
+        if (link->previous != NULL)
+        {
+            link->previous->next = link->next;
+        }
+        
+        if (link->next != NULL)
+        {
+            link->next->previous = link->previous;
+        }
+        
+        link->previous = NULL;
+        link->next = NULL;
+        
+        result = IL_SUCCESS;
+    }
+    
+    return result;
+}
+
+uint8 il_join(IL_LINK *list_a, IL_LINK *list_b)
+{
+    uint8 result = IL_BAD_ARGUMENT;
+    
+    if (list_a != NULL && list_b != NULL)
+    {
+        list_a = il_get_last(list_a);
+        list_b = il_get_first(list_b);
+        
+        list_a->next = list_b;
+        list_b->previous = list_a;
+        
+        result = IL_SUCCESS;
+    }
+    
+    return result;
+}
+
+uint8 il_exchange(IL_LINK *link_a, IL_LINK *link_b)
+{
+    uint8 result = IL_BAD_ARGUMENT;
+    IL_LINK *link_0;
+    IL_LINK *link_1;
+    IL_LINK *link_2;
+    IL_LINK *link_3;
+    
+    if (link_a != NULL && link_b != NULL)
+    {
+        if (link_a->next == link_b)
+        {
+            il_extract(link_a);
+            il_insert_after(link_b, link_a);
+        }
+        else if (link_b->next == link_a)
+        {
+            il_extract(link_b);
+            il_insert_after(link_a, link_b);
+        }
+        else
+        {
+            link_0 = link_a->previous;
+            link_1 = link_a->next;
+            link_2 = link_b->previous;
+            link_3 = link_b->next;
+            
+            il_extract(link_a);
+            il_extract(link_b);
+            
+            if (link_2 != NULL)
+            {
+                il_insert_after(link_2, link_a);
+            }
+            else
+            {
+                il_insert_before(link_3, link_a);
+            }
+            
+            if (link_0 != NULL)
+            {
+                il_insert_after(link_0, link_b);
+            }
+            else
+            {
+                il_insert_before(link_1, link_b);
+            }
+        }
+        
+        result = IL_SUCCESS;
+    }
+    
+    return result;
+}
+
+/****************************************************************************
+ *  Local Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ *  End of File
+ ****************************************************************************/
@@ -0,0 +1,271 @@
+/****************************************************************************
+ *
+ *  File:           ilist.h
+ *  Module:         Intrusive Linked List Library
+ *  Project:        Code Vault
+ *  Workspace:      PSoC Tools
+ *
+ *  Author:         Rodney B. Elliott
+ *  Date:           16 October 2026
+ *
+ ****************************************************************************
+ *
+ *  Copyright:      2013 Rodney B. Elliott
+ *
+ *  This file is part of PSoC Tools.
+ *
+ *  PSoC Tools is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  PSoC Tools is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with PSoC Tools. If not, see <http://www.gnu.org/licenses/>.
+ *
+ ****************************************************************************/
+#ifndef ILIST_H
+#define ILIST_H
+/**
+ *  @file ilist.h
+ *  @brief Intrusive linked list library interface.
+ *
+ *  <H3> Introduction </H3>
+ *
+ *  The intrusive linked list library is a collection of functions that
+ *  enable the programmer to make use of an intrusive doubly linked list
+ *  (ILL) within their project.
+ *
+ *  A doubly linked list library node contains a pointer to its object, so
+ *  that each element of a DLL requires two allocations - one for the node,
+ *  and one for the object - and every access to the object must follow the
+ *  node's object pointer. An ILL turns this arrangement inside out. Rather
+ *  than a node pointing to an object, the object itself contains a @em link,
+ *  and it is these links that are joined together to form the list. No
+ *  memory is allocated by the library, and the object that contains a link
+ *  is found from the address of the link itself.
+ *
+ *  The links of a library ILL contain the following fields:
+ *
+ *  -# Previous. A pointer to the previous link in the ILL.
+ *  -# Next. A pointer to the next link in the ILL.
+ *
+ *  The library uses the terms 'previous', 'next', 'first' and 'last', as
+ *  well as 'before' and 'after', in exactly the same way as the doubly
+ *  linked list library.
+ *
+ *  <H3> Use </H3>
+ *
+ *  In order to use the library, the programmer must start by embedding an
+ *  IL_LINK structure within their object type, ie:
+ *
+ *  @code
+ *  typedef struct MY_OBJECT
+ *  {
+ *      uint8 number;
+ *      IL_LINK link;
+ *  } MY_OBJECT;
+ *  @endcode
+ *
+ *  Before an object is added to an ILL, its link must be initialised using
+ *  il_init(). An initialised link forms an ILL containing a single link, to
+ *  which further links may be added using il_insert_before() and
+ *  il_insert_after(). Given a pointer to a link, the macro #IL_CONTAINER
+ *  returns a pointer to the object that contains it, ie:
+ *
+ *  @code MY_OBJECT *object = IL_CONTAINER(link, MY_OBJECT, link); @endcode
+ *
+ *  The remaining library functions mirror those of the doubly linked list
+ *  library. The function il_exchange() enables the position of two links
+ *  within an ILL to be exchanged, il_join() enables two ILLs to be joined
+ *  together, and il_extract() removes a single link from an ILL. Because the
+ *  library does not own the memory of either links or objects, there are no
+ *  equivalents of dl_create(), dl_delete() or dl_destroy(). It is up to the
+ *  programmer to extract an object's link from its ILL before the object is
+ *  destroyed.
+ *
+ *  For further information about these and other library functions, please
+ *  refer to the individual function documentation. For examples of their use,
+ *  please see the intrusive linked list test library.
+ *
+ *  <H3> Hardware </H3>
+ *
+ *  The ILL library has no hardware requirements.
+ */
+
+/****************************************************************************
+ *  Modules
+ ****************************************************************************/
+#include <stddef.h>
+
+/****************************************************************************
+ *  Definitions and Macros
+ ****************************************************************************/
+/**
+ *  @brief Generic success.
+ */
+#define IL_SUCCESS                      0
+
+/**
+ *  @brief Generic failure.
+ */
+#define IL_FAILURE                      1
+
+/**
+ *  @brief A bad argument was passed to a function.
+ */
+#define IL_BAD_ARGUMENT                 3
+
+/**
+ *  @brief Get the object that contains an ILL link.
+ *  @param[in] link A pointer to an ILL link.
+ *  @param[in] type The type of the object that contains the link.
+ *  @param[in] member The name of the link within the object type.
+ *  @return A pointer to the object that contains the link.
+ *  @remark If the link argument is NULL, a NULL pointer will be returned.
+ *  @warning The link argument is evaluated twice, and so must not have
+ *      any side effects.
+ */
+#define IL_CONTAINER(link, type, member) \
+    ((link) == NULL ? NULL : \
+    (type *)((char *)(link) - offsetof(type, member)))
+
+/****************************************************************************
+ *  Typedefs and Structures
+ ****************************************************************************/
+/**
+ *  @brief An intrusive linked list (ILL) link.
+ */
+typedef struct IL_LINK
+{
+    /**
+     *  @brief A pointer to the previous link in the ILL.
+     */
+    struct IL_LINK *previous;
+    
+    /**
+     *  @brief A pointer to the next link in the ILL.
+     */
+    struct IL_LINK *next;
+} IL_LINK;
+
+/****************************************************************************
+ *  Exported Variables
+ ****************************************************************************/
+
+/****************************************************************************
+ *  Exported Functions
+ ****************************************************************************/
+/**
+ *  @brief Initialise an ILL link.
+ *  @param[out] link A pointer to an ILL link.
+ *  @return #IL_SUCCESS if successful, otherwise #IL_BAD_ARGUMENT.
+ *  @remark The initialised link forms an ILL containing a single link.
+ *  @warning Initialising a link that belongs to an ILL of more than one
+ *      link would be a <B> very bad thing. </B>
+ */
+uint8 il_init(IL_LINK *link);
+
+/**
+ *  @brief Insert a link into an ILL before another link.
+ *  @param[in] link A pointer to the ILL link to insert before.
+ *  @param[in] new_link A pointer to the ILL link to insert.
+ *  @return #IL_SUCCESS if successful, otherwise #IL_BAD_ARGUMENT.
+ *  @warning It is up to the caller to ensure that both arguments
+ *      point to initialised links. Passing pointers to uninitialised
+ *      links would be a <B> very bad thing. </B>
+ */
+uint8 il_insert_before(IL_LINK *link, IL_LINK *new_link);
+
+/**
+ *  @brief Insert a link into an ILL after another link.
+ *  @param[in] link A pointer to the ILL link to insert after.
+ *  @param[in] new_link A pointer to the ILL link to insert.
+ *  @return #IL_SUCCESS if successful, otherwise #IL_BAD_ARGUMENT.
+ *  @warning It is up to the caller to ensure that both arguments
+ *      point to initialised links. Passing pointers to uninitialised
+ *      links would be a <B> very bad thing. </B>
+ */
+uint8 il_insert_after(IL_LINK *link, IL_LINK *new_link);
+
+/**
+ *  @brief Get the first link of an ILL.
+ *  @param[in] list A pointer to an ILL.
+ *  @return A pointer to the first link of the ILL.
+ *  @remark If the list argument is NULL, a NULL pointer will be returned.
+ */
+IL_LINK *il_get_first(IL_LINK *list);
+
+/**
+ *  @brief Get the last link of an ILL.
+ *  @param[in] list A pointer to an ILL.
+ *  @return A pointer to the last link of the ILL.
+ *  @remark If the list argument is NULL, a NULL pointer will be returned.
+ */
+IL_LINK *il_get_last(IL_LINK *list);
+
+/**
+ *  @brief Get the previous link of an ILL.
+ *  @param[in] link A pointer to an ILL link.
+ *  @return A pointer to the previous link of the ILL.
+ *  @remark If the link argument is the first link of the ILL, a NULL
+ *      pointer will be returned.
+ */
+IL_LINK *il_get_previous(IL_LINK *link);
+
+/**
+ *  @brief Get the next link of an ILL.
+ *  @param[in] link A pointer to an ILL link.
+ *  @return A pointer to the next link of the ILL.
+ *  @remark If the link argument is the last link of the ILL, a NULL
+ *      pointer will be returned.
+ */
+IL_LINK *il_get_next(IL_LINK *link);
+
+/**
+ *  @brief Get the link count of an ILL.
+ *  @param[in] list A pointer to an ILL.
+ *  @return The number of links in the ILL.
+ *  @remark If the list argument is NULL, a count of zero will be returned.
+ */
+uint32 il_get_count(IL_LINK *list);
+
+/**
+ *  @brief Extract a link from an ILL.
+ *  @param[in] link A pointer to an ILL link.
+ *  @return #IL_SUCCESS if successful, otherwise #IL_BAD_ARGUMENT.
+ *  @remark The extracted link forms an ILL containing a single link.
+ *  @warning If the link pointer is the only means of addressing an ILL,
+ *      the ILL will be lost.
+ */
+uint8 il_extract(IL_LINK *link);
+
+/**
+ *  @brief Join two ILLs.
+ *  @param[in] list_a A pointer to an ILL.
+ *  @param[in] list_b A pointer to an ILL.
+ *  @return #IL_SUCCESS if successful, otherwise #IL_BAD_ARGUMENT.
+ *  @remark After joining, the last link of list_a will point to
+ *      the first link of list_b.
+ *  @warning Joining an ILL to itself would be a <B> very bad thing.
+ *      </B>
+ */
+uint8 il_join(IL_LINK *list_a, IL_LINK *list_b);
+
+/**
+ *  @brief Exchange the position of two ILL links.
+ *  @param[in] link_a A pointer to an ILL link.
+ *  @param[in] link_b A pointer to an ILL link.
+ *  @return #IL_SUCCESS if successful, otherwise #IL_BAD_ARGUMENT.
+ */
+uint8 il_exchange(IL_LINK *link_a, IL_LINK *link_b);
+
+#endif
+
+/****************************************************************************
+ *  End of File
+ ****************************************************************************/
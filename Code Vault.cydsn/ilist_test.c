@@ -0,0 +1,514 @@
+/****************************************************************************
+ *
+ *  File:           ilist_test.c
+ *  Module:         Intrusive Linked List Test Library
+ *  Project:        Code Vault
+ *  Workspace:      PSoC Tools
+ *
+ *  Author:         Rodney B. Elliott
+ *  Date:           16 October 2026
+ *
+ ****************************************************************************
+ *
+ *  Copyright:      2013 Rodney B. Elliott
+ *
+ *  This file is part of PSoC Tools.
+ *
+ *  PSoC Tools is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  PSoC Tools is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with PSoC Tools. If not, see <http://www.gnu.org/licenses/>.
+ *
+ ****************************************************************************/
+/**
+ *  @file ilist_test.c
+ *  @brief Intrusive linked list test library implementation.
+ */
+
+/****************************************************************************
+ *  Modules
+ ****************************************************************************/
+#include <device.h>
+
+#include "ilist.h"
+#include "ilist_test.h"
+
+/****************************************************************************
+ *  Definitions and Macros
+ ****************************************************************************/
+/**
+ *  @brief Cypress CY8CKIT-001 development kit serial RX output pin.
+ */
+#define _CY8CKIT_RX                     CYREG_PRT1_PC2
+
+/**
+ *  @brief Cypress CY8CKIT-001 development kit serial TX output pin.
+ */
+#define _CY8CKIT_TX                     CYREG_PRT1_PC7
+
+/****************************************************************************
+ *  Typedefs and Structures
+ ****************************************************************************/
+
+/****************************************************************************
+ *  Prototypes of Local Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ *  Exported Variables
+ ****************************************************************************/
+
+/****************************************************************************
+ *  Global Variables
+ ****************************************************************************/
+
+/****************************************************************************
+ *  Exported Functions
+ ****************************************************************************/
+uint8 ilt_test_1(void)
+{
+    ILT_OBJECT object_1 = {1};
+    ILT_OBJECT object_2 = {2};
+    ILT_OBJECT object_3 = {3};
+    uint8 result = ILT_SUCCESS;
+    
+    UART_1_Start();
+    
+    UART_1_PutString("\x1b\x5b\x32\x4a");
+    UART_1_PutString("INTRUSIVE LINKED LIST LIBRARY TEST\r\n");
+    UART_1_PutString("\r\n");
+    UART_1_PutString("Test\tFunction\t\tResult\r\n");
+    UART_1_PutString("----\t--------\t\t------\r\n");
+    
+    /*
+     *  Initialise test.
+     */
+    if (result == ILT_SUCCESS)
+    {
+        if (il_init(&object_2.link) == IL_SUCCESS &&
+            il_init(&object_3.link) == IL_SUCCESS)
+        {
+            UART_1_PutString("   -\tInitialise test...\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("   -\tInitialise test...\tFAIL\r\n");
+            result = ILT_FAILURE;
+        }
+    }
+    
+    /*
+     *  Test il_init().
+     */
+    if (result == ILT_SUCCESS)
+    {
+        if (il_init(NULL) == IL_BAD_ARGUMENT)
+        {
+            UART_1_PutString("   1\til_init()\t\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("   1\til_init()\t\tFAIL\r\n");
+            result = ILT_FAILURE;
+        }
+    }
+    
+    if (result == ILT_SUCCESS)
+    {
+        if (il_init(&object_1.link) == IL_SUCCESS &&
+            object_1.link.previous == NULL &&
+            object_1.link.next == NULL)
+        {
+            UART_1_PutString("   2\til_init()\t\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("   2\til_init()\t\tFAIL\r\n");
+            result = ILT_FAILURE;
+        }
+    }
+    
+    /*
+     *  Test il_insert_before().
+     */
+    if (result == ILT_SUCCESS)
+    {
+        if (il_insert_before(NULL, &object_2.link) == IL_BAD_ARGUMENT)
+        {
+            UART_1_PutString("   3\til_insert_before()\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("   3\til_insert_before()\tFAIL\r\n");
+            result = ILT_FAILURE;
+        }
+    }
+    
+    if (result == ILT_SUCCESS)
+    {
+        if (il_insert_before(&object_1.link, &object_2.link) == IL_SUCCESS &&
+            il_get_first(&object_1.link) == &object_2.link)
+        {
+            UART_1_PutString("   4\til_insert_before()\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("   4\til_insert_before()\tFAIL\r\n");
+            result = ILT_FAILURE;
+        }
+    }
+    
+    /*
+     *  Test il_insert_after().
+     */
+    if (result == ILT_SUCCESS)
+    {
+        if (il_insert_after(&object_1.link, NULL) == IL_BAD_ARGUMENT)
+        {
+            UART_1_PutString("   5\til_insert_after()\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("   5\til_insert_after()\tFAIL\r\n");
+            result = ILT_FAILURE;
+        }
+    }
+    
+    if (result == ILT_SUCCESS)
+    {
+        if (il_insert_after(&object_1.link, &object_3.link) == IL_SUCCESS &&
+            il_get_last(&object_2.link) == &object_3.link)
+        {
+            UART_1_PutString("   6\til_insert_after()\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("   6\til_insert_after()\tFAIL\r\n");
+            result = ILT_FAILURE;
+        }
+    }
+    
+    /*
+     *  Test il_get_first().
+     */
+    if (result == ILT_SUCCESS)
+    {
+        if (il_get_first(NULL) == NULL)
+        {
+            UART_1_PutString("   7\til_get_first()\t\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("   7\til_get_first()\t\tFAIL\r\n");
+            result = ILT_FAILURE;
+        }
+    }
+    
+    if (result == ILT_SUCCESS)
+    {
+        if (IL_CONTAINER(il_get_first(&object_3.link), ILT_OBJECT, link)->number
+            == 2)
+        {
+            UART_1_PutString("   8\til_get_first()\t\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("   8\til_get_first()\t\tFAIL\r\n");
+            result = ILT_FAILURE;
+        }
+    }
+    
+    /*
+     *  Test il_get_last().
+     */
+    if (result == ILT_SUCCESS)
+    {
+        if (il_get_last(NULL) == NULL)
+        {
+            UART_1_PutString("   9\til_get_last()\t\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("   9\til_get_last()\t\tFAIL\r\n");
+            result = ILT_FAILURE;
+        }
+    }
+    
+    if (result == ILT_SUCCESS)
+    {
+        if (IL_CONTAINER(il_get_last(&object_2.link), ILT_OBJECT, link)->number
+            == 3)
+        {
+            UART_1_PutString("  10\til_get_last()\t\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("  10\til_get_last()\t\tFAIL\r\n");
+            result = ILT_FAILURE;
+        }
+    }
+    
+    /*
+     *  Test il_get_previous().
+     */
+    if (result == ILT_SUCCESS)
+    {
+        if (il_get_previous(&object_2.link) == NULL)
+        {
+            UART_1_PutString("  11\til_get_previous()\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("  11\til_get_previous()\tFAIL\r\n");
+            result = ILT_FAILURE;
+        }
+    }
+    
+    if (result == ILT_SUCCESS)
+    {
+        if (il_get_previous(&object_1.link) == &object_2.link)
+        {
+            UART_1_PutString("  12\til_get_previous()\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("  12\til_get_previous()\tFAIL\r\n");
+            result = ILT_FAILURE;
+        }
+    }
+    
+    /*
+     *  Test il_get_next().
+     */
+    if (result == ILT_SUCCESS)
+    {
+        if (il_get_next(&object_3.link) == NULL)
+        {
+            UART_1_PutString("  13\til_get_next()\t\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("  13\til_get_next()\t\tFAIL\r\n");
+            result = ILT_FAILURE;
+        }
+    }
+    
+    if (result == ILT_SUCCESS)
+    {
+        if (il_get_next(&object_1.link) == &object_3.link)
+        {
+            UART_1_PutString("  14\til_get_next()\t\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("  14\til_get_next()\t\tFAIL\r\n");
+            result = ILT_FAILURE;
+        }
+    }
+    
+    /*
+     *  Test il_get_count().
+     */
+    if (result == ILT_SUCCESS)
+    {
+        if (il_get_count(NULL) == 0)
+        {
+            UART_1_PutString("  15\til_get_count()\t\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("  15\til_get_count()\t\tFAIL\r\n");
+            result = ILT_FAILURE;
+        }
+    }
+    
+    if (result == ILT_SUCCESS)
+    {
+        if (il_get_count(&object_1.link) == 3)
+        {
+            UART_1_PutString("  16\til_get_count()\t\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("  16\til_get_count()\t\tFAIL\r\n");
+            result = ILT_FAILURE;
+        }
+    }
+    
+    /*
+     *  Test IL_CONTAINER().
+     */
+    if (result == ILT_SUCCESS)
+    {
+        if (IL_CONTAINER(NULL, ILT_OBJECT, link) == NULL)
+        {
+            UART_1_PutString("  17\tIL_CONTAINER()\t\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("  17\tIL_CONTAINER()\t\tFAIL\r\n");
+            result = ILT_FAILURE;
+        }
+    }
+    
+    if (result == ILT_SUCCESS)
+    {
+        if (IL_CONTAINER(&object_1.link, ILT_OBJECT, link) == &object_1)
+        {
+            UART_1_PutString("  18\tIL_CONTAINER()\t\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("  18\tIL_CONTAINER()\t\tFAIL\r\n");
+            result = ILT_FAILURE;
+        }
+    }
+    
+    /*
+     *  Test il_extract().
+     */
+    if (result == ILT_SUCCESS)
+    {
+        if (il_extract(NULL) == IL_BAD_ARGUMENT)
+        {
+            UART_1_PutString("  19\til_extract()\t\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("  19\til_extract()\t\tFAIL\r\n");
+            result = ILT_FAILURE;
+        }
+    }
+    
+    if (result == ILT_SUCCESS)
+    {
+        if (il_extract(&object_1.link) == IL_SUCCESS &&
+            il_get_count(&object_1.link) == 1 &&
+            il_get_count(&object_2.link) == 2)
+        {
+            UART_1_PutString("  20\til_extract()\t\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("  20\til_extract()\t\tFAIL\r\n");
+            result = ILT_FAILURE;
+        }
+    }
+    
+    /*
+     *  Test il_join().
+     */
+    if (result == ILT_SUCCESS)
+    {
+        if (il_join(NULL, &object_1.link) == IL_BAD_ARGUMENT)
+        {
+            UART_1_PutString("  21\til_join()\t\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("  21\til_join()\t\tFAIL\r\n");
+            result = ILT_FAILURE;
+        }
+    }
+    
+    if (result == ILT_SUCCESS)
+    {
+        if (il_join(&object_3.link, &object_1.link) == IL_SUCCESS &&
+            il_get_last(&object_2.link) == &object_1.link &&
+            il_get_count(&object_2.link) == 3)
+        {
+            UART_1_PutString("  22\til_join()\t\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("  22\til_join()\t\tFAIL\r\n");
+            result = ILT_FAILURE;
+        }
+    }
+    
+    /*
+     *  Test il_exchange().
+     */
+    if (result == ILT_SUCCESS)
+    {
+        if (il_exchange(NULL, &object_1.link) == IL_BAD_ARGUMENT)
+        {
+            UART_1_PutString("  23\til_exchange()\t\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("  23\til_exchange()\t\tFAIL\r\n");
+            result = ILT_FAILURE;
+        }
+    }
+    
+    if (result == ILT_SUCCESS)
+    {
+        if (il_exchange(&object_2.link, &object_1.link) == IL_SUCCESS &&
+            il_get_first(&object_3.link) == &object_1.link &&
+            il_get_last(&object_3.link) == &object_2.link)
+        {
+            UART_1_PutString("  24\til_exchange()\t\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("  24\til_exchange()\t\tFAIL\r\n");
+            result = ILT_FAILURE;
+        }
+    }
+    
+    if (result == ILT_SUCCESS)
+    {
+        if (il_exchange(&object_1.link, &object_3.link) == IL_SUCCESS &&
+            il_get_first(&object_1.link) == &object_3.link &&
+            il_get_next(&object_1.link) == &object_2.link)
+        {
+            UART_1_PutString("  25\til_exchange()\t\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("  25\til_exchange()\t\tFAIL\r\n");
+            result = ILT_FAILURE;
+        }
+    }
+    
+    /*
+     *  Report test result.
+     */
+    if (result == ILT_SUCCESS)
+    {
+        UART_1_PutString("\r\n");
+        UART_1_PutString("TEST PASSED\r\n");
+    }
+    else
+    {
+        UART_1_PutString("\r\n");
+        UART_1_PutString("TEST FAILED\r\n");
+    }
+    
+    while ((UART_1_ReadTxStatus() & UART_1_TX_STS_FIFO_EMPTY) !=
+        UART_1_TX_STS_FIFO_EMPTY)
+    {
+        CyDelay(1);
+    }
+    
+    UART_1_Stop();
+    
+    return result;
+}
+
+/****************************************************************************
+ *  Local Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ *  End of File
+ ****************************************************************************/
@@ -0,0 +1,156 @@
+/****************************************************************************
+ *
+ *  File:           ilist_test.h
+ *  Module:         Intrusive Linked List Test Library
+ *  Project:        Code Vault
+ *  Workspace:      PSoC Tools
+ *
+ *  Author:         Rodney B. Elliott
+ *  Date:           16 October 2026
+ *
+ ****************************************************************************
+ *
+ *  Copyright:      2013 Rodney B. Elliott
+ *
+ *  This file is part of PSoC Tools.
+ *
+ *  PSoC Tools is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  PSoC Tools is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with PSoC Tools. If not, see <http://www.gnu.org/licenses/>.
+ *
+ ****************************************************************************/
+#ifndef ILIST_TEST_H
+#define ILIST_TEST_H
+/**
+ *  @file ilist_test.h
+ *  @brief Intrusive linked list test library interface.
+ *
+ *  <H3> Introduction </H3>
+ *
+ *  The intrusive linked list test library contains a single function that
+ *  tests each of the functions that comprise the intrusive linked list (ILL)
+ *  library. As the ILL library does not allocate memory, the test objects
+ *  are declared on the stack.
+ *
+ *  <H3> Use </H3>
+ *
+ *  In order to use the library, the programmer must first connect the target
+ *  system to a serial terminal configured as 57600 8-N-1. To run the test,
+ *  simply call the function ilt_test_1() and observe the serial output, which
+ *  should be as follows.
+ *
+ *  @code
+ *  INTRUSIVE LINKED LIST LIBRARY TEST
+ *
+ *  Test    Function                Result
+ *  ----    --------                ------
+ *     -    Initialise test...      PASS
+ *     1    il_init()               PASS
+ *     2    il_init()               PASS
+ *     3    il_insert_before()      PASS
+ *     4    il_insert_before()      PASS
+ *     5    il_insert_after()       PASS
+ *     6    il_insert_after()       PASS
+ *     7    il_get_first()          PASS
+ *     8    il_get_first()          PASS
+ *     9    il_get_last()           PASS
+ *    10    il_get_last()           PASS
+ *    11    il_get_previous()       PASS
+ *    12    il_get_previous()       PASS
+ *    13    il_get_next()           PASS
+ *    14    il_get_next()           PASS
+ *    15    il_get_count()          PASS
+ *    16    il_get_count()          PASS
+ *    17    IL_CONTAINER()          PASS
+ *    18    IL_CONTAINER()          PASS
+ *    19    il_extract()            PASS
+ *    20    il_extract()            PASS
+ *    21    il_join()               PASS
+ *    22    il_join()               PASS
+ *    23    il_exchange()           PASS
+ *    24    il_exchange()           PASS
+ *    25    il_exchange()           PASS
+ *
+ *  TEST PASSED
+ *  @endcode
+ *
+ *  Alternatively, if no serial terminal is available, the ilt_test_1() return
+ *  value may be checked to see if the test completed successfully or not.
+ *
+ *  <H3> Hardware </H3>
+ *
+ *  The ILL test library has been designed to run on a Cypress CY8CKIT-001
+ *  development kit fitted with a PSoC5 CY8C5568AXI-060 module. It requires
+ *  access to the following components:
+ *
+ *  - UART_1
+ *
+ *  Pin P1_2 on the development kit prototype area must be connected to the
+ *  UART RX pin, and pin P1_7 must be connected to the UART TX pin. Ensure
+ *  that the RS_232PWR jumper is also set.
+ */
+
+/****************************************************************************
+ *  Modules
+ ****************************************************************************/
+#include "ilist.h"
+
+/****************************************************************************
+ *  Definitions and Macros
+ ****************************************************************************/
+/**
+ *  @brief Generic success.
+ */
+#define ILT_SUCCESS                     0
+
+/**
+ *  @brief Generic failure.
+ */
+#define ILT_FAILURE                     1
+
+/****************************************************************************
+ *  Typedefs and Structures
+ ****************************************************************************/
+/**
+ *  @brief The ILL test library object.
+ */
+typedef struct ILT_OBJECT
+{
+    /**
+     *  @brief The object identification number.
+     */
+    uint8 number;
+    
+    /**
+     *  @brief The ILL link embedded within the object.
+     */
+    IL_LINK link;
+} ILT_OBJECT;
+
+/****************************************************************************
+ *  Exported Variables
+ ****************************************************************************/
+
+/****************************************************************************
+ *  Exported Functions
+ ****************************************************************************/
+/**
+ *  @brief Tests the functions of the ILL library.
+ *  @return #ILT_SUCCESS if successful, otherwise #ILT_FAILURE.
+ */
+uint8 ilt_test_1(void);
+
+#endif
+
+/****************************************************************************
+ *  End of File
+ ****************************************************************************/
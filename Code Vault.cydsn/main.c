@@ -38,16 +38,20 @@
  ****************************************************************************/
 #include <device.h>
 
+//#include "bench.h"
 //#include "button_test.h"
 //#include "cbuff_test.h"
 //#include "cllist_test.h"
 //#include "deque_test.h"
 //#include "dllist_test.h"
 //#include "error_test.h"
+//#include "gesture_test.h"
+//#include "ilist_test.h"
 //#include "main.h"
 //#include "misc_test.h"
 //#include "queue_test.h"
 //#include "rtime_test.h"
+//#include "spsc_test.h"
 #include "state_test.h"
 
 /****************************************************************************
@@ -83,17 +87,33 @@ void main()
     CyGlobalIntEnable;
     
     //dlt_test_1();
+    //dlt_test_2();
+    //dlt_test_3();
+    //dlt_test_4();
+    //ilt_test_1();
     //det_test_1();
+    //det_test_2();
+    //det_test_3();
     //qut_test_1();
+    //qut_test_2();
     //clt_test_1();
     //cbt_test_1();
+    //cbt_test_2();
+    //spt_test_1();
     //mit_test_1();
     //rtt_test_1();
     //ert_test_1();
+    //ert_test_2();
+    //ert_test_3();
+    //ert_test_4();
+    //ert_test_5();
+    //ert_test_6();
     //but_test_1();
     //but_test_2();
+    //gst_test_1();
     //stt_test_1();
     stt_test_2();
+    //bm_run(100);
     
     for (;;)
     {
@@ -71,14 +71,9 @@ uint8 qu_add_last(QU_LIST *queue, uint16 tag, void *object)
     if (queue != NULL && object != NULL)
     {
         if ((queue->limit == 0) ||
-            (queue->limit > 0 && queue->count < queue->limit))
+            (queue->limit > 0 && queue->head.count < queue->limit))
         {
-            result = dl_add_last(&queue->list, tag, object);
-            
-            if (result == DL_SUCCESS)
-            {
-                ++queue->count;
-            }
+            result = dl_head_add_last(&queue->head, tag, object);
         }
         else
         {
@@ -92,15 +87,13 @@ uint8 qu_add_last(QU_LIST *queue, uint16 tag, void *object)
 uint8 qu_remove_first(QU_LIST *queue, void **object)
 {
     DL_LIST *first_node;
-    DL_LIST *next_node;
     uint8 result = QU_SUCCESS;
 
     if (queue != NULL)
     {
-        if (queue->count > 0)
+        if (queue->head.count > 0)
         {
-            first_node = dl_get_first(queue->list);
-            next_node = dl_get_next(first_node);
+            first_node = queue->head.first;
             
             if (object != NULL)
             {
@@ -109,11 +102,7 @@ uint8 qu_remove_first(QU_LIST *queue, void **object)
         
             if (result == DL_SUCCESS)
             {
-                queue->list = next_node;
-            
-                dl_delete(first_node);
-            
-                --queue->count;
+                result = dl_head_delete(&queue->head, first_node);
             }
         }
         else
@@ -129,15 +118,120 @@ uint8 qu_remove_first(QU_LIST *queue, void **object)
     return result;
 }
 
+uint8 qu_add_many(QU_LIST *queue, uint16 *tags, void **objects,
+    uint32 count, uint32 *accepted)
+{
+    DL_HEAD chain = {0};
+    uint32 i;
+    uint32 space = count;
+    uint8 result = QU_BAD_ARGUMENT;
+    
+    if (accepted != NULL)
+    {
+        *accepted = 0;
+    }
+    
+    if (queue != NULL && objects != NULL)
+    {
+        result = QU_SUCCESS;
+        
+        for (i = 0 ; i < count && result == QU_SUCCESS ; i++)
+        {
+            if (objects[i] == NULL)
+            {
+                result = QU_BAD_ARGUMENT;
+            }
+        }
+        
+        if (result == QU_SUCCESS && queue->limit > 0 &&
+            queue->limit - queue->head.count < count)
+        {
+            space = queue->limit - queue->head.count;
+        }
+#ifdef DL_POOL_SIZE
+        
+        chain.pool = queue->head.pool;
+#endif
+        
+        for (i = 0 ; i < space && result == QU_SUCCESS ; i++)
+        {
+            result = dl_head_add_last(&chain, tags != NULL ? tags[i] : 0,
+                objects[i]);
+        }
+        
+        if (result == QU_SUCCESS)
+        {
+            dl_head_join(&queue->head, &chain);
+            
+            if (accepted != NULL)
+            {
+                *accepted = space;
+            }
+            
+            if (space < count)
+            {
+                result = QU_FULL;
+            }
+        }
+        else
+        {
+            dl_head_destroy(&chain);
+        }
+    }
+    
+    return result;
+}
+
+uint8 qu_remove_many(QU_LIST *queue, void **objects, uint32 count,
+    uint32 *removed)
+{
+    DL_LIST *first_node;
+    uint32 i = 0;
+    uint8 result = QU_BAD_ARGUMENT;
+    
+    if (queue != NULL)
+    {
+        while (i < count && queue->head.count > 0)
+        {
+            first_node = queue->head.first;
+            
+            if (objects != NULL)
+            {
+                dl_get_object(first_node, NULL, &objects[i]);
+            }
+            
+            dl_head_delete(&queue->head, first_node);
+            
+            ++i;
+        }
+        
+        if (i < count)
+        {
+            result = QU_EMPTY;
+        }
+        else
+        {
+            result = QU_SUCCESS;
+        }
+    }
+    
+    if (removed != NULL)
+    {
+        *removed = i;
+    }
+    
+    return result;
+}
+
 uint8 qu_get_first_object(QU_LIST *queue, uint16 *tag, void **object)
 {
     uint8 result = QU_BAD_ARGUMENT;
 
     if (queue != NULL)
     {
-        if (queue->count > 0)
+        if (queue->head.count > 0)
         {
-            result = dl_get_object(dl_get_first(queue->list), tag, object);
+            result = dl_get_object(queue->head.first, tag, object);
         }
         else
         {
@@ -154,7 +248,7 @@ uint32 qu_get_count(QU_LIST *queue)
     
     if (queue != NULL)
     {
-        count = queue->count;
+        count = queue->head.count;
     }
     
     return count;
@@ -178,7 +272,7 @@ uint8 qu_set_limit(QU_LIST *queue, uint32 limit)
     
     if (queue != NULL)
     {
-        if ((queue->count > limit) && (limit != 0))
+        if ((queue->head.count > limit) && (limit != 0))
         {
             result = QU_FAILURE;
         }
@@ -199,12 +293,7 @@ uint8 qu_destroy(QU_LIST *queue)
     
     if (queue != NULL)
     {
-        while (qu_get_count(queue) > 0)
-        {
-            qu_remove_first(queue, NULL);
-        }
-        
-        result = QU_SUCCESS;
+        result = dl_head_destroy(&queue->head);
     }
     
     return result;
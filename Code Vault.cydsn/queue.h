@@ -67,7 +67,9 @@
  *
  *  By comparing the queue interface to that of a DLL, it should be apparent
  *  that a queue is simply a DLL with certain access restrictions, and a node
- *  count.
+ *  count. Each queue keeps its DLL in a DL_HEAD structure, which records the
+ *  first and last nodes of the DLL. Nodes are therefore added to and removed
+ *  from the queue in constant time, regardless of the length of the queue.
  *
  *  Note that each queue node contains a pointer to an object, rather than the
  *  object itself. Whilst the library is responsible for managing the object
@@ -87,6 +89,13 @@
  *  the library function qu_add_last(). Nodes may be removed from the queue
  *  using the function qu_remove_first().
  *
+ *  Where many objects are to be added or removed at once, the functions
+ *  qu_add_many() and qu_remove_many() may be used instead. These take an
+ *  array of objects, validate their arguments once, and report the number
+ *  of objects actually added or removed. qu_add_many() builds the new nodes
+ *  into a separate DLL, which is then joined to the rear of the queue in a
+ *  single operation.
+ *
  *  The function qu_get_first_object() may be used to examine an object
  *  without removing its node from the queue, whilst qu_get_limit() and
  *  qu_set_limit() may be used to get and set the maximum number of nodes
@@ -164,14 +173,12 @@
 typedef struct QU_LIST
 {
     /**
-     *  @brief A pointer to a DLL.
-     */
-    DL_LIST *list;
-    
-    /**
-     *  @brief The number of nodes in the DLL.
+     *  @brief The head of a DLL.
+     *
+     *  Records the first and last nodes of the DLL, together with the number
+     *  of nodes in the DLL.
      */
-    uint32 count;
+    DL_HEAD head;
     
     /**
      *  @brief The maximum number of nodes allowed in the DLL.
@@ -213,6 +220,52 @@ uint8 qu_add_last(QU_LIST *queue, uint16 tag, void *object);
  */
 uint8 qu_remove_first(QU_LIST *queue, void **object);
 
+/**
+ *  @brief Add many new nodes to a queue in last place.
+ *  @param[in] queue A pointer to a queue.
+ *  @param[in] tags A pointer to an array of tags, one per object.
+ *  @param[in] objects A pointer to an array of pointers to the new nodes'
+ *      objects.
+ *  @param[in] count The number of objects in the array.
+ *  @param[out] accepted A pointer to the returned number of objects added.
+ *  @return #QU_SUCCESS if every object was added, otherwise
+ *      #QU_BAD_ARGUMENT, #QU_NO_MEMORY, or #QU_FULL.
+ *  @remark Objects are added in array order, so that objects[0] will be the
+ *      first of them to be removed. If the queue's node limit does not
+ *      allow every object to be added, as many as possible are added and
+ *      #QU_FULL is returned.
+ *  @remark The tags and accepted parameters are optional, and may be set
+ *      to NULL. If the tags parameter is NULL, every new node is given a
+ *      tag of zero.
+ *  @remark If any of the objects is NULL, no objects are added and
+ *      #QU_BAD_ARGUMENT is returned.
+ *  @warning It is up to the caller to ensure that the queue argument
+ *      points to an actual queue. Passing a pointer to an uninitialised
+ *      queue would be a <B> very bad thing. </B>
+ */
+uint8 qu_add_many(QU_LIST *queue, uint16 *tags, void **objects,
+    uint32 count, uint32 *accepted);
+
+/**
+ *  @brief Remove many nodes from the front of a queue.
+ *  @param[in] queue A pointer to a queue.
+ *  @param[out] objects A pointer to an array of pointers to the returned
+ *      objects.
+ *  @param[in] count The number of nodes to remove.
+ *  @param[out] removed A pointer to the returned number of nodes removed.
+ *  @return #QU_SUCCESS if count nodes were removed, otherwise
+ *      #QU_BAD_ARGUMENT or #QU_EMPTY.
+ *  @remark If the queue holds fewer than count nodes, every node is
+ *      removed and #QU_EMPTY is returned.
+ *  @remark The objects and removed parameters are optional, and may be set
+ *      to NULL if not required.
+ *  @warning It is up to the caller to ensure that the objects array holds
+ *      at least count elements. Doing otherwise would be a <B> very bad
+ *      thing. </B>
+ */
+uint8 qu_remove_many(QU_LIST *queue, void **objects, uint32 count,
+    uint32 *removed);
+
 /**
  *  @brief Get the object of the first node of a queue.
  *  @param[in] queue A pointer to a queue.
@@ -38,6 +38,7 @@
  ****************************************************************************/
 #include <device.h>
 #include <stdlib.h>
+#include <string.h>
 
 #include "queue.h"
 #include "queue_test.h"
@@ -235,7 +236,7 @@ uint8 qut_test_1(void)
     
     if (result == QUT_SUCCESS)
     {
-        if (queue_1.count == 2)
+        if (queue_1.head.count == 2)
         {
             UART_1_PutString("   7\tqu_add_last()\t\tPASS\r\n");
         }
@@ -303,7 +304,7 @@ uint8 qut_test_1(void)
     
     if (result == QUT_SUCCESS)
     {
-        if (queue_1.count == 1)
+        if (queue_1.head.count == 1)
         {
             UART_1_PutString("  12\tqu_remove_first()\tPASS\r\n");
         }
@@ -691,7 +692,7 @@ uint8 qut_test_1(void)
     
     if (result == QUT_SUCCESS)
     {
-        if (queue_1.count == 0)
+        if (queue_1.head.count == 0)
         {
             UART_1_PutString("  34\tqu_destroy()\t\tPASS\r\n");
         }
@@ -735,6 +736,418 @@ uint8 qut_test_1(void)
     return result;
 }
 
+uint8 qut_test_2(void)
+{
+    QU_LIST queue_1 = {0};
+    QUT_OBJECT *object_0;
+    QUT_OBJECT *object_1;
+    QUT_OBJECT *object_2;
+    QUT_OBJECT *object_3;
+    void *object;
+    void *objects[4];
+    void *bad_objects[2] = {NULL};
+    void *returned[4] = {NULL};
+    uint16 tags[4] = {_TAG, _TAG + 1, _TAG + 2, _TAG + 3};
+    uint32 accepted = 0;
+    uint32 removed = 0;
+    uint8 result = QUT_SUCCESS;
+    uint16 tag_0;
+
+    UART_1_Start();
+    
+    UART_1_PutString("\x1b\x5b\x32\x4a");
+    UART_1_PutString("QUEUE BATCH TEST\r\n");
+    UART_1_PutString("\r\n");
+    UART_1_PutString("Test\tFunction\t\tResult\r\n");
+    UART_1_PutString("----\t--------\t\t------\r\n");
+    
+    /*
+     *  Initialise qu_add_many() test.
+     */
+    if (result == QUT_SUCCESS)
+    {
+        if (_create_object("zero", 0, &object_0) == QUT_SUCCESS)
+        {
+            objects[0] = object_0;
+            
+            UART_1_PutString("   -\tInitialise test...\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("   -\tInitialise test...\tFAIL\r\n");
+            result = QUT_FAILURE;
+        }
+    }
+    
+    if (result == QUT_SUCCESS)
+    {
+        if (_create_object("one", 1, &object_1) == QUT_SUCCESS)
+        {
+            objects[1] = object_1;
+            
+            UART_1_PutString("   -\tInitialise test...\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("   -\tInitialise test...\tFAIL\r\n");
+            result = QUT_FAILURE;
+        }
+    }
+    
+    if (result == QUT_SUCCESS)
+    {
+        if (_create_object("two", 2, &object_2) == QUT_SUCCESS)
+        {
+            objects[2] = object_2;
+            
+            UART_1_PutString("   -\tInitialise test...\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("   -\tInitialise test...\tFAIL\r\n");
+            result = QUT_FAILURE;
+        }
+    }
+    
+    if (result == QUT_SUCCESS)
+    {
+        if (_create_object("three", 3, &object_3) == QUT_SUCCESS)
+        {
+            objects[3] = object_3;
+            
+            UART_1_PutString("   -\tInitialise test...\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("   -\tInitialise test...\tFAIL\r\n");
+            result = QUT_FAILURE;
+        }
+    }
+    
+    /*
+     *  Test qu_add_many().
+     */
+    if (result == QUT_SUCCESS)
+    {
+        if (qu_add_many(NULL, tags, objects, 4, &accepted) == QU_BAD_ARGUMENT)
+        {
+            UART_1_PutString("   1\tqu_add_many()\t\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("   1\tqu_add_many()\t\tFAIL\r\n");
+            result = QUT_FAILURE;
+        }
+    }
+    
+    if (result == QUT_SUCCESS)
+    {
+        if (qu_add_many(&queue_1, tags, NULL, 4, &accepted) == QU_BAD_ARGUMENT)
+        {
+            UART_1_PutString("   2\tqu_add_many()\t\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("   2\tqu_add_many()\t\tFAIL\r\n");
+            result = QUT_FAILURE;
+        }
+    }
+    
+    if (result == QUT_SUCCESS)
+    {
+        bad_objects[0] = object_0;
+        
+        if (qu_add_many(&queue_1, tags, bad_objects, 2, &accepted) ==
+            QU_BAD_ARGUMENT)
+        {
+            UART_1_PutString("   3\tqu_add_many()\t\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("   3\tqu_add_many()\t\tFAIL\r\n");
+            result = QUT_FAILURE;
+        }
+    }
+    
+    if (result == QUT_SUCCESS)
+    {
+        if ((accepted == 0) && (queue_1.head.count == 0))
+        {
+            UART_1_PutString("   4\tqu_add_many()\t\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("   4\tqu_add_many()\t\tFAIL\r\n");
+            result = QUT_FAILURE;
+        }
+    }
+    
+    if (result == QUT_SUCCESS)
+    {
+        if (qu_add_many(&queue_1, tags, objects, 2, &accepted) == QU_SUCCESS)
+        {
+            UART_1_PutString("   5\tqu_add_many()\t\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("   5\tqu_add_many()\t\tFAIL\r\n");
+            result = QUT_FAILURE;
+        }
+    }
+    
+    if (result == QUT_SUCCESS)
+    {
+        if ((accepted == 2) && (queue_1.head.count == 2))
+        {
+            UART_1_PutString("   6\tqu_add_many()\t\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("   6\tqu_add_many()\t\tFAIL\r\n");
+            result = QUT_FAILURE;
+        }
+    }
+    
+    if (result == QUT_SUCCESS)
+    {
+        if (qu_add_many(&queue_1, NULL, &objects[2], 2, NULL) == QU_SUCCESS)
+        {
+            UART_1_PutString("   7\tqu_add_many()\t\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("   7\tqu_add_many()\t\tFAIL\r\n");
+            result = QUT_FAILURE;
+        }
+    }
+    
+    if (result == QUT_SUCCESS)
+    {
+        qu_get_first_object(&queue_1, &tag_0, &object);
+        
+        if ((tag_0 == _TAG) && (object == object_0))
+        {
+            UART_1_PutString("   8\tqu_add_many()\t\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("   8\tqu_add_many()\t\tFAIL\r\n");
+            result = QUT_FAILURE;
+        }
+    }
+    
+    if (result == QUT_SUCCESS)
+    {
+        dl_get_object(dl_head_get_last(&queue_1.head), &tag_0, &object);
+        
+        if ((tag_0 == 0) && (object == object_3) && (queue_1.head.count == 4))
+        {
+            UART_1_PutString("   9\tqu_add_many()\t\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("   9\tqu_add_many()\t\tFAIL\r\n");
+            result = QUT_FAILURE;
+        }
+    }
+    
+    if (result == QUT_SUCCESS)
+    {
+        queue_1.limit = 5;
+        
+        if (qu_add_many(&queue_1, tags, objects, 4, &accepted) == QU_FULL)
+        {
+            UART_1_PutString("  10\tqu_add_many()\t\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("  10\tqu_add_many()\t\tFAIL\r\n");
+            result = QUT_FAILURE;
+        }
+    }
+    
+    if (result == QUT_SUCCESS)
+    {
+        if ((accepted == 1) && (queue_1.head.count == 5))
+        {
+            UART_1_PutString("  11\tqu_add_many()\t\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("  11\tqu_add_many()\t\tFAIL\r\n");
+            result = QUT_FAILURE;
+        }
+    }
+    
+    if (result == QUT_SUCCESS)
+    {
+        accepted = 1;
+        
+        if (qu_add_many(&queue_1, NULL, objects, 0, &accepted) == QU_SUCCESS)
+        {
+            UART_1_PutString("  12\tqu_add_many()\t\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("  12\tqu_add_many()\t\tFAIL\r\n");
+            result = QUT_FAILURE;
+        }
+    }
+    
+    if (result == QUT_SUCCESS)
+    {
+        if (accepted == 0)
+        {
+            UART_1_PutString("  13\tqu_add_many()\t\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("  13\tqu_add_many()\t\tFAIL\r\n");
+            result = QUT_FAILURE;
+        }
+    }
+    
+    /*
+     *  Test qu_remove_many().
+     */
+    if (result == QUT_SUCCESS)
+    {
+        removed = 1;
+        
+        if ((qu_remove_many(NULL, returned, 3, &removed) == QU_BAD_ARGUMENT) &&
+            (removed == 0))
+        {
+            UART_1_PutString("  14\tqu_remove_many()\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("  14\tqu_remove_many()\tFAIL\r\n");
+            result = QUT_FAILURE;
+        }
+    }
+    
+    if (result == QUT_SUCCESS)
+    {
+        if (qu_remove_many(&queue_1, returned, 3, &removed) == QU_SUCCESS)
+        {
+            UART_1_PutString("  15\tqu_remove_many()\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("  15\tqu_remove_many()\tFAIL\r\n");
+            result = QUT_FAILURE;
+        }
+    }
+    
+    if (result == QUT_SUCCESS)
+    {
+        if ((removed == 3) &&
+            (returned[0] == object_0) &&
+            (returned[1] == object_1) &&
+            (returned[2] == object_2))
+        {
+            UART_1_PutString("  16\tqu_remove_many()\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("  16\tqu_remove_many()\tFAIL\r\n");
+            result = QUT_FAILURE;
+        }
+    }
+    
+    if (result == QUT_SUCCESS)
+    {
+        if (qu_remove_many(&queue_1, returned, 3, &removed) == QU_EMPTY)
+        {
+            UART_1_PutString("  17\tqu_remove_many()\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("  17\tqu_remove_many()\tFAIL\r\n");
+            result = QUT_FAILURE;
+        }
+    }
+    
+    if (result == QUT_SUCCESS)
+    {
+        if ((removed == 2) &&
+            (returned[0] == object_3) &&
+            (returned[1] == object_0) &&
+            (queue_1.head.count == 0))
+        {
+            UART_1_PutString("  18\tqu_remove_many()\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("  18\tqu_remove_many()\tFAIL\r\n");
+            result = QUT_FAILURE;
+        }
+    }
+    
+    if (result == QUT_SUCCESS)
+    {
+        if (qu_remove_many(&queue_1, NULL, 1, NULL) == QU_EMPTY)
+        {
+            UART_1_PutString("  19\tqu_remove_many()\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("  19\tqu_remove_many()\tFAIL\r\n");
+            result = QUT_FAILURE;
+        }
+    }
+    
+    if (result == QUT_SUCCESS)
+    {
+        qu_add_many(&queue_1, NULL, objects, 4, NULL);
+        
+        if ((qu_remove_many(&queue_1, NULL, 4, &removed) == QU_SUCCESS) &&
+            (removed == 4) &&
+            (queue_1.head.count == 0))
+        {
+            UART_1_PutString("  20\tqu_remove_many()\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("  20\tqu_remove_many()\tFAIL\r\n");
+            result = QUT_FAILURE;
+        }
+    }
+    
+    /*
+     *  Report test result.
+     */
+    if (result == QUT_SUCCESS)
+    {
+        UART_1_PutString("\r\n");
+        UART_1_PutString("TEST PASSED\r\n");
+    }
+    else
+    {
+        UART_1_PutString("\r\n");
+        UART_1_PutString("TEST FAILED\r\n");
+    }
+    
+    /*
+     *  Clean-up test.
+     */
+    qu_destroy(&queue_1);
+    _destroy_object(object_0);
+    _destroy_object(object_1);
+    _destroy_object(object_2);
+    _destroy_object(object_3);
+    
+    while ((UART_1_ReadTxStatus() & UART_1_TX_STS_FIFO_EMPTY) !=
+        UART_1_TX_STS_FIFO_EMPTY)
+    {
+        CyDelay(1);
+    }
+    
+    UART_1_Stop();
+    
+    return result;
+}
+
 /****************************************************************************
  *  Local Functions
  ****************************************************************************/
@@ -781,7 +1194,8 @@ void _walk_queue(QU_LIST *queue)
     DL_LIST *node;
     QUT_OBJECT *object;
     
-    for (node = dl_get_first(queue->list) ; node != NULL ; node = node->next)
+    for (node = dl_head_get_first(&queue->head) ; node != NULL ;
+        node = node->next)
     {
         object = node->object;
         
@@ -36,19 +36,21 @@
  *
  *  <H3> Introduction </H3>
  *
- *  The queue test library contains a single function that tests each of the
- *  functions that comprise the queue library.
+ *  The queue test library contains two functions that test the queue
+ *  library. The first, qut_test_1(), tests each of the functions that add,
+ *  remove and examine a single node, while the second, qut_test_2(), tests the
+ *  batch functions qu_add_many() and qu_remove_many().
  *
- *  This function, qut_test_1(), provides complete coverage of the queue
+ *  Together, these functions provide complete coverage of the queue
  *  library codebase, with one exception. Those queue library functions that
  *  call dl_create() have not had their #QU_NO_MEMORY return value tested.
  *
  *  <H3> Use </H3>
  *
  *  In order to use the library, the programmer must first connect the target
- *  system to a serial terminal configured as 57600 8-N-1. To run the test,
- *  simply call the function qut_test_1() and observe the serial output, which
- *  should be as follows.
+ *  system to a serial terminal configured as 57600 8-N-1. To run a test,
+ *  simply call the appropriate function and observe the serial output.
+ *  Running qut_test_1() should produce the following serial output.
  *
  *  @code
  *  QUEUE LIBRARY TEST
@@ -101,8 +103,44 @@
  *  TEST PASSED
  *  @endcode
  *
- *  Alternatively, if no serial terminal is available, the qut_test_1() return
- *  value may be checked to see if the test completed successfully or not.
+ *  Running qut_test_2() should produce the following serial output.
+ *
+ *  @code
+ *  QUEUE BATCH TEST
+ *  
+ *  Test    Function                Result
+ *  ----    --------                ------
+ *     -    Initialise test...      PASS
+ *     -    Initialise test...      PASS
+ *     -    Initialise test...      PASS
+ *     -    Initialise test...      PASS
+ *     1    qu_add_many()           PASS
+ *     2    qu_add_many()           PASS
+ *     3    qu_add_many()           PASS
+ *     4    qu_add_many()           PASS
+ *     5    qu_add_many()           PASS
+ *     6    qu_add_many()           PASS
+ *     7    qu_add_many()           PASS
+ *     8    qu_add_many()           PASS
+ *     9    qu_add_many()           PASS
+ *    10    qu_add_many()           PASS
+ *    11    qu_add_many()           PASS
+ *    12    qu_add_many()           PASS
+ *    13    qu_add_many()           PASS
+ *    14    qu_remove_many()        PASS
+ *    15    qu_remove_many()        PASS
+ *    16    qu_remove_many()        PASS
+ *    17    qu_remove_many()        PASS
+ *    18    qu_remove_many()        PASS
+ *    19    qu_remove_many()        PASS
+ *    20    qu_remove_many()        PASS
+ *  
+ *  TEST PASSED
+ *  @endcode
+ *
+ *  Alternatively, if no serial terminal is available, the return value of
+ *  each test function may be checked to see if the test completed
+ *  successfully or not.
  *
  *  <H3> Hardware </H3>
  *
@@ -179,6 +217,12 @@ typedef struct QUT_OBJECT
  */
 uint8 qut_test_1(void);
 
+/**
+ *  @brief Tests the batch functions of the queue library.
+ *  @return #QUT_SUCCESS if successful, otherwise #QUT_FAILURE.
+ */
+uint8 qut_test_2(void);
+
 #endif
 
 /****************************************************************************
@@ -40,7 +40,6 @@
 #include <stdlib.h>
 #include <string.h>
 
-#include "misc.h"
 #include "rtime.h"
 
 /****************************************************************************
@@ -76,13 +75,116 @@
  */
 #define _DEFAULT_YEAR                   1918
 
+/**
+ *  @brief The position of the hour in a converted string.
+ */
+#define _HOUR                           11
+
+/**
+ *  @brief The position of the minute in a converted string.
+ */
+#define _MINUTE                         14
+
+/**
+ *  @brief The position of the second in a converted string.
+ */
+#define _SECOND                         17
+
+/**
+ *  @brief The number of seconds in a day.
+ */
+#define _DAY_SECONDS                    86400ul
+
+#ifndef HO_SHIM
+/**
+ *  @brief SysTick control and status register.
+ */
+#define _SYST_CSR                       0xe000e010u
+
+/**
+ *  @brief SysTick reload value register.
+ */
+#define _SYST_RVR                       0xe000e014u
+
+/**
+ *  @brief SysTick current value register.
+ */
+#define _SYST_CVR                       0xe000e018u
+
+/**
+ *  @brief SysTick enable, interrupt enable and processor clock source mask.
+ */
+#define _SYST_CSR_START                 0x00000007u
+#endif
+
 /****************************************************************************
  *  Typedefs and Structures
  ****************************************************************************/
+/**
+ *  @brief The layout of the date within a converted string.
+ */
+typedef struct _LAYOUT
+{
+    /**
+     *  @brief The converted string with every digit replaced by a space.
+     */
+    char *pattern;
+    
+    /**
+     *  @brief The position of the day.
+     */
+    uint8 day;
+    
+    /**
+     *  @brief The position of the month.
+     */
+    uint8 month;
+    
+    /**
+     *  @brief The position of the year.
+     */
+    uint8 year;
+} _LAYOUT;
 
 /****************************************************************************
  *  Prototypes of Local Functions
  ****************************************************************************/
+/**
+ *  @brief Write a value as two decimal digits.
+ *  @param[out] string A pointer to the first digit.
+ *  @param[in] value The value, which must be less than 100.
+ */
+static void _put_pair(char *string, uint8 value);
+
+/**
+ *  @brief Determine whether a year is a leap year.
+ *  @param[in] year The year.
+ *  @return 1 if the year is a leap year, otherwise 0.
+ */
+static uint8 _is_leap(uint16 year);
+
+/**
+ *  @brief Get the number of days in a month.
+ *  @param[in] month The month (1-12).
+ *  @param[in] year The year.
+ *  @return The number of days in the month.
+ */
+static uint8 _get_month_days(uint8 month, uint16 year);
+
+/**
+ *  @brief Get the number of days between the start of #RT_EPOCH_YEAR and
+ *      the start of a year.
+ *  @param[in] year The year, which must not be before #RT_EPOCH_YEAR.
+ *  @return The number of days.
+ */
+static uint32 _get_year_days(uint16 year);
+
+#ifndef HO_SHIM
+/**
+ *  @brief SysTick interrupt service routine (ISR).
+ */
+static CY_ISR_PROTO(_tick_interrupt);
+#endif
 
 /****************************************************************************
  *  Exported Variables
@@ -96,6 +198,61 @@
  */
 static RT_DATA *_rt_data = NULL;
 
+/**
+ *  @brief Every value less than 100 as two decimal digits.
+ */
+static const char _DIGITS[] =
+    "0001020304050607080910111213141516171819"
+    "2021222324252627282930313233343536373839"
+    "4041424344454647484950515253545556575859"
+    "6061626364656667686970717273747576777879"
+    "8081828384858687888990919293949596979899";
+
+/**
+ *  @brief The layout of the date for each format.
+ */
+static const _LAYOUT _LAYOUTS[] =
+{
+    {"  /  /       :  :  ", 0, 3, 6},
+    {"    -  -  T  :  :  ", 8, 5, 0}
+};
+
+/**
+ *  @brief The number of days in each month of a year that is not a leap
+ *      year.
+ */
+static const uint8 _MONTH_DAYS[12] =
+{
+    31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31
+};
+
+/**
+ *  @brief The number of days before each month of a year that is not a
+ *      leap year.
+ */
+static const uint16 _MONTH_START[12] =
+{
+    0, 31, 59, 90, 120, 151, 181, 212, 243, 273, 304, 334
+};
+
+#ifdef HO_SHIM
+/**
+ *  @brief The host clock when the millisecond count was started, in
+ *      nanoseconds.
+ */
+static unsigned long long _tick_base = 0;
+#else
+/**
+ *  @brief The lower 32 bits of the millisecond count.
+ */
+static volatile uint32 _ticks = 0;
+
+/**
+ *  @brief The upper 32 bits of the millisecond count.
+ */
+static volatile uint32 _ticks_high = 0;
+#endif
+
 /****************************************************************************
  *  Exported Functions
  ****************************************************************************/
@@ -259,97 +416,221 @@ uint8 rt_set_time(uint8 hour, uint8 minute, uint8 second)
 
 uint8 rt_convert(RT_DATA *timestamp, char *string)
 {
+    return rt_format(timestamp, string, RT_FORMAT_DMY, NULL);
+}
+
+uint8 rt_format(RT_DATA *timestamp, char *string, uint8 format,
+    uint8 *length)
+{
+    const _LAYOUT *layout;
     uint8 result = RT_BAD_ARGUMENT;
     
-    if (timestamp != NULL && string != NULL)
+    if (timestamp != NULL && string != NULL && format <= RT_FORMAT_ISO &&
+        timestamp->DayOfMonth < 100 && timestamp->Month < 100 &&
+        timestamp->Year < 10000 && timestamp->Hour < 100 &&
+        timestamp->Min < 100 && timestamp->Sec < 100)
     {
-        char t[5] = {'\0'};
+        layout = &_LAYOUTS[format];
         
-        strcpy(string, "");
-        
-        if (timestamp->DayOfMonth < 10)
-        {
-            strcpy(string, "0");
-        }
+        memcpy(string, layout->pattern, RT_STRING_SIZE);
         
-        mi_utoa(timestamp->DayOfMonth, t);
-        strcat(string, t);
-        strcat(string, "/");
+        _put_pair(&string[layout->day], timestamp->DayOfMonth);
+        _put_pair(&string[layout->month], timestamp->Month);
+        _put_pair(&string[layout->year], timestamp->Year / 100);
+        _put_pair(&string[layout->year + 2], timestamp->Year % 100);
+        _put_pair(&string[_HOUR], timestamp->Hour);
+        _put_pair(&string[_MINUTE], timestamp->Min);
+        _put_pair(&string[_SECOND], timestamp->Sec);
         
-        if (timestamp->Month < 10)
+        if (length != NULL)
         {
-            strcat(string, "0");
+            *length = RT_STRING_SIZE - 1;
         }
         
-        mi_utoa(timestamp->Month, t);
-        strcat(string, t);
-        strcat(string, "/");
-        
-        mi_utoa(timestamp->Year, t);
-        strcat(string, t);
-        strcat(string, " ");
-            
-        if (timestamp->Hour == 0)
+        result = RT_SUCCESS;
+    }
+    
+    return result;
+}
+
+uint8 rt_render(RT_TEXT *text, RT_DATA *timestamp, uint8 format)
+{
+    uint8 result = RT_BAD_ARGUMENT;
+    
+    if (text != NULL && timestamp != NULL)
+    {
+        if ((text->length != 0) && (text->format == format) &&
+            (text->timestamp.Min == timestamp->Min) &&
+            (text->timestamp.Hour == timestamp->Hour) &&
+            (text->timestamp.DayOfMonth == timestamp->DayOfMonth) &&
+            (text->timestamp.Month == timestamp->Month) &&
+            (text->timestamp.Year == timestamp->Year) &&
+            (timestamp->Sec < 100))
         {
-            strcpy(t, "00");
-            strcat(string, t);
+            _put_pair(&text->string[_SECOND], timestamp->Sec);
+            
+            result = RT_SUCCESS;
         }
-        else if (timestamp->Hour > 0 && timestamp->Hour < 10)
+        else
         {
-            strcpy(t, "0");
-            strcat(string, t);
-            mi_utoa(timestamp->Hour, t);
-            strcat(string, t);
+            result = rt_format(timestamp, text->string, format,
+                &text->length);
+        }
         
+        if (result == RT_SUCCESS)
+        {
+            text->timestamp = *timestamp;
+            text->format = format;
         }
         else
         {
-            mi_utoa(timestamp->Hour, t);
-            strcat(string, t);
+            text->length = 0;
         }
+    }
+    
+    return result;
+}
+
+uint8 rt_tick_start(void)
+{
+#ifdef HO_SHIM
+    _tick_base = ho_get_nanoseconds();
+#else
+    CY_SET_REG32(_SYST_CSR, 0);
+    
+    _ticks = 0;
+    _ticks_high = 0;
+    
+    CyIntSetSysVector(CY_INT_SYSTICK_IRQN, _tick_interrupt);
+    CY_SET_REG32(_SYST_RVR, BCLK__BUS_CLK__HZ / 1000 - 1);
+    CY_SET_REG32(_SYST_CVR, 0);
+    CY_SET_REG32(_SYST_CSR, _SYST_CSR_START);
+#endif
+    
+    return RT_SUCCESS;
+}
+
+uint8 rt_tick_stop(void)
+{
+#ifndef HO_SHIM
+    CY_SET_REG32(_SYST_CSR, 0);
+#endif
+    
+    return RT_SUCCESS;
+}
+
+uint32 rt_get_ticks(void)
+{
+#ifdef HO_SHIM
+    return (uint32)rt_get_ticks64();
+#else
+    return _ticks;
+#endif
+}
+
+unsigned long long rt_get_ticks64(void)
+{
+#ifdef HO_SHIM
+    return (ho_get_nanoseconds() - _tick_base) / 1000000ull;
+#else
+    uint32 high;
+    uint32 low;
+    
+    /*
+     *  Read the upper half again, in case the lower half wrapped whilst
+     *  the two were being read.
+     */
+    do
+    {
+        high = _ticks_high;
+        low = _ticks;
+    }
+    while (high != _ticks_high);
+    
+    return ((unsigned long long)high << 32) | low;
+#endif
+}
+
+uint8 rt_to_epoch(RT_DATA *timestamp, uint32 *seconds)
+{
+    uint32 days;
+    uint8 result = RT_BAD_ARGUMENT;
+    unsigned long long total;
+    
+    if (timestamp != NULL && seconds != NULL &&
+        timestamp->Year >= RT_EPOCH_YEAR &&
+        timestamp->Month >= 1 && timestamp->Month <= 12 &&
+        timestamp->DayOfMonth >= 1 &&
+        timestamp->DayOfMonth <=
+        _get_month_days(timestamp->Month, timestamp->Year) &&
+        timestamp->Hour < 24 && timestamp->Min < 60 && timestamp->Sec < 60)
+    {
+        days = _get_year_days(timestamp->Year) +
+            _MONTH_START[timestamp->Month - 1] + timestamp->DayOfMonth - 1;
         
-        strcat(string, ":");
-        
-        if (timestamp->Min == 0)
+        if (timestamp->Month > 2)
         {
-            strcpy(t, "00");
-            strcat(string, t);
+            days += _is_leap(timestamp->Year);
         }
-        else if (timestamp->Min > 0 && timestamp->Min < 10)
-        {
-            strcpy(t, "0");
-            strcat(string, t);
-            mi_utoa(timestamp->Min, t);
-            strcat(string, t);
         
-        }
-        else
+        total = (unsigned long long)days * _DAY_SECONDS +
+            timestamp->Hour * 3600ul + timestamp->Min * 60ul +
+            timestamp->Sec;
+        
+        if (total <= 0xffffffffull)
         {
-            mi_utoa(timestamp->Min, t);
-            strcat(string, t);
+            *seconds = (uint32)total;
+            
+            result = RT_SUCCESS;
         }
+    }
+    
+    return result;
+}
+
+uint8 rt_from_epoch(uint32 seconds, RT_DATA *timestamp)
+{
+    uint32 days = seconds / _DAY_SECONDS;
+    uint8 month = 1;
+    uint8 result = RT_BAD_ARGUMENT;
+    uint16 year;
+    
+    if (timestamp != NULL)
+    {
+        timestamp->Sec = seconds % 60;
+        timestamp->Min = (seconds / 60) % 60;
+        timestamp->Hour = (seconds / 3600) % 24;
         
-        strcat(string, ":");
+        /*
+         *  The first day of the epoch was a Monday.
+         */
+        timestamp->DayOfWeek = (days + 1) % 7 + 1;
         
-        if (timestamp->Sec == 0)
+        /*
+         *  No year is longer than 366 days, so this estimate is never
+         *  later than the year sought, and at most one year before it.
+         */
+        year = RT_EPOCH_YEAR + days / 366;
+        days -= _get_year_days(year);
+        
+        while (days >= 365u + _is_leap(year))
         {
-            strcpy(t, "00");
-            strcat(string,t);
+            days -= 365u + _is_leap(year);
+            ++year;
         }
-        else if (timestamp->Sec > 0 && timestamp->Sec < 10)
-        {
-            strcpy(t, "0");
-            strcat(string, t);
-            mi_utoa(timestamp->Sec, t);
-            strcat(string, t);
         
-        }
-        else
+        timestamp->Year = year;
+        timestamp->DayOfYear = days + 1;
+        
+        while (days >= _get_month_days(month, year))
         {
-            mi_utoa(timestamp->Sec, t);
-            strcat(string, t);
+            days -= _get_month_days(month, year);
+            ++month;
         }
         
+        timestamp->Month = month;
+        timestamp->DayOfMonth = days + 1;
+        
         result = RT_SUCCESS;
     }
     
@@ -359,6 +640,48 @@ uint8 rt_convert(RT_DATA *timestamp, char *string)
 /****************************************************************************
  *  Local Functions
  ****************************************************************************/
+void _put_pair(char *string, uint8 value)
+{
+    string[0] = _DIGITS[value * 2];
+    string[1] = _DIGITS[value * 2 + 1];
+}
+
+uint8 _is_leap(uint16 year)
+{
+    return ((year % 4 == 0) && (year % 100 != 0)) || (year % 400 == 0);
+}
+
+uint8 _get_month_days(uint8 month, uint16 year)
+{
+    uint8 days = _MONTH_DAYS[month - 1];
+    
+    if (month == 2)
+    {
+        days += _is_leap(year);
+    }
+    
+    return days;
+}
+
+uint32 _get_year_days(uint16 year)
+{
+    uint32 before = year - 1;
+    uint32 epoch = RT_EPOCH_YEAR - 1;
+    
+    return (uint32)(year - RT_EPOCH_YEAR) * 365 +
+        (before / 4 - before / 100 + before / 400) -
+        (epoch / 4 - epoch / 100 + epoch / 400);
+}
+
+#ifndef HO_SHIM
+CY_ISR(_tick_interrupt)
+{
+    if (++_ticks == 0)
+    {
+        ++_ticks_high;
+    }
+}
+#endif
 
 /****************************************************************************
  *  End of File
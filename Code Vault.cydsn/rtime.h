@@ -66,6 +66,34 @@
  *  the function rt_convert(). Finally, the library function rt_stop() stops
  *  the RTC component.
  *
+ *  Every string is #RT_STRING_SIZE - 1 characters long, so each field is
+ *  written directly into place. The function rt_format() also returns the
+ *  length of the string, and offers ISO 8601 as well as the day-first
+ *  format of rt_convert(). A display that shows the time once a second
+ *  may instead keep an RT_TEXT structure, initialised to zero, ie:
+ *
+ *  @code RT_TEXT rt_text = {0}; @endcode
+ *
+ *  The function rt_render() then formats temporal values into the structure,
+ *  and, if only the second has changed since the previous call, rewrites
+ *  just the two digits of the second.
+ *
+ *  <H3> Time Base </H3>
+ *
+ *  Reading the RTC component returns a whole RT_DATA structure, which is
+ *  costly to store and awkward to subtract. For timestamps taken in hot
+ *  paths, and for measuring intervals, the library also keeps a monotonic
+ *  count of milliseconds, started using rt_tick_start(). The function
+ *  rt_get_ticks() returns the count as a 32-bit value, and the difference
+ *  between two such values is the interval between them, even across a
+ *  wrap of the count. The function rt_get_ticks64() returns the full count,
+ *  which does not wrap.
+ *
+ *  Temporal values may be converted to and from a count of seconds since
+ *  the start of #RT_EPOCH_YEAR using the functions rt_to_epoch() and
+ *  rt_from_epoch(), so that the interval between two RT_DATA structures is
+ *  also found by subtraction.
+ *
  *  For further information about these library functions, please refer to
  *  the individual function documentation.
  *
@@ -80,6 +108,11 @@
  *  The PSoC5 module must be fitted with a 32.768kHz crystal, and the 'XTAL
  *  32kHz' source must be enabled in the clock section of the project design
  *  wide resource (*.cydwr) file.
+ *
+ *  The millisecond count is kept by the SysTick timer of the Cortex-M3,
+ *  clocked from the bus clock, which must not be used for any other purpose
+ *  while the count is running. On the workstation, the host shim supplies
+ *  the count from its monotonic clock instead.
  */
  
 /****************************************************************************
@@ -112,6 +145,29 @@
  */
 #define RT_BAD_ARGUMENT                 3
 
+/**
+ *  @brief The size of a converted string, including its terminator.
+ */
+#define RT_STRING_SIZE                  20
+
+/**
+ *  @brief Selects the format 'DD/MM/YYYY HH:MM:SS'.
+ */
+#define RT_FORMAT_DMY                   0
+
+/**
+ *  @brief Selects the ISO 8601 format 'YYYY-MM-DDTHH:MM:SS'.
+ */
+#define RT_FORMAT_ISO                   1
+
+/**
+ *  @brief The year in which epoch seconds start.
+ *
+ *  Epoch seconds count from 00:00:00 on 1 January of this year, as do NTP
+ *  timestamps, and reach their limit early on 7 February 2036.
+ */
+#define RT_EPOCH_YEAR                   1900
+
 /****************************************************************************
  *  Typedefs and Structures
  ****************************************************************************/
@@ -161,6 +217,34 @@ typedef struct RT_DATA
     uint16 Year;
 } RT_DATA;
 
+/**
+ *  @brief A converted string, together with the values it was converted
+ *      from.
+ */
+typedef struct RT_TEXT
+{
+    /**
+     *  @brief The converted string.
+     */
+    char string[RT_STRING_SIZE];
+    
+    /**
+     *  @brief The temporal values last converted.
+     */
+    RT_DATA timestamp;
+    
+    /**
+     *  @brief The format last used.
+     */
+    uint8 format;
+    
+    /**
+     *  @brief The length of the string, or zero if no values have been
+     *      converted.
+     */
+    uint8 length;
+} RT_TEXT;
+
 /****************************************************************************
  *  Exported Variables
  ****************************************************************************/
@@ -240,13 +324,102 @@ uint8 rt_set_time(uint8 hour, uint8 minute, uint8 second);
  *  @param[in] timestamp A pointer to the temporal values to convert.
  *  @param[out] string A pointer to the returned string.
  *  @return #RT_SUCCESS if successful, otherwise #RT_BAD_ARGUMENT.
- *  @remark String format is 'DD/MM/YYY HH:MM:SS' where 'DD' is the
+ *  @remark String format is 'DD/MM/YYYY HH:MM:SS' where 'DD' is the
  *      day value et cetera.
- *  @remark It is up to the caller to allocate sufficient space for the
- *      string.
+ *  @remark It is up to the caller to allocate at least #RT_STRING_SIZE
+ *      characters for the string.
+ *  @remark #RT_BAD_ARGUMENT is returned if the year is greater than 9999,
+ *      or any other value is greater than 99.
  */
 uint8 rt_convert(RT_DATA *timestamp, char *string);
 
+/**
+ *  @brief Convert temporal values to an ASCII string of a given format.
+ *  @param[in] timestamp A pointer to the temporal values to convert.
+ *  @param[out] string A pointer to the returned string.
+ *  @param[in] format The format of the string.
+ *
+ *  This member may be one of the following values.
+ *
+ *  Value                | Description
+ *  -------------------- | ------------------------------------
+ *  @b RT_FORMAT_DMY     | Selects 'DD/MM/YYYY HH:MM:SS'.
+ *  @b RT_FORMAT_ISO     | Selects 'YYYY-MM-DDTHH:MM:SS'.
+ *
+ *  @param[out] length A pointer to the returned length of the string.
+ *  @return #RT_SUCCESS if successful, otherwise #RT_BAD_ARGUMENT.
+ *  @remark The length parameter is optional, and may be set to NULL if
+ *      the length of the string is not required.
+ *  @remark It is up to the caller to allocate at least #RT_STRING_SIZE
+ *      characters for the string.
+ *  @remark #RT_BAD_ARGUMENT is returned if the year is greater than 9999,
+ *      or any other value is greater than 99.
+ */
+uint8 rt_format(RT_DATA *timestamp, char *string, uint8 format,
+    uint8 *length);
+
+/**
+ *  @brief Convert temporal values to an ASCII string held by an RT_TEXT
+ *      structure.
+ *  @param[in,out] text A pointer to the structure.
+ *  @param[in] timestamp A pointer to the temporal values to convert.
+ *  @param[in] format The format of the string, as for rt_format().
+ *  @return #RT_SUCCESS if successful, otherwise #RT_BAD_ARGUMENT.
+ *  @remark If the format and every value other than the second match the
+ *      previous call, only the second is rewritten.
+ *  @remark The day of the week and the day of the year are not compared.
+ */
+uint8 rt_render(RT_TEXT *text, RT_DATA *timestamp, uint8 format);
+
+/**
+ *  @brief Start the millisecond count.
+ *  @return #RT_SUCCESS.
+ *  @remark The count starts from zero.
+ */
+uint8 rt_tick_start(void);
+
+/**
+ *  @brief Stop the millisecond count.
+ *  @return #RT_SUCCESS.
+ */
+uint8 rt_tick_stop(void);
+
+/**
+ *  @brief Get the millisecond count.
+ *  @return The number of milliseconds since rt_tick_start() was called,
+ *      modulo 2^32.
+ */
+uint32 rt_get_ticks(void);
+
+/**
+ *  @brief Get the full millisecond count.
+ *  @return The number of milliseconds since rt_tick_start() was called.
+ */
+unsigned long long rt_get_ticks64(void);
+
+/**
+ *  @brief Convert temporal values to epoch seconds.
+ *  @param[in] timestamp A pointer to the temporal values to convert.
+ *  @param[out] seconds A pointer to the returned number of seconds since
+ *      the start of #RT_EPOCH_YEAR.
+ *  @return #RT_SUCCESS if successful, otherwise #RT_BAD_ARGUMENT.
+ *  @remark The day of the week and the day of the year are ignored.
+ *  @remark #RT_BAD_ARGUMENT is returned if any value is out of range, or
+ *      if the number of seconds does not fit in 32 bits.
+ */
+uint8 rt_to_epoch(RT_DATA *timestamp, uint32 *seconds);
+
+/**
+ *  @brief Convert epoch seconds to temporal values.
+ *  @param[in] seconds The number of seconds since the start of
+ *      #RT_EPOCH_YEAR.
+ *  @param[out] timestamp A pointer to the returned temporal values.
+ *  @return #RT_SUCCESS if successful, otherwise #RT_BAD_ARGUMENT.
+ *  @remark Every value is set, with the day of the week counting from one
+ *      on Sunday, as it does for the RTC component.
+ */
+uint8 rt_from_epoch(uint32 seconds, RT_DATA *timestamp);
+
 #endif
 
 /****************************************************************************
@@ -77,8 +77,14 @@
 uint8 rtt_test_1(void)
 {
     RT_DATA data_0;
+    RT_DATA data_1;
+    uint8 length_0;
     uint8 result = RTT_SUCCESS;
-    char string[20] = {0};
+    uint32 seconds_0;
+    char string[RT_STRING_SIZE] = {0};
+    RT_TEXT text_0 = {{0}};
+    uint32 ticks_0;
+    uint32 ticks_1;
         
     UART_1_Start();
     
@@ -712,6 +718,532 @@ uint8 rtt_test_1(void)
             result = RTT_FAILURE;
         }
     }
+    
+    /*
+     *  Test rt_format().
+     */
+    if (result == RTT_SUCCESS)
+    {
+        if (rt_format(NULL, string, RT_FORMAT_DMY, NULL) == RT_BAD_ARGUMENT)
+        {
+            UART_1_PutString("  26\trt_format()\t\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("  26\trt_format()\t\tFAIL\r\n");
+            result = RTT_FAILURE;
+        }
+    }
+    
+    if (result == RTT_SUCCESS)
+    {
+        if (rt_format(&data_0, NULL, RT_FORMAT_DMY, NULL) ==
+            RT_BAD_ARGUMENT)
+        {
+            UART_1_PutString("  27\trt_format()\t\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("  27\trt_format()\t\tFAIL\r\n");
+            result = RTT_FAILURE;
+        }
+    }
+    
+    if (result == RTT_SUCCESS)
+    {
+        if (rt_format(&data_0, string, RT_FORMAT_ISO + 1, NULL) ==
+            RT_BAD_ARGUMENT)
+        {
+            UART_1_PutString("  28\trt_format()\t\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("  28\trt_format()\t\tFAIL\r\n");
+            result = RTT_FAILURE;
+        }
+    }
+    
+    if (result == RTT_SUCCESS)
+    {
+        data_0.Hour = 100;
+        
+        if (rt_format(&data_0, string, RT_FORMAT_DMY, NULL) ==
+            RT_BAD_ARGUMENT)
+        {
+            UART_1_PutString("  29\trt_format()\t\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("  29\trt_format()\t\tFAIL\r\n");
+            result = RTT_FAILURE;
+        }
+    }
+    
+    if (result == RTT_SUCCESS)
+    {
+        data_0.Hour = 23;
+        data_0.Min = 59;
+        data_0.Sec = 9;
+        
+        if ((rt_format(&data_0, string, RT_FORMAT_ISO, &length_0) ==
+            RT_SUCCESS) &&
+            (length_0 == RT_STRING_SIZE - 1))
+        {
+            UART_1_PutString("  30\trt_format()\t\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("  30\trt_format()\t\tFAIL\r\n");
+            result = RTT_FAILURE;
+        }
+    }
+    
+    if (result == RTT_SUCCESS)
+    {
+        if (strcmp(string, "2013-12-11T23:59:09") == 0)
+        {
+            UART_1_PutString("  31\trt_format()\t\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("  31\trt_format()\t\tFAIL\r\n");
+            result = RTT_FAILURE;
+        }
+    }
+    
+    if (result == RTT_SUCCESS)
+    {
+        rt_format(&data_0, string, RT_FORMAT_DMY, NULL);
+        
+        if (strcmp(string, "11/12/2013 23:59:09") == 0)
+        {
+            UART_1_PutString("  32\trt_format()\t\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("  32\trt_format()\t\tFAIL\r\n");
+            result = RTT_FAILURE;
+        }
+    }
+    
+    /*
+     *  Test rt_render().
+     */
+    if (result == RTT_SUCCESS)
+    {
+        if (rt_render(NULL, &data_0, RT_FORMAT_DMY) == RT_BAD_ARGUMENT)
+        {
+            UART_1_PutString("  33\trt_render()\t\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("  33\trt_render()\t\tFAIL\r\n");
+            result = RTT_FAILURE;
+        }
+    }
+    
+    if (result == RTT_SUCCESS)
+    {
+        if (rt_render(&text_0, NULL, RT_FORMAT_DMY) == RT_BAD_ARGUMENT)
+        {
+            UART_1_PutString("  34\trt_render()\t\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("  34\trt_render()\t\tFAIL\r\n");
+            result = RTT_FAILURE;
+        }
+    }
+    
+    if (result == RTT_SUCCESS)
+    {
+        if ((rt_render(&text_0, &data_0, RT_FORMAT_DMY) == RT_SUCCESS) &&
+            (text_0.length == RT_STRING_SIZE - 1))
+        {
+            UART_1_PutString("  35\trt_render()\t\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("  35\trt_render()\t\tFAIL\r\n");
+            result = RTT_FAILURE;
+        }
+    }
+    
+    if (result == RTT_SUCCESS)
+    {
+        if (strcmp(text_0.string, "11/12/2013 23:59:09") == 0)
+        {
+            UART_1_PutString("  36\trt_render()\t\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("  36\trt_render()\t\tFAIL\r\n");
+            result = RTT_FAILURE;
+        }
+    }
+    
+    if (result == RTT_SUCCESS)
+    {
+        data_0.Sec = 10;
+        rt_render(&text_0, &data_0, RT_FORMAT_DMY);
+        
+        if (strcmp(text_0.string, "11/12/2013 23:59:10") == 0)
+        {
+            UART_1_PutString("  37\trt_render()\t\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("  37\trt_render()\t\tFAIL\r\n");
+            result = RTT_FAILURE;
+        }
+    }
+    
+    if (result == RTT_SUCCESS)
+    {
+        data_0.DayOfMonth = 12;
+        data_0.Hour = 0;
+        data_0.Min = 0;
+        data_0.Sec = 0;
+        rt_render(&text_0, &data_0, RT_FORMAT_DMY);
+        
+        if (strcmp(text_0.string, "12/12/2013 00:00:00") == 0)
+        {
+            UART_1_PutString("  38\trt_render()\t\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("  38\trt_render()\t\tFAIL\r\n");
+            result = RTT_FAILURE;
+        }
+    }
+    
+    if (result == RTT_SUCCESS)
+    {
+        rt_render(&text_0, &data_0, RT_FORMAT_ISO);
+        
+        if (strcmp(text_0.string, "2013-12-12T00:00:00") == 0)
+        {
+            UART_1_PutString("  39\trt_render()\t\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("  39\trt_render()\t\tFAIL\r\n");
+            result = RTT_FAILURE;
+        }
+    }
+    
+    if (result == RTT_SUCCESS)
+    {
+        data_0.Sec = 100;
+        
+        if ((rt_render(&text_0, &data_0, RT_FORMAT_ISO) == RT_BAD_ARGUMENT) &&
+            (text_0.length == 0))
+        {
+            UART_1_PutString("  40\trt_render()\t\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("  40\trt_render()\t\tFAIL\r\n");
+            result = RTT_FAILURE;
+        }
+    }
+    
+    /*
+     *  Test rt_to_epoch().
+     */
+    if (result == RTT_SUCCESS)
+    {
+        if (rt_to_epoch(NULL, &seconds_0) == RT_BAD_ARGUMENT)
+        {
+            UART_1_PutString("  41\trt_to_epoch()\t\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("  41\trt_to_epoch()\t\tFAIL\r\n");
+            result = RTT_FAILURE;
+        }
+    }
+    
+    if (result == RTT_SUCCESS)
+    {
+        if (rt_to_epoch(&data_1, NULL) == RT_BAD_ARGUMENT)
+        {
+            UART_1_PutString("  42\trt_to_epoch()\t\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("  42\trt_to_epoch()\t\tFAIL\r\n");
+            result = RTT_FAILURE;
+        }
+    }
+    
+    if (result == RTT_SUCCESS)
+    {
+        data_1.DayOfMonth = 1;
+        data_1.Month = 1;
+        data_1.Year = 1900;
+        data_1.Hour = 0;
+        data_1.Min = 0;
+        data_1.Sec = 0;
+        
+        if ((rt_to_epoch(&data_1, &seconds_0) == RT_SUCCESS) &&
+            (seconds_0 == 0))
+        {
+            UART_1_PutString("  43\trt_to_epoch()\t\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("  43\trt_to_epoch()\t\tFAIL\r\n");
+            result = RTT_FAILURE;
+        }
+    }
+    
+    if (result == RTT_SUCCESS)
+    {
+        data_1.DayOfMonth = 11;
+        data_1.Month = 11;
+        data_1.Year = 1918;
+        data_1.Hour = 11;
+        rt_to_epoch(&data_1, &seconds_0);
+        
+        if (seconds_0 == 595162800ul)
+        {
+            UART_1_PutString("  44\trt_to_epoch()\t\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("  44\trt_to_epoch()\t\tFAIL\r\n");
+            result = RTT_FAILURE;
+        }
+    }
+    
+    if (result == RTT_SUCCESS)
+    {
+        data_1.DayOfMonth = 29;
+        data_1.Month = 2;
+        data_1.Year = 1900;
+        
+        if (rt_to_epoch(&data_1, &seconds_0) == RT_BAD_ARGUMENT)
+        {
+            UART_1_PutString("  45\trt_to_epoch()\t\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("  45\trt_to_epoch()\t\tFAIL\r\n");
+            result = RTT_FAILURE;
+        }
+    }
+    
+    if (result == RTT_SUCCESS)
+    {
+        data_1.Year = 2000;
+        data_1.Hour = 23;
+        data_1.Min = 59;
+        data_1.Sec = 59;
+        
+        if ((rt_to_epoch(&data_1, &seconds_0) == RT_SUCCESS) &&
+            (seconds_0 == 3160857599ul))
+        {
+            UART_1_PutString("  46\trt_to_epoch()\t\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("  46\trt_to_epoch()\t\tFAIL\r\n");
+            result = RTT_FAILURE;
+        }
+    }
+    
+    if (result == RTT_SUCCESS)
+    {
+        data_1.DayOfMonth = 7;
+        data_1.Year = 2036;
+        data_1.Hour = 6;
+        data_1.Min = 28;
+        data_1.Sec = 16;
+        
+        if (rt_to_epoch(&data_1, &seconds_0) == RT_BAD_ARGUMENT)
+        {
+            UART_1_PutString("  47\trt_to_epoch()\t\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("  47\trt_to_epoch()\t\tFAIL\r\n");
+            result = RTT_FAILURE;
+        }
+    }
+    
+    if (result == RTT_SUCCESS)
+    {
+        data_1.Sec = 15;
+        
+        if ((rt_to_epoch(&data_1, &seconds_0) == RT_SUCCESS) &&
+            (seconds_0 == 0xfffffffful))
+        {
+            UART_1_PutString("  48\trt_to_epoch()\t\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("  48\trt_to_epoch()\t\tFAIL\r\n");
+            result = RTT_FAILURE;
+        }
+    }
+    
+    if (result == RTT_SUCCESS)
+    {
+        data_1.Month = 13;
+        
+        if (rt_to_epoch(&data_1, &seconds_0) == RT_BAD_ARGUMENT)
+        {
+            UART_1_PutString("  49\trt_to_epoch()\t\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("  49\trt_to_epoch()\t\tFAIL\r\n");
+            result = RTT_FAILURE;
+        }
+    }
+    
+    /*
+     *  Test rt_from_epoch().
+     */
+    if (result == RTT_SUCCESS)
+    {
+        if (rt_from_epoch(0, NULL) == RT_BAD_ARGUMENT)
+        {
+            UART_1_PutString("  50\trt_from_epoch()\t\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("  50\trt_from_epoch()\t\tFAIL\r\n");
+            result = RTT_FAILURE;
+        }
+    }
+    
+    if (result == RTT_SUCCESS)
+    {
+        if ((rt_from_epoch(0, &data_1) == RT_SUCCESS) &&
+            (data_1.Year == 1900) &&
+            (data_1.Month == 1) &&
+            (data_1.DayOfMonth == 1) &&
+            (data_1.DayOfWeek == 2) &&
+            (data_1.DayOfYear == 1))
+        {
+            UART_1_PutString("  51\trt_from_epoch()\t\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("  51\trt_from_epoch()\t\tFAIL\r\n");
+            result = RTT_FAILURE;
+        }
+    }
+    
+    if (result == RTT_SUCCESS)
+    {
+        rt_from_epoch(3160857599ul, &data_1);
+        
+        if ((data_1.Year == 2000) &&
+            (data_1.Month == 2) &&
+            (data_1.DayOfMonth == 29) &&
+            (data_1.DayOfWeek == 3) &&
+            (data_1.DayOfYear == 60) &&
+            (data_1.Hour == 23))
+        {
+            UART_1_PutString("  52\trt_from_epoch()\t\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("  52\trt_from_epoch()\t\tFAIL\r\n");
+            result = RTT_FAILURE;
+        }
+    }
+    
+    if (result == RTT_SUCCESS)
+    {
+        rt_from_epoch(0xfffffffful, &data_1);
+        
+        if ((data_1.Year == 2036) &&
+            (data_1.Month == 2) &&
+            (data_1.DayOfMonth == 7) &&
+            (data_1.Hour == 6) &&
+            (data_1.Min == 28) &&
+            (data_1.Sec == 15))
+        {
+            UART_1_PutString("  53\trt_from_epoch()\t\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("  53\trt_from_epoch()\t\tFAIL\r\n");
+            result = RTT_FAILURE;
+        }
+    }
+    
+    /*
+     *  Test rt_tick_start().
+     */
+    if (result == RTT_SUCCESS)
+    {
+        if (rt_tick_start() == RT_SUCCESS)
+        {
+            UART_1_PutString("  54\trt_tick_start()\t\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("  54\trt_tick_start()\t\tFAIL\r\n");
+            result = RTT_FAILURE;
+        }
+    }
+    
+    /*
+     *  Test rt_get_ticks().
+     */
+    if (result == RTT_SUCCESS)
+    {
+        ticks_0 = rt_get_ticks();
+        CyDelay(2);
+        ticks_1 = rt_get_ticks();
+        
+        if (ticks_1 - ticks_0 < 1000)
+        {
+            UART_1_PutString("  55\trt_get_ticks()\t\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("  55\trt_get_ticks()\t\tFAIL\r\n");
+            result = RTT_FAILURE;
+        }
+    }
+    
+    /*
+     *  Test rt_get_ticks64().
+     */
+    if (result == RTT_SUCCESS)
+    {
+        if (rt_get_ticks64() >= ticks_1)
+        {
+            UART_1_PutString("  56\trt_get_ticks64()\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("  56\trt_get_ticks64()\tFAIL\r\n");
+            result = RTT_FAILURE;
+        }
+    }
+    
+    /*
+     *  Test rt_tick_stop().
+     */
+    if (result == RTT_SUCCESS)
+    {
+        if (rt_tick_stop() == RT_SUCCESS)
+        {
+            UART_1_PutString("  57\trt_tick_stop()\t\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("  57\trt_tick_stop()\t\tFAIL\r\n");
+            result = RTT_FAILURE;
+        }
+    }
      
     /*
      *  Report test result.
@@ -99,6 +99,38 @@
  *     -    Initialise test...      PASS
  *    24    rt_convert()            PASS
  *    25    rt_convert()            PASS
+ *    26    rt_format()             PASS
+ *    27    rt_format()             PASS
+ *    28    rt_format()             PASS
+ *    29    rt_format()             PASS
+ *    30    rt_format()             PASS
+ *    31    rt_format()             PASS
+ *    32    rt_format()             PASS
+ *    33    rt_render()             PASS
+ *    34    rt_render()             PASS
+ *    35    rt_render()             PASS
+ *    36    rt_render()             PASS
+ *    37    rt_render()             PASS
+ *    38    rt_render()             PASS
+ *    39    rt_render()             PASS
+ *    40    rt_render()             PASS
+ *    41    rt_to_epoch()           PASS
+ *    42    rt_to_epoch()           PASS
+ *    43    rt_to_epoch()           PASS
+ *    44    rt_to_epoch()           PASS
+ *    45    rt_to_epoch()           PASS
+ *    46    rt_to_epoch()           PASS
+ *    47    rt_to_epoch()           PASS
+ *    48    rt_to_epoch()           PASS
+ *    49    rt_to_epoch()           PASS
+ *    50    rt_from_epoch()         PASS
+ *    51    rt_from_epoch()         PASS
+ *    52    rt_from_epoch()         PASS
+ *    53    rt_from_epoch()         PASS
+ *    54    rt_tick_start()         PASS
+ *    55    rt_get_ticks()          PASS
+ *    56    rt_get_ticks64()        PASS
+ *    57    rt_tick_stop()          PASS
  *
  *  TEST PASSED
  *  @endcode
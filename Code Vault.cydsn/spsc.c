@@ -0,0 +1,226 @@
+/****************************************************************************
+ *
+ *  File:           spsc.c
+ *  Module:         Single-Producer Single-Consumer Ring Library
+ *  Project:        Code Vault
+ *  Workspace:      PSoC Tools
+ *
+ *  Author:         Rodney B. Elliott
+ *  Date:           16 October 2026
+ *
+ ****************************************************************************
+ *
+ *  Copyright:      2013 Rodney B. Elliott
+ *
+ *  This file is part of PSoC Tools.
+ *
+ *  PSoC Tools is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  PSoC Tools is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with PSoC Tools. If not, see <http://www.gnu.org/licenses/>.
+ *
+ ****************************************************************************/
+/**
+ *  @file spsc.c
+ *  @brief Single-producer single-consumer ring library implementation.
+ */
+
+/****************************************************************************
+ *  Modules
+ ****************************************************************************/
+#include <device.h>
+#include <string.h>
+
+#include "spsc.h"
+
+/****************************************************************************
+ *  Definitions and Macros
+ ****************************************************************************/
+/**
+ *  @brief Prevent memory accesses from being reordered across the barrier.
+ *
+ *  C11 fences are used where the compiler supports them. Otherwise the GCC
+ *  full barrier builtin, or failing that the CMSIS data memory barrier, is
+ *  used instead.
+ */
+#if defined(__STDC_VERSION__) && (__STDC_VERSION__ >= 201112L) && \
+    !defined(__STDC_NO_ATOMICS__)
+#include <stdatomic.h>
+#define _BARRIER() \
+    atomic_thread_fence(memory_order_seq_cst)
+#elif defined(__GNUC__)
+#define _BARRIER()                      __sync_synchronize()
+#else
+#define _BARRIER()                      __DMB()
+#endif
+
+/****************************************************************************
+ *  Typedefs and Structures
+ ****************************************************************************/
+
+/****************************************************************************
+ *  Prototypes of Local Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ *  Exported Variables
+ ****************************************************************************/
+
+/****************************************************************************
+ *  Global Variables
+ ****************************************************************************/
+
+/****************************************************************************
+ *  Exported Functions
+ ****************************************************************************/
+uint8 sp_init(SP_RING *ring, void *elements, uint32 size, uint16 width)
+{
+    uint8 result = SP_BAD_ARGUMENT;
+    
+    if (ring != NULL && elements != NULL && width != 0 &&
+        size != 0 && (size & (size - 1)) == 0)
+    {
+        ring->head = 0;
+        ring->tail = 0;
+        ring->dropped = 0;
+        ring->elements = elements;
+        ring->size = size;
+        ring->width = width;
+        
+        result = SP_SUCCESS;
+    }
+    
+    return result;
+}
+
+uint8 sp_put(SP_RING *ring, void *element)
+{
+    uint32 head;
+    uint8 result = SP_BAD_ARGUMENT;
+    
+    if (ring != NULL && element != NULL)
+    {
+        head = ring->head;
+        
+        if (head - ring->tail < ring->size)
+        {
+            memcpy(ring->elements + (head & (ring->size - 1)) * ring->width,
+                element, ring->width);
+            
+            /*
+             *  The element must be complete before the consumer is able to
+             *  see the new head.
+             */
+            _BARRIER();
+            
+            ring->head = head + 1;
+            
+            result = SP_SUCCESS;
+        }
+        else
+        {
+            ++ring->dropped;
+            
+            result = SP_FULL;
+        }
+    }
+    
+    return result;
+}
+
+uint8 sp_get(SP_RING *ring, void *element)
+{
+    uint32 tail;
+    uint8 result = SP_BAD_ARGUMENT;
+    
+    if (ring != NULL)
+    {
+        tail = ring->tail;
+        
+        if (ring->head != tail)
+        {
+            /*
+             *  The element must not be read before the head that published
+             *  it, nor released to the producer before it has been read.
+             */
+            _BARRIER();
+            
+            if (element != NULL)
+            {
+                memcpy(element,
+                    ring->elements + (tail & (ring->size - 1)) * ring->width,
+                    ring->width);
+            }
+            
+            _BARRIER();
+            
+            ring->tail = tail + 1;
+            
+            result = SP_SUCCESS;
+        }
+        else
+        {
+            result = SP_EMPTY;
+        }
+    }
+    
+    return result;
+}
+
+uint32 sp_get_count(SP_RING *ring)
+{
+    uint32 count = 0;
+    uint32 tail;
+    
+    if (ring != NULL)
+    {
+        tail = ring->tail;
+        count = ring->head - tail;
+    }
+    
+    return count;
+}
+
+uint32 sp_get_dropped(SP_RING *ring)
+{
+    uint32 dropped = 0;
+    
+    if (ring != NULL)
+    {
+        dropped = ring->dropped;
+    }
+    
+    return dropped;
+}
+
+uint8 sp_flush(SP_RING *ring)
+{
+    uint8 result = SP_BAD_ARGUMENT;
+    
+    if (ring != NULL)
+    {
+        _BARRIER();
+        
+        ring->tail = ring->head;
+        
+        result = SP_SUCCESS;
+    }
+    
+    return result;
+}
+
+/****************************************************************************
+ *  Local Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ *  End of File
+ ****************************************************************************/
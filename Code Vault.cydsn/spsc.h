@@ -0,0 +1,254 @@
+/****************************************************************************
+ *
+ *  File:           spsc.h
+ *  Module:         Single-Producer Single-Consumer Ring Library
+ *  Project:        Code Vault
+ *  Workspace:      PSoC Tools
+ *
+ *  Author:         Rodney B. Elliott
+ *  Date:           16 October 2026
+ *
+ ****************************************************************************
+ *
+ *  Copyright:      2013 Rodney B. Elliott
+ *
+ *  This file is part of PSoC Tools.
+ *
+ *  PSoC Tools is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  PSoC Tools is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with PSoC Tools. If not, see <http://www.gnu.org/licenses/>.
+ *
+ ****************************************************************************/
+#ifndef SPSC_H
+#define SPSC_H
+/**
+ *  @file spsc.h
+ *  @brief Single-producer single-consumer ring library interface.
+ *
+ *  <H3> Introduction </H3>
+ *
+ *  The single-producer single-consumer ring library is a collection of
+ *  functions that enable the programmer to pass fixed-size elements from an
+ *  interrupt service routine (ISR) to the main loop of their project without
+ *  disabling interrupts.
+ *
+ *  A single-producer single-consumer (SPSC) ring is a ring buffer in which
+ *  exactly one context adds elements and exactly one other context removes
+ *  them. The producer only ever writes the ring's head index, and the
+ *  consumer only ever writes its tail index. Provided that each index is
+ *  read and written in a single access, and that a memory barrier separates
+ *  the copying of an element from the update of the index that publishes
+ *  it, neither context is ever able to observe a partially added or removed
+ *  element. Unlike the circular buffer library, the ring therefore requires
+ *  no critical sections - an ISR may add an element at any point, including
+ *  whilst the main loop is part way through removing one.
+ *
+ *  The elements of a ring are copied into and out of an array supplied by
+ *  the programmer, so no memory is allocated by the library. The number of
+ *  elements in the array must be a power of two. Should the producer add an
+ *  element to a full ring, the element is discarded and the ring's dropped
+ *  element count incremented, so that the oldest unread elements are never
+ *  overwritten underneath the consumer.
+ *
+ *  <H3> Use </H3>
+ *
+ *  In order to use the library, the programmer must start by declaring an
+ *  instance of an SP_RING structure, together with an array of elements,
+ *  with scope appropriate to the intended application. Both must then be
+ *  passed to sp_init(), ie:
+ *
+ *  @code
+ *  SP_RING sp_ring;
+ *  MY_ELEMENT sp_elements[16];
+ *
+ *  sp_init(&sp_ring, sp_elements, 16, sizeof(MY_ELEMENT));
+ *  @endcode
+ *
+ *  The ring must be initialised before the producer is started. Thereafter,
+ *  the producer adds elements using sp_put(), and the consumer removes them
+ *  using sp_get(). The functions sp_get_count() and sp_get_dropped() return
+ *  the number of elements in the ring and the number of elements discarded
+ *  because the ring was full respectively, whilst sp_flush() enables the
+ *  consumer to discard every element in the ring.
+ *
+ *  For further information about these library functions, please refer to the
+ *  individual function documentation. For examples of their use, please see
+ *  the SPSC ring test library.
+ *
+ *  <H3> Hardware </H3>
+ *
+ *  The SPSC ring library has no hardware requirements.
+ *
+ *  <H3> Further Reading </H3>
+ *
+ *  Circular buffer library (cbuff.h)
+ *
+ *  <a href = "http://en.wikipedia.org/wiki/Memory_barrier">
+ *      Memory barrier (Wikipedia) </a>
+ */
+
+/****************************************************************************
+ *  Modules
+ ****************************************************************************/
+
+/****************************************************************************
+ *  Definitions and Macros
+ ****************************************************************************/
+/**
+ *  @brief Generic success.
+ */
+#define SP_SUCCESS                      0
+
+/**
+ *  @brief Generic failure.
+ */
+#define SP_FAILURE                      1
+
+/**
+ *  @brief A bad argument was passed to a function.
+ */
+#define SP_BAD_ARGUMENT                 3
+
+/**
+ *  @brief The SPSC ring is empty.
+ */
+#define SP_EMPTY                        4
+
+/**
+ *  @brief The SPSC ring is full.
+ */
+#define SP_FULL                         5
+
+/****************************************************************************
+ *  Typedefs and Structures
+ ****************************************************************************/
+/**
+ *  @brief A single-producer single-consumer (SPSC) ring.
+ */
+typedef struct SP_RING
+{
+    /**
+     *  @brief The number of elements ever added to the SPSC ring.
+     *
+     *  Only ever written by the producer.
+     */
+    volatile uint32 head;
+    
+    /**
+     *  @brief The number of elements ever removed from the SPSC ring.
+     *
+     *  Only ever written by the consumer.
+     */
+    volatile uint32 tail;
+    
+    /**
+     *  @brief The number of elements discarded because the ring was full.
+     *
+     *  Only ever written by the producer.
+     */
+    volatile uint32 dropped;
+    
+    /**
+     *  @brief A pointer to the array of elements.
+     */
+    uint8 *elements;
+    
+    /**
+     *  @brief The number of elements in the array.
+     */
+    uint32 size;
+    
+    /**
+     *  @brief The size of each element in bytes.
+     */
+    uint16 width;
+} SP_RING;
+
+/****************************************************************************
+ *  Exported Variables
+ ****************************************************************************/
+
+/****************************************************************************
+ *  Exported Functions
+ ****************************************************************************/
+/**
+ *  @brief Initialise an SPSC ring.
+ *  @param[out] ring A pointer to an SPSC ring.
+ *  @param[in] elements A pointer to an array of elements.
+ *  @param[in] size The number of elements in the array.
+ *  @param[in] width The size of each element in bytes.
+ *  @return #SP_SUCCESS if successful, otherwise #SP_BAD_ARGUMENT.
+ *  @remark The size argument must be a power of two, and the width argument
+ *      must not be zero.
+ *  @warning Initialising a ring whilst its producer is running would be a
+ *      <B> very bad thing. </B>
+ */
+uint8 sp_init(SP_RING *ring, void *elements, uint32 size, uint16 width);
+
+/**
+ *  @brief Add an element to an SPSC ring.
+ *  @param[in] ring A pointer to an SPSC ring.
+ *  @param[in] element A pointer to the element to be copied into the ring.
+ *  @return #SP_SUCCESS if successful, otherwise #SP_BAD_ARGUMENT or
+ *      #SP_FULL.
+ *  @remark If the ring is full, the element is discarded and the dropped
+ *      element count incremented.
+ *  @warning This function must only be called by the producer.
+ */
+uint8 sp_put(SP_RING *ring, void *element);
+
+/**
+ *  @brief Remove the oldest element from an SPSC ring.
+ *  @param[in] ring A pointer to an SPSC ring.
+ *  @param[out] element A pointer to the memory into which the element is to
+ *      be copied.
+ *  @return #SP_SUCCESS if successful, otherwise #SP_BAD_ARGUMENT or
+ *      #SP_EMPTY.
+ *  @remark The element parameter is optional, and may be set to NULL if the
+ *      element is not required.
+ *  @warning This function must only be called by the consumer.
+ */
+uint8 sp_get(SP_RING *ring, void *element);
+
+/**
+ *  @brief Get the element count of an SPSC ring.
+ *  @param[in] ring A pointer to an SPSC ring.
+ *  @return The number of elements in the SPSC ring.
+ *  @remark If the ring argument is NULL, a count of zero will be returned.
+ *  @remark When called by the consumer, the count returned is the minimum
+ *      number of elements that may be removed.
+ */
+uint32 sp_get_count(SP_RING *ring);
+
+/**
+ *  @brief Get the dropped element count of an SPSC ring.
+ *  @param[in] ring A pointer to an SPSC ring.
+ *  @return The number of elements discarded because the ring was full.
+ *  @remark If the ring argument is NULL, a count of zero will be returned.
+ */
+uint32 sp_get_dropped(SP_RING *ring);
+
+/**
+ *  @brief Remove every element from an SPSC ring.
+ *  @param[in] ring A pointer to an SPSC ring.
+ *  @return #SP_SUCCESS if successful, otherwise #SP_BAD_ARGUMENT.
+ *  @remark Elements added by the producer whilst this function is running
+ *      may or may not be removed.
+ *  @warning This function must only be called by the consumer.
+ */
+uint8 sp_flush(SP_RING *ring);
+
+#endif
+
+/****************************************************************************
+ *  End of File
+ ****************************************************************************/
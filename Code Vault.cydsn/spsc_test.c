@@ -0,0 +1,504 @@
+/****************************************************************************
+ *
+ *  File:           spsc_test.c
+ *  Module:         Single-Producer Single-Consumer Ring Test Library
+ *  Project:        Code Vault
+ *  Workspace:      PSoC Tools
+ *
+ *  Author:         Rodney B. Elliott
+ *  Date:           16 October 2026
+ *
+ ****************************************************************************
+ *
+ *  Copyright:      2013 Rodney B. Elliott
+ *
+ *  This file is part of PSoC Tools.
+ *
+ *  PSoC Tools is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  PSoC Tools is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with PSoC Tools. If not, see <http://www.gnu.org/licenses/>.
+ *
+ ****************************************************************************/
+/**
+ *  @file spsc_test.c
+ *  @brief Single-producer single-consumer ring test library implementation.
+ */
+
+/****************************************************************************
+ *  Modules
+ ****************************************************************************/
+#include <device.h>
+
+#include "spsc.h"
+#include "spsc_test.h"
+
+/****************************************************************************
+ *  Definitions and Macros
+ ****************************************************************************/
+/**
+ *  @brief Cypress CY8CKIT-001 development kit serial RX output pin.
+ */
+#define _CY8CKIT_RX                     CYREG_PRT1_PC2
+
+/**
+ *  @brief Cypress CY8CKIT-001 development kit serial TX output pin.
+ */
+#define _CY8CKIT_TX                     CYREG_PRT1_PC7
+
+/****************************************************************************
+ *  Typedefs and Structures
+ ****************************************************************************/
+
+/****************************************************************************
+ *  Prototypes of Local Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ *  Exported Variables
+ ****************************************************************************/
+
+/****************************************************************************
+ *  Global Variables
+ ****************************************************************************/
+
+/****************************************************************************
+ *  Exported Functions
+ ****************************************************************************/
+uint8 spt_test_1(void)
+{
+    SP_RING ring;
+    uint16 element = 0;
+    uint16 elements[4];
+    uint8 count;
+    uint8 i;
+    uint8 result = SPT_SUCCESS;
+    
+    UART_1_Start();
+    
+    UART_1_PutString("\x1b\x5b\x32\x4a");
+    UART_1_PutString("SPSC RING LIBRARY TEST\r\n");
+    UART_1_PutString("\r\n");
+    UART_1_PutString("Test\tFunction\t\tResult\r\n");
+    UART_1_PutString("----\t--------\t\t------\r\n");
+    
+    /*
+     *  Test sp_init().
+     */
+    if (result == SPT_SUCCESS)
+    {
+        if (sp_init(NULL, elements, 4, sizeof(uint16)) == SP_BAD_ARGUMENT)
+        {
+            UART_1_PutString("   1\tsp_init()\t\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("   1\tsp_init()\t\tFAIL\r\n");
+            result = SPT_FAILURE;
+        }
+    }
+    
+    if (result == SPT_SUCCESS)
+    {
+        if (sp_init(&ring, NULL, 4, sizeof(uint16)) == SP_BAD_ARGUMENT)
+        {
+            UART_1_PutString("   2\tsp_init()\t\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("   2\tsp_init()\t\tFAIL\r\n");
+            result = SPT_FAILURE;
+        }
+    }
+    
+    if (result == SPT_SUCCESS)
+    {
+        if (sp_init(&ring, elements, 3, sizeof(uint16)) == SP_BAD_ARGUMENT)
+        {
+            UART_1_PutString("   3\tsp_init()\t\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("   3\tsp_init()\t\tFAIL\r\n");
+            result = SPT_FAILURE;
+        }
+    }
+    
+    if (result == SPT_SUCCESS)
+    {
+        if (sp_init(&ring, elements, 4, 0) == SP_BAD_ARGUMENT)
+        {
+            UART_1_PutString("   4\tsp_init()\t\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("   4\tsp_init()\t\tFAIL\r\n");
+            result = SPT_FAILURE;
+        }
+    }
+    
+    if (result == SPT_SUCCESS)
+    {
+        if (sp_init(&ring, elements, 4, sizeof(uint16)) == SP_SUCCESS)
+        {
+            UART_1_PutString("   5\tsp_init()\t\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("   5\tsp_init()\t\tFAIL\r\n");
+            result = SPT_FAILURE;
+        }
+    }
+    
+    /*
+     *  Test sp_put().
+     */
+    if (result == SPT_SUCCESS)
+    {
+        if (sp_put(NULL, &element) == SP_BAD_ARGUMENT)
+        {
+            UART_1_PutString("   6\tsp_put()\t\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("   6\tsp_put()\t\tFAIL\r\n");
+            result = SPT_FAILURE;
+        }
+    }
+    
+    if (result == SPT_SUCCESS)
+    {
+        if (sp_put(&ring, NULL) == SP_BAD_ARGUMENT)
+        {
+            UART_1_PutString("   7\tsp_put()\t\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("   7\tsp_put()\t\tFAIL\r\n");
+            result = SPT_FAILURE;
+        }
+    }
+    
+    if (result == SPT_SUCCESS)
+    {
+        count = 0;
+        
+        for (i = 0 ; i < 4 ; i++)
+        {
+            element = 1000 + i;
+            
+            if (sp_put(&ring, &element) == SP_SUCCESS)
+            {
+                ++count;
+            }
+        }
+        
+        if (count == 4)
+        {
+            UART_1_PutString("   8\tsp_put()\t\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("   8\tsp_put()\t\tFAIL\r\n");
+            result = SPT_FAILURE;
+        }
+    }
+    
+    if (result == SPT_SUCCESS)
+    {
+        if (sp_put(&ring, &element) == SP_FULL)
+        {
+            UART_1_PutString("   9\tsp_put()\t\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("   9\tsp_put()\t\tFAIL\r\n");
+            result = SPT_FAILURE;
+        }
+    }
+    
+    /*
+     *  Test sp_get_count() and sp_get_dropped().
+     */
+    if (result == SPT_SUCCESS)
+    {
+        if (sp_get_count(NULL) == 0)
+        {
+            UART_1_PutString("  10\tsp_get_count()\t\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("  10\tsp_get_count()\t\tFAIL\r\n");
+            result = SPT_FAILURE;
+        }
+    }
+    
+    if (result == SPT_SUCCESS)
+    {
+        if (sp_get_count(&ring) == 4)
+        {
+            UART_1_PutString("  11\tsp_get_count()\t\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("  11\tsp_get_count()\t\tFAIL\r\n");
+            result = SPT_FAILURE;
+        }
+    }
+    
+    if (result == SPT_SUCCESS)
+    {
+        if (sp_get_dropped(NULL) == 0)
+        {
+            UART_1_PutString("  12\tsp_get_dropped()\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("  12\tsp_get_dropped()\tFAIL\r\n");
+            result = SPT_FAILURE;
+        }
+    }
+    
+    if (result == SPT_SUCCESS)
+    {
+        if (sp_get_dropped(&ring) == 1)
+        {
+            UART_1_PutString("  13\tsp_get_dropped()\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("  13\tsp_get_dropped()\tFAIL\r\n");
+            result = SPT_FAILURE;
+        }
+    }
+    
+    /*
+     *  Test sp_get().
+     */
+    if (result == SPT_SUCCESS)
+    {
+        if (sp_get(NULL, &element) == SP_BAD_ARGUMENT)
+        {
+            UART_1_PutString("  14\tsp_get()\t\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("  14\tsp_get()\t\tFAIL\r\n");
+            result = SPT_FAILURE;
+        }
+    }
+    
+    if (result == SPT_SUCCESS)
+    {
+        if (sp_get(&ring, &element) == SP_SUCCESS)
+        {
+            UART_1_PutString("  15\tsp_get()\t\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("  15\tsp_get()\t\tFAIL\r\n");
+            result = SPT_FAILURE;
+        }
+    }
+    
+    if (result == SPT_SUCCESS)
+    {
+        if (element == 1000)
+        {
+            UART_1_PutString("  16\tsp_get()\t\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("  16\tsp_get()\t\tFAIL\r\n");
+            result = SPT_FAILURE;
+        }
+    }
+    
+    if (result == SPT_SUCCESS)
+    {
+        if (sp_get(&ring, NULL) == SP_SUCCESS)
+        {
+            UART_1_PutString("  17\tsp_get()\t\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("  17\tsp_get()\t\tFAIL\r\n");
+            result = SPT_FAILURE;
+        }
+    }
+    
+    if (result == SPT_SUCCESS)
+    {
+        if (sp_get_count(&ring) == 2)
+        {
+            UART_1_PutString("  18\tsp_get()\t\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("  18\tsp_get()\t\tFAIL\r\n");
+            result = SPT_FAILURE;
+        }
+    }
+    
+    if (result == SPT_SUCCESS)
+    {
+        element = 1004;
+        
+        if (sp_put(&ring, &element) == SP_SUCCESS)
+        {
+            UART_1_PutString("   -\tInitialise test...\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("   -\tInitialise test...\tFAIL\r\n");
+            result = SPT_FAILURE;
+        }
+    }
+    
+    if (result == SPT_SUCCESS)
+    {
+        element = 1005;
+        
+        if (sp_put(&ring, &element) == SP_SUCCESS)
+        {
+            UART_1_PutString("   -\tInitialise test...\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("   -\tInitialise test...\tFAIL\r\n");
+            result = SPT_FAILURE;
+        }
+    }
+    
+    if (result == SPT_SUCCESS)
+    {
+        count = 0;
+        
+        for (i = 0 ; i < 4 ; i++)
+        {
+            if ((sp_get(&ring, &element) == SP_SUCCESS) &&
+                (element == 1002 + i))
+            {
+                ++count;
+            }
+        }
+        
+        if (count == 4)
+        {
+            UART_1_PutString("  19\tsp_get()\t\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("  19\tsp_get()\t\tFAIL\r\n");
+            result = SPT_FAILURE;
+        }
+    }
+    
+    if (result == SPT_SUCCESS)
+    {
+        if (sp_get(&ring, &element) == SP_EMPTY)
+        {
+            UART_1_PutString("  20\tsp_get()\t\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("  20\tsp_get()\t\tFAIL\r\n");
+            result = SPT_FAILURE;
+        }
+    }
+    
+    /*
+     *  Test sp_flush().
+     */
+    if (result == SPT_SUCCESS)
+    {
+        if (sp_flush(NULL) == SP_BAD_ARGUMENT)
+        {
+            UART_1_PutString("  21\tsp_flush()\t\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("  21\tsp_flush()\t\tFAIL\r\n");
+            result = SPT_FAILURE;
+        }
+    }
+    
+    if (result == SPT_SUCCESS)
+    {
+        if (sp_put(&ring, &element) == SP_SUCCESS)
+        {
+            UART_1_PutString("   -\tInitialise test...\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("   -\tInitialise test...\tFAIL\r\n");
+            result = SPT_FAILURE;
+        }
+    }
+    
+    if (result == SPT_SUCCESS)
+    {
+        if (sp_flush(&ring) == SP_SUCCESS)
+        {
+            UART_1_PutString("  22\tsp_flush()\t\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("  22\tsp_flush()\t\tFAIL\r\n");
+            result = SPT_FAILURE;
+        }
+    }
+    
+    if (result == SPT_SUCCESS)
+    {
+        if (sp_get_count(&ring) == 0)
+        {
+            UART_1_PutString("  23\tsp_flush()\t\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("  23\tsp_flush()\t\tFAIL\r\n");
+            result = SPT_FAILURE;
+        }
+    }
+    
+    /*
+     *  Report test result.
+     */
+    if (result == SPT_SUCCESS)
+    {
+        UART_1_PutString("\r\n");
+        UART_1_PutString("TEST PASSED\r\n");
+    }
+    else
+    {
+        UART_1_PutString("\r\n");
+        UART_1_PutString("TEST FAILED\r\n");
+    }
+    
+    while ((UART_1_ReadTxStatus() & UART_1_TX_STS_FIFO_EMPTY) !=
+        UART_1_TX_STS_FIFO_EMPTY)
+    {
+        CyDelay(1);
+    }
+    
+    UART_1_Stop();
+    
+    return result;
+}
+
+/****************************************************************************
+ *  Local Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ *  End of File
+ ****************************************************************************/
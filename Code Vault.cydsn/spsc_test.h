@@ -0,0 +1,142 @@
+/****************************************************************************
+ *
+ *  File:           spsc_test.h
+ *  Module:         Single-Producer Single-Consumer Ring Test Library
+ *  Project:        Code Vault
+ *  Workspace:      PSoC Tools
+ *
+ *  Author:         Rodney B. Elliott
+ *  Date:           16 October 2026
+ *
+ ****************************************************************************
+ *
+ *  Copyright:      2013 Rodney B. Elliott
+ *
+ *  This file is part of PSoC Tools.
+ *
+ *  PSoC Tools is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  PSoC Tools is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with PSoC Tools. If not, see <http://www.gnu.org/licenses/>.
+ *
+ ****************************************************************************/
+#ifndef SPSC_TEST_H
+#define SPSC_TEST_H
+/**
+ *  @file spsc_test.h
+ *  @brief Single-producer single-consumer ring test library interface.
+ *
+ *  <H3> Introduction </H3>
+ *
+ *  The SPSC ring test library contains a single function that tests each of
+ *  the functions that comprise the single-producer single-consumer (SPSC)
+ *  ring library. As the test runs entirely within the main loop, it checks
+ *  the behaviour of the ring rather than its freedom from data races, which
+ *  instead rests upon the producer and consumer each writing only their own
+ *  index.
+ *
+ *  <H3> Use </H3>
+ *
+ *  In order to use the library, the programmer must first connect the target
+ *  system to a serial terminal configured as 57600 8-N-1. To run the test,
+ *  simply call the function spt_test_1() and observe the serial output, which
+ *  should be as follows.
+ *
+ *  @code
+ *  SPSC RING LIBRARY TEST
+ *
+ *  Test    Function                Result
+ *  ----    --------                ------
+ *     1    sp_init()               PASS
+ *     2    sp_init()               PASS
+ *     3    sp_init()               PASS
+ *     4    sp_init()               PASS
+ *     5    sp_init()               PASS
+ *     6    sp_put()                PASS
+ *     7    sp_put()                PASS
+ *     8    sp_put()                PASS
+ *     9    sp_put()                PASS
+ *    10    sp_get_count()          PASS
+ *    11    sp_get_count()          PASS
+ *    12    sp_get_dropped()        PASS
+ *    13    sp_get_dropped()        PASS
+ *    14    sp_get()                PASS
+ *    15    sp_get()                PASS
+ *    16    sp_get()                PASS
+ *    17    sp_get()                PASS
+ *    18    sp_get()                PASS
+ *     -    Initialise test...      PASS
+ *     -    Initialise test...      PASS
+ *    19    sp_get()                PASS
+ *    20    sp_get()                PASS
+ *    21    sp_flush()              PASS
+ *     -    Initialise test...      PASS
+ *    22    sp_flush()              PASS
+ *    23    sp_flush()              PASS
+ *
+ *  TEST PASSED
+ *  @endcode
+ *
+ *  Alternatively, if no serial terminal is available, the spt_test_1() return
+ *  value may be checked to see if the test completed successfully or not.
+ *
+ *  <H3> Hardware </H3>
+ *
+ *  The SPSC ring test library has been designed to run on a Cypress
+ *  CY8CKIT-001 development kit fitted with a PSoC5 CY8C5568AXI-060 module. It
+ *  requires access to the following components:
+ *
+ *  - UART_1
+ *
+ *  Pin P1_2 on the development kit prototype area must be connected to the
+ *  UART RX pin, and pin P1_7 must be connected to the UART TX pin. Ensure
+ *  that the RS_232PWR jumper is also set.
+ */
+
+/****************************************************************************
+ *  Modules
+ ****************************************************************************/
+
+/****************************************************************************
+ *  Definitions and Macros
+ ****************************************************************************/
+/**
+ *  @brief Generic success.
+ */
+#define SPT_SUCCESS                     0
+
+/**
+ *  @brief Generic failure.
+ */
+#define SPT_FAILURE                     1
+
+/****************************************************************************
+ *  Typedefs and Structures
+ ****************************************************************************/
+
+/****************************************************************************
+ *  Exported Variables
+ ****************************************************************************/
+
+/****************************************************************************
+ *  Exported Functions
+ ****************************************************************************/
+/**
+ *  @brief Tests the functions of the SPSC ring library.
+ *  @return #SPT_SUCCESS if successful, otherwise #SPT_FAILURE.
+ */
+uint8 spt_test_1(void);
+
+#endif
+
+/****************************************************************************
+ *  End of File
+ ****************************************************************************/
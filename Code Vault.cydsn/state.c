@@ -37,42 +37,142 @@
  *  Modules
  ****************************************************************************/
 #include <device.h>
-#include <stdlib.h>
 #include <string.h>
 
-#include "cbuff.h"
+#include "spsc.h"
 #include "state.h"
 
 /****************************************************************************
  *  Definitions and Macros
  ****************************************************************************/
 /**
- *  @brief The finite state machine library object tag.
+ *  @brief The mask used to find the index of a key within the circular
+ *      buffer.
  */
-#define _TAG                            1100
+#define _MASK                           (ST_BUFFER_SIZE - 1)
+
+/**
+ *  @brief The backspace key.
+ */
+#define _BACKSPACE                      0x08
+
+/**
+ *  @brief The delete key.
+ */
+#define _DELETE                         0x7f
+
+/**
+ *  @brief Indicates that an input automaton node completes no input, or
+ *      that a state has no event of a given input type.
+ */
+#define _NO_EVENT                       0xff
+
+/**
+ *  @brief Status byte mask used to indicate that predefined text has been
+ *      matched.
+ */
+#define _TEXT_MATCH                     0x40
+
+/**
+ *  @brief Status byte mask used to indicate that arbitrary text has been
+ *      terminated with a CR.
+ */
+#define _ARBITRARY_MATCH                0x80
+
+/**
+ *  @brief Status byte mask used to indicate that valid input has been
+ *      found.
+ */
+#define _MATCHED                        (_TEXT_MATCH | _ARBITRARY_MATCH)
+
+/**
+ *  @brief Status byte mask used to indicate that the most recent key was a
+ *      CR.
+ */
+#define _AFTER_CR                       0x20
 
 /****************************************************************************
  *  Typedefs and Structures
  ****************************************************************************/
+/**
+ *  @brief Input automaton node.
+ */
+typedef struct _NODE
+{
+    /**
+     *  @brief The node that follows for each character class.
+     */
+    uint8 next[ST_MATCH_CLASSES];
+    
+    /**
+     *  @brief The event of the predefined text completed on reaching the
+     *      node, or #_NO_EVENT.
+     */
+    uint8 event;
+} _NODE;
 
 /****************************************************************************
  *  Prototypes of Local Functions
  ****************************************************************************/
 /**
- *  @brief Create a new state object.
- *  @param[out] object A pointer to a pointer to the newly-created object.
- *  @param[in] key A pointer to the most recent key to be pressed.
- *  @return #ST_SUCCESS if successful, otherwise #ST_NO_MEMORY.
+ *  @brief Compile the predefined text of a transition table into the input
+ *      automaton.
+ *  @param[in] table A pointer to a transition table.
+ *  @return #ST_SUCCESS if successful, otherwise #ST_FAILURE.
+ *  @remark The root of each state is the node whose index is the state,
+ *      so the table may have no more than #ST_MATCH_NODES states. A larger
+ *      table, or one with more than #ST_STATE_MAXIMUM states, is refused
+ *      with #ST_FAILURE, and none of its text is compiled.
+ *  @remark Returns #ST_FAILURE if any predefined text does not fit. The
+ *      remaining text is compiled regardless.
+ */
+static uint8 _compile(const ST_TABLE *table);
+
+/**
+ *  @brief Add predefined text to the trie of a state.
+ *  @param[in] root The root node of the state.
+ *  @param[in] text A pointer to the predefined text.
+ *  @param[in] event The event triggered by the text.
+ *  @param[in,out] nodes A pointer to the number of nodes in use.
+ *  @param[in,out] classes A pointer to the number of character classes in
+ *      use.
+ *  @return #ST_SUCCESS if successful, otherwise #ST_FAILURE.
  */
-static uint8 _create_object(ST_OBJECT **object, char *key);
+static uint8 _insert(uint8 root, char *text, uint8 event, uint8 *nodes,
+    uint8 *classes);
 
 /**
- *  @brief Compare circular buffer user input to valid input.
- *  @param[in] input A pointer to valid input.
- *  @param[in] buffer A pointer to a circular buffer.
- *  @return #ST_SUCCESS if successful, otherwise ST_FAILURE.
+ *  @brief Advance the input automaton by one key.
+ *  @param[in] key The key.
  */
-static uint8 _compare(char *input, CB_LIST *buffer);
+static void _advance(char key);
+
+/**
+ *  @brief Return the input automaton to the root of the current state, and
+ *      advance it by each key of the circular buffer.
+ *  @remark Stops at the first valid input.
+ */
+static void _replay(void);
+
+/**
+ *  @brief Assemble a key into the current line.
+ *  @param[in] key The key.
+ *  @return #ST_SUCCESS if successful, otherwise #ST_FULL.
+ */
+static uint8 _edit(char key);
+
+/**
+ *  @brief Add a key to the circular buffer, and advance the input automaton
+ *      by it.
+ *  @param[in] key The key.
+ *  @return #ST_SUCCESS if successful, otherwise #ST_FULL.
+ */
+static uint8 _put(char key);
+
+/**
+ *  @brief Move the keys held by the SPSC ring into the circular buffer.
+ */
+static void _drain(void);
 
 /****************************************************************************
  *  Exported Variables
@@ -87,29 +187,69 @@ static uint8 _compare(char *input, CB_LIST *buffer);
 static ST_DATA _st_data = {{0}};        /* GCC bug 53119 requires double
                                            braces to suppress a warning
                                            about the initializer. */
+
+/**
+ *  @brief The SPSC ring used to pass keys from the ISR to the main loop.
+ */
+static SP_RING _ring;
+
+/**
+ *  @brief The array of keys used by the SPSC ring.
+ */
+static char _keys[ST_RING_SIZE];
+
+/**
+ *  @brief The character class of each character.
+ *
+ *  Class zero holds every character that appears in no predefined text.
+ */
+static uint8 _classes[256];
+
+/**
+ *  @brief The nodes of the input automaton.
+ */
+static _NODE _nodes[ST_MATCH_NODES];
+
+/**
+ *  @brief The arbitrary text event of each state, or #_NO_EVENT.
+ */
+static uint8 _arbitrary[ST_STATE_MAXIMUM];
+
+/**
+ *  @brief The hardware event of each state, or #_NO_EVENT.
+ */
+static uint8 _hardware[ST_STATE_MAXIMUM];
                                            
 /**
- *  @brief The array of system events.
+ *  @brief The library FSM transitions, one row per state.
  */
-static char *_valid_inputs[ST_STATE_MAXIMUM][ST_EVENT_MAXIMUM] =
+static const ST_TRANSITION _transitions[ST_STATE_MAXIMUM][ST_EVENT_MAXIMUM] =
 {
-    {"C"},
-    {"1", "2", "3"},
-    {"_hardware_event"},
-    {"\r"},
-    {"_arbitrary_input"}
+    {
+        {ST_INPUT_TEXT, "C", NULL, st_state_0_event_0, ST_STATE_1}
+    },
+    {
+        {ST_INPUT_TEXT, "1", NULL, st_state_1_event_0, ST_STATE_2},
+        {ST_INPUT_TEXT, "2", NULL, st_state_1_event_1, ST_STATE_3},
+        {ST_INPUT_TEXT, "3", NULL, st_state_1_event_2, ST_STATE_4}
+    },
+    {
+        {ST_INPUT_HARDWARE, NULL, NULL, st_state_2_event_0, ST_STATE_1}
+    },
+    {
+        {ST_INPUT_TEXT, "\r", NULL, st_state_3_event_0, ST_STATE_1}
+    },
+    {
+        {ST_INPUT_ARBITRARY, NULL, NULL, st_state_4_event_0, ST_STATE_5}
+    }
 };
 
 /**
- *  @brief The array of pointers to action functions.
+ *  @brief The library FSM transition table.
  */
-static void (*_action_functions[ST_STATE_MAXIMUM][ST_EVENT_MAXIMUM])(void) =
+static const ST_TABLE _table =
 {
-    {st_state_0_event_0},
-    {st_state_1_event_0, st_state_1_event_1, st_state_1_event_2},
-    {st_state_2_event_0},
-    {st_state_3_event_0},
-    {st_state_4_event_0}
+    &_transitions[0][0], ST_EVENT_MAXIMUM, ST_STATE_MAXIMUM
 };
 
 static char *_state_0_event_0 = 
@@ -117,10 +257,11 @@ static char *_state_0_event_0 =
     "\x1b\x5b\x32\x4a"
     "MODIFYING THE LIBRARY\r\n"
     "\r\n"
-    "The library FSM is hard-coded rather than interpreted. This means\r\n"
-    "that modifying the library will require the programmer to rewrite\r\n"
-    "some of its code. Before making a start on this task however, the\r\n"
-    "programmer is advised to do the following:\r\n"
+    "The library FSM is interpreted from a transition table. This means\r\n"
+    "that modifying the library requires the programmer to rewrite the\r\n"
+    "table and its functions, rather than the library engine. Before\r\n"
+    "making a start on this task however, the programmer is advised to\r\n"
+    "do the following:\r\n"
     "\r\n"
     "1. Make a backup copy of the library\r\n"
     "2. Complete the design of their FSM\r\n"
@@ -129,8 +270,8 @@ static char *_state_0_event_0 =
     "fully-described, the programmer can now begin to modify the code. To\r\n"
     "learn more, please select from one of the following options.\r\n"
     "\r\n"
-    "[1] System event array\r\n"
-    "[2] Action function array\r\n"
+    "[1] Transition table\r\n"
+    "[2] Guard functions\r\n"
     "[3] Action functions\r\n"
     "\r\n"
     ">> "
@@ -139,16 +280,17 @@ static char *_state_0_event_0 =
 static char *_state_1_event_0 = 
 {
     "\x1b\x5b\x32\x4a"
-    "MODIFYING THE LIBRARY - SYSTEM EVENT ARRAY\r\n"
+    "MODIFYING THE LIBRARY - TRANSITION TABLE\r\n"
     "\r\n"
-    "The programmer should begin by filling the system event array. This\r\n"
-    "contains the user input and other conditions that will trigger an\r\n"
-    "event. The event array may be found in the global variable section\r\n"
-    "of the library implementation file.\r\n"
+    "The programmer should begin by filling the transition table. This\r\n"
+    "holds one row per state and one entry per event, each giving the\r\n"
+    "input that will trigger the event, and the state that follows it.\r\n"
+    "The table may be found in the global variable section of the\r\n"
+    "library implementation file.\r\n"
     "\r\n"
     "Predefined text should be entered verbatim. Arbitrary text and any\r\n"
-    "hardware events should have their corresponding placeholder text\r\n"
-    "inserted into the system event array instead.\r\n"
+    "hardware events need only be given their corresponding input type\r\n"
+    "instead.\r\n"
     "\r\n"
     "[10 Second Delay] Previous screen\r\n"
     "\r\n"
@@ -158,12 +300,12 @@ static char *_state_1_event_0 =
 static char *_state_1_event_1 = 
 {
     "\x1b\x5b\x32\x4a"
-    "MODIFYING THE LIBRARY - ACTION FUNCTION ARRAY\r\n"
+    "MODIFYING THE LIBRARY - GUARD FUNCTIONS\r\n"
     "\r\n"
-    "Hving filled-out the system event array, the next step is to fill\r\n"
-    "the action function array. This contains pointers to the action\r\n"
-    "functions that will be called whenever the corresponding system\r\n"
-    "event occurs.\r\n"
+    "Having filled-out the transition table, the next step is to write\r\n"
+    "any guard functions it names. A guard function is called whenever\r\n"
+    "the corresponding event occurs, and the transition is only taken\r\n"
+    "should the guard function allow it.\r\n"
     "\r\n"
     "[ENTER] Previous Screen\r\n"
     "\r\n"
@@ -176,8 +318,8 @@ static char *_state_1_event_2 =
     "MODIFYING THE LIBRARY - ACTION FUNCTIONS\r\n"
     "\r\n"
     "The last step is to write the action functions whose pointers were\r\n"
-    "entered into the action function array. The programmer is reminded\r\n"
-    "to update the FSM state number within each action function.\r\n"
+    "entered into the transition table. There is no need to update the\r\n"
+    "FSM state within an action function, as the engine does so first.\r\n"
     "\r\n"
     "[Your Name]\r\n"
     "\r\n"
@@ -219,7 +361,6 @@ static char *_state_4_event_0_b =
 CY_ISR(st_interrupt)
 {
     char key;
-    ST_OBJECT *object;
     uint8 result = ST_SUCCESS;
     uint8 size = UART_1_GetRxBufferSize();
     uint8 status = UART_1_ReadRxStatus();
@@ -240,30 +381,12 @@ CY_ISR(st_interrupt)
     {
         key = (char)UART_1_ReadRxData();
         
-        result = _create_object(&object, &key);
-        
-        if (result == ST_SUCCESS)
-        {
-            result = cb_add_new(&_st_data.buffer, _TAG, object);
-            
-            if (result != CB_SUCCESS)
-            {
-                free(object->key);
-                free(object);
-                
-                /*
-                 *  Add a "no memory" error message to your application error
-                 *  deque here if so desired.
-                 */
-            }
-        }
-        else
-        {
-            /*
-             *  Add a "no memory" error message to your application error
-             *  deque here if so desired.
-             */
-        }
+        /*
+         *  Should the ring be full, the key is discarded and counted by the
+         *  ring. The count may be checked from the main loop using the
+         *  function sp_get_dropped().
+         */
+        sp_put(&_ring, &key);
         
         --size;
     }
@@ -273,12 +396,27 @@ void st_start(void)
 {   
     UART_1_Start();
     
+    sp_init(&_ring, _keys, ST_RING_SIZE, sizeof(*_keys));
+    
     isr_2_StartEx(st_interrupt);
     isr_2_ClearPending();
     
-    _st_data.status = ST_CARRIAGE_RETURN;
+    _st_data.status = ST_CARRIAGE_RETURN | ST_LINE_EDIT;
+    
+    st_init_machine(&_st_data.machine, &_table, ST_STATE_0, NULL);
+    
+    if (_compile(&_table) != ST_SUCCESS)
+    {
+        /*
+         *  Add a "predefined text too long" error message to your
+         *  application error deque here if so desired.
+         */
+    }
+    
+    _st_data.node = ST_STATE_0;
     
-    cb_set_limit(&_st_data.buffer, ST_NODE_LIMIT);
+    _st_data.buffer.read = _st_data.buffer.write;
+    _st_data.buffer.limit = ST_NODE_LIMIT;
 }
 
 void st_stop(void)
@@ -287,31 +425,21 @@ void st_stop(void)
     
     isr_2_Stop();
     
-    cb_destroy(&_st_data.buffer);
+    sp_flush(&_ring);
+    _st_data.buffer.read = _st_data.buffer.write;
 }
 
 uint8 st_add_key(char *key)
 {
-    ST_OBJECT *object;
     uint8 result = ST_BAD_ARGUMENT;
     
     if (key != NULL)
     {
-        result = _create_object(&object, key);
-            
-        if (result == ST_SUCCESS)
+        result = ST_SUCCESS;
+        
+        while (*key != '\0' && result == ST_SUCCESS)
         {
-            result = cb_add_new(&_st_data.buffer, _TAG, object);
-            
-            if (result != CB_SUCCESS)
-            {
-                free(object->key);
-                free(object);
-            }
-            else
-            {
-                result = ST_SUCCESS;
-            }
+            result = _edit(*key++);
         }
     }
     
@@ -320,102 +448,136 @@ uint8 st_add_key(char *key)
 
 uint8 st_is_valid_input(void)
 {
-    uint32 i = 0;
-    ST_OBJECT *object;
     uint8 result = ST_FAILURE;
-    char *valid_input;
+    uint16 state = _st_data.machine.state;
     
     if (_st_data.status & ST_HARDWARE_EVENT)
     {
         _st_data.status &= ~ST_HARDWARE_EVENT;
         
-        for (i = 0 ; i < ST_EVENT_MAXIMUM ; i++)
+        if (_hardware[state] != _NO_EVENT)
         {
-            valid_input = _valid_inputs[_st_data.state][i];
+            _st_data.event = _hardware[state];
             
-            if (strcmp(valid_input, "_hardware_event") == ST_SUCCESS)
-            {
-                _st_data.event = i;
-                
-                result = ST_SUCCESS;
-            }
+            result = ST_SUCCESS;
         }
     }
     else
     {
-        if (cb_get_count(&_st_data.buffer) > 0)
+        _drain();
+        
+        if (_st_data.status & _TEXT_MATCH)
         {
             /*
-             *  Having the ISR insert a node into the circular buffer while
-             *  it is being manipulated by the _compare() function would be
-             *  a very bad thing. The easiest way to get around this is to
-             *  disable the ISR, manipulate the buffer, and then enable the
-             *  ISR again.
+             *  Remove the matched text, together with any user input that
+             *  preceded it.
              */
-            isr_2_Disable();
+            _st_data.buffer.read = _st_data.buffer.write;
             
-            do
-            {
-                valid_input = _valid_inputs[_st_data.state][i];
-                
-                if (_compare(valid_input, &_st_data.buffer) == ST_SUCCESS)
-                {
-                    _st_data.event = i;
-                    
-                    for (i = 0 ; i < strlen(valid_input) ; i++)
-                    {
-                        cb_remove_old(&_st_data.buffer, (void **)&object);
-                        
-                        free(object->key);
-                        free(object);
-                    }
-                    
-                    result = ST_SUCCESS;
-                }
-                else if (strcmp(valid_input, "_arbitrary_input")
-                    == ST_SUCCESS)
-                {
-                    cb_get_new_object(&_st_data.buffer, NULL,
-                        (void **)&object);
-                    
-                    if ((_st_data.status & ST_CARRIAGE_RETURN) &&
-                        (*object->key == 0x0d))
-                    {
-                        _st_data.event = i;
-                        
-                        result = ST_SUCCESS;
-                    }
-                }
-                
-                ++i;
-                
-            } while (i < ST_EVENT_MAXIMUM && result == ST_FAILURE);
-                    
-            isr_2_StartEx(st_interrupt);
+            result = ST_SUCCESS;
+        }
+        else if (_st_data.status & _ARBITRARY_MATCH)
+        {
+            result = ST_SUCCESS;
         }
+        
+        _st_data.status &= ~_MATCHED;
     }
     
     return result;
 }
 
-void st_transition(void)
+uint8 st_transition(void)
 {
-    _action_functions[_st_data.state][_st_data.event]();
+    uint8 result = st_dispatch(&_st_data.machine, _st_data.event);
+    
+    _st_data.node = _st_data.machine.state;
+    _st_data.status &= ~_MATCHED;
+    
+    return result;
+}
+
+uint8 st_init_machine(ST_MACHINE *machine, const ST_TABLE *table,
+    uint16 state, void *context)
+{
+    uint8 result = ST_BAD_ARGUMENT;
+    
+    if (machine != NULL && table != NULL && table->transitions != NULL &&
+        state < table->states)
+    {
+        machine->table = table;
+        machine->context = context;
+        machine->event = 0;
+        machine->state = state;
+        
+        result = ST_SUCCESS;
+    }
+    
+    return result;
+}
+
+uint8 st_dispatch(ST_MACHINE *machine, uint16 event)
+{
+    uint8 result = ST_BAD_ARGUMENT;
+    const ST_TRANSITION *transition;
+    
+    if (machine != NULL && machine->table != NULL &&
+        event < machine->table->events)
+    {
+        transition = &machine->table->transitions[machine->state *
+            machine->table->events + event];
+        
+        if (transition->type == ST_INPUT_NONE)
+        {
+            result = ST_FAILURE;
+        }
+        else if (transition->guard != NULL &&
+            transition->guard(machine) != ST_TRUE)
+        {
+            result = ST_FAILURE;
+        }
+        else
+        {
+            machine->event = event;
+            machine->state = transition->next;
+            
+            if (transition->action != NULL)
+            {
+                transition->action(machine);
+            }
+            
+            result = ST_SUCCESS;
+        }
+    }
+    
+    return result;
 }
 
 uint32 st_get_limit(void)
 {
-    return cb_get_limit(&_st_data.buffer);
+    return _st_data.buffer.limit;
 }
 
 uint8 st_set_limit(uint32 limit)
 {
-    return cb_set_limit(&_st_data.buffer, limit);
+    uint8 result = ST_FAILURE;
+    
+    if (((st_get_count() <= limit) || (limit == 0)) &&
+        (limit <= ST_BUFFER_SIZE))
+    {
+        _st_data.buffer.limit = limit;
+        
+        result = ST_SUCCESS;
+    }
+    
+    return result;
 }
 
 uint32 st_get_count(void)
 {
-    return cb_get_count(&_st_data.buffer);
+    _drain();
+    
+    return _st_data.buffer.write - _st_data.buffer.read;
 }
 
 void st_set_bit(uint8 mask)
@@ -434,7 +596,9 @@ uint8 st_set_state(uint16 state)
     
     if (state < ST_STATE_MAXIMUM)
     {
-        _st_data.state = state;
+        _st_data.machine.state = state;
+        _st_data.node = state;
+        _st_data.status &= ~_MATCHED;
         
         result = ST_SUCCESS;
     }
@@ -444,34 +608,29 @@ uint8 st_set_state(uint16 state)
 
 uint8 st_copy_buffer(char *string)
 {
-    uint32 count = cb_get_count(&_st_data.buffer);
-    uint32 i = 0;
-    CB_LIST *buffer = &_st_data.buffer;
-    ST_OBJECT *object;
+    uint32 count = st_get_count();
+    uint32 first;
+    uint32 index = _st_data.buffer.read & _MASK;
     uint8 result = ST_BAD_ARGUMENT;
     
     if (string != NULL)
     {
         if (count > 0)
         {
-            isr_2_Disable();
-            
-            cl_move_backward(buffer->list, count - 1);
+            /*
+             *  The keys are copied in at most two parts, the second of which
+             *  starts at the beginning of the array should the keys wrap
+             *  around its end.
+             */
+            first = ST_BUFFER_SIZE - index;
             
-            do
+            if (first > count)
             {
-                cl_get_current_object(buffer->list, NULL,
-                    (void **)&object);
-                
-                *(string + i) = *object->key;
-                
-                cl_move_forward(buffer->list, 1);
-                
-                ++i;
-                
-            } while (i < count);
+                first = count;
+            }
             
-            isr_2_StartEx(st_interrupt);
+            memcpy(string, &_st_data.buffer.keys[index], first);
+            memcpy(string + first, _st_data.buffer.keys, count - first);
             
             result = ST_SUCCESS;
         }
@@ -486,17 +645,19 @@ uint8 st_copy_buffer(char *string)
 
 void st_empty_buffer(void)
 {
-    cb_destroy(&_st_data.buffer);
+    sp_flush(&_ring);
+    _st_data.buffer.read = _st_data.buffer.write;
+    
+    _st_data.node = _st_data.machine.state;
+    _st_data.status &= ~(_MATCHED | _AFTER_CR);
 }
 
-void st_state_0_event_0(void)
+void st_state_0_event_0(ST_MACHINE *machine)
 {
     UART_1_PutString(_state_0_event_0);
-    
-    _st_data.state = ST_STATE_1;
 }
 
-void st_state_1_event_0(void)
+void st_state_1_event_0(ST_MACHINE *machine)
 {
     UART_1_PutString(_state_1_event_0);
     
@@ -507,35 +668,29 @@ void st_state_1_event_0(void)
      */
     CyDelay(10000);
     _st_data.status |= ST_HARDWARE_EVENT;
-    
-    _st_data.state = ST_STATE_2;
 }
 
-void st_state_1_event_1(void)
+void st_state_1_event_1(ST_MACHINE *machine)
 {
     UART_1_PutString(_state_1_event_1);
-    
-    _st_data.state = ST_STATE_3;
 }
 
-void st_state_1_event_2(void)
+void st_state_1_event_2(ST_MACHINE *machine)
 {
     UART_1_PutString(_state_1_event_2);
-    
-    _st_data.state = ST_STATE_4;
 }
 
-void st_state_2_event_0(void)
+void st_state_2_event_0(ST_MACHINE *machine)
 {
-    st_state_0_event_0();
+    st_state_0_event_0(machine);
 }
 
-void st_state_3_event_0(void)
+void st_state_3_event_0(ST_MACHINE *machine)
 {
-    st_state_0_event_0();
+    st_state_0_event_0(machine);
 }
 
-void st_state_4_event_0(void)
+void st_state_4_event_0(ST_MACHINE *machine)
 {
     char display[60] = {0};
     char buffer[ST_NODE_LIMIT] = {0};
@@ -569,77 +724,325 @@ void st_state_4_event_0(void)
     UART_1_Stop();
     
     st_stop();
-    
-    _st_data.state = ST_STATE_5;
 }
 
 /****************************************************************************
  *  Local Functions
  ****************************************************************************/
-uint8 _create_object(ST_OBJECT **object, char *key)
+uint8 _compile(const ST_TABLE *table)
 {
-    char *new_key;
-    ST_OBJECT *new_object;
-    uint8 result = ST_NO_MEMORY;
+    uint8 child;
+    uint8 classes = 1;
+    uint16 event;
+    uint8 fail[ST_MATCH_NODES];
+    uint8 head = 0;
+    uint8 index;
+    uint8 node;
+    uint8 nodes;
+    uint8 queue[ST_MATCH_NODES];
+    uint8 result = ST_SUCCESS;
+    uint16 state;
+    uint16 states = table->states;
+    uint8 tail = 0;
+    const ST_TRANSITION *transition;
+    
+    memset(_classes, 0, sizeof(_classes));
+    memset(_nodes, 0, sizeof(_nodes));
+    
+    for (index = 0 ; index < ST_MATCH_NODES ; index++)
+    {
+        _nodes[index].event = _NO_EVENT;
+    }
+    
+    /*
+     *  The root node, arbitrary text event, and hardware event of each state
+     *  are indexed by state, so a table with too many states is refused
+     *  before any of them are written.
+     */
+    if ((states > ST_MATCH_NODES) || (states > ST_STATE_MAXIMUM))
+    {
+        states = 0;
+        result = ST_FAILURE;
+    }
     
-    new_object = malloc(sizeof(*new_object));
+    nodes = states;
     
-    if (object != NULL)
+    /*
+     *  Build a trie of the predefined text of each state, and note the
+     *  arbitrary text and hardware events of each state along the way.
+     */
+    for (state = 0 ; state < states ; state++)
     {
-        new_key = malloc(strlen(key) + 1);
+        _arbitrary[state] = _NO_EVENT;
+        _hardware[state] = _NO_EVENT;
         
-        if (new_key != NULL)
+        for (event = 0 ; event < table->events ; event++)
         {
-            strcpy(new_key, key);
-            new_object->key = new_key;
+            transition = &table->transitions[state * table->events + event];
             
-            *object = new_object;
+            if (transition->type == ST_INPUT_TEXT)
+            {
+                if (_insert(state, transition->text, event, &nodes,
+                    &classes) != ST_SUCCESS)
+                {
+                    result = ST_FAILURE;
+                }
+            }
+            else if (transition->type == ST_INPUT_ARBITRARY &&
+                _arbitrary[state] == _NO_EVENT)
+            {
+                _arbitrary[state] = event;
+            }
+            else if (transition->type == ST_INPUT_HARDWARE &&
+                _hardware[state] == _NO_EVENT)
+            {
+                _hardware[state] = event;
+            }
+        }
+        
+        for (index = 0 ; index < ST_MATCH_CLASSES ; index++)
+        {
+            child = _nodes[state].next[index];
             
-            result = ST_SUCCESS;
+            if (child != 0)
+            {
+                fail[child] = state;
+                queue[tail++] = child;
+            }
+            else
+            {
+                _nodes[state].next[index] = state;
+            }
+        }
+    }
+    
+    /*
+     *  Turn the tries into an automaton, breadth-first, so that the node
+     *  reached by the longest proper suffix of each node's text is complete
+     *  before it is needed. A node that completes no text of its own takes
+     *  the event of that suffix, if any.
+     */
+    while (head < tail)
+    {
+        node = queue[head++];
+        
+        if (_nodes[node].event == _NO_EVENT)
+        {
+            _nodes[node].event = _nodes[fail[node]].event;
+        }
+        
+        for (index = 0 ; index < ST_MATCH_CLASSES ; index++)
+        {
+            child = _nodes[node].next[index];
+            
+            if (child != 0)
+            {
+                fail[child] = _nodes[fail[node]].next[index];
+                queue[tail++] = child;
+            }
+            else
+            {
+                _nodes[node].next[index] = _nodes[fail[node]].next[index];
+            }
+        }
+    }
+    
+    return result;
+}
+
+uint8 _insert(uint8 root, char *text, uint8 event, uint8 *nodes,
+    uint8 *classes)
+{
+    uint8 character;
+    uint8 node = root;
+    uint8 result = ST_FAILURE;
+    
+    if (text != NULL && *text != '\0')
+    {
+        result = ST_SUCCESS;
+    }
+    
+    while (result == ST_SUCCESS && *text != '\0')
+    {
+        character = (uint8)*text++;
+        
+        if (_classes[character] == 0 && *classes < ST_MATCH_CLASSES)
+        {
+            _classes[character] = (*classes)++;
+        }
+        
+        if (_classes[character] == 0)
+        {
+            result = ST_FAILURE;
+        }
+        else if (_nodes[node].next[_classes[character]] != 0)
+        {
+            node = _nodes[node].next[_classes[character]];
+        }
+        else if (*nodes < ST_MATCH_NODES)
+        {
+            _nodes[node].next[_classes[character]] = *nodes;
+            node = (*nodes)++;
         }
         else
         {
-            free(object);
+            result = ST_FAILURE;
         }
     }
     
+    /*
+     *  Where two inputs share the same text, the first of them is kept.
+     */
+    if (result == ST_SUCCESS && _nodes[node].event == _NO_EVENT)
+    {
+        _nodes[node].event = event;
+    }
+    
     return result;
 }
 
-uint8 _compare(char *input, CB_LIST *buffer)
+void _advance(char key)
 {
-    uint32 buffer_size = cb_get_count(buffer);
-    uint32 i;
-    uint32 input_size = strlen(input);
-    ST_OBJECT *object;
-    uint8 result = ST_SUCCESS;
+    uint16 state = _st_data.machine.state;
+    
+    /*
+     *  A state without a root node, as in a table refused by _compile(),
+     *  never matches predefined text.
+     */
+    if (_st_data.node < ST_MATCH_NODES)
+    {
+        _st_data.node = _nodes[_st_data.node].next[_classes[(uint8)key]];
+    }
+    
+    if ((_st_data.node < ST_MATCH_NODES) &&
+        (_nodes[_st_data.node].event != _NO_EVENT))
+    {
+        _st_data.event = _nodes[_st_data.node].event;
+        _st_data.status |= _TEXT_MATCH;
+    }
+    else if (key == '\r' && (_st_data.status & ST_CARRIAGE_RETURN) &&
+        _arbitrary[state] != _NO_EVENT)
+    {
+        _st_data.event = _arbitrary[state];
+        _st_data.status |= _ARBITRARY_MATCH;
+    }
+}
+
+void _replay(void)
+{
+    uint32 index;
+    
+    _st_data.node = _st_data.machine.state;
+    _st_data.status &= ~_MATCHED;
+    
+    for (index = _st_data.buffer.read ;
+        index != _st_data.buffer.write && (_st_data.status & _MATCHED) == 0 ;
+        index++)
+    {
+        _advance(_st_data.buffer.keys[index & _MASK]);
+    }
+}
 
-    if (buffer_size >= input_size && input != NULL)
+uint8 _edit(char key)
+{
+    uint8 result = ST_SUCCESS;
+    
+    if ((_st_data.status & ST_LINE_EDIT) == 0)
     {
-        cl_move_backward(buffer->list, input_size - 1);
-        
-        for (i = 0 ; i < input_size ; i++)
+        result = _put(key);
+    }
+    else if (key == _BACKSPACE || key == _DELETE)
+    {
+        /*
+         *  Removing a key may undo or reveal a match, so the automaton is
+         *  advanced afresh by the keys that remain.
+         */
+        if (_st_data.buffer.write != _st_data.buffer.read)
         {
-            cl_get_current_object(buffer->list, NULL, (void **)&object);
-            
-            if (*(input + i) != *(object->key))
-            {
-                result = ST_FAILURE;
-            }
+            --_st_data.buffer.write;
             
-            cl_move_forward(buffer->list, 1);
+            _replay();
         }
         
-        cl_move_backward(buffer->list, 1);
+        _st_data.status &= ~_AFTER_CR;
+    }
+    else if (key == '\n' && (_st_data.status & _AFTER_CR))
+    {
+        _st_data.status &= ~_AFTER_CR;
     }
     else
     {
-        result = ST_FAILURE;
+        if (key == '\r')
+        {
+            _st_data.status |= _AFTER_CR;
+        }
+        else
+        {
+            _st_data.status &= ~_AFTER_CR;
+        }
+        
+        if (key == '\n')
+        {
+            key = '\r';
+        }
+        
+        result = _put(key);
     }
     
     return result;
 }
 
+uint8 _put(char key)
+{
+    ST_BUFFER *buffer = &_st_data.buffer;
+    uint8 result = ST_SUCCESS;
+    
+    if ((buffer->limit != 0) &&
+        (buffer->write - buffer->read >= buffer->limit))
+    {
+        ++buffer->read;
+    }
+    else if (buffer->write - buffer->read >= ST_BUFFER_SIZE)
+    {
+        result = ST_FULL;
+    }
+    
+    if (result == ST_SUCCESS)
+    {
+        buffer->keys[buffer->write & _MASK] = key;
+        
+        ++buffer->write;
+        
+        if ((_st_data.status & _MATCHED) == 0)
+        {
+            _advance(key);
+        }
+    }
+    
+    return result;
+}
+
+void _drain(void)
+{
+    char key;
+    
+    /*
+     *  Stop at the first valid input, leaving any keys that follow it in
+     *  the ring for the next state.
+     */
+    while ((_st_data.status & _MATCHED) == 0 &&
+        sp_get(&_ring, &key) == SP_SUCCESS)
+    {
+        if (_edit(key) != ST_SUCCESS)
+        {
+            /*
+             *  Add a "buffer full" error message to your application error
+             *  deque here if so desired.
+             */
+        }
+    }
+}
+
 /****************************************************************************
  *  End of File
  ****************************************************************************/
@@ -54,23 +54,34 @@
  *
  *  The library consists of several functional elements, the first of which is
  *  the circular buffer used to hold FSM input. This is a first-in, first-out
- *	(FIFO) buffer. Each time the user presses a key, the library creates a
- *	node and inserts it into the circular buffer.
- *
- *  Each node contains a pointer to an object that is normally owned by the
- *  library - that is, the library is responsible for the object's creation,
- *  right through to its eventual destruction. There is one situation where
- *  the programmer is responsible for the object's destruction, and this is
- *  described in detail later on. Objects contain a record of a key that was
- *  pressed by the user.
+ *	(FIFO) buffer. Each time the user presses a key, the library ISR places
+ *  the key into a single-producer single-consumer (SPSC) ring. The keys held
+ *  by the ring are moved into the circular buffer, one byte per key, by
+ *  those library functions that examine the buffer from the main loop. The
+ *  ISR and the main loop therefore never share the circular buffer, and the
+ *  ISR never needs to be disabled. The ring is able to hold #ST_RING_SIZE
+ *  keys between calls to the library.
+ *
+ *  The circular buffer is a contiguous array of #ST_BUFFER_SIZE bytes held
+ *  within the library, so that no memory is allocated from the heap as keys
+ *  are received, and its content is copied using at most two calls to
+ *  memcpy().
  *
  *  By default, the circular buffer is restricted to containing a maximum of
- *  64 nodes. This limit may be increased, decreased, or removed altogether
- *  using the function st_set_limit(). Programmers are advised not to remove
- *  the limit completely however, as doing so may result in their application
- *	running out of memory. With the limit in place, the worst that can happen
- *	is that new FSM input overwrites old FSM input before the application has
- *	had a chance to process it.
+ *  #ST_NODE_LIMIT keys. This limit may be decreased, or removed altogether
+ *  using the function st_set_limit(). With the limit in place, the worst
+ *  that can happen is that new FSM input overwrites old FSM input before
+ *  the application has had a chance to process it. Without the limit, new
+ *  FSM input is discarded once the buffer is full.
+ *
+ *  The library also assembles the keys into a line, much as a serial
+ *  terminal in line mode would. A backspace or delete key removes the most
+ *  recent key from the circular buffer rather than being added to it. A
+ *  line feed (LF) that follows a CR is discarded, and any other LF is
+ *  replaced with a CR, so that every line ends with a single CR whether the
+ *  terminal sends CR, LF, or both. Line assembly is enabled by the
+ *  #ST_LINE_EDIT bit, and may be disabled by clearing it, so that every key
+ *  is added to the circular buffer unchanged.
  *
  *  The library continually scans the circular buffer, searching for valid
  *  user input. When input matching an event of the current state is found,
@@ -83,16 +94,27 @@
  *  of the private data structure indirectly, although this should not
  *  normally be necessary.
  *
- *  The second functional element is the array of system events. This holds
- *  a list of valid FSM inputs for each system state. It is this array that
- *  the library compares the content of the circular buffer to when looking
- *  for valid input.
- *
- *  The third functional element is the array of pointers to so-called action
- *  functions. The library uses these functions to effect the actual state
- *  transitions. For each entry in the array of system events, there is a
- *  matching entry in the array of action functions. Action functions are
- *  named after the state and event to which they pertain.
+ *  The second functional element is the transition table. This is a constant
+ *  array of #ST_TRANSITION structures, holding one row for each state and
+ *  one column for each event. Each entry describes the input that triggers
+ *  the event in that state, an optional guard function, an optional action
+ *  function, and the state that the FSM enters when the event occurs. An
+ *  entry whose input type is #ST_INPUT_NONE is undefined, so that any entry
+ *  left out of a partially-initialised row is undefined as well. It is this
+ *  table that the library compares the content of the circular buffer to
+ *  when looking for valid input.
+ *
+ *  The third functional element is the engine that interprets the table.
+ *  Each FSM is held in an #ST_MACHINE structure, which is initialised using
+ *  the function st_init_machine(). Any number of FSM may be declared, each
+ *  with a table of its own or sharing a table with another. When an event
+ *  is passed to st_dispatch(), the engine indexes the table directly by the
+ *  current state and the event, so that dispatching an event takes constant
+ *  time no matter how large the table. Should the entry have a guard
+ *  function, the transition is taken only if the guard returns #ST_TRUE.
+ *  The engine then moves the FSM to the next state, and calls the action
+ *  function. Action functions are named after the state and event to which
+ *  they pertain.
  *
  *  The library supports three types of input:
  *
@@ -102,22 +124,43 @@
  *
  *  Predefined text is known at compile-time, and is often used to provide the
  *  user with a fixed set of options to choose from. Predefined text should be
- *  placed into the event array exactly as the user is expected to type it. To
- *  illustrate, consider a state that contains four valid inputs - "1", "2",
- *  "3", and "4". As none of these inputs contain a carriage-return (CR), an
- *  event will be triggered as soon as one of the four numbers is entered by
- *  the user. Programmers may add non-printable characters to predefined text
- *  if they so wish. For example, a CR could be added to the four inputs above
- *  to yield "1\r", "2\r" et cetera.
+ *  placed into the transition table exactly as the user is expected to type
+ *  it, with the input type #ST_INPUT_TEXT. To illustrate, consider a state
+ *  that contains four valid inputs - "1", "2", "3", and "4". As none of these
+ *  inputs contain a carriage-return (CR), an event will be triggered as soon
+ *  as one of the four numbers is entered by the user. Programmers may add
+ *  non-printable characters to predefined text if they so wish. For example,
+ *  a CR could be added to the four inputs above to yield "1\r", "2\r" et
+ *  cetera.
  *
  *	When scanning for predefined text, the library will automatically remove
  *	matching user input from the circular buffer. It also removes user input
- *	that does not match any of the entries in the array of system events for
- *	the current state. If the user were to type "XXX3\r" in the example from
- *	the preceding paragraph, the library would remove the "XXX" characters
- *	from the circular buffer as soon as they were typed. The serial terminal
- *	would continue to display the "XXX" characters, as the library does not
- *  remove them from the serial terminal screen buffer.
+ *	that does not match any of the entries in the transition table for the
+ *	current state. If the user were to type "XXX3\r" in the example from the
+ *	preceding paragraph, the library would remove the "XXX" characters from
+ *	the circular buffer together with the "3" that completes the match. The
+ *	CR is left for the next state. The serial terminal would continue to
+ *	display the "XXX" characters, as the library does not remove them from
+ *	the serial terminal screen buffer.
+ *
+ *  Predefined text is not compared to the circular buffer directly. Rather,
+ *  st_start() compiles the predefined text of every state into a byte-level
+ *  automaton, in which each state of the FSM has a root of its own. Each key
+ *  moved into the circular buffer advances the automaton by a single step,
+ *  which is a single table look-up, so that the cost of matching a key is
+ *  the same no matter how many inputs the current state accepts. The input
+ *  is matched however it is split between keys, and wherever it lies in the
+ *  user input, so that "XXX3" matches "3" as soon as the "3" arrives. Where
+ *  two inputs of a state end at the same key, the longer input is matched.
+ *  Matching stops at the first input to match, so that any keys that follow
+ *  it are left in the SPSC ring until the event has been dispatched.
+ *
+ *  The automaton holds up to #ST_MATCH_NODES nodes, being one for the root
+ *  of each state and one for each character of predefined text that is not
+ *  shared with another input of the same state. It distinguishes up to
+ *  #ST_MATCH_CLASSES different characters, counting one class for all those
+ *  characters that appear in no input. Predefined text that does not fit is
+ *  never matched.
  *
  *  @code
  *  ADDRESS BOOK
@@ -133,22 +176,20 @@
  *  Arbitrary text is not known until run-time. It is often used to provide
  *  the user with the ability to enter file names and the like. Because the
  *  text is not known at compile-time, it cannot be entered into the system
- *  event array in the same manner as predefined text. Instead, the library
- *  uses placeholder text to represent arbitrary input. The programmer must
- *  enter "_arbitrary_input" into the event array whenever they want the
- *  user to be able to enter arbitrary text.
+ *  transition table in the same manner as predefined text. Instead, the
+ *  programmer must give an entry the input type #ST_INPUT_ARBITRARY whenever
+ *  they want the user to be able to enter arbitrary text.
  *
  *  As previously stated, the library continually scans the circular buffer
  *  looking for valid user input. In the case of predefined text, comparing
- *  the content of the circular buffer to the array of system events is all
+ *  the content of the circular buffer to the transition table is all
  *  that is required to determine if particular input is valid or not. This
  *  is not the case with arbitrary text however.
  *
  *  During normal operation, arbitrary text is expected to end with a CR. The
- *  library scans the circular buffer looking for a CR whenever the system
- *  event array contains the placeholder text "_arbitrary_input". When a CR
- *  is found, it triggers a call to the action function corresponding to the
- *  event array entry.
+ *  library scans the circular buffer looking for a CR whenever the current
+ *  state has an entry of type #ST_INPUT_ARBITRARY. When a CR is found, it
+ *  triggers the event corresponding to the entry.
  *
  *  Note that unlike predefined text, it is up to the programmer to remove
  *  arbitrary text from the circular buffer. The functions st_get_count(),
@@ -169,19 +210,23 @@
  *
  *  Hardware events may be used to trigger a state transition based upon the
  *  occurrence of a hardware-related event such as the expiry of a timer, or
- *  a button being pressed. The library uses placeholder text to represent a
- *  hardware event in the same manner as it does with arbitrary text. In the
- *	case of of a hardware event, the text used is "_hardware_event".
+ *  a button being pressed. Entries for such events are given the input type
+ *  #ST_INPUT_HARDWARE.
  *
  *  Unlike predefined and arbitrary text input, a hardware event does not
- *  result in nodes being added to the circular buffer. Instead, a bit is
+ *  result in keys being added to the circular buffer. Instead, a bit is
  *  set in the status byte contained within the libraries private data
  *  structure. This bit is cleared by the library automatically.
  *
  *  Two functions are responsible for bringing the various library elements
  *  together. The function st_is_valid_input() is used to scan the circular
- *  buffer for valid input, whilst st_transition() calls the correct action
- *  function when valid input is detected.
+ *  buffer for valid input, whilst st_transition() dispatches the event that
+ *  was detected to the library FSM.
+ *
+ *  The engine itself does not depend upon the circular buffer, and may be
+ *  used to drive any number of other FSM by passing their events directly
+ *  to st_dispatch(). Such events may be given any input type other than
+ *  #ST_INPUT_NONE.
  *
  *  <H3> Use </H3>
  *
@@ -210,7 +255,7 @@
  *
  *  <H3> Further Reading </H3>
  *
- *  Circular buffer library (cbuff.h)
+ *  Single-producer single-consumer ring library (spsc.h)
  *
  *  <a href = "http://en.wikipedia.org/wiki/Finite-state_machine">
  *      Finite state machine (Wikipedia) </a>
@@ -222,7 +267,6 @@
 /****************************************************************************
  *  Modules
  ****************************************************************************/
-#include "cbuff.h"
 
 /****************************************************************************
  *  Definitions and Macros
@@ -255,6 +299,11 @@
  */
 #define ST_EMPTY                        4
 
+/**
+ *  @brief The circular buffer is full.
+ */
+#define ST_FULL                         5
+
 /**
  *  @brief Generic falsehood.
  */
@@ -280,25 +329,96 @@
 #define ST_CARRIAGE_RETURN              0x02
 
 /**
- *  @brief The circular buffer node limit.
+ *  @brief Status byte line edit mask.
+ *
+ *  Used to indicate that keys will be assembled into a line.
+ */
+#define ST_LINE_EDIT                    0x04
+
+/**
+ *  @brief Transition input type - the event is not defined for the state.
+ */
+#define ST_INPUT_NONE                   0
+
+/**
+ *  @brief Transition input type - predefined text.
+ */
+#define ST_INPUT_TEXT                   1
+
+/**
+ *  @brief Transition input type - arbitrary text.
+ */
+#define ST_INPUT_ARBITRARY              2
+
+/**
+ *  @brief Transition input type - a hardware event.
+ */
+#define ST_INPUT_HARDWARE               3
+
+/**
+ *  @brief The number of keys the circular buffer is able to hold.
+ *
+ *  The value must be a power of two.
+ */
+#define ST_BUFFER_SIZE                  64
+
+#if (ST_BUFFER_SIZE == 0) || ((ST_BUFFER_SIZE & (ST_BUFFER_SIZE - 1)) != 0)
+#error ST_BUFFER_SIZE must be a power of two.
+#endif
+
+/**
+ *  @brief The default circular buffer key limit.
+ */
+#define ST_NODE_LIMIT                   ST_BUFFER_SIZE
+
+/**
+ *  @brief The number of keys the ISR is able to hold.
+ *
+ *  The value must be a power of two.
+ */
+#define ST_RING_SIZE                    32
+
+#if (ST_RING_SIZE == 0) || ((ST_RING_SIZE & (ST_RING_SIZE - 1)) != 0)
+#error ST_RING_SIZE must be a power of two.
+#endif
+
+/**
+ *  @brief The number of nodes in the input automaton.
+ *
+ *  The value must not exceed 255.
  */
-#define ST_NODE_LIMIT                   64
+#define ST_MATCH_NODES                  32
+
+#if (ST_MATCH_NODES > 255)
+#error ST_MATCH_NODES must not exceed 255.
+#endif
+
+/**
+ *  @brief The number of character classes in the input automaton.
+ */
+#define ST_MATCH_CLASSES                8
 
 /****************************************************************************
  *  Typedefs and Structures
  ****************************************************************************/
 /**
- *  @brief Finite state machine (FSM) information.
+ *  @brief Finite state machine (FSM) instance.
  */
-typedef struct ST_DATA
+typedef struct ST_MACHINE
 {
     /**
-     *  The library circular buffer.
+     *  @brief A pointer to the transition table interpreted by the FSM.
+     */
+    const struct ST_TABLE *table;
+    
+    /**
+     *  @brief A pointer to application data used by guard and action
+     *      functions, or NULL.
      */
-    CB_LIST buffer;
+    void *context;
     
     /**
-     *  @brief The most recent event to occur.
+     *  @brief The most recent event to be dispatched.
      */
     uint16 event;
     
@@ -306,6 +426,131 @@ typedef struct ST_DATA
      *  @brief The current state.
      */
     uint16 state;
+} ST_MACHINE;
+
+/**
+ *  @brief Finite state machine (FSM) transition.
+ */
+typedef struct ST_TRANSITION
+{
+    /**
+     *  @brief The type of input that triggers the event.
+     *
+     *  This member may be one of the following values.
+     *
+     *  Value                 | Description
+     *  --------------------- | -----------------------------------------
+     *  @b ST_INPUT_NONE      | The event is not defined for the state.
+     *  @b ST_INPUT_TEXT      | Predefined text.
+     *  @b ST_INPUT_ARBITRARY | Arbitrary text.
+     *  @b ST_INPUT_HARDWARE  | A hardware event.
+     */
+    uint8 type;
+    
+    /**
+     *  @brief A pointer to the predefined text, or NULL.
+     */
+    char *text;
+    
+    /**
+     *  @brief A pointer to the guard function, or NULL.
+     *
+     *  The transition is taken only if the guard function returns #ST_TRUE.
+     */
+    uint8 (*guard)(ST_MACHINE *machine);
+    
+    /**
+     *  @brief A pointer to the action function, or NULL.
+     */
+    void (*action)(ST_MACHINE *machine);
+    
+    /**
+     *  @brief The state that the FSM enters when the transition is taken.
+     */
+    uint16 next;
+} ST_TRANSITION;
+
+/**
+ *  @brief Finite state machine (FSM) transition table.
+ */
+typedef struct ST_TABLE
+{
+    /**
+     *  @brief A pointer to the first transition of the table.
+     *
+     *  The table holds states * events transitions, stored one row per
+     *  state, so that the transition for a given state and event is found
+     *  at index state * events + event.
+     */
+    const ST_TRANSITION *transitions;
+    
+    /**
+     *  @brief The number of events in each row of the table.
+     */
+    uint16 events;
+    
+    /**
+     *  @brief The number of states in the table.
+     */
+    uint16 states;
+} ST_TABLE;
+
+/**
+ *  @brief A circular buffer of keys.
+ */
+typedef struct ST_BUFFER
+{
+    /**
+     *  @brief The number of keys ever removed from the buffer.
+     *
+     *  Masked with #ST_BUFFER_SIZE - 1, this gives the index of the oldest
+     *  key in the array.
+     */
+    uint32 read;
+    
+    /**
+     *  @brief The number of keys ever added to the buffer.
+     *
+     *  Masked with #ST_BUFFER_SIZE - 1, this gives the index at which the
+     *  next key will be written.
+     */
+    uint32 write;
+    
+    /**
+     *  @brief The array of keys.
+     */
+    char keys[ST_BUFFER_SIZE];
+    
+    /**
+     *  @brief The maximum number of keys allowed in the buffer.
+     */
+    uint32 limit;
+} ST_BUFFER;
+
+/**
+ *  @brief Library finite state machine (FSM) information.
+ */
+typedef struct ST_DATA
+{
+    /**
+     *  The library circular buffer.
+     */
+    ST_BUFFER buffer;
+    
+    /**
+     *  @brief The library FSM.
+     */
+    ST_MACHINE machine;
+    
+    /**
+     *  @brief The most recent event to be detected.
+     */
+    uint16 event;
+    
+    /**
+     *  @brief The current node of the input automaton.
+     */
+    uint8 node;
     
     /**
      *  @brief The status of the FSM.
@@ -316,21 +561,11 @@ typedef struct ST_DATA
      *  ------------------ | ---------------------------------------------
      *  @b ST_HARDWARE_EVENT  | A hardware event has occurred.
      *  @b ST_CARRIAGE_RETURN | Arbitrary text will be terminated with a CR.
+     *  @b ST_LINE_EDIT       | Keys will be assembled into a line.
      */
     uint8 status;
 } ST_DATA;
 
-/**
- *  @brief Key information.
- */
-typedef struct ST_OBJECT
-{
-    /**
-     *  @brief The most recent key to be pressed.
-     */
-    char *key;
-} ST_OBJECT;
-
 /**
  *  @brief Permitted events.
  */
@@ -373,8 +608,11 @@ enum ST_STATES
  ****************************************************************************/
 /**
  *  @brief Start the components used by the library.
- *  @remark Sets the circular buffer size limit to #ST_NODE_LIMIT, and
- *      sets the #ST_CARRIAGE_RETURN bit.
+ *  @remark Empties the circular buffer, sets its size limit to
+ *      #ST_NODE_LIMIT, sets the #ST_CARRIAGE_RETURN and #ST_LINE_EDIT
+ *      bits, places the library FSM in #ST_STATE_0,
+ *      and compiles the predefined text of the library FSM into the input
+ *      automaton.
  *  @warning This must be the first library function to be called.
  */
 void st_start(void);
@@ -386,10 +624,16 @@ void st_start(void);
 void st_stop(void);
 
 /**
- *  @brief Manually add a key object to the circular buffer.
- *  @param[in] key A pointer to the most recent key to be pressed.
+ *  @brief Manually add keys to the circular buffer.
+ *  @param[in] key A pointer to the keys, one per character.
  *  @return #ST_SUCCESS if successful, otherwise #ST_BAD_ARGUMENT or
- *      #ST_NO_MEMORY.
+ *      #ST_FULL.
+ *  @remark Each key is subject to line assembly if the #ST_LINE_EDIT bit
+ *      is set.
+ *  @remark Advances the input automaton by one step for each key, unless
+ *      valid input has already been found.
+ *  @remark Should the circular buffer fill without a limit in place, the
+ *      remaining keys are discarded and #ST_FULL is returned.
  */
 uint8 st_add_key(char *key);
 
@@ -400,6 +644,8 @@ uint8 st_add_key(char *key);
  *      circular buffer. Predefined text will be automatically removed.
  *  @remark If the #ST_CARRIAGE_RETURN bit has been cleared, it is up to
  *      the programmer to transition the FSM to the next state.
+ *  @remark Keys are moved from the SPSC ring only until valid input is
+ *      found.
  *  @see st_get_count()
  *  @see st_copy_buffer()
  *  @see st_empty_buffer()
@@ -407,32 +653,64 @@ uint8 st_add_key(char *key);
 uint8 st_is_valid_input(void);
 
 /**
- *  @brief Transition the FSM to the next state.
+ *  @brief Transition the library FSM to the next state.
+ *  @return #ST_SUCCESS if successful, otherwise #ST_FAILURE.
+ *  @remark Dispatches the event most recently detected by
+ *      st_is_valid_input(), and returns the input automaton to the root of
+ *      the current state.
+ *  @see st_dispatch()
+ */
+uint8 st_transition(void);
+
+/**
+ *  @brief Initialise a finite state machine (FSM).
+ *  @param[out] machine A pointer to the FSM.
+ *  @param[in] table A pointer to the transition table to be interpreted.
+ *  @param[in] state The initial state.
+ *  @param[in] context A pointer to application data used by guard and
+ *      action functions, or NULL.
+ *  @return #ST_SUCCESS if successful, otherwise #ST_BAD_ARGUMENT.
+ */
+uint8 st_init_machine(ST_MACHINE *machine, const ST_TABLE *table,
+    uint16 state, void *context);
+
+/**
+ *  @brief Dispatch an event to a finite state machine (FSM).
+ *  @param[in] machine A pointer to the FSM.
+ *  @param[in] event The event.
+ *  @return #ST_SUCCESS if the transition was taken, otherwise #ST_FAILURE or
+ *      #ST_BAD_ARGUMENT.
+ *  @remark Returns #ST_FAILURE if the event is not defined for the current
+ *      state, or if the guard function does not allow the transition.
+ *  @remark The FSM enters the next state before the action function is
+ *      called, so that the action function may change the state itself.
  */
-void st_transition(void);
+uint8 st_dispatch(ST_MACHINE *machine, uint16 event);
 
 /**
- *  @brief Get the node limit of the circular buffer.
- *  @return The maximum number of nodes allowed in the circular buffer.
+ *  @brief Get the key limit of the circular buffer.
+ *  @return The maximum number of keys allowed in the circular buffer.
  */
 uint32 st_get_limit(void);
 
 /**
- *  @brief Set the node limit of the circular buffer.
- *  @param[in] limit The maximum number of nodes allowed in the circular
+ *  @brief Set the key limit of the circular buffer.
+ *  @param[in] limit The maximum number of keys allowed in the circular
  *      buffer.
  *  @return #ST_SUCCESS if successful, otherwise #ST_FAILURE.
- *  @remark It is up to the caller to ensure that the number of nodes in the
+ *  @remark It is up to the caller to ensure that the number of keys in the
  *      circular buffer is less than the proposed limit. Failure to do so will
  *      result in this function returning #ST_FAILURE.
- *  @remark Set the limit to zero to allow the circular buffer to grow without
- *      limit.
+ *  @remark A limit greater than #ST_BUFFER_SIZE will also result in this
+ *      function returning #ST_FAILURE.
+ *  @remark Set the limit to zero to allow the circular buffer to fill without
+ *      overwriting old keys.
  */
 uint8 st_set_limit(uint32 limit);
 
 /**
- *  @brief Get the node count of the circular buffer.
- *  @return The number of nodes in the circular buffer.
+ *  @brief Get the key count of the circular buffer.
+ *  @return The number of keys in the circular buffer.
  */
 uint32 st_get_count(void);
 
@@ -446,6 +724,7 @@ uint32 st_get_count(void);
  *  ------------------ | ---------------------------------------------
  *  @b ST_HARDWARE_EVENT  | A hardware event has occurred.
  *  @b ST_CARRIAGE_RETURN | Arbitrary text will be terminated with a CR.
+ *  @b ST_LINE_EDIT       | Keys will be assembled into a line.
  */
 void st_set_bit(uint8 mask);
 
@@ -459,16 +738,18 @@ void st_set_bit(uint8 mask);
  *  ------------------ | ---------------------------------------------
  *  @b ST_HARDWARE_EVENT  | A hardware event has occurred.
  *  @b ST_CARRIAGE_RETURN | Arbitrary text will be terminated with a CR.
+ *  @b ST_LINE_EDIT       | Keys will be assembled into a line.
  */
 void st_clear_bit(uint8 mask);
 
 /**
- *  @brief Set the library state.
+ *  @brief Set the library FSM state.
  *  @param[in] state The new state.
  *  @return #ST_SUCCESS if successful, otherwise #ST_BAD_ARGUMENT.
  *  @remark It is up to the caller to ensure that the state is less
  *      than #ST_STATE_MAXIMUM. Failure to do so will result in this
  *      function returning #ST_BAD_ARGUMENT.
+ *  @remark Returns the input automaton to the root of the new state.
  */
 uint8 st_set_state(uint16 state);
 
@@ -478,78 +759,87 @@ uint8 st_set_state(uint16 state);
  *  @return #ST_SUCCESS if successful, otherwise #ST_BAD_ARGUMENT or
  *      #ST_EMPTY.
  *  @remark It is up to the caller to allocate sufficient space for the
- *      string.
+ *      string, which is not terminated.
  *  @see st_get_count()
  */
 uint8 st_copy_buffer(char *string);
 
 /**
  *  @brief Empty the circular buffer.
- *  @remark Deletes all nodes from the circular buffer.
+ *  @remark Deletes all keys from the circular buffer, and returns the
+ *      input automaton to the root of the current state.
  */
 void st_empty_buffer(void);
 
 /**
  *  @brief State zero event zero action function.
  *
- *	This function displays the "modifying the library" text block, and sets
- *	the FSM state to ST_STATE_1. Three predefined text events are defined
- *	for this state.
+ *	This function displays the "modifying the library" text block, as the FSM
+ *	enters ST_STATE_1. Three predefined text events are defined for this
+ *	state.
+ *  @param[in] machine A pointer to the FSM.
  */
-void st_state_0_event_0(void);
+void st_state_0_event_0(ST_MACHINE *machine);
 
 /**
  *  @brief State one event zero action function.
  *
- *	This function displays the "modifying the library - system event array"
- *	text block, delays for ten seconds, and then sets the FSM state to
- *	ST_STATE_2. A single hardware event is defined for this state.
+ *	This function displays the "modifying the library - transition table"
+ *	text block as the FSM enters ST_STATE_2, delays for ten seconds, and then
+ *	sets the hardware event bit. A single hardware event is defined for this
+ *	state.
+ *  @param[in] machine A pointer to the FSM.
  */
-void st_state_1_event_0(void);
+void st_state_1_event_0(ST_MACHINE *machine);
 
 /**
  *  @brief State one event one action function.
  *
- *	This function displays the "modifying the library - action function array"
- *	text block, and sets the FSM state to ST_STATE_3.  A single predefined
- *	text event is defined for this state.
+ *	This function displays the "modifying the library - guard functions"
+ *	text block, as the FSM enters ST_STATE_3. A single predefined text event
+ *	is defined for this state.
+ *  @param[in] machine A pointer to the FSM.
  */
-void st_state_1_event_1(void);
+void st_state_1_event_1(ST_MACHINE *machine);
 
 /**
  *  @brief State one event two action function.
  *
  *	This function displays the "modifying the library - action functions" text
- *	block, and sets the FSM state to ST_STATE_4. A single arbitrary text
- *	event is defined for this state.
+ *	block, as the FSM enters ST_STATE_4. A single arbitrary text event is
+ *	defined for this state.
+ *  @param[in] machine A pointer to the FSM.
  */
-void st_state_1_event_2(void);
+void st_state_1_event_2(ST_MACHINE *machine);
 
 /**
  *  @brief State two event zero action function.
  *
- *	This function returns the FSM to ST_STATE_1. It does this by calling the
+ *	This function is called as the FSM returns to ST_STATE_1. It calls the
  *	st_state_0_event_0() action function.
+ *  @param[in] machine A pointer to the FSM.
  */
-void st_state_2_event_0(void);
+void st_state_2_event_0(ST_MACHINE *machine);
 
 /**
  *  @brief State three event zero action function.
  *
- *	This function returns the FSM to ST_STATE_1. It does this by calling the
+ *	This function is called as the FSM returns to ST_STATE_1. It calls the
  *	st_state_0_event_0() action function.
+ *  @param[in] machine A pointer to the FSM.
  */
-void st_state_3_event_0(void);
+void st_state_3_event_0(ST_MACHINE *machine);
 
 /**
  *  @brief State four event zero action function.
  *
  *	This function displays the "certificate of completion" text block, and
  *	removes the arbitrary text from the circular buffer after copying it to
- *	a local string. It also sets the FSM state to ST_STATE_5. There are no
- *	events defined for this state.
+ *	a local string. It is called as the FSM enters ST_STATE_5, for which
+ *	there are no events defined.
+ *  @param[in] machine A pointer to the FSM.
  */
-void st_state_4_event_0(void);
+void st_state_4_event_0(ST_MACHINE *machine);
 
 #endif
 
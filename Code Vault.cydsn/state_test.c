@@ -37,6 +37,7 @@
  *  Modules
  ****************************************************************************/
 #include <device.h>
+#include <string.h>
 
 #include "state.h"
 #include "state_test.h"
@@ -54,13 +55,81 @@
  */
 #define _CY8CKIT_TX                     CYREG_PRT1_PC7
 
+/**
+ *  @brief Turnstile state - locked.
+ */
+#define _LOCKED                         0
+
+/**
+ *  @brief Turnstile state - unlocked.
+ */
+#define _UNLOCKED                       1
+
+/**
+ *  @brief The number of turnstile states.
+ */
+#define _STATE_MAXIMUM                  2
+
+/**
+ *  @brief Turnstile event - a coin is inserted.
+ */
+#define _COIN                           0
+
+/**
+ *  @brief Turnstile event - the arm is pushed.
+ */
+#define _PUSH                           1
+
+/**
+ *  @brief The number of turnstile events.
+ */
+#define _EVENT_MAXIMUM                  2
+
 /****************************************************************************
  *  Typedefs and Structures
  ****************************************************************************/
+/**
+ *  @brief Turnstile information, used by the turnstile FSM.
+ */
+typedef struct _TURNSTILE
+{
+    /**
+     *  @brief The number of coins inserted.
+     */
+    uint32 coins;
+    
+    /**
+     *  @brief Whether or not the turnstile accepts coins.
+     */
+    uint8 enabled;
+    
+    /**
+     *  @brief The number of times the turnstile has been passed.
+     */
+    uint32 passes;
+} _TURNSTILE;
 
 /****************************************************************************
  *  Prototypes of Local Functions
  ****************************************************************************/
+/**
+ *  @brief Turnstile guard function.
+ *  @param[in] machine A pointer to the turnstile FSM.
+ *  @return #ST_TRUE if the turnstile accepts coins, otherwise #ST_FALSE.
+ */
+static uint8 _is_enabled(ST_MACHINE *machine);
+
+/**
+ *  @brief Turnstile coin action function.
+ *  @param[in] machine A pointer to the turnstile FSM.
+ */
+static void _add_coin(ST_MACHINE *machine);
+
+/**
+ *  @brief Turnstile push action function.
+ *  @param[in] machine A pointer to the turnstile FSM.
+ */
+static void _add_pass(ST_MACHINE *machine);
 
 /****************************************************************************
  *  Exported Variables
@@ -69,6 +138,28 @@
 /****************************************************************************
  *  Global Variables
  ****************************************************************************/
+/**
+ *  @brief The turnstile FSM transitions, one row per state.
+ */
+static const ST_TRANSITION _transitions[_STATE_MAXIMUM][_EVENT_MAXIMUM] =
+{
+    {
+        {ST_INPUT_HARDWARE, NULL, _is_enabled, _add_coin, _UNLOCKED}
+    },
+    {
+        {ST_INPUT_HARDWARE, NULL, NULL, _add_coin, _UNLOCKED},
+        {ST_INPUT_HARDWARE, NULL, NULL, _add_pass, _LOCKED}
+    }
+};
+
+/**
+ *  @brief The turnstile FSM transition table.
+ */
+static const ST_TABLE _turnstile =
+{
+    &_transitions[0][0], _EVENT_MAXIMUM, _STATE_MAXIMUM
+};
+
 static char *_state_none_event_none = 
 {
     "\x1b\x5b\x32\x4a"
@@ -95,8 +186,13 @@ static char *_state_none_event_none =
  ****************************************************************************/
 uint8 stt_test_1(void)
 {
+    uint32 i;
+    ST_MACHINE machine_0;
+    ST_MACHINE machine_1;
     uint8 result = STT_SUCCESS;
     char string_0[ST_NODE_LIMIT] = {0};
+    _TURNSTILE turnstile_0 = {0};
+    _TURNSTILE turnstile_1 = {0};
     
     UART_1_Start();
     
@@ -520,52 +616,709 @@ uint8 stt_test_1(void)
     }
         
     /*
-     *  Report test result.
+     *  Test st_init_machine().
      */
     if (result == STT_SUCCESS)
     {
-        UART_1_PutString("\r\n");
-        UART_1_PutString("TEST PASSED\r\n");
+        if (st_init_machine(NULL, &_turnstile, _LOCKED, &turnstile_0) ==
+            ST_BAD_ARGUMENT)
+        {
+            UART_1_PutString("  22\tst_init_machine()\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("  22\tst_init_machine()\tFAIL\r\n");
+            result = STT_FAILURE;
+        }
     }
-    else
+    
+    if (result == STT_SUCCESS)
     {
-        UART_1_PutString("\r\n");
-        UART_1_PutString("TEST FAILED\r\n");
+        if (st_init_machine(&machine_0, NULL, _LOCKED, &turnstile_0) ==
+            ST_BAD_ARGUMENT)
+        {
+            UART_1_PutString("  23\tst_init_machine()\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("  23\tst_init_machine()\tFAIL\r\n");
+            result = STT_FAILURE;
+        }
+    }
+    
+    if (result == STT_SUCCESS)
+    {
+        if (st_init_machine(&machine_0, &_turnstile, _STATE_MAXIMUM,
+            &turnstile_0) == ST_BAD_ARGUMENT)
+        {
+            UART_1_PutString("  24\tst_init_machine()\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("  24\tst_init_machine()\tFAIL\r\n");
+            result = STT_FAILURE;
+        }
     }
     
     /*
-     *  Clean-up test.
+     *  Initialise st_dispatch() test.
      */
-    while (UART_1_ReadTxStatus() != UART_1_TX_STS_FIFO_EMPTY)
+    if (result == STT_SUCCESS)
     {
-        CyDelay(1);
+        if (st_init_machine(&machine_0, &_turnstile, _LOCKED, &turnstile_0) ==
+            ST_SUCCESS)
+        {
+            UART_1_PutString("   -\tInitialise test...\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("   -\tInitialise test...\tFAIL\r\n");
+            result = STT_FAILURE;
+        }
     }
     
-    UART_1_Stop();
+    /*
+     *  Initialise st_dispatch() test.
+     */
+    if (result == STT_SUCCESS)
+    {
+        if (st_init_machine(&machine_1, &_turnstile, _LOCKED, &turnstile_1) ==
+            ST_SUCCESS)
+        {
+            UART_1_PutString("   -\tInitialise test...\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("   -\tInitialise test...\tFAIL\r\n");
+            result = STT_FAILURE;
+        }
+    }
     
-    st_stop();
+    /*
+     *  Test st_dispatch().
+     */
+    if (result == STT_SUCCESS)
+    {
+        if (st_dispatch(NULL, _COIN) == ST_BAD_ARGUMENT)
+        {
+            UART_1_PutString("  25\tst_dispatch()\t\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("  25\tst_dispatch()\t\tFAIL\r\n");
+            result = STT_FAILURE;
+        }
+    }
     
-    return result;
-}
-
-void stt_test_2(void)
-{
-    st_start();
+    if (result == STT_SUCCESS)
+    {
+        if (st_dispatch(&machine_0, _EVENT_MAXIMUM) == ST_BAD_ARGUMENT)
+        {
+            UART_1_PutString("  26\tst_dispatch()\t\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("  26\tst_dispatch()\t\tFAIL\r\n");
+            result = STT_FAILURE;
+        }
+    }
     
-    UART_1_PutString(_state_none_event_none);
+    if (result == STT_SUCCESS)
+    {
+        if ((st_dispatch(&machine_0, _PUSH) == ST_FAILURE) &&
+            (machine_0.state == _LOCKED))
+        {
+            UART_1_PutString("  27\tst_dispatch()\t\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("  27\tst_dispatch()\t\tFAIL\r\n");
+            result = STT_FAILURE;
+        }
+    }
     
-    for (;;)
+    if (result == STT_SUCCESS)
     {
-        if (st_is_valid_input() == ST_SUCCESS)
+        if ((st_dispatch(&machine_0, _COIN) == ST_FAILURE) &&
+            (machine_0.state == _LOCKED) &&
+            (turnstile_0.coins == 0))
         {
-            st_transition();
+            UART_1_PutString("  28\tst_dispatch()\t\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("  28\tst_dispatch()\t\tFAIL\r\n");
+            result = STT_FAILURE;
         }
     }
-}
-
-/****************************************************************************
- *  Local Functions
- ****************************************************************************/
+    
+    /*
+     *  Initialise st_dispatch() test.
+     */
+    if (result == STT_SUCCESS)
+    {
+        turnstile_0.enabled = ST_TRUE;
+        
+        UART_1_PutString("   -\tInitialise test...\tPASS\r\n");
+    }
+    
+    /*
+     *  Test st_dispatch().
+     */
+    if (result == STT_SUCCESS)
+    {
+        if ((st_dispatch(&machine_0, _COIN) == ST_SUCCESS) &&
+            (machine_0.state == _UNLOCKED) &&
+            (machine_0.event == _COIN) &&
+            (turnstile_0.coins == 1))
+        {
+            UART_1_PutString("  29\tst_dispatch()\t\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("  29\tst_dispatch()\t\tFAIL\r\n");
+            result = STT_FAILURE;
+        }
+    }
+    
+    if (result == STT_SUCCESS)
+    {
+        if ((st_dispatch(&machine_0, _COIN) == ST_SUCCESS) &&
+            (machine_0.state == _UNLOCKED) &&
+            (turnstile_0.coins == 2))
+        {
+            UART_1_PutString("  30\tst_dispatch()\t\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("  30\tst_dispatch()\t\tFAIL\r\n");
+            result = STT_FAILURE;
+        }
+    }
+    
+    if (result == STT_SUCCESS)
+    {
+        if ((st_dispatch(&machine_1, _PUSH) == ST_FAILURE) &&
+            (machine_1.state == _LOCKED) &&
+            (turnstile_1.passes == 0))
+        {
+            UART_1_PutString("  31\tst_dispatch()\t\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("  31\tst_dispatch()\t\tFAIL\r\n");
+            result = STT_FAILURE;
+        }
+    }
+    
+    if (result == STT_SUCCESS)
+    {
+        if ((st_dispatch(&machine_0, _PUSH) == ST_SUCCESS) &&
+            (machine_0.state == _LOCKED) &&
+            (turnstile_0.passes == 1))
+        {
+            UART_1_PutString("  32\tst_dispatch()\t\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("  32\tst_dispatch()\t\tFAIL\r\n");
+            result = STT_FAILURE;
+        }
+    }
+    
+    /*
+     *  Initialise st_transition() test.
+     */
+    if (result == STT_SUCCESS)
+    {
+        if (st_set_state(ST_STATE_5) == ST_SUCCESS)
+        {
+            UART_1_PutString("   -\tInitialise test...\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("   -\tInitialise test...\tFAIL\r\n");
+            result = STT_FAILURE;
+        }
+    }
+    
+    /*
+     *  Test st_transition().
+     */
+    if (result == STT_SUCCESS)
+    {
+        if (st_transition() == ST_FAILURE)
+        {
+            UART_1_PutString("  33\tst_transition()\t\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("  33\tst_transition()\t\tFAIL\r\n");
+            result = STT_FAILURE;
+        }
+    }
+    
+    /*
+     *  Initialise st_is_valid_input() test.
+     */
+    if (result == STT_SUCCESS)
+    {
+        if (st_set_state(ST_STATE_1) == ST_SUCCESS)
+        {
+            UART_1_PutString("   -\tInitialise test...\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("   -\tInitialise test...\tFAIL\r\n");
+            result = STT_FAILURE;
+        }
+    }
+    
+    /*
+     *  Test st_is_valid_input().
+     */
+    if (result == STT_SUCCESS)
+    {
+        st_add_key("X");
+        st_add_key("3");
+        
+        if ((st_is_valid_input() == ST_SUCCESS) && (st_get_count() == 0))
+        {
+            UART_1_PutString("  34\tst_is_valid_input()\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("  34\tst_is_valid_input()\tFAIL\r\n");
+            result = STT_FAILURE;
+        }
+    }
+    
+    if (result == STT_SUCCESS)
+    {
+        st_add_key("C");
+        
+        if ((st_is_valid_input() == ST_FAILURE) && (st_get_count() == 1))
+        {
+            UART_1_PutString("  35\tst_is_valid_input()\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("  35\tst_is_valid_input()\tFAIL\r\n");
+            result = STT_FAILURE;
+        }
+    }
+    
+    if (result == STT_SUCCESS)
+    {
+        st_add_key("X2");
+        
+        if ((st_is_valid_input() == ST_SUCCESS) && (st_get_count() == 0))
+        {
+            UART_1_PutString("  36\tst_is_valid_input()\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("  36\tst_is_valid_input()\tFAIL\r\n");
+            result = STT_FAILURE;
+        }
+    }
+    
+    /*
+     *  Test st_empty_buffer().
+     */
+    if (result == STT_SUCCESS)
+    {
+        st_add_key("1");
+        st_empty_buffer();
+        
+        if (st_is_valid_input() == ST_FAILURE)
+        {
+            UART_1_PutString("  37\tst_empty_buffer()\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("  37\tst_empty_buffer()\tFAIL\r\n");
+            result = STT_FAILURE;
+        }
+    }
+    
+    /*
+     *  Test st_set_state().
+     */
+    if (result == STT_SUCCESS)
+    {
+        st_add_key("2");
+        st_set_state(ST_STATE_0);
+        
+        if (st_is_valid_input() == ST_FAILURE)
+        {
+            UART_1_PutString("  38\tst_set_state()\t\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("  38\tst_set_state()\t\tFAIL\r\n");
+            result = STT_FAILURE;
+        }
+    }
+    
+    if (result == STT_SUCCESS)
+    {
+        st_add_key("C");
+        
+        if ((st_is_valid_input() == ST_SUCCESS) && (st_get_count() == 0))
+        {
+            UART_1_PutString("  39\tst_set_state()\t\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("  39\tst_set_state()\t\tFAIL\r\n");
+            result = STT_FAILURE;
+        }
+    }
+    
+    /*
+     *  Test st_set_limit().
+     */
+    if (result == STT_SUCCESS)
+    {
+        if (st_set_limit(ST_BUFFER_SIZE + 1) == ST_FAILURE)
+        {
+            UART_1_PutString("  40\tst_set_limit()\t\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("  40\tst_set_limit()\t\tFAIL\r\n");
+            result = STT_FAILURE;
+        }
+    }
+    
+    /*
+     *  Initialise st_add_key() test.
+     */
+    if (result == STT_SUCCESS)
+    {
+        st_set_state(ST_STATE_4);
+        st_set_bit(ST_CARRIAGE_RETURN);
+        st_empty_buffer();
+        
+        for (i = 0 ; i < ST_BUFFER_SIZE ; i++)
+        {
+            st_add_key("x");
+        }
+        
+        if (st_set_limit(0) == ST_SUCCESS)
+        {
+            UART_1_PutString("   -\tInitialise test...\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("   -\tInitialise test...\tFAIL\r\n");
+            result = STT_FAILURE;
+        }
+    }
+    
+    /*
+     *  Test st_add_key().
+     */
+    if (result == STT_SUCCESS)
+    {
+        if ((st_add_key("y") == ST_FULL) && (st_get_count() == ST_BUFFER_SIZE))
+        {
+            UART_1_PutString("  41\tst_add_key()\t\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("  41\tst_add_key()\t\tFAIL\r\n");
+            result = STT_FAILURE;
+        }
+    }
+    
+    if (result == STT_SUCCESS)
+    {
+        st_empty_buffer();
+        st_set_limit(4);
+        
+        if ((st_add_key("abcdef") == ST_SUCCESS) && (st_get_count() == 4))
+        {
+            UART_1_PutString("  42\tst_add_key()\t\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("  42\tst_add_key()\t\tFAIL\r\n");
+            result = STT_FAILURE;
+        }
+    }
+    
+    /*
+     *  Test st_copy_buffer().
+     */
+    if (result == STT_SUCCESS)
+    {
+        if ((st_copy_buffer(string_0) == ST_SUCCESS) &&
+            (strncmp(string_0, "cdef", 4) == 0))
+        {
+            UART_1_PutString("  43\tst_copy_buffer()\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("  43\tst_copy_buffer()\tFAIL\r\n");
+            result = STT_FAILURE;
+        }
+    }
+    
+    /*
+     *  Initialise st_add_key() test.
+     */
+    if (result == STT_SUCCESS)
+    {
+        st_empty_buffer();
+        
+        if (st_set_limit(ST_NODE_LIMIT) == ST_SUCCESS)
+        {
+            UART_1_PutString("   -\tInitialise test...\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("   -\tInitialise test...\tFAIL\r\n");
+            result = STT_FAILURE;
+        }
+    }
+    
+    /*
+     *  Test st_add_key().
+     */
+    if (result == STT_SUCCESS)
+    {
+        st_add_key("ab\bc");
+        st_copy_buffer(string_0);
+        
+        if ((st_get_count() == 2) && (strncmp(string_0, "ac", 2) == 0))
+        {
+            UART_1_PutString("  44\tst_add_key()\t\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("  44\tst_add_key()\t\tFAIL\r\n");
+            result = STT_FAILURE;
+        }
+    }
+    
+    if (result == STT_SUCCESS)
+    {
+        st_add_key("\b\b\b\x7f");
+        
+        if (st_get_count() == 0)
+        {
+            UART_1_PutString("  45\tst_add_key()\t\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("  45\tst_add_key()\t\tFAIL\r\n");
+            result = STT_FAILURE;
+        }
+    }
+    
+    if (result == STT_SUCCESS)
+    {
+        st_add_key("a\r\n");
+        st_copy_buffer(string_0);
+        
+        if ((st_get_count() == 2) && (strncmp(string_0, "a\r", 2) == 0))
+        {
+            UART_1_PutString("  46\tst_add_key()\t\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("  46\tst_add_key()\t\tFAIL\r\n");
+            result = STT_FAILURE;
+        }
+    }
+    
+    /*
+     *  Test st_is_valid_input().
+     */
+    if (result == STT_SUCCESS)
+    {
+        if (st_is_valid_input() == ST_SUCCESS)
+        {
+            UART_1_PutString("  47\tst_is_valid_input()\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("  47\tst_is_valid_input()\tFAIL\r\n");
+            result = STT_FAILURE;
+        }
+    }
+    
+    /*
+     *  Test st_add_key().
+     */
+    if (result == STT_SUCCESS)
+    {
+        st_empty_buffer();
+        st_add_key("b\n\n");
+        st_copy_buffer(string_0);
+        
+        if ((st_get_count() == 3) && (strncmp(string_0, "b\r\r", 3) == 0))
+        {
+            UART_1_PutString("  48\tst_add_key()\t\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("  48\tst_add_key()\t\tFAIL\r\n");
+            result = STT_FAILURE;
+        }
+    }
+    
+    /*
+     *  Test st_is_valid_input().
+     */
+    if (result == STT_SUCCESS)
+    {
+        if (st_is_valid_input() == ST_SUCCESS)
+        {
+            UART_1_PutString("  49\tst_is_valid_input()\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("  49\tst_is_valid_input()\tFAIL\r\n");
+            result = STT_FAILURE;
+        }
+    }
+    
+    /*
+     *  Test st_clear_bit().
+     */
+    if (result == STT_SUCCESS)
+    {
+        st_empty_buffer();
+        st_clear_bit(ST_LINE_EDIT);
+        st_add_key("a\b\n");
+        st_set_bit(ST_LINE_EDIT);
+        
+        if ((st_get_count() == 3) && (st_is_valid_input() == ST_FAILURE))
+        {
+            UART_1_PutString("  50\tst_clear_bit()\t\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("  50\tst_clear_bit()\t\tFAIL\r\n");
+            result = STT_FAILURE;
+        }
+    }
+    
+    /*
+     *  Initialise st_add_key() test.
+     */
+    if (result == STT_SUCCESS)
+    {
+        st_empty_buffer();
+        
+        if (st_set_state(ST_STATE_1) == ST_SUCCESS)
+        {
+            UART_1_PutString("   -\tInitialise test...\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("   -\tInitialise test...\tFAIL\r\n");
+            result = STT_FAILURE;
+        }
+    }
+    
+    /*
+     *  Test st_add_key().
+     */
+    if (result == STT_SUCCESS)
+    {
+        st_add_key("3\b");
+        
+        if ((st_is_valid_input() == ST_FAILURE) && (st_get_count() == 0))
+        {
+            UART_1_PutString("  51\tst_add_key()\t\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("  51\tst_add_key()\t\tFAIL\r\n");
+            result = STT_FAILURE;
+        }
+    }
+    
+    if (result == STT_SUCCESS)
+    {
+        st_add_key("3X\b");
+        
+        if ((st_is_valid_input() == ST_SUCCESS) && (st_get_count() == 0))
+        {
+            UART_1_PutString("  52\tst_add_key()\t\tPASS\r\n");
+        }
+        else
+        {
+            UART_1_PutString("  52\tst_add_key()\t\tFAIL\r\n");
+            result = STT_FAILURE;
+        }
+    }
+    
+    /*
+     *  Report test result.
+     */
+    if (result == STT_SUCCESS)
+    {
+        UART_1_PutString("\r\n");
+        UART_1_PutString("TEST PASSED\r\n");
+    }
+    else
+    {
+        UART_1_PutString("\r\n");
+        UART_1_PutString("TEST FAILED\r\n");
+    }
+    
+    /*
+     *  Clean-up test.
+     */
+    while (UART_1_ReadTxStatus() != UART_1_TX_STS_FIFO_EMPTY)
+    {
+        CyDelay(1);
+    }
+    
+    UART_1_Stop();
+    
+    st_stop();
+    
+    return result;
+}
+
+void stt_test_2(void)
+{
+    st_start();
+    
+    UART_1_PutString(_state_none_event_none);
+    
+    for (;;)
+    {
+        if (st_is_valid_input() == ST_SUCCESS)
+        {
+            st_transition();
+        }
+    }
+}
+
+/****************************************************************************
+ *  Local Functions
+ ****************************************************************************/
+uint8 _is_enabled(ST_MACHINE *machine)
+{
+    return ((_TURNSTILE *)machine->context)->enabled;
+}
+
+void _add_coin(ST_MACHINE *machine)
+{
+    ++((_TURNSTILE *)machine->context)->coins;
+}
+
+void _add_pass(ST_MACHINE *machine)
+{
+    ++((_TURNSTILE *)machine->context)->passes;
+}
 
 /****************************************************************************
  *  End of File
@@ -80,6 +80,45 @@
  *    20    st_is_valid_input()     PASS
  *     -    Initialise test...      PASS
  *    21    st_is_valid_input()     PASS
+ *    22    st_init_machine()       PASS
+ *    23    st_init_machine()       PASS
+ *    24    st_init_machine()       PASS
+ *     -    Initialise test...      PASS
+ *     -    Initialise test...      PASS
+ *    25    st_dispatch()           PASS
+ *    26    st_dispatch()           PASS
+ *    27    st_dispatch()           PASS
+ *    28    st_dispatch()           PASS
+ *     -    Initialise test...      PASS
+ *    29    st_dispatch()           PASS
+ *    30    st_dispatch()           PASS
+ *    31    st_dispatch()           PASS
+ *    32    st_dispatch()           PASS
+ *     -    Initialise test...      PASS
+ *    33    st_transition()         PASS
+ *     -    Initialise test...      PASS
+ *    34    st_is_valid_input()     PASS
+ *    35    st_is_valid_input()     PASS
+ *    36    st_is_valid_input()     PASS
+ *    37    st_empty_buffer()       PASS
+ *    38    st_set_state()          PASS
+ *    39    st_set_state()          PASS
+ *    40    st_set_limit()          PASS
+ *     -    Initialise test...      PASS
+ *    41    st_add_key()            PASS
+ *    42    st_add_key()            PASS
+ *    43    st_copy_buffer()        PASS
+ *     -    Initialise test...      PASS
+ *    44    st_add_key()            PASS
+ *    45    st_add_key()            PASS
+ *    46    st_add_key()            PASS
+ *    47    st_is_valid_input()     PASS
+ *    48    st_add_key()            PASS
+ *    49    st_is_valid_input()     PASS
+ *    50    st_clear_bit()          PASS
+ *     -    Initialise test...      PASS
+ *    51    st_add_key()            PASS
+ *    52    st_add_key()            PASS
  *
  *  TEST PASSED
  *  @endcode
@@ -91,6 +130,10 @@
  *  - st_stop()
  *  - st_set_bit()
  *  - st_clear_bit()
+ *
+ *  In addition, stt_test_1() declares a second FSM, modelled on a coin-
+ *  operated turnstile, which is used to test the FSM engine independently
+ *  of the library FSM.
  
  *  In the case of stt_test_2(), the serial output will vary depending on the
  *  current state.
@@ -0,0 +1,338 @@
+/****************************************************************************
+ *
+ *  File:           host.c
+ *  Module:         Host Shim
+ *  Project:        Code Vault
+ *  Workspace:      PSoC Tools
+ *
+ *  Author:         Rodney B. Elliott
+ *  Date:           16 October 2026
+ *
+ ****************************************************************************
+ *
+ *  Copyright:      2013 Rodney B. Elliott
+ *
+ *  This file is part of PSoC Tools.
+ *
+ *  PSoC Tools is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  PSoC Tools is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with PSoC Tools. If not, see <http://www.gnu.org/licenses/>.
+ *
+ ****************************************************************************/
+/**
+ *  @file host.c
+ *  @brief Host shim implementation.
+ */
+
+/****************************************************************************
+ *  Modules
+ ****************************************************************************/
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+#include "project.h"
+
+/****************************************************************************
+ *  Definitions and Macros
+ ****************************************************************************/
+/**
+ *  @brief The size of the UART receive buffer.
+ */
+#define _RX_SIZE                        64
+
+/****************************************************************************
+ *  Typedefs and Structures
+ ****************************************************************************/
+
+/****************************************************************************
+ *  Prototypes of Local Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ *  Exported Variables
+ ****************************************************************************/
+uint8 ho_eeprom[CYDEV_EE_SIZE];
+
+/****************************************************************************
+ *  Global Variables
+ ****************************************************************************/
+/**
+ *  @brief The path of the file backing the EEPROM, if any.
+ */
+static const char *_eeprom_path = NULL;
+
+/**
+ *  @brief The real-time clock time and date.
+ */
+static RTC_1_TIME_DATE _time;
+
+/**
+ *  @brief The UART receive buffer.
+ */
+static char _rx_buffer[_RX_SIZE];
+
+/**
+ *  @brief The number of characters in the UART receive buffer.
+ */
+static uint8 _rx_count = 0;
+
+/**
+ *  @brief The index of the next character to be read from the UART receive
+ *      buffer.
+ */
+static uint8 _rx_index = 0;
+
+/**
+ *  @brief The status register value.
+ */
+static uint8 _status = 0xff;
+
+/****************************************************************************
+ *  Exported Functions
+ ****************************************************************************/
+void CyDelay(uint32 milliseconds)
+{
+    (void)milliseconds;
+}
+
+void UART_1_Start(void)
+{
+}
+
+void UART_1_Stop(void)
+{
+    fflush(stdout);
+}
+
+void UART_1_PutString(const char *string)
+{
+    fputs(string, stdout);
+}
+
+uint8 UART_1_ReadTxStatus(void)
+{
+    return UART_1_TX_STS_FIFO_EMPTY;
+}
+
+uint8 UART_1_ReadRxStatus(void)
+{
+    uint8 status = 0;
+    
+    if (_rx_index < _rx_count)
+    {
+        status = UART_1_RX_STS_FIFO_NOTEMPTY;
+    }
+    
+    return status;
+}
+
+uint8 UART_1_GetRxBufferSize(void)
+{
+    return _rx_count - _rx_index;
+}
+
+uint8 UART_1_ReadRxData(void)
+{
+    uint8 data = 0;
+    
+    if (_rx_index < _rx_count)
+    {
+        data = (uint8)_rx_buffer[_rx_index++];
+    }
+    
+    return data;
+}
+
+void UART_1_ClearRxBuffer(void)
+{
+    _rx_count = 0;
+    _rx_index = 0;
+}
+
+void RTC_1_Start(void)
+{
+}
+
+void RTC_1_Stop(void)
+{
+}
+
+void RTC_1_EnableInt(void)
+{
+}
+
+void RTC_1_DisableInt(void)
+{
+}
+
+void RTC_1_WriteSecond(uint8 second)
+{
+    _time.Sec = second;
+}
+
+void RTC_1_WriteMinute(uint8 minute)
+{
+    _time.Min = minute;
+}
+
+void RTC_1_WriteHour(uint8 hour)
+{
+    _time.Hour = hour;
+}
+
+void RTC_1_WriteDayOfMonth(uint8 day)
+{
+    _time.DayOfMonth = day;
+}
+
+void RTC_1_WriteMonth(uint8 month)
+{
+    _time.Month = month;
+}
+
+void RTC_1_WriteYear(uint16 year)
+{
+    _time.Year = year;
+}
+
+RTC_1_TIME_DATE *RTC_1_ReadTime(void)
+{
+    return &_time;
+}
+
+void isr_1_StartEx(cyisraddress address)
+{
+    (void)address;
+}
+
+void isr_1_Stop(void)
+{
+}
+
+void isr_1_ClearPending(void)
+{
+}
+
+void isr_1_Enable(void)
+{
+}
+
+void isr_1_Disable(void)
+{
+}
+
+void isr_2_StartEx(cyisraddress address)
+{
+    (void)address;
+}
+
+void isr_2_Stop(void)
+{
+}
+
+void isr_2_ClearPending(void)
+{
+}
+
+uint8 Status_Reg_1_Read(void)
+{
+    return _status;
+}
+
+void EEPROM_1_Start(void)
+{
+}
+
+void EEPROM_1_Stop(void)
+{
+}
+
+cystatus EEPROM_1_Write(const uint8 *rowData, uint8 rowNumber)
+{
+    FILE *file = NULL;
+    uint32 offset = (uint32)rowNumber * CYDEV_EEPROM_ROW_SIZE;
+    
+    if (offset + CYDEV_EEPROM_ROW_SIZE <= CYDEV_EE_SIZE)
+    {
+        memcpy(&ho_eeprom[offset], rowData, CYDEV_EEPROM_ROW_SIZE);
+        
+        if (_eeprom_path != NULL)
+        {
+            file = fopen(_eeprom_path, "wb");
+            
+            if (file != NULL)
+            {
+                fwrite(ho_eeprom, 1, CYDEV_EE_SIZE, file);
+                fclose(file);
+            }
+        }
+    }
+    
+    return CYRET_SUCCESS;
+}
+
+void ho_uart_receive(const char *string)
+{
+    if (_rx_index == _rx_count)
+    {
+        UART_1_ClearRxBuffer();
+    }
+    
+    while (*string != '\0' && _rx_count < _RX_SIZE)
+    {
+        _rx_buffer[_rx_count++] = *string++;
+    }
+}
+
+void ho_status_write(uint8 value)
+{
+    _status = value;
+}
+
+uint8 ho_eeprom_file(const char *path)
+{
+    FILE *file = fopen(path, "rb");
+    uint8 result = 0;
+    
+    _eeprom_path = path;
+    
+    if (file != NULL)
+    {
+        if (fread(ho_eeprom, 1, CYDEV_EE_SIZE, file) == CYDEV_EE_SIZE)
+        {
+            result = 1;
+        }
+        
+        fclose(file);
+    }
+    
+    return result;
+}
+
+unsigned long long ho_get_nanoseconds(void)
+{
+    struct timespec now;
+    
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    
+    return (unsigned long long)now.tv_sec * 1000000000ull +
+        (unsigned long long)now.tv_nsec;
+}
+
+/****************************************************************************
+ *  Local Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ *  End of File
+ ****************************************************************************/
@@ -0,0 +1,103 @@
+/****************************************************************************
+ *
+ *  File:           host_bench.c
+ *  Module:         Host Benchmark Runner
+ *  Project:        Code Vault
+ *  Workspace:      PSoC Tools
+ *
+ *  Author:         Rodney B. Elliott
+ *  Date:           16 October 2026
+ *
+ ****************************************************************************
+ *
+ *  Copyright:      2013 Rodney B. Elliott
+ *
+ *  This file is part of PSoC Tools.
+ *
+ *  PSoC Tools is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  PSoC Tools is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with PSoC Tools. If not, see <http://www.gnu.org/licenses/>.
+ *
+ ****************************************************************************/
+/**
+ *  @file host_bench.c
+ *  @brief Host benchmark runner implementation.
+ *
+ *  Runs the code vault benchmarks on a workstation, writing the results to
+ *  the standard output as comma-separated values. The largest container
+ *  size to be measured may be given on the command line, ie:
+ *
+ *  @code host_bench 1000 > results.csv @endcode
+ *
+ *  If no size is given, #BM_SIZE_MAXIMUM is used. The exit status is zero
+ *  if every benchmark ran successfully.
+ */
+
+/****************************************************************************
+ *  Modules
+ ****************************************************************************/
+#include <stdio.h>
+#include <stdlib.h>
+
+#include <device.h>
+
+#include "bench.h"
+
+/****************************************************************************
+ *  Definitions and Macros
+ ****************************************************************************/
+
+/****************************************************************************
+ *  Typedefs and Structures
+ ****************************************************************************/
+
+/****************************************************************************
+ *  Prototypes of Local Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ *  Exported Variables
+ ****************************************************************************/
+
+/****************************************************************************
+ *  Global Variables
+ ****************************************************************************/
+
+/****************************************************************************
+ *  Exported Functions
+ ****************************************************************************/
+int main(int argc, char *argv[])
+{
+    uint32 maximum = BM_SIZE_MAXIMUM;
+    int result = 0;
+    
+    if (argc > 1)
+    {
+        maximum = (uint32)strtoul(argv[1], NULL, 10);
+    }
+    
+    if (bm_run(maximum) != BM_SUCCESS)
+    {
+        fprintf(stderr, "Benchmark failed\n");
+        result = 1;
+    }
+    
+    return result;
+}
+
+/****************************************************************************
+ *  Local Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ *  End of File
+ ****************************************************************************/
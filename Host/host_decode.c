@@ -0,0 +1,386 @@
+/****************************************************************************
+ *
+ *  File:           host_decode.c
+ *  Module:         Host Error Decoder
+ *  Project:        Code Vault
+ *  Workspace:      PSoC Tools
+ *
+ *  Author:         Rodney B. Elliott
+ *  Date:           16 October 2026
+ *
+ ****************************************************************************
+ *
+ *  Copyright:      2013 Rodney B. Elliott
+ *
+ *  This file is part of PSoC Tools.
+ *
+ *  PSoC Tools is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  PSoC Tools is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with PSoC Tools. If not, see <http://www.gnu.org/licenses/>.
+ *
+ ****************************************************************************/
+/**
+ *  @file host_decode.c
+ *  @brief Host error decoder implementation.
+ *
+ *  Decodes the binary error records written by er_export() and
+ *  er_log_export(), writing one line of text per error to the standard
+ *  output. Each line holds the severity level, error message, timestamp,
+ *  and location, separated by tabs, with a dash standing in for any missing
+ *  field. An error that occurred more than once is followed by a field giving
+ *  the number of occurrences, and the time of the last if known. The
+ *  records are read from the file given on the command line, or from the
+ *  standard input if no file is given, ie:
+ *
+ *  @code host_decode errors.bin > errors.txt @endcode
+ *
+ *  Running host_decode -t instead checks that a deque of errors survives
+ *  export and decoding unchanged. The exit status is zero if all records
+ *  were decoded successfully.
+ */
+
+/****************************************************************************
+ *  Modules
+ ****************************************************************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <device.h>
+
+#include "error.h"
+#include "misc.h"
+
+/****************************************************************************
+ *  Definitions and Macros
+ ****************************************************************************/
+/**
+ *  @brief The size of the buffer used by the self test.
+ */
+#define _CHUNK_SIZE                     48
+
+/**
+ *  @brief The size of a line of decoded text.
+ */
+#define _LINE_SIZE                      640
+
+/****************************************************************************
+ *  Typedefs and Structures
+ ****************************************************************************/
+
+/****************************************************************************
+ *  Prototypes of Local Functions
+ ****************************************************************************/
+/**
+ *  @brief Decode a buffer of binary error records.
+ *  @param[in] buffer A pointer to the records.
+ *  @param[in] size The size of the records in bytes.
+ *  @param[in] stream The stream to receive the decoded text.
+ *  @return Zero if successful, otherwise one if the records are malformed.
+ *  @remark The records are imported using er_import(), so that the library
+ *      and this decoder always agree upon the format.
+ */
+static int _decode(uint8 *buffer, uint32 size, FILE *stream);
+
+/**
+ *  @brief Convert an error object to a line of text.
+ *  @param[in] object A pointer to the error object.
+ *  @param[out] line A pointer to the returned line.
+ */
+static void _format(ER_OBJECT *object, char *line);
+
+/**
+ *  @brief Check that a deque of errors survives export and decoding.
+ *  @return Zero if successful, otherwise one.
+ */
+static int _self_test(void);
+
+/****************************************************************************
+ *  Exported Variables
+ ****************************************************************************/
+
+/****************************************************************************
+ *  Global Variables
+ ****************************************************************************/
+/**
+ *  @brief The names of the severity levels, indexed by level.
+ */
+static char *_levels[] =
+{
+    "DEBUG",
+    "INFO",
+    "WARN",
+    "ERROR",
+    "FATAL"
+};
+
+/****************************************************************************
+ *  Exported Functions
+ ****************************************************************************/
+int main(int argc, char *argv[])
+{
+    uint8 *buffer = NULL;
+    FILE *input = stdin;
+    uint8 *larger;
+    int result = 0;
+    size_t size = 0;
+    int value;
+    
+    if ((argc > 1) && (strcmp(argv[1], "-t") == 0))
+    {
+        result = _self_test();
+    }
+    else
+    {
+        if (argc > 1)
+        {
+            input = fopen(argv[1], "rb");
+        }
+        
+        if (input != NULL)
+        {
+            while ((result == 0) && ((value = fgetc(input)) != EOF))
+            {
+                /*
+                 *  Double the buffer each time it fills.
+                 */
+                if ((size & (size + 1)) == 0)
+                {
+                    larger = realloc(buffer, 2 * (size + 1));
+                    
+                    if (larger != NULL)
+                    {
+                        buffer = larger;
+                    }
+                    else
+                    {
+                        result = 1;
+                    }
+                }
+                
+                if (result == 0)
+                {
+                    buffer[size++] = (uint8)value;
+                }
+            }
+            
+            if (result == 0)
+            {
+                result = _decode(buffer, (uint32)size, stdout);
+            }
+            
+            if (input != stdin)
+            {
+                fclose(input);
+            }
+        }
+        else
+        {
+            result = 1;
+        }
+    }
+    
+    if (result != 0)
+    {
+        fprintf(stderr, "Decoding failed\n");
+    }
+    
+    free(buffer);
+    
+    return result;
+}
+
+/****************************************************************************
+ *  Local Functions
+ ****************************************************************************/
+int _decode(uint8 *buffer, uint32 size, FILE *stream)
+{
+    DE_LIST deque = {0};
+    char line[_LINE_SIZE];
+    ER_OBJECT *object;
+    int result = 0;
+    
+    /*
+     *  The errors imported ahead of a malformed record are still written
+     *  out, so that as much of a damaged stream as possible is recovered.
+     */
+    if (er_import(&deque, buffer, size) != ER_SUCCESS)
+    {
+        result = 1;
+    }
+    
+    while (er_get_first_object(&deque, &object) == ER_SUCCESS)
+    {
+        _format(object, line);
+        fputs(line, stream);
+        
+        er_remove(&deque);
+    }
+    
+    return result;
+}
+
+void _format(ER_OBJECT *object, char *line)
+{
+    uint32 count;
+    RT_DATA *last;
+    uint8 level;
+    RT_DATA *timestamp;
+    ER_LOCATION *location;
+    char *message;
+    char string[_LINE_SIZE / 2];
+    
+    er_get_level(object, &level);
+    er_get_message(object, &message);
+    er_get_timestamp(object, &timestamp);
+    er_get_location(object, &location);
+    er_get_occurrences(object, &count);
+    er_get_last_timestamp(object, &last);
+    
+    strcpy(line, _levels[level]);
+    strcat(line, "\t");
+    strcat(line, message);
+    strcat(line, "\t");
+    
+    if (timestamp != NULL)
+    {
+        er_convert_timestamp(timestamp, string);
+        strcat(line, string);
+    }
+    else
+    {
+        strcat(line, "-");
+    }
+    
+    strcat(line, "\t");
+    
+    if (location != NULL)
+    {
+        er_convert_location(location, string);
+        strcat(line, string);
+    }
+    else
+    {
+        strcat(line, "-");
+    }
+    
+    if (count > 1)
+    {
+        strcat(line, "\trepeated ");
+        mi_utoa(count, string);
+        strcat(line, string);
+        strcat(line, " times");
+        
+        if (last != NULL)
+        {
+            strcat(line, " until ");
+            er_convert_timestamp(last, string);
+            strcat(line, string);
+        }
+    }
+    
+    strcat(line, "\n");
+}
+
+int _self_test(void)
+{
+    uint8 buffer[_CHUNK_SIZE];
+    DE_LIST deque = {0};
+    char expected[4 * _LINE_SIZE] = "";
+    char line[_LINE_SIZE];
+    ER_OBJECT *object;
+    char received[4 * _LINE_SIZE] = "";
+    int result = 0;
+    FILE *stream;
+    uint32 i;
+    uint32 written;
+    
+    rt_start();
+    
+    /*
+     *  Name the files directly, so that the record sizes do not depend upon
+     *  where the source tree is.
+     */
+    _add_standard(&deque, E00900, ER_OPTIONS_TIMESTAMP | ER_OPTIONS_LOCATION,
+        "main.c", 100);
+    rt_set_time(12, 30, 45);
+    rt_write();
+    _add_standard(&deque, E00900, ER_OPTIONS_TIMESTAMP | ER_OPTIONS_LOCATION |
+        ER_OPTIONS_COALESCE, "main.c", 100);
+    _add_special(&deque, "Special message.", ER_OPTIONS_LOCATION,
+        "host_decode.c", 300);
+    _report_standard(&deque, ER_LEVEL_WARN, E00100, ER_OPTIONS_NONE,
+        "main.c", 0);
+    _add_standard(&deque, E01100, ER_OPTIONS_LOCATION, "main.c", 700);
+    
+    for (i = 0 ; i < er_get_count(&deque) ; i++)
+    {
+        de_get_object(&deque, i, NULL, (void **)&object);
+        
+        _format(object, line);
+        strcat(expected, line);
+    }
+    
+    stream = tmpfile();
+    
+    if (stream != NULL)
+    {
+        /*
+         *  Export through a buffer too small to hold every record, so that
+         *  the export must be resumed.
+         */
+        while ((result == 0) && (er_get_count(&deque) > 0))
+        {
+            er_export(&deque, buffer, sizeof(buffer), &written);
+            
+            if (written > 0)
+            {
+                result = _decode(buffer, written, stream);
+            }
+            else
+            {
+                result = 1;
+            }
+        }
+        
+        rewind(stream);
+        
+        if (fread(received, 1, sizeof(received) - 1, stream) == 0)
+        {
+            result = 1;
+        }
+        
+        fclose(stream);
+    }
+    else
+    {
+        result = 1;
+    }
+    
+    if ((result == 0) && (strcmp(expected, received) == 0))
+    {
+        fputs(received, stdout);
+    }
+    else
+    {
+        result = 1;
+    }
+    
+    er_destroy(&deque);
+    rt_stop();
+    
+    return result;
+}
+
+/****************************************************************************
+ *  End of File
+ ****************************************************************************/
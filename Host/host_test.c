@@ -0,0 +1,226 @@
+/****************************************************************************
+ *
+ *  File:           host_test.c
+ *  Module:         Host Test Runner
+ *  Project:        Code Vault
+ *  Workspace:      PSoC Tools
+ *
+ *  Author:         Rodney B. Elliott
+ *  Date:           16 October 2026
+ *
+ ****************************************************************************
+ *
+ *  Copyright:      2013 Rodney B. Elliott
+ *
+ *  This file is part of PSoC Tools.
+ *
+ *  PSoC Tools is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  PSoC Tools is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with PSoC Tools. If not, see <http://www.gnu.org/licenses/>.
+ *
+ ****************************************************************************/
+/**
+ *  @file host_test.c
+ *  @brief Host test runner implementation.
+ *
+ *  Runs the code vault test functions on a workstation. When called without
+ *  arguments, every test function is run in turn. Otherwise, only the test
+ *  functions named on the command line are run, ie:
+ *
+ *  @code host_test dlt_test_1 cbt_test_2 @endcode
+ *
+ *  If the first arguments are -e and a file name, the EEPROM is backed by
+ *  that file, so that its contents are kept from one run to the next.
+ *
+ *  The exit status is zero if every test function that was run passed. Test
+ *  functions that wait for user input, such as but_test_2() and stt_test_2(),
+ *  are not included.
+ */
+
+/****************************************************************************
+ *  Modules
+ ****************************************************************************/
+#include <stdio.h>
+#include <string.h>
+
+#include <device.h>
+
+#include "button_test.h"
+#include "cbuff_test.h"
+#include "cllist_test.h"
+#include "deque_test.h"
+#include "dllist_test.h"
+#include "error_test.h"
+#include "gesture_test.h"
+#include "ilist_test.h"
+#include "misc_test.h"
+#include "queue_test.h"
+#include "rtime_test.h"
+#include "spsc_test.h"
+#include "state_test.h"
+
+/****************************************************************************
+ *  Definitions and Macros
+ ****************************************************************************/
+/**
+ *  @brief Declare a test table entry.
+ */
+#define _TEST(FUNCTION)                 {#FUNCTION, FUNCTION}
+
+/****************************************************************************
+ *  Typedefs and Structures
+ ****************************************************************************/
+/**
+ *  @brief A test table entry.
+ */
+typedef struct _TEST_ENTRY
+{
+    /**
+     *  @brief The name of the test function.
+     */
+    char *name;
+    
+    /**
+     *  @brief A pointer to the test function.
+     */
+    uint8 (*function)(void);
+} _TEST_ENTRY;
+
+/****************************************************************************
+ *  Prototypes of Local Functions
+ ****************************************************************************/
+/**
+ *  @brief Run a single test function.
+ *  @param[in] test A pointer to a test table entry.
+ *  @return Zero if the test function passed, otherwise one.
+ */
+static int _run(const _TEST_ENTRY *test);
+
+/****************************************************************************
+ *  Exported Variables
+ ****************************************************************************/
+
+/****************************************************************************
+ *  Global Variables
+ ****************************************************************************/
+/**
+ *  @brief The table of test functions.
+ */
+static const _TEST_ENTRY _tests[] =
+{
+    _TEST(dlt_test_1),
+    _TEST(dlt_test_2),
+#ifdef DL_COUNTED
+    _TEST(dlt_test_3),
+#endif
+#ifdef DL_POOL_SIZE
+    _TEST(dlt_test_4),
+#endif
+    _TEST(ilt_test_1),
+    _TEST(det_test_1),
+    _TEST(det_test_2),
+    _TEST(det_test_3),
+    _TEST(qut_test_1),
+    _TEST(qut_test_2),
+    _TEST(clt_test_1),
+    _TEST(cbt_test_1),
+    _TEST(cbt_test_2),
+    _TEST(spt_test_1),
+    _TEST(mit_test_1),
+    _TEST(rtt_test_1),
+    _TEST(ert_test_1),
+    _TEST(ert_test_2),
+    _TEST(ert_test_3),
+    _TEST(ert_test_4),
+    _TEST(ert_test_5),
+#ifdef ER_PERSIST_ROWS
+    _TEST(ert_test_6),
+#endif
+    _TEST(but_test_1),
+    _TEST(but_test_3),
+    _TEST(gst_test_1),
+    _TEST(stt_test_1)
+};
+
+/****************************************************************************
+ *  Exported Functions
+ ****************************************************************************/
+int main(int argc, char *argv[])
+{
+    int first = 1;
+    int found;
+    int i;
+    int j;
+    int result = 0;
+    int size = sizeof(_tests) / sizeof(_tests[0]);
+    
+    if ((argc > 2) && (strcmp(argv[1], "-e") == 0))
+    {
+        ho_eeprom_file(argv[2]);
+        
+        first = 3;
+    }
+    
+    if (argc <= first)
+    {
+        for (i = 0 ; i < size ; i++)
+        {
+            result |= _run(&_tests[i]);
+        }
+    }
+    else
+    {
+        for (j = first ; j < argc ; j++)
+        {
+            found = 0;
+            
+            for (i = 0 ; i < size ; i++)
+            {
+                if (strcmp(argv[j], _tests[i].name) == 0)
+                {
+                    result |= _run(&_tests[i]);
+                    found = 1;
+                }
+            }
+            
+            if (found == 0)
+            {
+                fprintf(stderr, "Unknown test function: %s\n", argv[j]);
+                result = 1;
+            }
+        }
+    }
+    
+    return result;
+}
+
+/****************************************************************************
+ *  Local Functions
+ ****************************************************************************/
+int _run(const _TEST_ENTRY *test)
+{
+    int result = 0;
+    
+    if (test->function() != 0)
+    {
+        result = 1;
+    }
+    
+    printf("\n");
+    fflush(stdout);
+    
+    return result;
+}
+
+/****************************************************************************
+ *  End of File
+ ****************************************************************************/
@@ -0,0 +1,273 @@
+/****************************************************************************
+ *
+ *  File:           project.h
+ *  Module:         Host Shim
+ *  Project:        Code Vault
+ *  Workspace:      PSoC Tools
+ *
+ *  Author:         Rodney B. Elliott
+ *  Date:           16 October 2026
+ *
+ ****************************************************************************
+ *
+ *  Copyright:      2013 Rodney B. Elliott
+ *
+ *  This file is part of PSoC Tools.
+ *
+ *  PSoC Tools is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  PSoC Tools is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with PSoC Tools. If not, see <http://www.gnu.org/licenses/>.
+ *
+ ****************************************************************************/
+#ifndef PROJECT_H
+#define PROJECT_H
+/**
+ *  @file project.h
+ *  @brief Host shim interface.
+ *
+ *  <H3> Introduction </H3>
+ *
+ *  The host shim stands in for the project.h header that PSoC Creator
+ *  generates for the target. It provides the Cypress integer types, the
+ *  interrupt service routine (ISR) macros, and those component functions used
+ *  by the code vault, so that the vault libraries and test libraries may be
+ *  built and run on a workstation.
+ *
+ *  Component functions behave as follows:
+ *
+ *  - UART_1. Transmitted strings are written to the standard output, and the
+ *    transmit FIFO is always empty. Received characters are supplied using
+ *    the function ho_uart_receive().
+ *  - RTC_1. Written values are held in a private time structure, which is
+ *    returned unchanged by RTC_1_ReadTime(). The clock does not advance.
+ *  - isr_1 and isr_2. Starting, stopping, enabling, disabling and clearing
+ *    an ISR does nothing. An ISR may be run by calling it directly, ie
+ *    bu_interrupt().
+ *  - Status_Reg_1. Returns the value supplied using ho_status_write(), which
+ *    defaults to 0xff - that is, no buttons pressed.
+ *  - EEPROM_1. Rows are held in the exported array ho_eeprom, which is read
+ *    using CY_GET_REG8(CYDEV_EE_BASE + offset) as on the target. The array
+ *    starts erased, but may be loaded from and written through to a file
+ *    using ho_eeprom_file(), so that its contents survive a restart.
+ *  - CyDelay(). Returns immediately.
+ *
+ *  The shim also defines #HO_SHIM, so that code which must behave
+ *  differently on a workstation is able to detect it, and supplies a
+ *  nanosecond clock using ho_get_nanoseconds().
+ *
+ *  <H3> Use </H3>
+ *
+ *  The host shim is used by the CMake build in the root of the workspace. It
+ *  is not part of the PSoC Creator project, and must not be added to it.
+ */
+
+/****************************************************************************
+ *  Modules
+ ****************************************************************************/
+#include <stddef.h>
+#include <stdint.h>
+
+/****************************************************************************
+ *  Definitions and Macros
+ ****************************************************************************/
+/**
+ *  @brief Defined when building against the host shim.
+ */
+#define HO_SHIM
+
+/**
+ *  @brief Declare an interrupt service routine (ISR).
+ */
+#define CY_ISR(FUNCTION)                void FUNCTION(void)
+
+/**
+ *  @brief Declare an interrupt service routine (ISR) prototype.
+ */
+#define CY_ISR_PROTO(FUNCTION)          void FUNCTION(void)
+
+/**
+ *  @brief Enable interrupts globally.
+ */
+#define CyGlobalIntEnable
+
+/*
+ *  Port 0 and port 1 pin control registers.
+ */
+#define CYREG_PRT0_PC0                  0x40005000u
+#define CYREG_PRT0_PC1                  0x40005001u
+#define CYREG_PRT0_PC2                  0x40005002u
+#define CYREG_PRT0_PC3                  0x40005003u
+#define CYREG_PRT0_PC4                  0x40005004u
+#define CYREG_PRT0_PC5                  0x40005005u
+#define CYREG_PRT0_PC6                  0x40005006u
+#define CYREG_PRT0_PC7                  0x40005007u
+#define CYREG_PRT1_PC2                  0x4000500au
+#define CYREG_PRT1_PC7                  0x4000500fu
+
+/**
+ *  @brief UART receive status register FIFO not empty mask.
+ */
+#define UART_1_RX_STS_FIFO_NOTEMPTY     0x20u
+
+/**
+ *  @brief UART transmit status register FIFO empty mask.
+ */
+#define UART_1_TX_STS_FIFO_EMPTY        0x02u
+
+/**
+ *  @brief The return value of a successful component function.
+ */
+#define CYRET_SUCCESS                   0x00u
+
+/**
+ *  @brief The size of the EEPROM, in bytes.
+ */
+#define CYDEV_EE_SIZE                   0x0800u
+
+/**
+ *  @brief The size of an EEPROM row, in bytes.
+ */
+#define CYDEV_EEPROM_ROW_SIZE           0x0010u
+
+/**
+ *  @brief The base address of the EEPROM.
+ */
+#define CYDEV_EE_BASE                   (ho_eeprom)
+
+/**
+ *  @brief Read an 8-bit register.
+ */
+#define CY_GET_REG8(ADDRESS)            (*(volatile uint8 *)(ADDRESS))
+
+/****************************************************************************
+ *  Typedefs and Structures
+ ****************************************************************************/
+typedef uint8_t uint8;
+typedef uint16_t uint16;
+typedef uint32_t uint32;
+typedef int8_t int8;
+typedef int16_t int16;
+typedef int32_t int32;
+
+/**
+ *  @brief The status returned by component functions.
+ */
+typedef uint8 cystatus;
+
+/**
+ *  @brief The address of an interrupt service routine (ISR).
+ */
+typedef void (*cyisraddress)(void);
+
+/**
+ *  @brief Real-time clock time and date.
+ *
+ *  Shares its layout with the RT_DATA structure of the real-time clock
+ *  library.
+ */
+typedef struct RTC_1_TIME_DATE
+{
+    uint8 Sec;
+    uint8 Min;
+    uint8 Hour;
+    uint8 DayOfWeek;
+    uint8 DayOfMonth;
+    uint16 DayOfYear;
+    uint8 Month;
+    uint16 Year;
+} RTC_1_TIME_DATE;
+
+/****************************************************************************
+ *  Exported Variables
+ ****************************************************************************/
+/**
+ *  @brief The contents of the EEPROM.
+ */
+extern uint8 ho_eeprom[CYDEV_EE_SIZE];
+
+/****************************************************************************
+ *  Exported Functions
+ ****************************************************************************/
+/*
+ *  Component functions.
+ */
+void CyDelay(uint32 milliseconds);
+
+void UART_1_Start(void);
+void UART_1_Stop(void);
+void UART_1_PutString(const char *string);
+uint8 UART_1_ReadTxStatus(void);
+uint8 UART_1_ReadRxStatus(void);
+uint8 UART_1_GetRxBufferSize(void);
+uint8 UART_1_ReadRxData(void);
+void UART_1_ClearRxBuffer(void);
+
+void RTC_1_Start(void);
+void RTC_1_Stop(void);
+void RTC_1_EnableInt(void);
+void RTC_1_DisableInt(void);
+void RTC_1_WriteSecond(uint8 second);
+void RTC_1_WriteMinute(uint8 minute);
+void RTC_1_WriteHour(uint8 hour);
+void RTC_1_WriteDayOfMonth(uint8 day);
+void RTC_1_WriteMonth(uint8 month);
+void RTC_1_WriteYear(uint16 year);
+RTC_1_TIME_DATE *RTC_1_ReadTime(void);
+
+void isr_1_StartEx(cyisraddress address);
+void isr_1_Stop(void);
+void isr_1_ClearPending(void);
+void isr_1_Enable(void);
+void isr_1_Disable(void);
+void isr_2_StartEx(cyisraddress address);
+void isr_2_Stop(void);
+void isr_2_ClearPending(void);
+
+uint8 Status_Reg_1_Read(void);
+
+void EEPROM_1_Start(void);
+void EEPROM_1_Stop(void);
+cystatus EEPROM_1_Write(const uint8 *rowData, uint8 rowNumber);
+
+/**
+ *  @brief Supply characters to the UART receive buffer.
+ *  @param[in] string A pointer to the characters to be received.
+ *  @remark Characters that do not fit in the receive buffer are discarded.
+ */
+void ho_uart_receive(const char *string);
+
+/**
+ *  @brief Set the value returned by Status_Reg_1_Read().
+ *  @param[in] value The new status register value.
+ */
+void ho_status_write(uint8 value);
+
+/**
+ *  @brief Back the EEPROM with a file.
+ *  @param[in] path A pointer to the path of the file.
+ *  @return 1 if the EEPROM was loaded from the file, otherwise 0.
+ *  @remark If the file does not exist, the EEPROM is left unchanged, and the
+ *  file is created by the next call to EEPROM_1_Write().
+ */
+uint8 ho_eeprom_file(const char *path);
+
+/**
+ *  @brief Get the current value of the host's monotonic clock.
+ *  @return The number of nanoseconds since an arbitrary starting point.
+ */
+unsigned long long ho_get_nanoseconds(void);
+
+#endif
+
+/****************************************************************************
+ *  End of File
+ ****************************************************************************/